@@ -0,0 +1,178 @@
+#pragma once
+
+#include <atomic>     // for std::atomic
+#include <cstddef>    // for size_t
+#include <cstdint>    // for std::uintptr_t, std::uint64_t
+#include <concepts>   // C++20: for requires
+#include <functional> // for std::less
+#include <memory>     // for std::allocator, std::allocator_traits
+#include <utility>    // for std::forward
+
+namespace mys {
+
+// Values are compared by threads that may be racing with the erase of their node, and erase never
+// touches the value, so any movable, destructible T that Compare orders strictly will do.
+template <typename T, typename Compare>
+concept ConcurrentSortable = std::movable<T> && std::destructible<T> && std::strict_weak_order<const Compare &, const T &, const T &>;
+
+// Lock-free sorted set on a singly linked list (Harris's marked pointers with Michael's search).
+//
+// The list has the shape of mys::forward_list: a head sentinel and one next pointer per node. insert()
+// splices a node in with a CAS on its predecessor's next. erase() first sets the low bit of the
+// victim's own next (logical deletion: no insert can land behind it any more, and contains() treats
+// it as gone), then tries to swing the predecessor past it; a search that runs into a marked node
+// finishes that unlink itself. contains() never writes.
+//
+// Unlinked nodes are reclaimed with epoch-based reclamation. Every operation pins the current global
+// epoch in a per-thread record for its duration. The thread that unlinks a node retires it into its
+// record's limbo bucket for the epoch at that time; the epoch only advances when every pinned
+// record has seen the current one, so two advances later no operation can still hold the node and
+// the bucket is freed. A thread stalled inside an operation holds reclamation back (not progress).
+//
+// Records are claimed per operation with one CAS, normally on the record the thread used last, so a
+// thread exiting costs nothing and a record is never shared. The allocator must be usable from every
+// thread that erases, and the list is neither copyable nor movable.
+template <typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>>
+    requires ConcurrentSortable<T, Compare>
+class concurrent_forward_list {
+public:
+    static constexpr std::size_t cache_line_size = 64;
+
+private:
+    // Low bit of a next word: the node owning the word is logically deleted
+    static constexpr std::uintptr_t mark_bit = 1;
+
+    struct NodeBase {
+        std::atomic<std::uintptr_t> next{0};
+    };
+
+    struct Node : NodeBase {
+        T val;
+        Node *retired_next = nullptr; // link in a limbo bucket, once unlinked
+
+        template <typename... Args>
+        explicit Node(Args &&...args) : val(std::forward<Args>(args)...) {}
+    };
+
+    // An unpinned record holds quiescent, so epoch advances ignore it
+    static constexpr std::uint64_t quiescent = ~std::uint64_t{0};
+    static constexpr std::size_t limbo_buckets = 3;
+    // Retirements between attempts to advance the epoch
+    static constexpr std::size_t advance_interval = 64;
+
+    struct alignas(cache_line_size) Record {
+        std::atomic<std::uint64_t> epoch{quiescent};
+        std::atomic<bool> in_use{false};
+        Record *next = nullptr; // records are only ever pushed onto records_
+
+        // Only touched by the thread holding the record: nodes retired in epoch limbo_epoch[i]
+        Node *limbo[limbo_buckets] = {};
+        std::uint64_t limbo_epoch[limbo_buckets] = {};
+        std::size_t retired_since_advance = 0;
+    };
+
+    // Pins the list's epoch for the lifetime of one operation
+    class Guard {
+        const concurrent_forward_list *list_;
+        Record *record_;
+
+    public:
+        explicit Guard(const concurrent_forward_list *list);
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+        ~Guard();
+
+        Record *record() const noexcept { return record_; }
+    };
+
+    // Result of search(): key belongs between prev and curr; found when curr holds it
+    struct Position {
+        NodeBase *prev;
+        Node *curr;
+        bool found;
+    };
+
+    using NodeAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    [[no_unique_address]] NodeAlloc allocator_;
+    [[no_unique_address]] Compare comp_;
+
+    alignas(cache_line_size) NodeBase head_;
+    alignas(cache_line_size) std::atomic<std::uint64_t> epoch_{0};
+    mutable std::atomic<Record *> records_{nullptr}; // contains() may have to add one
+
+    // Distinguishes lists in the per-thread record cache, even ones reusing a destroyed list's address
+    const std::uint64_t id_;
+    static inline std::atomic<std::uint64_t> next_id_{1};
+    struct RecordCache {
+        std::uint64_t list_id = 0;
+        Record *record = nullptr;
+    };
+    static inline thread_local RecordCache cached_record_;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using value_compare = Compare;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    explicit concurrent_forward_list(const Compare &comp = Compare(), const Allocator &alloc = Allocator());
+    concurrent_forward_list(const concurrent_forward_list &) = delete;
+    concurrent_forward_list &operator=(const concurrent_forward_list &) = delete;
+    // No other thread may be inside an operation
+    ~concurrent_forward_list();
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    // O(n) walk; exact when no other thread is modifying the list, a snapshot otherwise
+    [[nodiscard]] std::size_t size_approx() const;
+    [[nodiscard]] bool empty_approx() const;
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    // Return false and leave the list unchanged when an equivalent value is already present
+    bool insert(const T &value);
+    bool insert(T &&value);
+    // The node is built before the search, so a duplicate costs one construction
+    template <typename... Args>
+    bool emplace(Args &&...args);
+
+    // Return false when no equivalent value is present
+    bool erase(const T &key);
+
+    // ===========================================================
+    // 7. Lookup
+    // ===========================================================
+
+    [[nodiscard]] bool contains(const T &key) const;
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    static Node *to_node(std::uintptr_t word) noexcept { return reinterpret_cast<Node *>(word & ~mark_bit); }
+    static bool is_marked(std::uintptr_t word) noexcept { return (word & mark_bit) != 0; }
+    static std::uintptr_t to_word(Node *node) noexcept { return reinterpret_cast<std::uintptr_t>(node); }
+
+    Position search(const T &key, Record *record);
+    bool link(Node *node);
+    void destroy_node(Node *node) noexcept;
+
+    Record *acquire_record() const;
+    // Put an unlinked node into the record's bucket for the current epoch
+    void retire(Record *record, Node *node) noexcept;
+    // Advance the global epoch if every pinned record has reached it
+    void try_advance(std::uint64_t epoch) noexcept;
+    // Free the record's buckets that are at least two epochs old
+    void reclaim(Record *record, std::uint64_t epoch) noexcept;
+};
+
+} // namespace mys
+
+#include "concurrent_forward_list.tpp"
\ No newline at end of file
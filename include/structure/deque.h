@@ -0,0 +1,283 @@
+#pragma once
+
+#include <cstddef>          // for size_t
+#include <initializer_list> // for std::initializer_list
+#include <compare>          // C++20: for operator <=>
+#include <concepts>         // C++20: for requires
+#include <iterator>         // for std::random_access_iterator_tag
+#include <memory>           // for std::allocator, std::allocator_traits
+#include <utility>          // for std::move, std::forward
+
+#include "vector.h"
+
+namespace mys {
+
+// Double-ended queue built from fixed-size blocks plus a growable map of block pointers.
+//
+// Element i lives at map_[(start_ + i) / block_size][(start_ + i) % block_size]; only the
+// blocks that hold elements are allocated. Growing the map copies block pointers, never
+// elements, so references stay valid across push_front/push_back (iterators do not).
+// A block that empties is kept as a single spare and reused before asking the allocator
+// again, so a sliding window (push_back + pop_front) runs without allocating.
+template <Vectorable T, typename Allocator = std::allocator<T>>
+class deque {
+public:
+    // Elements per block: about 4 KiB per block, at least 16 elements
+    static constexpr std::size_t block_size = sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+
+private:
+    using AllocTraits = std::allocator_traits<Allocator>;
+    using MapAlloc = typename AllocTraits::template rebind_alloc<T *>;
+    using MapTraits = std::allocator_traits<MapAlloc>;
+    [[no_unique_address]] Allocator allocator_;
+
+    T **map_ = nullptr;
+    std::size_t map_cap_ = 0;
+    std::size_t start_ = 0;
+    std::size_t length_ = 0;
+    T *spare_ = nullptr;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+
+    // ===========================================================
+    // 1. Iterator Implementation (C++20 random access iterator)
+    // ===========================================================
+    template <bool IsConst>
+    class DequeIterator {
+    private:
+        using Ptr = std::conditional_t<IsConst, const T *, T *>;
+        using NodePtr = std::conditional_t<IsConst, T *const *, T **>;
+        static constexpr std::ptrdiff_t B = static_cast<std::ptrdiff_t>(block_size);
+
+        Ptr current_ = nullptr;
+        Ptr first_ = nullptr; // Start of the block current_ points into
+        NodePtr node_ = nullptr;
+
+        friend class deque;
+        friend class DequeIterator<!IsConst>;
+
+        void set_node(NodePtr node) {
+            node_ = node;
+            first_ = *node;
+        }
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = Ptr;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        DequeIterator() = default;
+        DequeIterator(NodePtr node, std::size_t offset) : node_(node) {
+            first_ = *node;
+            current_ = first_ + offset;
+        }
+        DequeIterator(const DequeIterator &) = default;
+        DequeIterator &operator=(const DequeIterator &) = default;
+
+        DequeIterator(const DequeIterator<false> &other)
+            requires IsConst
+            : current_(other.current_), first_(other.first_), node_(other.node_) {}
+
+        reference operator*() const { return *current_; }
+        pointer operator->() const { return current_; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        DequeIterator &operator++() {
+            if (++current_ == first_ + B) {
+                set_node(node_ + 1);
+                current_ = first_;
+            }
+            return *this;
+        }
+        DequeIterator operator++(int) {
+            DequeIterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+        DequeIterator &operator--() {
+            if (current_ == first_) {
+                set_node(node_ - 1);
+                current_ = first_ + B;
+            }
+            --current_;
+            return *this;
+        }
+        DequeIterator operator--(int) {
+            DequeIterator temp = *this;
+            --(*this);
+            return temp;
+        }
+
+        DequeIterator &operator+=(difference_type n) {
+            difference_type offset = n + (current_ - first_);
+            if (offset >= 0 && offset < B) {
+                current_ += n;
+            } else {
+                difference_type node_offset = offset > 0 ? offset / B : -((-offset - 1) / B) - 1;
+                set_node(node_ + node_offset);
+                current_ = first_ + (offset - node_offset * B);
+            }
+            return *this;
+        }
+        DequeIterator &operator-=(difference_type n) { return *this += -n; }
+
+        friend DequeIterator operator+(DequeIterator it, difference_type n) { return it += n; }
+        friend DequeIterator operator+(difference_type n, DequeIterator it) { return it += n; }
+        friend DequeIterator operator-(DequeIterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const DequeIterator &lhs, const DequeIterator &rhs) {
+            return (lhs.node_ - rhs.node_) * B + (lhs.current_ - lhs.first_) - (rhs.current_ - rhs.first_);
+        }
+
+        friend bool operator==(const DequeIterator &lhs, const DequeIterator &rhs) {
+            return lhs.node_ == rhs.node_ && lhs.current_ == rhs.current_;
+        }
+        friend std::strong_ordering operator<=>(const DequeIterator &lhs, const DequeIterator &rhs) {
+            if (auto cmp = lhs.node_ <=> rhs.node_; cmp != 0) return cmp;
+            return lhs.current_ <=> rhs.current_;
+        }
+    };
+
+    using iterator = DequeIterator<false>;
+    using const_iterator = DequeIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    deque() = default;
+    explicit deque(std::size_t count);
+    deque(std::size_t count, const T &value);
+    template <std::input_iterator InputIt>
+    deque(InputIt first, InputIt last);
+    deque(std::initializer_list<T> init);
+    deque(const deque &other);
+    deque(deque &&other) noexcept;
+    deque &operator=(const deque &other);
+    deque &operator=(deque &&other) noexcept;
+    ~deque();
+
+    // ===========================================================
+    // 3. Element Access
+    // ===========================================================
+
+    template <typename Self>
+    auto &&at(this Self &&self, std::size_t index);
+    template <typename Self>
+    auto &&operator[](this Self &&self, std::size_t index);
+    template <typename Self>
+    auto &&front(this Self &&self);
+    template <typename Self>
+    auto &&back(this Self &&self);
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] std::size_t max_size() const noexcept;
+    // Return the spare block to the allocator
+    void shrink_to_fit() noexcept;
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    void clear() noexcept;
+    void swap(deque &other) noexcept;
+
+    void push_back(const T &value);
+    void push_back(T &&value);
+    void push_front(const T &value);
+    void push_front(T &&value);
+
+    template <typename... Args>
+    T &emplace_back(Args &&...args);
+    template <typename... Args>
+    T &emplace_front(Args &&...args);
+
+    void pop_back();
+    void pop_front();
+
+    iterator insert(const_iterator pos, const T &value);
+    iterator insert(const_iterator pos, T &&value);
+
+    // Shifts the shorter side: O(min(index, size() - index))
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&...args);
+
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+
+    void resize(std::size_t count);
+    void resize(std::size_t count, const T &value);
+
+    // ===========================================================
+    // 6. Iterator Interface
+    // ===========================================================
+
+    template <typename Self>
+    auto begin(this Self &&self) noexcept;
+    const_iterator cbegin() const noexcept;
+
+    template <typename Self>
+    auto end(this Self &&self) noexcept;
+    const_iterator cend() const noexcept;
+
+    template <typename Self>
+    auto rbegin(this Self &&self) noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    template <typename Self>
+    auto rend(this Self &&self) noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    // ===========================================================
+    // 7. C++20 Comparison Operations (Spaceship Operator)
+    // ===========================================================
+
+    std::strong_ordering operator<=>(const deque &other) const;
+    bool operator==(const deque &other) const;
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    T *element(std::size_t pos) const noexcept { return map_[pos / block_size] + pos % block_size; }
+
+    // Take a block from the spare slot or the allocator, and give one back
+    T *acquire_block();
+    void release_block(T *block) noexcept;
+
+    // Make sure the block holding map position pos exists; returns true if it was just created
+    bool ensure_block(std::size_t pos);
+
+    // Recenter the used blocks in the map, growing the map if it is more than half full.
+    // Afterwards there is room for one more block on either side plus the end position.
+    void grow_map();
+
+    // Called whenever the deque becomes empty: park start_ in the middle of the map
+    void reset_start() noexcept;
+
+    iterator make_iterator(std::size_t pos) const noexcept;
+};
+
+// External swap function, for ADL (Argument Dependent Lookup)
+template <Vectorable T, typename Allocator>
+void swap(deque<T, Allocator> &lhs, deque<T, Allocator> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mys
+
+#include "deque.tpp"
\ No newline at end of file
@@ -6,14 +6,26 @@
 #include <concepts>
 #include <iterator>
 #include <memory>
+#include <ranges>
 #include <utility>
 
+#include "instrumentation.h"
+#include "pool_allocator.h"
+
 namespace mys {
 
 template <typename T>
 concept ForwardListable = std::movable<T> && std::destructible<T>;
 
-template <ForwardListable T, typename Allocator = std::allocator<T>>
+// C++23: assign_range / insert_range_after / prepend_range / append_range 接受的范围
+template <typename R, typename T>
+concept ForwardListRange = std::ranges::input_range<R> && std::constructible_from<T, std::ranges::range_reference_t<R>>;
+
+// Instrumentation 为可选的插桩策略（见 instrumentation.h），默认策略不产生任何代码
+// TrackTail 为 true 时额外维护指向最后一个节点的 before_end_，
+// 提供 O(1) 的 push_back / emplace_back / append_range 和整表 splice_after；为 false 时不占空间
+template <ForwardListable T, typename Allocator = std::allocator<T>, ListInstrumentation Instrumentation = no_instrumentation,
+          bool TrackTail = false>
 class forward_list {
 private:
     // 基础节点（仅包含指针，用作哨兵）
@@ -28,13 +40,31 @@ private:
         Node(Args &&...args) : val(std::forward<Args>(args)...) {}
     };
 
+    // 范围操作在链表外建好的节点链：first..last 由 next 串起，last->next 为空
+    struct Chain {
+        NodeBase *first = nullptr;
+        NodeBase *last = nullptr;
+        std::size_t count = 0;
+    };
+
     using NodeAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
     [[no_unique_address]] NodeAlloc allocator_;
 
+    // 移动赋值能否直接接管 other 的节点：分配器随节点传播，或者总是相等；
+    // 否则分配器不相等时只能逐个移动元素，可能抛出异常
+    static constexpr bool nothrow_move_assign = std::allocator_traits<NodeAlloc>::propagate_on_container_move_assignment::value ||
+                                                std::allocator_traits<NodeAlloc>::is_always_equal::value;
+
     // 哨兵节点
     NodeBase head_;
     std::size_t length_ = 0;
 
+    [[no_unique_address]] Instrumentation instrumentation_;
+
+    // 最后一个节点，链表为空时指向 head_；不跟踪尾部时是空类型
+    struct NoTail {};
+    [[no_unique_address]] std::conditional_t<TrackTail, NodeBase *, NoTail> before_end_{};
+
 public:
     // ===========================================================
     // 1. Iterator Implementation
@@ -88,16 +118,18 @@ public:
 
     using iterator = ForwardListIterator<false>;
     using const_iterator = ForwardListIterator<true>;
+    using allocator_type = Allocator;
 
     // ===========================================================
     // 2. Construction and Destruction
     // ===========================================================
     forward_list();
+    explicit forward_list(const Allocator &alloc) noexcept;
     forward_list(std::initializer_list<T> init);
     forward_list(const forward_list &other);
     forward_list(forward_list &&other) noexcept;
     forward_list &operator=(const forward_list &other);
-    forward_list &operator=(forward_list &&other) noexcept;
+    forward_list &operator=(forward_list &&other) noexcept(nothrow_move_assign);
     ~forward_list();
 
     // ===========================================================
@@ -112,6 +144,10 @@ public:
     [[nodiscard]] bool empty() const noexcept;
     [[nodiscard]] std::size_t size() const noexcept;
 
+    // 插桩策略的计数器；拷贝、移动、swap 时留在原对象上
+    template <typename Self>
+    auto &&instrumentation(this Self &&self) noexcept;
+
     // ===========================================================
     // 5. Modifiers
     // ===========================================================
@@ -124,6 +160,15 @@ public:
     template <typename... Args>
     void emplace_front(Args &&...args);
 
+    // 仅在 TrackTail 时提供：借助 before_end_ 在尾部 O(1) 插入
+    void push_back(const T &value)
+        requires TrackTail;
+    void push_back(T &&value)
+        requires TrackTail;
+    template <typename... Args>
+    void emplace_back(Args &&...args)
+        requires TrackTail;
+
     void pop_front();
 
     iterator insert_after(const_iterator pos, const T &value);
@@ -132,7 +177,27 @@ public:
     template <typename... Args>
     iterator emplace_after(const_iterator pos, Args &&...args);
 
+    // 范围操作先在链表外建好整条链，再一次接入：要么全部插入，要么链表保持原样
+    template <std::input_iterator InputIt>
+    void assign(InputIt first, InputIt last);
+    void assign(std::initializer_list<T> init);
+    template <ForwardListRange<T> R>
+    void assign_range(R &&rg);
+
+    // 返回最后一个插入的元素，范围为空时返回 pos
+    template <std::input_iterator InputIt>
+    iterator insert_after(const_iterator pos, InputIt first, InputIt last);
+    iterator insert_after(const_iterator pos, std::initializer_list<T> init);
+    template <ForwardListRange<T> R>
+    iterator insert_range_after(const_iterator pos, R &&rg);
+    template <ForwardListRange<T> R>
+    void prepend_range(R &&rg);
+    // 不跟踪尾部时需要先走到末尾，额外 O(size())
+    template <ForwardListRange<T> R>
+    void append_range(R &&rg);
+
     iterator erase_after(const_iterator pos);
+    // 整段 (first, last) 一次摘下，再逐个销毁
     iterator erase_after(const_iterator first, const_iterator last);
 
     // ===========================================================
@@ -150,9 +215,20 @@ public:
     auto end(this Self &&self) noexcept;
     const_iterator cend() const noexcept;
 
+    // 最后一个元素，空表时等于 before_begin()；仅在 TrackTail 时提供
+    template <typename Self>
+    auto before_end(this Self &&self) noexcept
+        requires TrackTail;
+    const_iterator cbefore_end() const noexcept
+        requires TrackTail;
+
     // ===========================================================
     // 7. Operations
     // ===========================================================
+    allocator_type get_allocator() const noexcept { return allocator_type(allocator_); }
+
+    // splice_after / merge 直接重连 other 的节点，节点之后由本表的分配器释放，
+    // 因此两表分配器不相等时抛出 std::invalid_argument，两表都保持不变
     void splice_after(const_iterator pos, forward_list &other);
     void splice_after(const_iterator pos, forward_list &&other);
     void splice_after(const_iterator pos, forward_list &other, const_iterator it);
@@ -166,12 +242,35 @@ public:
     template <typename BinaryPredicate>
     void unique(BinaryPredicate pred);
 
-    // void sort();
-    // template <typename Compare>
-    // void sort(Compare comp);
+    void merge(forward_list &other);
+    void merge(forward_list &&other);
+    template <typename Compare>
+    void merge(forward_list &other, Compare comp);
+    template <typename Compare>
+    void merge(forward_list &&other, Compare comp);
+
+    // 自底向上归并排序：稳定，只重连 next 指针，不分配内存，额外空间 O(1)
+    void sort();
+    template <typename Compare>
+    void sort(Compare comp);
 
     void reverse() noexcept;
 
+    // 按遍历顺序重新分配全部节点再释放旧节点，长时间插入/删除之后让遍历重新顺序读内存。
+    // 新节点全部分配完之前旧节点都不释放，分配器无法把旧槽位交回来：
+    // 使用 pool_allocator（空闲链表用完之后）或 malloc 尚未用过的堆时，新节点落在一段或少数几段连续内存中。
+    // 元素用 std::move_if_noexcept 转移，峰值内存为每个元素两个节点。
+    //
+    // 所有指向元素的迭代器、指针和引用失效，before_begin() 与 end() 仍然有效。
+    // 分配或拷贝抛异常时，链表仍按原顺序持有全部元素（其中一个前缀已在新节点中），迭代器同样失效
+    void compact();
+    // 下一个节点不在当前节点末尾之后一个缓存行以内的链接所占比例，取值 [0, 1]：
+    // compact() 或顺序插入后接近 0，随机增删之后接近 1。O(n)
+    [[nodiscard]] double fragmentation() const noexcept;
+    // fragmentation() 超过 threshold 时整理，返回是否整理过。即使不整理也是 O(n)，
+    // 适合在不持有迭代器的时机调用，例如一批更新之后
+    bool compact_if(double threshold);
+
     // ===========================================================
     // 8. Comparison Operators (C++20)
     // ===========================================================
@@ -183,6 +282,38 @@ public:
     Node *create_node(Args &&...args);
     void destroy_node(Node *ptr);
 
+    // 由 [first, last) 建链；构造抛异常时销毁已建的部分，链表本身不受影响
+    template <typename Iter, typename Sent>
+    Chain build_chain(Iter first, Sent last);
+    // 销毁从 first 开始、以空指针结尾的链
+    void destroy_chain(NodeBase *first) noexcept;
+    // 把 chain 接到 pos 之后，返回最后一个接入的节点，chain 为空时返回 pos
+    NodeBase *link_chain_after(NodeBase *pos, const Chain &chain) noexcept;
+    // 销毁现有元素，以 chain 作为全部内容
+    void replace_with_chain(const Chain &chain) noexcept;
+
+    // 从 first 开始数 n 个节点后断开，返回剩余部分的首节点
+    static NodeBase *split_after(NodeBase *first, std::size_t n) noexcept;
+    // 将有序链 a、b 稳定归并后接到 tail 之后，返回归并结果的最后一个节点
+    // comp 抛出时先把 a、b 的剩余部分依次接到 tail 之后再重新抛出，节点不会丢失
+    template <typename Compare>
+    static NodeBase *merge_runs(NodeBase *tail, NodeBase *a, NodeBase *b, Compare &comp);
+
+    // 在 pos 之后接入了以 last 结尾的节点：pos 原本是尾部时更新 before_end_
+    void relink_tail(NodeBase *pos, NodeBase *last) noexcept;
+    // 接管 other 的全部节点 (调用前 *this 为空)，other 变为空表
+    void steal_nodes(forward_list &other) noexcept;
+    // 在 prev 之后摘下了节点：prev 成为新的尾部时更新 before_end_
+    void unlink_tail(NodeBase *prev) noexcept;
+    // 从 from 走到链尾，把最后一个节点作为 before_end_；用于中途抛异常后恢复尾指针
+    void reset_tail_from(NodeBase *from) noexcept;
+    // other 的节点不能由 allocator_ 释放时抛出 std::invalid_argument(what)
+    void check_allocator(const forward_list &other, const char *what) const;
+    // 最后一个节点（空表时为 head_）；不跟踪尾部时需要遍历
+    NodeBase *last_node() noexcept;
+    // next 是否紧跟在 node 末尾之后一个缓存行以内（见 fragmentation）
+    static bool adjacent(const NodeBase *node, const NodeBase *next) noexcept;
+
     // 获取 NodeBase* 的非 const 版本，用于 erase_after 等操作
     NodeBase *get_node_base(const_iterator it) {
         // const_cast 是安全的，因为我们只在非 const 成员函数中调用此函数修改链表结构
@@ -190,9 +321,13 @@ public:
     }
 };
 
+// 跟踪尾指针的 forward_list，适合用作只在尾部入队、头部出队的队列
+template <ForwardListable T, typename Allocator = std::allocator<T>, ListInstrumentation Instrumentation = no_instrumentation>
+using tail_forward_list = forward_list<T, Allocator, Instrumentation, true>;
+
 // External swap function
-template <ForwardListable T>
-void swap(forward_list<T> &lhs, forward_list<T> &rhs) noexcept {
+template <ForwardListable T, typename Allocator, ListInstrumentation Instrumentation, bool TrackTail>
+void swap(forward_list<T, Allocator, Instrumentation, TrackTail> &lhs, forward_list<T, Allocator, Instrumentation, TrackTail> &rhs) noexcept {
     lhs.swap(rhs);
 }
 
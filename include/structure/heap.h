@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <concepts>    // C++20: for requires
+#include <functional>  // for std::less
+#include <limits>      // for std::numeric_limits
+#include <memory>      // for std::allocator, std::allocator_traits
+#include <utility>     // for std::move, std::forward, std::swap
+
+#include "vector.h"
+
+namespace mys {
+
+// Indexed D-ary heap: a priority queue in one contiguous array that also supports changing or
+// removing any element through the handle returned by push().
+//
+// Like std::priority_queue, top() is the element that is largest according to Compare
+// (std::greater gives a min-heap). A wider node (D = 4 or 8) halves or thirds the tree height and
+// keeps all children of a node on one or two cache lines, at the cost of more comparisons per level
+// in sift-down.
+//
+// Handles stay valid while their element is in the heap, no matter how it moves; once the element
+// is popped or erased, its handle may be recycled for a later push().
+//
+// If Compare throws, push/update/decrease_key/erase leave the heap as it was, provided that moving
+// a T does not throw either.
+template <std::movable T, typename Compare = std::less<T>, std::size_t D = 4, typename Allocator = std::allocator<T>>
+class heap {
+    static_assert(D >= 2, "heap arity must be at least 2");
+
+public:
+    // Opaque, trivially copyable reference to an element
+    struct handle {
+        std::size_t id = std::numeric_limits<std::size_t>::max();
+
+        friend bool operator==(const handle &, const handle &) = default;
+    };
+
+private:
+    struct Entry {
+        T value;
+        std::size_t id;
+    };
+
+    using EntryAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+    using IndexAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>;
+
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    [[no_unique_address]] Compare comp_;
+    vector<Entry, EntryAlloc> entries_;             // the heap array
+    vector<std::size_t, IndexAlloc> position_;      // handle id -> index in entries_, npos when free
+    vector<std::size_t, IndexAlloc> free_ids_;      // recycled handle ids
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using value_compare = Compare;
+
+    static constexpr std::size_t arity = D;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    heap() = default;
+    explicit heap(const Compare &comp) : comp_(comp) {}
+
+    // ===========================================================
+    // 3. Element Access
+    // ===========================================================
+
+    const T &top() const;
+    const T &value(handle h) const;
+    // True while h refers to an element in the heap
+    [[nodiscard]] bool contains(handle h) const noexcept;
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+    void reserve(std::size_t new_cap);
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    void clear() noexcept;
+
+    handle push(const T &value);
+    handle push(T &&value);
+    template <typename... Args>
+    handle emplace(Args &&...args);
+
+    void pop();
+
+    // Replace the value behind h and restore the heap order: O(log_D n)
+    void update(handle h, T value);
+    // Like update(), for a value that ranks at least as high as the old one (e.g. a shorter
+    // distance in a std::greater heap); only sifts up, so it is cheaper than update()
+    void decrease_key(handle h, T value);
+
+    void erase(handle h);
+
+private:
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    // Both move the entry at index through a hole and return its final index. If Compare throws,
+    // the entries shifted so far are moved back and the hole is refilled before rethrowing
+    std::size_t sift_up(std::size_t index);
+    std::size_t sift_down(std::size_t index);
+
+    // Put entry into slot index and record its new position
+    void place(std::size_t index, Entry &&entry);
+
+    std::size_t allocate_id();
+    void check_handle(handle h) const;
+};
+
+} // namespace mys
+
+#include "heap.tpp"
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+
+namespace mys {
+
+// 链表容器的可选插桩策略
+// - 作为 list / forward_list 的最后一个模板参数，默认 no_instrumentation
+// - 容器在节点分配/释放、遍历、erase 以及长度增长处调用策略的钩子
+// - 钩子必须是 noexcept：clear() 和析构函数里也会调用
+
+// 传给外部 tracer 的事件类型；value 的含义见各钩子
+enum class list_event {
+    allocate,   // value = 本次分配的节点数
+    deallocate, // value = 本次释放的节点数
+    visit,      // value = 本次访问的节点数
+    erase,      // value = 1
+    length,     // value = 增长后的长度
+};
+
+template <typename P>
+concept ListInstrumentation = std::default_initializable<P> && requires(P &p, std::size_t n) {
+    { p.on_allocate(n) } noexcept;
+    { p.on_deallocate(n) } noexcept;
+    { p.on_visit(n) } noexcept;
+    { p.on_erase() } noexcept;
+    { p.on_length(n) } noexcept;
+};
+
+// 默认策略：空类型 + 空的内联钩子
+// 以 [[no_unique_address]] 存放时不占空间，开启优化后不产生任何指令
+struct no_instrumentation {
+    void on_allocate(std::size_t) noexcept {}
+    void on_deallocate(std::size_t) noexcept {}
+    void on_visit(std::size_t) noexcept {}
+    void on_erase() noexcept {}
+    void on_length(std::size_t) noexcept {}
+};
+
+// 计数策略：累计各类操作次数，并把每个事件转发给可选的 tracer
+// 计数器属于容器对象本身，拷贝、移动、swap 都不会转移它们
+struct counting_instrumentation {
+    // tracer 不允许抛出异常
+    using tracer_fn = void (*)(void *context, list_event event, std::size_t value) noexcept;
+
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+    std::size_t nodes_visited = 0; // remove_if / unique / splice_after 等遍历访问的节点
+    std::size_t erase_calls = 0;   // 单节点 erase 的次数，区间 erase 按节点逐个计数
+    std::size_t peak_length = 0;
+
+    tracer_fn tracer = nullptr;
+    void *context = nullptr;
+
+    void set_tracer(tracer_fn fn, void *ctx = nullptr) noexcept {
+        tracer = fn;
+        context = ctx;
+    }
+
+    void reset() noexcept {
+        allocations = 0;
+        deallocations = 0;
+        nodes_visited = 0;
+        erase_calls = 0;
+        peak_length = 0;
+    }
+
+    void on_allocate(std::size_t n) noexcept {
+        allocations += n;
+        trace(list_event::allocate, n);
+    }
+
+    void on_deallocate(std::size_t n) noexcept {
+        deallocations += n;
+        trace(list_event::deallocate, n);
+    }
+
+    void on_visit(std::size_t n) noexcept {
+        nodes_visited += n;
+        trace(list_event::visit, n);
+    }
+
+    void on_erase() noexcept {
+        ++erase_calls;
+        trace(list_event::erase, 1);
+    }
+
+    void on_length(std::size_t n) noexcept {
+        if (n > peak_length) peak_length = n;
+        trace(list_event::length, n);
+    }
+
+    void trace(list_event event, std::size_t value) const noexcept {
+        if (tracer) tracer(context, event, value);
+    }
+};
+
+} // namespace mys
+
+// 容器内部调用钩子的唯一入口
+// 定义 MYS_STRIP_INSTRUMENTATION 时在预处理阶段去掉全部钩子调用，得到与未插桩时完全相同的容器；
+// tests/unit 的代码体积测试以此为基准，验证默认实例化的零开销
+#ifdef MYS_STRIP_INSTRUMENTATION
+#define MYS_INSTRUMENT(call) static_cast<void>(0)
+#else
+#define MYS_INSTRUMENT(call) instrumentation_.call
+#endif
\ No newline at end of file
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <cstddef>     // for size_t
+#include <iterator>    // for std::bidirectional_iterator_tag
+#include <type_traits> // for std::conditional_t
+
+#include "list_links.h"
+
+namespace mys {
+
+// Links embedded in an element of an intrusive_list. An object can be in as many intrusive lists
+// at once as it has hooks, but in at most one list per hook; both links are null while unlinked.
+template <typename T>
+struct list_hook : detail::list_links {
+    [[nodiscard]] bool is_linked() const noexcept { return next != nullptr; }
+};
+
+// Doubly linked list that links the user's objects through a list_hook member instead of
+// allocating nodes. The list does not own its elements: inserting and erasing never allocate or
+// construct anything, clear() and the destructor only unlink, and every element must outlive its
+// membership. Given a reference to an element, erase() unlinks it in O(1). The hooks are linked
+// through a circular sentinel with the same helpers as list, so an iterator is a single pointer and
+// --end() reaches the last element.
+//
+// struct Task { int id; mys::list_hook<Task> hook; };
+// mys::intrusive_list<Task, &Task::hook> queue;
+template <typename T, list_hook<T> T::*Hook>
+class intrusive_list {
+private:
+    using NodeBase = detail::list_links;
+
+    // head_.next is the first element's hook, head_.prev the last one's, and end() is &head_
+    NodeBase head_{&head_, &head_};
+    std::size_t length = 0;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+
+    // ===========================================================
+    // 1. Iterator Implementation
+    // ===========================================================
+    template <bool IsConst>
+    class IntrusiveIterator {
+    private:
+        using NodeBasePtr = std::conditional_t<IsConst, const NodeBase *, NodeBase *>;
+        NodeBasePtr current_ = nullptr;
+
+        friend class intrusive_list;
+        friend class IntrusiveIterator<!IsConst>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        IntrusiveIterator() = default;
+        explicit IntrusiveIterator(NodeBasePtr node) : current_(node) {}
+        IntrusiveIterator(const IntrusiveIterator &) = default;
+        IntrusiveIterator &operator=(const IntrusiveIterator &) = default;
+
+        IntrusiveIterator(const IntrusiveIterator<false> &other)
+            requires IsConst
+            : current_(other.current_) {}
+
+        // Dereferencing end() is undefined: the sentinel belongs to no element
+        reference operator*() const { return *owner(current_); }
+
+        pointer operator->() const { return owner(current_); }
+
+        IntrusiveIterator &operator++() {
+            current_ = current_->next;
+            return *this;
+        }
+
+        IntrusiveIterator operator++(int) {
+            IntrusiveIterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        IntrusiveIterator &operator--() {
+            current_ = current_->prev;
+            return *this;
+        }
+
+        IntrusiveIterator operator--(int) {
+            IntrusiveIterator temp = *this;
+            --*this;
+            return temp;
+        }
+
+        friend bool operator==(const IntrusiveIterator &lhs, const IntrusiveIterator &rhs) {
+            return lhs.current_ == rhs.current_;
+        }
+    };
+
+    using iterator = IntrusiveIterator<false>;
+    using const_iterator = IntrusiveIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    // Copying would put the same hooks in two lists, so the list is move-only
+    intrusive_list() = default;
+    intrusive_list(const intrusive_list &) = delete;
+    intrusive_list &operator=(const intrusive_list &) = delete;
+    intrusive_list(intrusive_list &&other) noexcept;
+    intrusive_list &operator=(intrusive_list &&other) noexcept;
+    ~intrusive_list();
+
+    // ===========================================================
+    // 3. Element Access
+    // ===========================================================
+
+    template <typename Self>
+    auto &&front(this Self &&self);
+    template <typename Self>
+    auto &&back(this Self &&self);
+
+    // Iterator to an element known to be in this list, in O(1)
+    template <typename Self>
+    auto iterator_to(this Self &&self, const T &value) noexcept;
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    // Unlink every element; the elements themselves are untouched
+    void clear() noexcept;
+    void swap(intrusive_list &other) noexcept;
+
+    // Linking a value whose hook is already linked throws std::invalid_argument
+    void push_back(T &value);
+    void push_front(T &value);
+    void pop_back() noexcept;
+    void pop_front() noexcept;
+
+    // Link value before pos
+    iterator insert(const_iterator pos, T &value);
+
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    // Unlink value, which must be in this list, in O(1); returns the element after it
+    iterator erase(T &value) noexcept;
+
+    // Move elements of other (which may be *this for the single-element and range forms) before pos
+    void splice(const_iterator pos, intrusive_list &other) noexcept;
+    void splice(const_iterator pos, intrusive_list &other, const_iterator it) noexcept;
+    void splice(const_iterator pos, intrusive_list &other, const_iterator first, const_iterator last) noexcept;
+
+    // ===========================================================
+    // 6. Iterator Interface
+    // ===========================================================
+
+    template <typename Self>
+    auto begin(this Self &&self) noexcept;
+    const_iterator cbegin() const noexcept;
+
+    template <typename Self>
+    auto end(this Self &&self) noexcept;
+    const_iterator cend() const noexcept;
+
+    template <typename Self>
+    auto rbegin(this Self &&self) noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    template <typename Self>
+    auto rend(this Self &&self) noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    static list_hook<T> &hook(T &value) noexcept { return value.*Hook; }
+    // The element whose hook is node, found by stepping back over the hook's offset
+    static T *owner(NodeBase *node) noexcept;
+    static const T *owner(const NodeBase *node) noexcept;
+    // Throw if value's hook is already in a list, then link it before pos and count it
+    iterator link_value(NodeBase *pos, T &value);
+};
+
+template <typename T, list_hook<T> T::*Hook>
+void swap(intrusive_list<T, Hook> &lhs, intrusive_list<T, Hook> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mys
+
+#include "intrusive_list.tpp"
\ No newline at end of file
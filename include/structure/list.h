@@ -3,11 +3,17 @@
 #include <cstddef>          // for size_t
 #include <initializer_list> // for std::initializer_list
 #include <compare>          // C++20: for operator <=>
+#include <functional>       // for std::equal_to
 #include <concepts>         // C++20: for requires
 #include <iterator>         // for std::bidirectional_iterator_tag
 #include <memory>           // for std::allocator (optional, advanced challenge)
+#include <ranges>           // C++23: for the *_range modifiers
 #include <utility>          // for std::move, std::forward
 
+#include "instrumentation.h"
+#include "list_links.h"
+#include "pool_allocator.h"
+
 namespace mys {
 
 // C++20: Define a Concept to constrain that types stored in the list must be movable and destructible
@@ -15,27 +21,51 @@ namespace mys {
 template <typename T>
 concept Listable = std::movable<T> && std::destructible<T>;
 
-template <Listable T, typename Allocator = std::allocator<T>>
+// C++23: Ranges accepted by assign_range / insert_range / append_range / prepend_range
+template <typename R, typename T>
+concept ListRange = std::ranges::input_range<R> && std::constructible_from<T, std::ranges::range_reference_t<R>>;
+
+// Instrumentation is an opt-in policy (see instrumentation.h); the default compiles to nothing
+template <Listable T, typename Allocator = std::allocator<T>, ListInstrumentation Instrumentation = no_instrumentation>
 class list {
 private:
+    // Links only; the sentinel head_ is a bare NodeBase. Linking and unlinking go through the
+    // static helpers of list_links, which never touch length or destroy anything
+    using NodeBase = detail::list_links;
+
     // Internal node structure
-    struct Node {
+    struct Node : NodeBase {
         T val;
-        Node *prev = nullptr;
-        Node *next = nullptr;
 
         // Perfect Forwarding
         template <typename... Args>
         Node(Args &&...args) : val(std::forward<Args>(args)...) {}
     };
 
+    // Nodes built off-list by the range modifiers: first..last linked through prev/next,
+    // first->prev and last->next are null
+    struct Chain {
+        NodeBase *first = nullptr;
+        NodeBase *last = nullptr;
+        std::size_t count = 0;
+    };
+
     using NodeAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
     [[no_unique_address]] NodeAlloc allocator_;
 
-    Node *head = nullptr;
-    Node *tail = nullptr;
+    // Move assignment can take over other's nodes only if their allocator comes along or is equal anyway;
+    // otherwise the elements are moved one by one, which may throw
+    static constexpr bool nothrow_move_assign = std::allocator_traits<NodeAlloc>::propagate_on_container_move_assignment::value ||
+                                                std::allocator_traits<NodeAlloc>::is_always_equal::value;
+
+    // Circular sentinel: head_.next is the first node, head_.prev the last one, and end() is &head_.
+    // An empty list links head_ to itself, so linking and unlinking never test for null; the price is
+    // that move and swap must point the boundary nodes at the new sentinel (see reattach_head)
+    NodeBase head_{&head_, &head_};
     std::size_t length = 0;
 
+    [[no_unique_address]] Instrumentation instrumentation_;
+
 public:
     // ===========================================================
     // 1. Iterator Implementation (Challenge: Compliant with C++20 Iterator Concepts)
@@ -43,9 +73,10 @@ public:
     template <bool IsConst>
     class ListIterator {
     private:
+        // A single pointer: end() is the sentinel, so --end() just follows prev
+        using NodeBasePtr = std::conditional_t<IsConst, const NodeBase *, NodeBase *>;
         using NodePtr = std::conditional_t<IsConst, const Node *, Node *>;
-        NodePtr current_ = nullptr;
-        const list *list_ = nullptr;
+        NodeBasePtr current_ = nullptr;
 
         friend class list;
         friend class ListIterator<!IsConst>;
@@ -60,7 +91,7 @@ public:
         using reference = std::conditional_t<IsConst, const T &, T &>;
 
         ListIterator() = default;
-        explicit ListIterator(NodePtr node, const list *l = nullptr) : current_(node), list_(l){};
+        explicit ListIterator(NodeBasePtr node) : current_(node) {}
         ListIterator(const ListIterator &) = default;
 
         // 允许从 iterator (IsConst=false) 隐式转换为 const_iterator (IsConst=true)
@@ -68,29 +99,26 @@ public:
         // 避免干扰 iterator 自身的默认拷贝构造函数。
         ListIterator(const ListIterator<false> &other)
             requires IsConst
-            : current_(other.current_), list_(other.list_) {}
+            : current_(other.current_) {}
 
-        reference operator*() const { return current_->val; }
+        // Dereferencing end() is undefined, as for std::list: the sentinel holds no value
+        reference operator*() const { return static_cast<NodePtr>(current_)->val; }
 
-        pointer operator->() const { return &(current_->val); }
+        pointer operator->() const { return &(static_cast<NodePtr>(current_)->val); }
 
         ListIterator &operator++() {
-            if (current_) current_ = current_->next;
+            current_ = current_->next;
             return *this;
         }
 
         ListIterator operator++(int) {
             ListIterator temp = *this;
-            if (current_) current_ = current_->next;
+            current_ = current_->next;
             return temp;
         }
 
         ListIterator &operator--() {
-            if (current_) {
-                current_ = current_->prev;
-            } else if (list_) {
-                current_ = list_->tail;
-            }
+            current_ = current_->prev;
             return *this;
         }
 
@@ -111,17 +139,19 @@ public:
 
     using iterator = ListIterator<false>;
     using const_iterator = ListIterator<true>;
+    using allocator_type = Allocator;
 
     // ===========================================================
     // 2. Construction and Destruction (Lifecycle Management)
     // ===========================================================
 
     list() = default;
+    explicit list(const Allocator &alloc) noexcept;
     list(std::initializer_list<T> init);
     list(const list &other);
     list(list &&other) noexcept;
     list &operator=(const list &other);
-    list &operator=(list &&other) noexcept;
+    list &operator=(list &&other) noexcept(nothrow_move_assign);
     ~list();
 
     // ===========================================================
@@ -146,6 +176,10 @@ public:
     [[nodiscard]] bool empty() const noexcept;
     [[nodiscard]] std::size_t size() const noexcept;
 
+    // Counters of the instrumentation policy; they stay with this object on copy, move and swap
+    template <typename Self>
+    auto &&instrumentation(this Self &&self) noexcept;
+
     // ===========================================================
     // 5. Modifiers
     // ===========================================================
@@ -176,7 +210,26 @@ public:
     template <typename... Args>
     iterator emplace(const_iterator pos, Args &&...args);
 
+    // Range modifiers build the whole chain first and link it with a single relink,
+    // so they either insert every element or leave the list untouched
+    template <std::input_iterator InputIt>
+    void assign(InputIt first, InputIt last);
+    void assign(std::initializer_list<T> init);
+    template <ListRange<T> R>
+    void assign_range(R &&rg);
+
+    template <std::input_iterator InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last);
+    iterator insert(const_iterator pos, std::initializer_list<T> init);
+    template <ListRange<T> R>
+    iterator insert_range(const_iterator pos, R &&rg);
+    template <ListRange<T> R>
+    void append_range(R &&rg);
+    template <ListRange<T> R>
+    void prepend_range(R &&rg);
+
     iterator erase(const_iterator pos);
+    // Unlinks [first, last) in one step, then destroys the detached nodes
     iterator erase(const_iterator first, const_iterator last);
 
     // ===========================================================
@@ -215,14 +268,101 @@ public:
     // 8. Other Operations
     // ===========================================================
 
+    allocator_type get_allocator() const noexcept { return allocator_type(allocator_); }
+
+    // Like splice, merge relinks other's nodes, so the allocators must compare equal;
+    // std::invalid_argument is thrown otherwise and both lists are left untouched
+    void merge(list &other);
+    void merge(list &&other);
+    template <typename Compare>
+    void merge(list &other, Compare comp);
+    template <typename Compare>
+    void merge(list &&other, Compare comp);
+
+    // Bottom-up merge sort: stable, relinks prev/next only, no allocation, O(1) extra space
+    void sort();
+    template <typename Compare>
+    void sort(Compare comp);
+
+    // Move nodes from other before pos by relinking prev/next; nothing is allocated or copied.
+    // The whole-list and single-element forms are O(1); the range form is O(1) within the same list
+    // and otherwise counts the moved nodes. Nodes of one allocator cannot be freed through another, so
+    // splicing from a list whose allocator compares unequal throws std::invalid_argument
+    void splice(const_iterator pos, list &other);
+    void splice(const_iterator pos, list &&other);
+    void splice(const_iterator pos, list &other, const_iterator it);
+    void splice(const_iterator pos, list &&other, const_iterator it);
+    void splice(const_iterator pos, list &other, const_iterator first, const_iterator last);
+    void splice(const_iterator pos, list &&other, const_iterator first, const_iterator last);
+
+    // C++20: return the number of removed elements. Removed nodes are destroyed after the scan,
+    // so value may refer to an element of this list
+    std::size_t remove(const T &value);
+    template <typename Predicate>
+    std::size_t remove_if(Predicate pred);
+
+    // Remove every element equal to the element kept before it
+    std::size_t unique();
+    template <typename BinaryPredicate>
+    std::size_t unique(BinaryPredicate pred);
+
+    void reverse() noexcept;
+
+    // Reallocate every node in traversal order and free the old ones, so that a walk reads memory front
+    // to back again after long insert/erase churn. All new nodes are allocated while the old ones are
+    // still held, so the allocator cannot hand back the old slots: with pool_allocator (once its free
+    // list is used up) or malloc's untouched heap the new nodes form one or a few runs. Values are moved
+    // with std::move_if_noexcept, and peak memory is two nodes per element.
+    //
+    // Every iterator, pointer and reference to an element is invalidated; end() stays valid. If an
+    // allocation or a copy throws, the list still holds the same elements in the same order (a prefix of
+    // them already in new nodes) and iterators are invalidated all the same
+    void compact();
+    // Share of links, in [0, 1], whose next node does not start within a cache line after the end of
+    // the current one: near 0 after compact() or sequential insertion, near 1 after random churn. O(n)
+    [[nodiscard]] double fragmentation() const noexcept;
+    // Compact when fragmentation() is above threshold and report whether it did. Being O(n) even when
+    // nothing moves, it is meant for points where no iterators are held, such as after a batch of updates
+    bool compact_if(double threshold);
+
     template <typename... Args>
     Node *create_node(Args &&...args);
-    void destroy_node(Node *ptr);
+    void destroy_node(NodeBase *ptr);
+
+    // Build a chain from [first, last); on exception the partial chain is destroyed and the list is untouched
+    template <typename Iter, typename Sent>
+    Chain build_chain(Iter first, Sent last);
+    // Destroy the null-terminated chain starting at first
+    void destroy_chain(NodeBase *first) noexcept;
+    // Link one new node before pos and count it, return the node
+    Node *link_node(NodeBase *pos, Node *node) noexcept;
+    // Link chain before pos (&head_ means end()), return the first linked node or pos if chain is empty
+    NodeBase *link_chain(NodeBase *pos, const Chain &chain) noexcept;
+    // Detach every node as a null-terminated chain (nullptr if empty) and leave the list empty
+    NodeBase *release_chain() noexcept;
+    // Destroy the current elements and take chain as the whole content
+    void replace_with_chain(const Chain &chain) noexcept;
+    // After head_ was copied or swapped in from another list, point the boundary nodes back at it
+    // (or at itself if length is 0)
+    void reattach_head() noexcept;
+    // Throw std::invalid_argument(what) unless other's nodes can be freed by allocator_
+    void check_allocator(const list &other, const char *what) const;
+    // Walk the null-terminated chain from tail, fixing prev links, and close it into the ring
+    void close_chain(NodeBase *tail) noexcept;
+    // Whether next starts no more than a cache line after the end of node (see fragmentation)
+    static bool adjacent(const NodeBase *node, const NodeBase *next) noexcept;
+
+    // Cut the chain n nodes after first, return the head of the remainder
+    static NodeBase *split_after(NodeBase *first, std::size_t n) noexcept;
+    // Stably merge sorted chains a and b after tail, return the last merged node.
+    // If comp throws, whatever is left of a and b is hung after tail before rethrowing
+    template <typename Compare>
+    static NodeBase *merge_runs(NodeBase *tail, NodeBase *a, NodeBase *b, Compare &comp);
 };
 
 // External swap function, for ADL (Argument Dependent Lookup)
-template <Listable T>
-void swap(list<T> &lhs, list<T> &rhs) noexcept {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void swap(list<T, Allocator, Instrumentation> &lhs, list<T, Allocator, Instrumentation> &rhs) noexcept {
     lhs.swap(rhs);
 }
 
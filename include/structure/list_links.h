@@ -0,0 +1,54 @@
+#pragma once
+
+namespace mys {
+
+namespace detail {
+
+// Links of a circular doubly linked list closed by a sentinel of the same type, shared by list and
+// intrusive_list. The sentinel of an empty list points at itself, so linking and unlinking never
+// test for null; a node that is in no list has both links null.
+struct list_links {
+    list_links *prev = nullptr;
+    list_links *next = nullptr;
+
+    // Link the detached nodes first..last before pos
+    static void link_range(list_links *pos, list_links *first, list_links *last) noexcept {
+        list_links *before = pos->prev;
+        first->prev = before;
+        last->next = pos;
+        before->next = first;
+        pos->prev = last;
+    }
+
+    // Detach first..last (inclusive) from their list; first->prev and last->next become null
+    static void unlink_range(list_links *first, list_links *last) noexcept {
+        list_links *before = first->prev;
+        list_links *after = last->next;
+        before->next = after;
+        after->prev = before;
+        first->prev = nullptr;
+        last->next = nullptr;
+    }
+
+    // Detach a single node; its own links are left dangling
+    static void unlink_node(list_links *node) noexcept {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+
+    // Called on a sentinel after it was copied or swapped in from another list: point the boundary
+    // nodes back at it, or at itself if the list is empty
+    void reattach(bool empty) noexcept {
+        if (empty) {
+            next = this;
+            prev = this;
+        } else {
+            next->prev = this;
+            prev->next = this;
+        }
+    }
+};
+
+} // namespace detail
+
+} // namespace mys
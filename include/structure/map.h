@@ -0,0 +1,351 @@
+#pragma once
+
+#include <cstddef>          // for size_t
+#include <initializer_list> // for std::initializer_list
+#include <concepts>         // C++20: for requires
+#include <functional>       // for std::less
+#include <iterator>         // for std::bidirectional_iterator_tag
+#include <memory>           // for std::allocator, std::allocator_traits
+#include <type_traits>      // for std::conditional_t
+#include <utility>          // for std::pair, std::move, std::forward
+
+#include "vector.h"
+
+namespace mys {
+
+// Tag for constructors and assign() whose input is already sorted by key without duplicates
+struct sorted_unique_t {
+    explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+
+// Ordered map stored as a B+-tree.
+//
+// All elements live in leaves of up to Fanout entries; keys and mapped values are kept in two
+// parallel arrays so that searching a node only touches contiguous keys. Leaves are chained in
+// both directions, so iteration is a walk over arrays rather than a tree traversal. Inner nodes
+// hold up to Fanout children and copies of the smallest key of each child but the first, which is
+// why Key must be copyable. Every node except the root stays at least half full.
+//
+// Because keys and values are stored apart, the iterators' reference type is the proxy
+// std::pair<const Key &, T &> (as with std::flat_map) and value_type is std::pair<Key, T>;
+// it->first and it->second work as with std::map.
+//
+// Inserting or erasing may move elements between nodes and invalidates all iterators.
+template <std::copyable Key, std::movable T, typename Compare = std::less<Key>, std::size_t Fanout = 32,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class map {
+    static_assert(Fanout >= 4, "map fanout must be at least 4");
+
+private:
+    // Raw storage for N objects whose lifetimes are managed by hand
+    template <typename U, std::size_t N>
+    union Slots {
+        U data[N];
+        Slots() {}
+        ~Slots() {}
+    };
+
+    struct NodeBase {
+        bool is_leaf;
+        std::size_t count = 0; // elements in a leaf, children in an inner node
+    };
+
+    // One spare slot in each array lets a node overflow by one before it is split
+    struct Leaf : NodeBase {
+        Slots<Key, Fanout + 1> keys;
+        Slots<T, Fanout + 1> values;
+        Leaf *prev = nullptr;
+        Leaf *next = nullptr;
+        Leaf() : NodeBase{true} {}
+    };
+
+    struct Inner : NodeBase {
+        Slots<Key, Fanout> keys; // keys[i] <= every key under children[i + 1] < keys[i + 1]
+        NodeBase *children[Fanout + 1];
+        Inner() : NodeBase{false} {}
+    };
+
+    static constexpr std::size_t min_count = Fanout / 2;
+    static constexpr std::size_t max_height = 64;
+
+    // Inner nodes visited on the way down, with the child index taken at each
+    struct Path {
+        struct Step {
+            Inner *node;
+            std::size_t index;
+        };
+        Step steps[max_height];
+        std::size_t depth = 0;
+    };
+
+    using LeafAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Leaf>;
+    using InnerAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Inner>;
+    using LeafTraits = std::allocator_traits<LeafAlloc>;
+    using InnerTraits = std::allocator_traits<InnerAlloc>;
+
+    [[no_unique_address]] Compare comp_;
+    [[no_unique_address]] LeafAlloc leaf_allocator_;
+    [[no_unique_address]] InnerAlloc inner_allocator_;
+
+    NodeBase *root_ = nullptr;
+    Leaf *first_leaf_ = nullptr;
+    Leaf *last_leaf_ = nullptr;
+    std::size_t size_ = 0;
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = Compare;
+    using allocator_type = Allocator;
+    using reference = std::pair<const Key &, T &>;
+    using const_reference = std::pair<const Key &, const T &>;
+
+    // ===========================================================
+    // 1. Iterator Implementation (bidirectional, walks the leaf chain)
+    // ===========================================================
+    template <bool IsConst>
+    class MapIterator {
+    private:
+        using LeafPtr = std::conditional_t<IsConst, const Leaf *, Leaf *>;
+        LeafPtr leaf_ = nullptr;
+        std::size_t index_ = 0;
+        const map *map_ = nullptr;
+
+        friend class map;
+        friend class MapIterator<!IsConst>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::pair<Key, T>;
+        using reference = std::conditional_t<IsConst, std::pair<const Key &, const T &>, std::pair<const Key &, T &>>;
+
+        // operator-> has to return something that outlives the call, so it wraps the proxy pair
+        struct pointer {
+            reference ref;
+            reference *operator->() { return &ref; }
+        };
+
+        MapIterator() = default;
+        MapIterator(LeafPtr leaf, std::size_t index, const map *m) : leaf_(leaf), index_(index), map_(m) {}
+        MapIterator(const MapIterator &) = default;
+        MapIterator &operator=(const MapIterator &) = default;
+
+        MapIterator(const MapIterator<false> &other)
+            requires IsConst
+            : leaf_(other.leaf_), index_(other.index_), map_(other.map_) {}
+
+        reference operator*() const { return reference(leaf_->keys.data[index_], leaf_->values.data[index_]); }
+        pointer operator->() const { return pointer{**this}; }
+
+        MapIterator &operator++() {
+            if (++index_ == leaf_->count) {
+                leaf_ = leaf_->next;
+                index_ = 0;
+            }
+            return *this;
+        }
+        MapIterator operator++(int) {
+            MapIterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        MapIterator &operator--() {
+            if (!leaf_) {
+                leaf_ = map_->last_leaf_;
+                index_ = leaf_->count - 1;
+            } else if (index_ == 0) {
+                leaf_ = leaf_->prev;
+                index_ = leaf_->count - 1;
+            } else {
+                --index_;
+            }
+            return *this;
+        }
+        MapIterator operator--(int) {
+            MapIterator temp = *this;
+            --*this;
+            return temp;
+        }
+
+        friend bool operator==(const MapIterator &lhs, const MapIterator &rhs) {
+            return lhs.leaf_ == rhs.leaf_ && lhs.index_ == rhs.index_;
+        }
+    };
+
+    using iterator = MapIterator<false>;
+    using const_iterator = MapIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    map() = default;
+    explicit map(const Compare &comp, const Allocator &alloc = Allocator());
+    template <std::input_iterator InputIt>
+    map(InputIt first, InputIt last, const Compare &comp = Compare(), const Allocator &alloc = Allocator());
+    // Bulk load in O(n); [first, last) must be sorted by key with no duplicates
+    template <std::input_iterator InputIt>
+    map(sorted_unique_t, InputIt first, InputIt last, const Compare &comp = Compare(), const Allocator &alloc = Allocator());
+    map(std::initializer_list<value_type> init, const Compare &comp = Compare(), const Allocator &alloc = Allocator());
+    map(const map &other);
+    map(map &&other) noexcept;
+    map &operator=(const map &other);
+    map &operator=(map &&other) noexcept;
+    ~map();
+
+    // Replace the contents by bulk loading sorted, duplicate-free input in O(n)
+    template <std::input_iterator InputIt>
+    void assign(sorted_unique_t, InputIt first, InputIt last);
+
+    // ===========================================================
+    // 3. Element Access and Lookup
+    // ===========================================================
+
+    template <typename Self>
+    auto &&at(this Self &&self, const Key &key);
+    T &operator[](const Key &key);
+    T &operator[](Key &&key);
+
+    template <typename Self>
+    auto find(this Self &&self, const Key &key);
+    [[nodiscard]] bool contains(const Key &key) const;
+    std::size_t count(const Key &key) const;
+
+    // First element not less than key / first element greater than key
+    template <typename Self>
+    auto lower_bound(this Self &&self, const Key &key);
+    template <typename Self>
+    auto upper_bound(this Self &&self, const Key &key);
+    template <typename Self>
+    auto equal_range(this Self &&self, const Key &key);
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] std::size_t max_size() const noexcept;
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    void clear() noexcept;
+    void swap(map &other) noexcept;
+
+    std::pair<iterator, bool> insert(const value_type &value);
+    std::pair<iterator, bool> insert(value_type &&value);
+    template <std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last);
+    void insert(std::initializer_list<value_type> ilist);
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key &key, M &&obj);
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(Key &&key, M &&obj);
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args &&...args);
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+
+    iterator erase(iterator pos);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    std::size_t erase(const Key &key);
+
+    // ===========================================================
+    // 6. Iterator Interface
+    // ===========================================================
+
+    template <typename Self>
+    auto begin(this Self &&self) noexcept;
+    const_iterator cbegin() const noexcept;
+
+    template <typename Self>
+    auto end(this Self &&self) noexcept;
+    const_iterator cend() const noexcept;
+
+    template <typename Self>
+    auto rbegin(this Self &&self) noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    template <typename Self>
+    auto rend(this Self &&self) noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    // ===========================================================
+    // 7. Comparison Operations
+    // ===========================================================
+
+    bool operator==(const map &other) const;
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    key_compare key_comp() const { return comp_; }
+    allocator_type get_allocator() const noexcept { return allocator_type(leaf_allocator_); }
+
+    // Walk from the root to the leaf whose key range covers key, recording the path if asked
+    Leaf *find_leaf(const Key &key, Path *path = nullptr) const;
+    std::size_t leaf_lower_bound(const Leaf *leaf, const Key &key) const;
+
+    // Insert key (constructed from key_arg) and T(args...) unless key is present
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_impl(K &&key_arg, Args &&...args);
+
+    // Split an overfull leaf/inner node into node and a preallocated right sibling; the separator
+    // for the parent is returned through separator
+    void split_leaf(Leaf *leaf, Leaf *right) noexcept;
+    void split_inner(Inner *node, Inner *right, Key &separator) noexcept;
+    static void insert_child(Inner *node, std::size_t index, Key &&separator, NodeBase *child) noexcept;
+    static void remove_child(Inner *node, std::size_t index) noexcept;
+
+    // Remove the element at (leaf, pos) and rebalance; returns the following element
+    iterator erase_at(Path &path, Leaf *leaf, std::size_t pos);
+    void rebalance_leaf(Path &path, Leaf *&leaf, std::size_t &successor);
+    void rebalance_inner(Path &path, std::size_t level) noexcept;
+    void unlink_leaf(Leaf *leaf) noexcept;
+
+    template <std::input_iterator InputIt>
+    void bulk_load(InputIt first, InputIt last);
+
+    Leaf *create_leaf();
+    Inner *create_inner();
+    // Free a node whose elements/keys have already been destroyed or moved out
+    void deallocate_leaf(Leaf *leaf) noexcept;
+    void deallocate_inner(Inner *node) noexcept;
+    // Destroy every inner node below and including node (leaves are freed through the chain)
+    void destroy_inner_nodes(NodeBase *node) noexcept;
+
+    // Move-construct *src into dst and end the lifetime of *src
+    template <typename U>
+    static void relocate(U *dst, U *src) noexcept;
+    // Open an unconstructed gap at data[pos], shifting [pos, count) up by one
+    template <typename U>
+    static void open_gap(U *data, std::size_t pos, std::size_t count) noexcept;
+    // Close the unconstructed gap at data[pos], shifting (pos, count) down by one
+    template <typename U>
+    static void close_gap(U *data, std::size_t pos, std::size_t count) noexcept;
+};
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void swap(map<Key, T, Compare, Fanout, Allocator> &lhs, map<Key, T, Compare, Fanout, Allocator> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mys
+
+#include "map.tpp"
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>      // for std::atomic
+#include <cstddef>     // for size_t
+#include <concepts>    // C++20: for requires
+#include <iterator>    // for std::input_iterator
+#include <memory>      // for std::allocator, std::allocator_traits
+#include <new>         // for std::launder
+#include <type_traits> // for std::is_nothrow_move_constructible
+#include <utility>     // for std::move, std::forward
+
+namespace mys {
+
+// Values are constructed after a slot has been claimed and cannot be handed back if that throws,
+// so the queue only relocates values with operations that cannot fail.
+template <typename T>
+concept Queueable = std::movable<T> && std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>;
+
+// Bounded lock-free multi-producer/multi-consumer queue (Vyukov's ring with per-slot sequence numbers).
+//
+// Slot i holds a sequence number that tells each side whose turn it is:
+//   sequence == pos       the slot is free for the producer claiming position pos
+//   sequence == pos + 1   the slot holds the value for the consumer claiming position pos
+// A position is claimed with one CAS on enqueue_pos_/dequeue_pos_; the bulk operations claim a whole
+// run of consecutive positions with that single CAS and then only touch the per-slot sequences.
+//
+// Every slot and both cursors sit on their own cache line so that neighbouring operations do not
+// false-share. The queue is neither copyable nor movable: other threads hold references into it.
+template <Queueable T, typename Allocator = std::allocator<T>>
+class mpmc_queue {
+public:
+    static constexpr std::size_t cache_line_size = 64;
+
+private:
+    struct alignas(cache_line_size) Slot {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        explicit Slot(std::size_t seq) noexcept : sequence(seq) {}
+
+        T *value() noexcept { return std::launder(reinterpret_cast<T *>(storage)); }
+    };
+
+    using SlotAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+    using SlotTraits = std::allocator_traits<SlotAlloc>;
+    [[no_unique_address]] SlotAlloc allocator_;
+
+    Slot *slots_ = nullptr;
+    std::size_t mask_ = 0;
+
+    alignas(cache_line_size) std::atomic<std::size_t> enqueue_pos_{0};
+    alignas(cache_line_size) std::atomic<std::size_t> dequeue_pos_{0};
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    // capacity is rounded up to the next power of two (at least 2)
+    explicit mpmc_queue(std::size_t capacity, const Allocator &alloc = Allocator());
+    mpmc_queue(const mpmc_queue &) = delete;
+    mpmc_queue &operator=(const mpmc_queue &) = delete;
+    ~mpmc_queue();
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] std::size_t capacity() const noexcept;
+    // Only a snapshot while other threads are pushing or popping
+    [[nodiscard]] std::size_t size_approx() const noexcept;
+    [[nodiscard]] bool empty_approx() const noexcept;
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    // Return false instead of blocking when the queue is full
+    bool try_push(const T &value);
+    bool try_push(T &&value);
+    template <typename... Args>
+    bool try_emplace(Args &&...args);
+
+    // Return false instead of blocking when the queue is empty
+    bool try_pop(T &out);
+
+    // Push up to count items from first with a single claim on the ring; returns how many were pushed.
+    // Constructing from *first must not throw: wrap copying iterators in std::make_move_iterator.
+    template <std::input_iterator InputIt>
+        requires std::is_nothrow_constructible_v<T, std::iter_reference_t<InputIt>>
+    std::size_t try_push_n(InputIt first, std::size_t count);
+
+    // Pop up to max_count items into out with a single claim on the ring; returns how many were popped.
+    // If writing to out throws, the rest of the claimed items are dropped before rethrowing.
+    template <typename OutputIt>
+    std::size_t try_pop_n(OutputIt out, std::size_t max_count);
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    static std::size_t round_up_capacity(std::size_t capacity) noexcept;
+};
+
+} // namespace mys
+
+#include "mpmc_queue.tpp"
\ No newline at end of file
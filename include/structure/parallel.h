@@ -0,0 +1,120 @@
+#pragma once
+
+#include <concepts>    // C++20: for requires
+#include <cstddef>     // for size_t
+#include <functional>  // for std::plus
+#include <utility>     // for std::declval
+#include <vector>      // for std::vector
+
+#include "thread_pool.h"
+
+// Parallel for_each / reduce / transform_reduce / count_if over node-based containers.
+//
+// A linked list cannot be split by index, so the work is cut into chunks of `grain` consecutive
+// elements. Threads claim chunks one at a time from a shared counter, which also balances chunks
+// whose elements cost different amounts of work.
+//
+// Finding where a chunk starts takes a walk over the links, and that walk is as latency bound as a
+// cheap fold itself. The container overloads overlap it with the work: the calling thread walks
+// ahead and publishes each chunk start, the other threads fold the chunks published so far, and the
+// caller joins them once the walk is done. A cheap operation over a list that is walked once is
+// therefore limited to about the speed of the walk; a list that is folded repeatedly should keep a
+// chunk_index, which takes the walk out of every call.
+//
+// Chunk boundaries depend only on the container and the grain, never on the number of threads, and
+// partial results are combined in chunk order starting from init. An associative operation therefore
+// gives the same result as the sequential fold, and even a non-associative one (floating point sums)
+// gives the same result for every thread count and every run.
+//
+// The calling thread works on the chunks itself; the other threads are tasks on a mys::thread_pool,
+// thread_pool::shared() unless options names another one.
+//
+// The functions call f / op / pred concurrently from several threads on distinct elements, so these
+// must be safe to call that way. An exception thrown by one of them stops the remaining chunks from
+// being started and is rethrown to the caller once all threads have finished.
+namespace mys::parallel {
+
+// Anything that can be walked from begin() to end() and knows its size up front
+template <typename Container>
+concept Partitionable = requires(Container &c) {
+    c.begin();
+    c.end();
+    { c.size() } -> std::convertible_to<std::size_t>;
+};
+
+struct options {
+    std::size_t threads = 0;      // 0 uses std::thread::hardware_concurrency(), the caller included
+    std::size_t grain = 4096;     // elements per chunk; large enough to amortise claiming a chunk
+    thread_pool *pool = nullptr;  // nullptr uses thread_pool::shared()
+};
+
+// Iterators to every grain-th element of a container, i.e. the chunk boundaries.
+//
+// Building it costs one walk over the links; every algorithm given the index then starts all threads
+// on their chunks at once. It does not have to be rebuilt after every change:
+// - the first chunk starts at the current begin() and the last one ends at the current end(), so
+//   elements pushed or popped at either end are picked up;
+// - the interior boundaries are ordinary iterators, so the index stays usable as long as they stay
+//   valid under the container's own invalidation rules. Elements inserted or erased between them only
+//   make the chunks uneven; call rebuild() to even them out again.
+// Erasing a boundary element, clear(), moving or swapping the container invalidates the index.
+template <Partitionable Container>
+class chunk_index {
+public:
+    using iterator = decltype(std::declval<Container &>().begin());
+
+private:
+    Container *container_;
+    std::size_t grain_;
+    std::vector<iterator> bounds_; // bounds_[i] is where chunk i + 1 starts
+
+public:
+    explicit chunk_index(Container &container, std::size_t grain = options{}.grain);
+
+    // Walk the container again and place a boundary at every grain-th element
+    void rebuild();
+
+    [[nodiscard]] std::size_t chunks() const noexcept;
+    [[nodiscard]] std::size_t grain() const noexcept;
+
+    // Chunk i is [chunk_begin(i), chunk_end(i)); it may be empty after the container changed
+    iterator chunk_begin(std::size_t i) const;
+    iterator chunk_end(std::size_t i) const;
+};
+
+// ===========================================================
+// Algorithms over a container (chunk starts are found while the chunks are processed)
+// ===========================================================
+
+template <Partitionable Container, typename F>
+void for_each(Container &container, F f, options opts = {});
+
+template <Partitionable Container, typename T, typename BinaryOp = std::plus<>>
+T reduce(const Container &container, T init, BinaryOp op = {}, options opts = {});
+
+template <Partitionable Container, typename T, typename BinaryOp, typename UnaryOp>
+T transform_reduce(const Container &container, T init, BinaryOp reduce_op, UnaryOp transform_op, options opts = {});
+
+template <Partitionable Container, typename Predicate>
+std::size_t count_if(const Container &container, Predicate pred, options opts = {});
+
+// ===========================================================
+// Algorithms over a prebuilt index (opts.grain is ignored, the index already fixes the chunks)
+// ===========================================================
+
+template <typename Container, typename F>
+void for_each(const chunk_index<Container> &index, F f, options opts = {});
+
+template <typename Container, typename T, typename BinaryOp = std::plus<>>
+T reduce(const chunk_index<Container> &index, T init, BinaryOp op = {}, options opts = {});
+
+template <typename Container, typename T, typename BinaryOp, typename UnaryOp>
+T transform_reduce(const chunk_index<Container> &index, T init, BinaryOp reduce_op, UnaryOp transform_op,
+                   options opts = {});
+
+template <typename Container, typename Predicate>
+std::size_t count_if(const chunk_index<Container> &index, Predicate pred, options opts = {});
+
+} // namespace mys::parallel
+
+#include "parallel.tpp"
\ No newline at end of file
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <atomic>           // for std::atomic
+#include <cstddef>          // for size_t
+#include <compare>          // C++20: for operator <=>
+#include <concepts>         // C++20: for requires
+#include <initializer_list> // for std::initializer_list
+#include <iterator>         // for std::forward_iterator_tag
+#include <memory>           // for std::allocator, std::allocator_traits
+#include <type_traits>      // for std::conditional_t
+#include <utility>          // for std::move, std::forward
+
+namespace mys {
+
+// Nodes are never modified once linked, so T only has to be destructible; it is never moved or assigned
+template <typename T>
+concept PersistentListable = std::destructible<T>;
+
+// Singly linked list with structural sharing: nodes are immutable and reference counted, and a list
+// object is just a handle on its first node. Copying a list bumps one count, so every copy is an O(1)
+// snapshot that later changes to the original cannot affect. push_front links a new node in front of
+// the shared chain and pop_front steps past it, both O(1), so versions derived from one another share
+// their common tail. A node's count is the number of lists and nodes pointing at it; when the last
+// one lets go the node is freed and its successor released in turn, in a loop, so dropping the last
+// handle on a long chain does not recurse.
+//
+// With AtomicRefCount = false the counts are plain integers and every version must stay on one
+// thread. With AtomicRefCount = true copies can be handed to other threads and copied, popped and
+// destroyed there concurrently (as with std::shared_ptr, a single list object still needs external
+// synchronization); the allocator must then be usable from those threads too.
+//
+// Allocators always travel with the nodes (copy, move and swap propagate them), since a shared node
+// is freed by whichever list drops it last. Other edits go through mys::forward_list.
+template <PersistentListable T, typename Allocator = std::allocator<T>, bool AtomicRefCount = false>
+class persistent_forward_list {
+private:
+    using RefCount = std::conditional_t<AtomicRefCount, std::atomic<std::size_t>, std::size_t>;
+
+    struct Node {
+        RefCount refs{1};
+        Node *next; // owns one count of next; only written before the node is shared
+        T val;
+
+        template <typename... Args>
+        explicit Node(Node *next, Args &&...args) : next(next), val(std::forward<Args>(args)...) {}
+    };
+
+    using NodeAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    [[no_unique_address]] NodeAlloc allocator_;
+
+    Node *head_ = nullptr; // owns one count
+    std::size_t length_ = 0;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using allocator_type = Allocator;
+
+    // ===========================================================
+    // 1. Iterator Implementation (forward and constant: nodes are immutable)
+    // ===========================================================
+    class PersistentListIterator {
+    private:
+        const Node *current_ = nullptr;
+
+        friend class persistent_forward_list;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using pointer = const T *;
+        using reference = const T &;
+        using difference_type = std::ptrdiff_t;
+
+        PersistentListIterator() = default;
+        explicit PersistentListIterator(const Node *node) : current_(node) {}
+
+        reference operator*() const { return current_->val; }
+        pointer operator->() const { return &current_->val; }
+
+        PersistentListIterator &operator++() {
+            current_ = current_->next;
+            return *this;
+        }
+        PersistentListIterator operator++(int) {
+            PersistentListIterator temp = *this;
+            current_ = current_->next;
+            return temp;
+        }
+
+        friend bool operator==(const PersistentListIterator &lhs, const PersistentListIterator &rhs) {
+            return lhs.current_ == rhs.current_;
+        }
+    };
+
+    using iterator = PersistentListIterator;
+    using const_iterator = PersistentListIterator;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    persistent_forward_list() = default;
+    explicit persistent_forward_list(const Allocator &alloc);
+    template <std::input_iterator InputIt>
+    persistent_forward_list(InputIt first, InputIt last, const Allocator &alloc = Allocator());
+    persistent_forward_list(std::initializer_list<T> init, const Allocator &alloc = Allocator());
+    // O(1): the copy shares every node
+    persistent_forward_list(const persistent_forward_list &other) noexcept;
+    persistent_forward_list(persistent_forward_list &&other) noexcept;
+    persistent_forward_list &operator=(const persistent_forward_list &other) noexcept;
+    persistent_forward_list &operator=(persistent_forward_list &&other) noexcept;
+    // Frees the nodes no other version holds, iteratively
+    ~persistent_forward_list();
+
+    // ===========================================================
+    // 3. Element Access
+    // ===========================================================
+
+    const T &front() const;
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    // ===========================================================
+    // 5. Modifiers (change this version only)
+    // ===========================================================
+
+    void clear() noexcept;
+    void swap(persistent_forward_list &other) noexcept;
+
+    void push_front(const T &value);
+    void push_front(T &&value);
+    template <typename... Args>
+    void emplace_front(Args &&...args);
+
+    // Frees the old first node only if no other version holds it; does nothing on an empty list
+    void pop_front();
+
+    // ===========================================================
+    // 6. Iterator Interface
+    // ===========================================================
+
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    // ===========================================================
+    // 7. Comparison Operators (C++20)
+    // ===========================================================
+
+    // Both stop as soon as the two lists reach a shared node, so comparing related versions only
+    // walks the part where they differ
+    bool operator==(const persistent_forward_list &other) const;
+    std::strong_ordering operator<=>(const persistent_forward_list &other) const;
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    allocator_type get_allocator() const noexcept { return allocator_type(allocator_); }
+
+    // Whether this list and other are the same version: they start at the same node (or are both
+    // empty), as a snapshot and its source do until either changes
+    [[nodiscard]] bool shares_with(const persistent_forward_list &other) const noexcept;
+
+    static void retain(Node *node) noexcept;
+    // Drop one count of node; each node whose count reaches zero is freed and its successor released
+    void release(Node *node) noexcept;
+    // Whether node's count can only be ours; acquires the effects of the versions that let it go
+    static bool unique(const Node *node) noexcept;
+
+    template <typename... Args>
+    Node *create_node(Node *next, Args &&...args);
+    void destroy_node(Node *node) noexcept;
+};
+
+// Shared snapshots with atomic counts, for handing versions to other threads
+template <PersistentListable T, typename Allocator = std::allocator<T>>
+using shared_persistent_forward_list = persistent_forward_list<T, Allocator, true>;
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+void swap(persistent_forward_list<T, Allocator, AtomicRefCount> &lhs, persistent_forward_list<T, Allocator, AtomicRefCount> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mys
+
+#include "persistent_forward_list.tpp"
\ No newline at end of file
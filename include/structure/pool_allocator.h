@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstddef>
+#include <concepts>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace mys {
+
+// 支持整体释放的分配器：release() 成功时一次性归还全部内存，调用者需保证其中已无存活对象
+template <typename Alloc>
+concept BulkReleasable = requires(Alloc &alloc) {
+    { alloc.release() } -> std::same_as<bool>;
+};
+
+namespace detail {
+
+// pool_allocator 的共享内存资源：同一资源上的所有分配器 (包括 rebind 得到的) 彼此相等，
+// 每种槽位规格 (大小, 对齐) 对应一个子池，子池创建后地址不变，直到资源析构
+template <std::size_t SlabSize>
+class pool_resource {
+private:
+    // 空闲槽位复用自身内存存放 next 指针
+    struct FreeSlot {
+        FreeSlot *next;
+    };
+
+    // 每个 slab 的头部，串成单链表以便整体释放
+    struct SlabHeader {
+        SlabHeader *next;
+    };
+
+public:
+    struct Pool {
+        std::size_t slot_size;
+        std::size_t slot_align;
+        Pool *next_pool = nullptr;
+        SlabHeader *slabs = nullptr;
+        FreeSlot *free_list = nullptr;
+        std::byte *cursor = nullptr; // 最新 slab 中尚未切分区域的起点
+        std::byte *limit = nullptr;
+
+        Pool(std::size_t size, std::size_t align) noexcept;
+        Pool(const Pool &) = delete;
+        Pool &operator=(const Pool &) = delete;
+        ~Pool();
+
+        void *take();
+        void give_back(void *ptr) noexcept;
+        void release_slabs() noexcept;
+        void add_slab();
+    };
+
+    // 槽位至少能放下空闲链表指针
+    static constexpr std::size_t min_slot_size() noexcept { return sizeof(FreeSlot); }
+    static constexpr std::size_t min_slot_align() noexcept { return alignof(FreeSlot); }
+
+    pool_resource() = default;
+    pool_resource(const pool_resource &) = delete;
+    pool_resource &operator=(const pool_resource &) = delete;
+    ~pool_resource();
+
+    // 已有的同规格子池，没有时返回 nullptr
+    Pool *find(std::size_t slot_size, std::size_t slot_align) const noexcept;
+    // 同规格子池，没有时创建
+    Pool *pool_for(std::size_t slot_size, std::size_t slot_align);
+    // 归还所有子池的全部 slab，子池本身保留
+    void release_all() noexcept;
+
+private:
+    Pool *pools_ = nullptr; // 通常只有一两个规格，线性查找
+};
+
+} // namespace detail
+
+// 固定大小的 slab 池分配器
+// - 单对象分配 (n == 1) 从 slab 中切分，释放后挂到侵入式空闲链表上复用
+// - 批量分配 (n > 1) 直接退回 std::allocator
+// - 每个实例构造时即持有一个共享资源；拷贝和 rebind 都共享它，因此彼此相等，
+//   任一拷贝都能释放另一拷贝分配的内存。不同元素类型各用资源里按槽位规格划分的子池
+// - 被移动后的分配器交出资源，下次分配时再新建
+template <typename T, std::size_t SlabSize = 4096>
+class pool_allocator {
+private:
+    using Resource = detail::pool_resource<SlabSize>;
+    using Pool = typename Resource::Pool;
+
+    template <typename U, std::size_t S>
+    friend class pool_allocator;
+
+    std::shared_ptr<Resource> resource_;
+    Pool *pool_ = nullptr; // resource_ 中本类型规格的子池，首次用到时查找
+
+    // 用函数而不是静态数据成员，避免在 T 尚不完整时求值 sizeof(T)
+    static constexpr std::size_t slot_align() noexcept {
+        return alignof(T) > Resource::min_slot_align() ? alignof(T) : Resource::min_slot_align();
+    }
+    static constexpr std::size_t slot_size() noexcept {
+        std::size_t n = sizeof(T) > Resource::min_slot_size() ? sizeof(T) : Resource::min_slot_size();
+        return (n + slot_align() - 1) / slot_align() * slot_align();
+    }
+
+    // 本类型规格的子池；不存在时返回 nullptr (create 为 false) 或创建
+    Pool *own_pool(bool create);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    // 容器移动/交换时池随节点一起转移；拷贝赋值保留自己的池
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    // SlabSize 是非类型参数，allocator_traits 无法自动 rebind
+    template <typename U>
+    struct rebind {
+        using other = pool_allocator<U, SlabSize>;
+    };
+
+    pool_allocator() : resource_(std::make_shared<Resource>()) {}
+    pool_allocator(const pool_allocator &other) noexcept = default;
+    pool_allocator(pool_allocator &&other) noexcept;
+    pool_allocator &operator=(const pool_allocator &other) noexcept = default;
+    pool_allocator &operator=(pool_allocator &&other) noexcept;
+    ~pool_allocator() = default;
+
+    // 共享 other 的资源，满足 A a(b); B(a) == b；子池按本类型的槽位规格另取
+    template <typename U>
+    pool_allocator(const pool_allocator<U, SlabSize> &other) noexcept : resource_(other.resource_) {}
+
+    [[nodiscard]] T *allocate(std::size_t n);
+    void deallocate(T *ptr, std::size_t n) noexcept;
+
+    // 拷贝构造容器时使用全新的池，避免两个容器的 release() 互相影响
+    pool_allocator select_on_container_copy_construction() const { return pool_allocator(); }
+
+    // 整体归还资源中全部 slab，O(slab 数量)
+    // 仅当资源只被当前分配器持有时生效，返回 false 表示调用者需要逐个释放
+    bool release() noexcept;
+
+    friend bool operator==(const pool_allocator &lhs, const pool_allocator &rhs) noexcept { return lhs.resource_ == rhs.resource_; }
+    // a == b 等价于 a == A(b)
+    template <typename U>
+    friend bool operator==(const pool_allocator &lhs, const pool_allocator<U, SlabSize> &rhs) noexcept {
+        return lhs == pool_allocator(rhs);
+    }
+};
+
+} // namespace mys
+
+#include "pool_allocator.tpp"
\ No newline at end of file
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstddef>          // for size_t
+#include <cstdint>          // for std::uint64_t
+#include <initializer_list> // for std::initializer_list
+#include <concepts>         // C++20: for requires
+#include <functional>       // for std::less
+#include <iterator>         // for std::forward_iterator_tag
+#include <memory>           // for std::allocator, std::allocator_traits
+#include <utility>          // for std::pair, std::move, std::forward
+
+namespace mys {
+
+template <typename Key, typename Compare>
+concept SkipListable = std::movable<Key> && std::destructible<Key> && std::strict_weak_order<const Compare &, const Key &, const Key &>;
+
+// Ordered set stored as a skip list (Pugh, "Skip Lists: A Probabilistic Alternative to Balanced
+// Trees", 1990), with expected O(log n) find, insert, erase and lower_bound.
+//
+// The links use forward_list's NodeBase idea, one NodeBase per level: a node's tower is an array of
+// height NodeBases, and a link always points at the bottom of the next tower, so level i of any tower
+// t is t[i]. The head sentinel is nothing but a full-height tower of its own. Each node is a single
+// allocation laid out as
+//
+//     [ Key | height | NodeBase x height ]
+//                      ^ node pointer
+//
+// so walking level 0 reads one link per node exactly like forward_list, and a node of height 1 is
+// as large as a forward_list node for small keys. Three of four nodes have height 1 (p = 1/4).
+//
+// Heights come from a xorshift generator owned by the list. It starts from a fixed seed and can be
+// reseeded, so a given sequence of operations always builds the same towers. Iterators are forward
+// and constant (elements are keys); erasing invalidates only iterators to the erased element.
+template <typename Key, typename Compare = std::less<Key>, typename Allocator = std::allocator<Key>>
+    requires SkipListable<Key, Compare>
+class skip_list {
+public:
+    static constexpr std::size_t max_height = 32;
+    static constexpr std::uint64_t default_seed = 0x9e3779b97f4a7c15ULL;
+
+private:
+    struct NodeBase {
+        NodeBase *next = nullptr;
+    };
+
+    // Storage unit of a node: aligned for both the key and the links
+    static constexpr std::size_t node_align = alignof(Key) > alignof(NodeBase) ? alignof(Key) : alignof(NodeBase);
+    struct alignas(node_align) Unit {
+        unsigned char bytes[node_align];
+    };
+    // Distance from the start of a node to its tower; the height byte sits right before the tower
+    static constexpr std::size_t tower_offset = (sizeof(Key) + 1 + alignof(NodeBase) - 1) / alignof(NodeBase) * alignof(NodeBase);
+
+    using UnitAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Unit>;
+    using KeyAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Key>;
+    [[no_unique_address]] UnitAlloc allocator_;
+    [[no_unique_address]] Compare comp_;
+
+    NodeBase head_[max_height];
+    std::size_t height_ = 1; // levels in use: no tower is taller, and head_[height_ - 1] is non-empty unless height_ == 1
+    std::size_t size_ = 0;
+    std::uint64_t rng_ = default_seed;
+
+public:
+    using key_type = Key;
+    using value_type = Key;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    // ===========================================================
+    // 1. Iterator Implementation (forward, walks level 0)
+    // ===========================================================
+    class SkipListIterator {
+    private:
+        const NodeBase *current_ = nullptr;
+
+        friend class skip_list;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Key;
+        using pointer = const Key *;
+        using reference = const Key &;
+        using difference_type = std::ptrdiff_t;
+
+        SkipListIterator() = default;
+        explicit SkipListIterator(const NodeBase *node) : current_(node) {}
+
+        reference operator*() const { return *key_of(current_); }
+        pointer operator->() const { return key_of(current_); }
+
+        SkipListIterator &operator++() {
+            current_ = current_->next;
+            return *this;
+        }
+        SkipListIterator operator++(int) {
+            SkipListIterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        friend bool operator==(const SkipListIterator &lhs, const SkipListIterator &rhs) { return lhs.current_ == rhs.current_; }
+    };
+
+    // Elements are keys, so as with std::set both iterators are constant
+    using iterator = SkipListIterator;
+    using const_iterator = SkipListIterator;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    skip_list() = default;
+    explicit skip_list(const Compare &comp, const Allocator &alloc = Allocator());
+    template <std::input_iterator InputIt>
+    skip_list(InputIt first, InputIt last, const Compare &comp = Compare(), const Allocator &alloc = Allocator());
+    skip_list(std::initializer_list<Key> init, const Compare &comp = Compare(), const Allocator &alloc = Allocator());
+    // Copies are built in O(n) by appending; they draw their heights from the copied generator state
+    skip_list(const skip_list &other);
+    skip_list(skip_list &&other) noexcept;
+    skip_list &operator=(const skip_list &other);
+    skip_list &operator=(skip_list &&other) noexcept;
+    ~skip_list();
+
+    // Restart the height generator; the same seed and operations give the same towers
+    void seed(std::uint64_t value) noexcept;
+
+    // ===========================================================
+    // 3. Lookup
+    // ===========================================================
+
+    iterator find(const Key &key) const;
+    [[nodiscard]] bool contains(const Key &key) const;
+    std::size_t count(const Key &key) const;
+
+    // First element not less than key / first element greater than key
+    iterator lower_bound(const Key &key) const;
+    iterator upper_bound(const Key &key) const;
+
+    const Key &front() const;
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+    // Height of the tallest tower (1 when empty); about log4(size()) on average
+    [[nodiscard]] std::size_t levels() const noexcept;
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    void clear() noexcept;
+    void swap(skip_list &other) noexcept;
+
+    std::pair<iterator, bool> insert(const Key &key);
+    std::pair<iterator, bool> insert(Key &&key);
+    template <std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last);
+    void insert(std::initializer_list<Key> init);
+    // The node is built before the search, so a duplicate costs one construction
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args &&...args);
+
+    // Return the element after pos
+    iterator erase(const_iterator pos);
+    std::size_t erase(const Key &key);
+
+    // ===========================================================
+    // 6. Iterator Interface
+    // ===========================================================
+
+    iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    // ===========================================================
+    // 7. Comparison Operations
+    // ===========================================================
+
+    bool operator==(const skip_list &other) const;
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    key_compare key_comp() const { return comp_; }
+    allocator_type get_allocator() const noexcept { return allocator_type(allocator_); }
+
+    static Key *key_of(NodeBase *node) noexcept { return reinterpret_cast<Key *>(reinterpret_cast<unsigned char *>(node) - tower_offset); }
+    static const Key *key_of(const NodeBase *node) noexcept {
+        return reinterpret_cast<const Key *>(reinterpret_cast<const unsigned char *>(node) - tower_offset);
+    }
+    static unsigned char &height_of(NodeBase *node) noexcept { return reinterpret_cast<unsigned char *>(node)[-1]; }
+    static std::size_t units_for(std::size_t height) noexcept;
+
+    // Height of a new tower: 1 + the number of trailing zero bit pairs of the next random word
+    std::size_t random_height() noexcept;
+
+    // Tower preceding the first element not less than key on each level below height_
+    void find_predecessors(const Key &key, NodeBase **update) const;
+    NodeBase *lower_bound_node(const Key &key) const;
+
+    template <typename... Args>
+    NodeBase *create_node(std::size_t height, Args &&...args);
+    void destroy_node(NodeBase *node) noexcept;
+    // Insert Key(key) unless an equivalent key is present; searches before allocating
+    template <typename K>
+    std::pair<iterator, bool> insert_unique(K &&key);
+    // Splice a node in after the predecessors found for its key
+    void link_node(NodeBase *node, NodeBase **update) noexcept;
+    // Append elements known to be sorted and unique in O(1) each; last holds the last tower per level
+    void append(const Key &key, NodeBase **last);
+    NodeBase *head() const noexcept { return const_cast<NodeBase *>(head_); }
+};
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+void swap(skip_list<Key, Compare, Allocator> &lhs, skip_list<Key, Compare, Allocator> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mys
+
+#include "skip_list.tpp"
\ No newline at end of file
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>          // for size_t
+#include <initializer_list> // for std::initializer_list
+#include <compare>          // C++20: for operator <=>
+#include <concepts>         // C++20: for requires
+#include <iterator>         // for std::contiguous_iterator_tag
+#include <memory>           // for std::allocator, std::allocator_traits
+#include <new>              // for std::launder
+#include <type_traits>      // for std::is_nothrow_move_constructible
+#include <utility>          // for std::move, std::forward
+
+#include "vector.h"
+
+namespace mys {
+
+// Vector with the first N elements stored inside the object itself: it only
+// touches the allocator once it outgrows the inline buffer.
+//
+// Element access, the modifiers and growth are shared with mys::vector
+// (detail::vector_storage); this class only owns the inline buffer.
+//
+// Moving a heap-backed small_vector steals the buffer, unless move assignment
+// meets an unequal allocator that does not propagate; moving an inline one
+// relocates at most N elements (a memcpy for trivially relocatable types).
+// Unlike mys::vector, swap and move of an inline small_vector therefore
+// invalidate iterators.
+template <Vectorable T, std::size_t N = 8, typename Allocator = std::allocator<T>>
+class small_vector : public detail::vector_storage<T, Allocator, small_vector<T, N, Allocator>> {
+    static_assert(N >= 1, "small_vector needs an inline capacity of at least one element");
+
+private:
+    using Base = detail::vector_storage<T, Allocator, small_vector>;
+    friend Base;
+
+    using typename Base::AllocTraits;
+    using Base::allocator_;
+    using Base::begin_;
+    using Base::end_;
+    using Base::cap_;
+
+    alignas(T) unsigned char buffer_[sizeof(T) * N];
+
+    // Move assignment adopts other's heap buffer only when the allocators allow it; otherwise it
+    // moves element by element and may allocate
+    static constexpr bool nothrow_move_assign =
+        std::is_nothrow_move_constructible_v<T> &&
+        (AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value);
+
+public:
+    static constexpr std::size_t inline_capacity = N;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    small_vector() noexcept { point_at_inline(); }
+    explicit small_vector(std::size_t count);
+    small_vector(std::size_t count, const T &value);
+    template <std::input_iterator InputIt>
+    small_vector(InputIt first, InputIt last);
+    small_vector(std::initializer_list<T> init);
+    small_vector(const small_vector &other);
+    small_vector(small_vector &&other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    small_vector &operator=(const small_vector &other);
+    small_vector &operator=(small_vector &&other) noexcept(nothrow_move_assign);
+    ~small_vector();
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    // True while the elements live in the inline buffer
+    [[nodiscard]] bool is_inline() const noexcept;
+    void shrink_to_fit();
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    void swap(small_vector &other) noexcept(nothrow_move_assign);
+
+private:
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    T *inline_data() noexcept { return std::launder(reinterpret_cast<T *>(buffer_)); }
+    const T *inline_data() const noexcept { return std::launder(reinterpret_cast<const T *>(buffer_)); }
+
+    // Point begin_/end_/cap_ at the empty inline buffer
+    void point_at_inline() noexcept;
+
+    // Move the elements into a buffer of new_cap elements (the inline one when new_cap <= N)
+    void reallocate(std::size_t new_cap);
+
+    // Return the heap buffer, if any; the inline buffer is never handed to the allocator
+    void release_buffer() noexcept;
+
+    // Return the heap buffer, if any, and point back at the (empty) inline buffer
+    void release_heap() noexcept;
+
+    // Take over other's elements, leaving other empty; *this must be empty and inline
+    void steal(small_vector &other);
+};
+
+// External swap function, for ADL (Argument Dependent Lookup)
+template <Vectorable T, std::size_t N, typename Allocator>
+void swap(small_vector<T, N, Allocator> &lhs, small_vector<T, N, Allocator> &rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+} // namespace mys
+
+#include "small_vector.tpp"
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>      // for std::atomic
+#include <cstddef>     // for size_t
+#include <concepts>    // C++20: for requires
+#include <memory>      // for std::allocator, std::allocator_traits
+#include <span>        // C++20: for std::span
+#include <utility>     // for std::move, std::forward
+
+namespace mys {
+
+template <typename T>
+concept RingStorable = std::movable<T> && std::default_initializable<T>;
+
+// Wait-free single-producer/single-consumer ring buffer.
+//
+// head_ (next slot to read) is written only by the consumer and tail_ (next slot to write) only
+// by the producer. Each side keeps a private copy of the other side's index and only reloads it
+// when the copy says the ring is full/empty, so in steady state neither side reads the other's
+// cache line.
+//
+// Every slot always holds a live T (default-constructed up front). Values are moved in and out by
+// assignment, which is what lets reserve()/peek() hand out plain spans over the slots: a stage
+// writes or reads a batch in place and then publishes it with commit()/release().
+//
+// Exactly one thread may call the producer operations (try_push, reserve, commit) and exactly one
+// thread the consumer operations (try_pop, peek, release).
+template <RingStorable T, typename Allocator = std::allocator<T>>
+class spsc_ring {
+public:
+    static constexpr std::size_t cache_line_size = 64;
+
+private:
+    using AllocTraits = std::allocator_traits<Allocator>;
+    [[no_unique_address]] Allocator allocator_;
+
+    T *slots_ = nullptr;
+    std::size_t mask_ = 0;
+
+    // Consumer side
+    alignas(cache_line_size) std::atomic<std::size_t> head_{0};
+    std::size_t cached_tail_ = 0;
+
+    // Producer side
+    alignas(cache_line_size) std::atomic<std::size_t> tail_{0};
+    std::size_t cached_head_ = 0;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    // capacity is rounded up to the next power of two (at least 2)
+    explicit spsc_ring(std::size_t capacity, const Allocator &alloc = Allocator());
+    spsc_ring(const spsc_ring &) = delete;
+    spsc_ring &operator=(const spsc_ring &) = delete;
+    ~spsc_ring();
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] std::size_t capacity() const noexcept;
+    [[nodiscard]] std::size_t size_approx() const noexcept;
+    [[nodiscard]] bool empty_approx() const noexcept;
+
+    // ===========================================================
+    // 5. Producer Operations
+    // ===========================================================
+
+    bool try_push(const T &value);
+    bool try_push(T &&value);
+
+    // Up to n writable slots at the tail, contiguous in memory (may be shorter than n at the wrap
+    // point or when the ring is nearly full; empty when full). Nothing is visible until commit().
+    std::span<T> reserve(std::size_t n);
+    // Publish the first n slots of the last reserve()
+    void commit(std::size_t n) noexcept;
+
+    // ===========================================================
+    // 6. Consumer Operations
+    // ===========================================================
+
+    bool try_pop(T &out);
+
+    // Up to n readable values at the head, contiguous in memory. Values may be moved from in place;
+    // the slots are handed back to the producer by release().
+    std::span<T> peek(std::size_t n);
+    // Give the first n slots of the last peek() back to the producer
+    void release(std::size_t n) noexcept;
+
+private:
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    // Shared body of both try_push overloads
+    template <typename U>
+    bool push_impl(U &&value);
+};
+
+} // namespace mys
+
+#include "spsc_ring.tpp"
\ No newline at end of file
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <atomic>      // for std::atomic
+#include <cstddef>     // for size_t
+#include <cstdint>     // for std::uint64_t
+#include <exception>   // for std::exception_ptr
+#include <memory>      // for std::unique_ptr
+#include <mutex>       // for std::mutex
+#include <thread>      // for std::jthread
+#include <type_traits> // for std::decay_t
+#include <utility>     // for std::forward
+#include <vector>      // for std::vector
+
+#include "deque.h"
+#include "ws_deque.h"
+
+namespace mys {
+
+// Fork/join thread pool with one mys::ws_deque per worker and randomised stealing.
+//
+// spawn() called on a worker pushes onto that worker's own deque, which it pops LIFO, so the most
+// recently forked (and smallest, hottest) task runs next; idle workers steal FIFO from a random victim
+// and so take the oldest, largest pieces. spawn() from any other thread goes through one
+// mutex-guarded injection queue, which is only on the path of the first fork of a computation.
+//
+// wait() on a worker does not block while there is work: it runs tasks, its own first, until the
+// group is done, so a worker waiting on its children usually just runs them itself. wait() on any
+// other thread only blocks: the tasks it ran would spawn through the FIFO injection queue and unfold
+// breadth first, nested on its stack. Idle workers and blocked waiters sleep on separate atomic
+// counters, and spawning or finishing a group only costs a wake-up syscall when somebody sleeps on
+// the matching one.
+//
+// A task_group counts the tasks spawned into it. It must be waited on before it is destroyed, and a
+// task must not outlive what it references, which wait() guarantees for captures from the caller's
+// frame. The first exception thrown by a task of the group is rethrown by wait(); the other tasks of
+// the group still run.
+//
+// The pool is neither copyable nor movable. Its destructor joins the workers; all groups must have
+// been waited on by then.
+class thread_pool {
+public:
+    class task_group {
+    private:
+        friend class thread_pool;
+
+        std::atomic<std::size_t> pending_{0};
+        std::atomic<bool> failed_{false};
+        std::exception_ptr error_; // written once by the task that set failed_
+
+    public:
+        task_group() = default;
+        task_group(const task_group &) = delete;
+        task_group &operator=(const task_group &) = delete;
+
+        [[nodiscard]] bool done() const noexcept { return pending_.load(std::memory_order_acquire) == 0; }
+    };
+
+private:
+    struct Task {
+        task_group *group;
+
+        explicit Task(task_group *g) noexcept : group(g) {}
+        virtual ~Task() = default;
+        virtual void run() = 0;
+    };
+
+    template <typename F>
+    struct TaskImpl final : Task {
+        F fn;
+
+        template <typename G>
+        TaskImpl(task_group *g, G &&f) : Task(g), fn(std::forward<G>(f)) {}
+        void run() override { fn(); }
+    };
+
+    static constexpr std::size_t cache_line_size = 64;
+
+    struct alignas(cache_line_size) Worker {
+        ws_deque<Task *> deque;
+    };
+
+    // Which pool and worker the calling thread is, and its xorshift state for picking victims
+    static inline thread_local const thread_pool *current_pool_ = nullptr;
+    static inline thread_local std::size_t current_index_ = 0;
+    static inline thread_local std::uint64_t rng_ = 0;
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    std::mutex injected_mutex_;
+    deque<Task *> injected_;
+    std::atomic<std::size_t> injected_size_{0}; // lets find_task skip the lock when nothing is injected
+
+    // Idle workers register in idle_ and sleep on work_epoch_, which spawn() bumps; threads blocked in
+    // wait() register in waiters_ and sleep on done_epoch_, which a group reaching zero bumps. Keeping
+    // them apart means spawning never pays for a wake-up nobody can use.
+    alignas(cache_line_size) std::atomic<std::uint64_t> work_epoch_{0};
+    std::atomic<std::size_t> idle_{0};
+    alignas(cache_line_size) std::atomic<std::uint64_t> done_epoch_{0};
+    std::atomic<std::size_t> waiters_{0};
+    std::atomic<bool> stop_{false};
+
+    std::vector<std::jthread> threads_;
+
+    static constexpr std::size_t no_worker = static_cast<std::size_t>(-1);
+
+public:
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    // threads == 0 uses std::thread::hardware_concurrency()
+    explicit thread_pool(std::size_t threads = 0);
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+    ~thread_pool();
+
+    // Process-wide pool backing mys::parallel; hardware_concurrency() - 1 workers (at least 1), since
+    // a thread running a parallel algorithm works on it alongside them
+    static thread_pool &shared();
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    // ===========================================================
+    // 5. Fork / Join
+    // ===========================================================
+
+    // Run f() on some thread of the pool as part of group
+    template <typename F>
+    void spawn(task_group &group, F &&f);
+
+    // Until every task of group has finished, run tasks (on a worker) or block (elsewhere); then
+    // rethrow the first exception among them
+    void wait(task_group &group);
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    // Index of the calling thread among this pool's workers, or no_worker
+    std::size_t current_worker() const noexcept;
+    // Own deque first, then the injection queue, then one pass over the other workers from a random one
+    Task *find_task(std::size_t self) noexcept;
+    static std::size_t random_index(std::size_t n) noexcept;
+    void execute(Task *task) noexcept;
+    // Wake sleepers registered in count on epoch, if there are any; notify_one or notify_all
+    static void wake(std::atomic<std::size_t> &count, std::atomic<std::uint64_t> &epoch, bool all) noexcept;
+    void worker_loop(std::size_t self);
+};
+
+} // namespace mys
+
+#include "thread_pool.tpp"
\ No newline at end of file
@@ -0,0 +1,367 @@
+#pragma once
+
+#include <bit>              // C++20: for std::countr_zero
+#include <cstddef>          // for size_t
+#include <cstdint>          // for int8_t, uint32_t
+#include <concepts>         // C++20: for requires
+#include <functional>       // for std::hash, std::equal_to
+#include <initializer_list> // for std::initializer_list
+#include <iterator>         // for std::forward_iterator_tag
+#include <memory>           // for std::allocator, std::allocator_traits
+#include <tuple>            // for std::forward_as_tuple
+#include <type_traits>      // for std::conditional_t
+#include <utility>          // for std::pair, std::move, std::forward
+
+// Define MYS_HASH_NO_SSE2 to force the portable group implementation on x86
+#if !defined(MYS_HASH_NO_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MYS_HASH_USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define MYS_HASH_USE_SSE2 0
+#endif
+
+namespace mys {
+
+namespace detail {
+
+// One control byte per slot. Empty and deleted have the high bit set; a full slot stores the low
+// 7 bits of its hash (H2). A sentinel after the last slot stops iteration.
+using ctrl_t = std::int8_t;
+inline constexpr ctrl_t ctrl_empty = -128;
+inline constexpr ctrl_t ctrl_deleted = -2;
+inline constexpr ctrl_t ctrl_sentinel = -1;
+
+// 16 consecutive control bytes, matched all at once. Bit i of each returned mask stands for slot i
+// of the group.
+class ControlGroup {
+public:
+    static constexpr std::size_t width = 16;
+
+#if MYS_HASH_USE_SSE2
+    explicit ControlGroup(const ctrl_t *ctrl) : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))) {}
+
+    std::uint32_t match(ctrl_t h2) const noexcept {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+    }
+    std::uint32_t match_empty() const noexcept { return match(ctrl_empty); }
+    // Empty and deleted are exactly the bytes with the sign bit set
+    std::uint32_t match_empty_or_deleted() const noexcept { return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_)); }
+
+private:
+    __m128i ctrl_;
+#else
+    explicit ControlGroup(const ctrl_t *ctrl) {
+        for (std::size_t i = 0; i < width; ++i) ctrl_[i] = ctrl[i];
+    }
+
+    std::uint32_t match(ctrl_t h2) const noexcept {
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < width; ++i) mask |= static_cast<std::uint32_t>(ctrl_[i] == h2) << i;
+        return mask;
+    }
+    std::uint32_t match_empty() const noexcept { return match(ctrl_empty); }
+    std::uint32_t match_empty_or_deleted() const noexcept {
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < width; ++i) mask |= static_cast<std::uint32_t>(ctrl_[i] < 0) << i;
+        return mask;
+    }
+
+private:
+    ctrl_t ctrl_[width];
+#endif
+};
+
+} // namespace detail
+
+// Hash and KeyEqual both opt into lookup by keys of other types
+template <typename Hash, typename KeyEqual>
+concept TransparentLookup = requires {
+    typename Hash::is_transparent;
+    typename KeyEqual::is_transparent;
+};
+
+// Open-addressing hash map with a separate control-byte array (the "Swiss table" layout).
+//
+// Slots live in one flat array; a parallel array holds one control byte per slot. Lookup hashes the
+// key once, uses the bits above the low 7 to pick a group of 16 slots and the low 7 (H2) as a tag:
+// one SIMD compare finds every slot in the group whose tag matches, so the keys themselves are only
+// touched for likely hits. Groups are probed quadratically until one contains an empty slot.
+//
+// Hash and KeyEqual follow std::unordered_map: any functor with size_t operator()(const Key &)
+// works, including hand-written combiners like the TupleHash in tips.md. The result is passed
+// through a bit mixer, so weak hashes such as std::hash<int> (the identity) are fine. If both
+// Hash and KeyEqual declare is_transparent, find/contains/count/erase accept any comparable key
+// type (e.g. std::string_view for std::string keys) without building a Key.
+//
+// Inserting may rehash, which invalidates all iterators, pointers and references; erasing only
+// invalidates those to the erased element. The table grows at 7/8 load.
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map {
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using allocator_type = Allocator;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+
+private:
+    using ctrl_t = detail::ctrl_t;
+    using Group = detail::ControlGroup;
+    using AllocTraits = std::allocator_traits<Allocator>;
+    using CtrlAlloc = typename AllocTraits::template rebind_alloc<ctrl_t>;
+    using CtrlTraits = std::allocator_traits<CtrlAlloc>;
+    using IndexAlloc = typename AllocTraits::template rebind_alloc<std::size_t>;
+    using IndexTraits = std::allocator_traits<IndexAlloc>;
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    [[no_unique_address]] Hash hash_;
+    [[no_unique_address]] KeyEqual equal_;
+    [[no_unique_address]] Allocator allocator_;
+
+    ctrl_t *ctrl_ = nullptr;        // capacity_ control bytes followed by the sentinel
+    value_type *slots_ = nullptr;
+    std::size_t capacity_ = 0;      // 0 or a power of two >= Group::width
+    std::size_t size_ = 0;
+    std::size_t growth_left_ = 0;   // insertions into empty slots before the next rehash
+
+public:
+    // ===========================================================
+    // 1. Iterator Implementation (forward iterator)
+    // ===========================================================
+    template <bool IsConst>
+    class HashIterator {
+    private:
+        using Ptr = std::conditional_t<IsConst, const std::pair<const Key, T> *, std::pair<const Key, T> *>;
+        const ctrl_t *ctrl_ = nullptr;
+        Ptr slot_ = nullptr;
+
+        friend class unordered_map;
+        friend class HashIterator<!IsConst>;
+
+        // Advance to the next full slot or the sentinel
+        void skip_free() {
+            while (*ctrl_ < detail::ctrl_sentinel) {
+                ++ctrl_;
+                ++slot_;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::pair<const Key, T>;
+        using pointer = Ptr;
+        using reference = std::conditional_t<IsConst, const value_type &, value_type &>;
+
+        HashIterator() = default;
+        HashIterator(const ctrl_t *ctrl, Ptr slot) : ctrl_(ctrl), slot_(slot) {}
+        HashIterator(const HashIterator &) = default;
+        HashIterator &operator=(const HashIterator &) = default;
+
+        HashIterator(const HashIterator<false> &other)
+            requires IsConst
+            : ctrl_(other.ctrl_), slot_(other.slot_) {}
+
+        reference operator*() const { return *slot_; }
+        pointer operator->() const { return slot_; }
+
+        HashIterator &operator++() {
+            ++ctrl_;
+            ++slot_;
+            skip_free();
+            return *this;
+        }
+        HashIterator operator++(int) {
+            HashIterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        friend bool operator==(const HashIterator &lhs, const HashIterator &rhs) { return lhs.ctrl_ == rhs.ctrl_; }
+    };
+
+    using iterator = HashIterator<false>;
+    using const_iterator = HashIterator<true>;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    unordered_map() = default;
+    explicit unordered_map(std::size_t bucket_count, const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual(),
+                           const Allocator &alloc = Allocator());
+    template <std::input_iterator InputIt>
+    unordered_map(InputIt first, InputIt last, std::size_t bucket_count = 0, const Hash &hash = Hash(),
+                  const KeyEqual &equal = KeyEqual(), const Allocator &alloc = Allocator());
+    unordered_map(std::initializer_list<value_type> init, std::size_t bucket_count = 0, const Hash &hash = Hash(),
+                  const KeyEqual &equal = KeyEqual(), const Allocator &alloc = Allocator());
+    unordered_map(const unordered_map &other);
+    unordered_map(unordered_map &&other) noexcept;
+    unordered_map &operator=(const unordered_map &other);
+    unordered_map &operator=(unordered_map &&other) noexcept;
+    ~unordered_map();
+
+    // ===========================================================
+    // 3. Element Access and Lookup
+    // ===========================================================
+
+    template <typename Self>
+    auto &&at(this Self &&self, const Key &key);
+    T &operator[](const Key &key);
+    T &operator[](Key &&key);
+
+    template <typename Self>
+    auto find(this Self &&self, const Key &key);
+    template <typename K>
+        requires TransparentLookup<Hash, KeyEqual>
+    iterator find(const K &key);
+    template <typename K>
+        requires TransparentLookup<Hash, KeyEqual>
+    const_iterator find(const K &key) const;
+
+    [[nodiscard]] bool contains(const Key &key) const;
+    template <typename K>
+        requires TransparentLookup<Hash, KeyEqual>
+    [[nodiscard]] bool contains(const K &key) const;
+
+    std::size_t count(const Key &key) const;
+    template <typename K>
+        requires TransparentLookup<Hash, KeyEqual>
+    std::size_t count(const K &key) const;
+
+    // ===========================================================
+    // 4. Capacity Query and Bucket Interface
+    // ===========================================================
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] std::size_t max_size() const noexcept;
+
+    // Number of slots
+    [[nodiscard]] std::size_t bucket_count() const noexcept;
+    [[nodiscard]] float load_factor() const noexcept;
+    [[nodiscard]] float max_load_factor() const noexcept { return 0.875f; }
+
+    // Rebuild the table with at least count slots (fewer if count cannot hold size()); also drops
+    // all tombstones left by erase()
+    void rehash(std::size_t count);
+    // Make room for count elements without further rehashing
+    void reserve(std::size_t count);
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    void clear() noexcept;
+    void swap(unordered_map &other) noexcept;
+
+    std::pair<iterator, bool> insert(const value_type &value);
+    std::pair<iterator, bool> insert(value_type &&value);
+    template <typename P>
+        requires std::constructible_from<value_type, P &&>
+    std::pair<iterator, bool> insert(P &&value);
+    template <std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last);
+    void insert(std::initializer_list<value_type> ilist);
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key &key, M &&obj);
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(Key &&key, M &&obj);
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args &&...args);
+
+    // Construct the mapped value only if key is absent; key is moved only on insertion
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+
+    iterator erase(iterator pos);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    std::size_t erase(const Key &key);
+    template <typename K>
+        requires TransparentLookup<Hash, KeyEqual> && (!std::convertible_to<K, iterator>) && (!std::convertible_to<K, const_iterator>)
+    std::size_t erase(K &&key);
+
+    // ===========================================================
+    // 6. Iterator Interface
+    // ===========================================================
+
+    template <typename Self>
+    auto begin(this Self &&self) noexcept;
+    const_iterator cbegin() const noexcept;
+
+    template <typename Self>
+    auto end(this Self &&self) noexcept;
+    const_iterator cend() const noexcept;
+
+    // ===========================================================
+    // 7. Comparison Operations
+    // ===========================================================
+
+    bool operator==(const unordered_map &other) const;
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    hasher hash_function() const { return hash_; }
+    key_equal key_eq() const { return equal_; }
+    allocator_type get_allocator() const noexcept { return allocator_; }
+
+    // Hash passed through a 64-bit finalizer: low 7 bits are H2, the bits above them pick the first group
+    template <typename K>
+    std::size_t hash_of(const K &key) const;
+    static ctrl_t h2(std::size_t hash) noexcept { return static_cast<ctrl_t>(hash & 0x7F); }
+
+    // Smallest valid capacity that holds count elements below the maximum load
+    static std::size_t capacity_for(std::size_t count) noexcept;
+    static std::size_t max_load(std::size_t capacity) noexcept { return capacity - capacity / 8; }
+
+    // Index of the slot holding key, or npos
+    template <typename K>
+    std::size_t find_index(const K &key, std::size_t hash) const;
+
+    // Index of key if present ({index, true}); otherwise a free slot where it can be constructed
+    // ({index, false}), rehashing first if the table is out of room
+    template <typename K>
+    std::pair<std::size_t, bool> find_or_prepare_insert(const K &key, std::size_t hash);
+
+    // First empty or deleted slot on the probe sequence of hash
+    std::size_t find_first_free(std::size_t hash) const noexcept;
+
+    // Look key up and, if absent, construct value_type(args...) in its slot
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> emplace_key(const K &key, std::size_t hash, Args &&...args);
+
+    // Mark slot index as holding an element with the given hash
+    void set_full(std::size_t index, std::size_t hash) noexcept;
+    void erase_at(std::size_t index) noexcept;
+
+    // Grow, or rebuild in place when most of the used space is tombstones
+    void rehash_for_insert();
+    // Move every element into a fresh table of new_capacity slots
+    void resize(std::size_t new_capacity);
+    void destroy_and_deallocate() noexcept;
+
+    iterator iterator_at(std::size_t index) noexcept { return iterator(ctrl_ + index, slots_ + index); }
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void swap(unordered_map<Key, T, Hash, KeyEqual, Allocator> &lhs, unordered_map<Key, T, Hash, KeyEqual, Allocator> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mys
+
+#include "unordered_map.tpp"
\ No newline at end of file
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cstddef>          // for size_t
+#include <initializer_list> // for std::initializer_list
+#include <compare>          // C++20: for operator <=>
+#include <concepts>         // C++20: for requires
+#include <iterator>         // for std::bidirectional_iterator_tag
+#include <memory>           // for std::allocator
+#include <new>              // for std::launder
+#include <utility>          // for std::move, std::forward
+
+#include "list.h"
+
+namespace mys {
+
+// Unrolled linked list: every node stores up to N elements in an inline array,
+// so a scan touches one cache line per handful of elements instead of one per element.
+//
+// Iterator invalidation: insert/emplace may split a full node and erase may merge
+// neighbouring nodes, so both invalidate iterators into the affected node and its
+// neighbours. Iterators into other nodes stay valid.
+template <Listable T, std::size_t N = 16, typename Allocator = std::allocator<T>>
+class unrolled_list {
+    static_assert(N >= 2, "unrolled_list needs room for at least two elements per node");
+
+private:
+    // Internal node structure: raw storage, only [0, count) is constructed
+    struct Node {
+        Node *prev = nullptr;
+        Node *next = nullptr;
+        std::size_t count = 0;
+        alignas(T) unsigned char storage[sizeof(T) * N];
+
+        // User-provided so that storage is left uninitialized instead of zero-filled
+        Node() noexcept {}
+
+        T *slot(std::size_t i) noexcept { return std::launder(reinterpret_cast<T *>(storage + i * sizeof(T))); }
+        const T *slot(std::size_t i) const noexcept { return std::launder(reinterpret_cast<const T *>(storage + i * sizeof(T))); }
+    };
+
+    using NodeAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    [[no_unique_address]] NodeAlloc allocator_;
+
+    Node *head = nullptr;
+    Node *tail = nullptr;
+    std::size_t length = 0;
+
+    // A node whose count drops below this is merged with a neighbour when they fit together
+    static constexpr std::size_t min_fill = N / 2;
+
+public:
+    // ===========================================================
+    // 1. Iterator Implementation
+    // ===========================================================
+    template <bool IsConst>
+    class UnrolledListIterator {
+    private:
+        using NodePtr = std::conditional_t<IsConst, const Node *, Node *>;
+        NodePtr current_ = nullptr;
+        std::size_t index_ = 0;
+        const unrolled_list *list_ = nullptr;
+
+        friend class unrolled_list;
+        friend class UnrolledListIterator<!IsConst>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        UnrolledListIterator() = default;
+        explicit UnrolledListIterator(NodePtr node, std::size_t index, const unrolled_list *l = nullptr) : current_(node), index_(index), list_(l) {}
+        UnrolledListIterator(const UnrolledListIterator &) = default;
+
+        UnrolledListIterator(const UnrolledListIterator<false> &other)
+            requires IsConst
+            : current_(other.current_), index_(other.index_), list_(other.list_) {}
+
+        reference operator*() const { return *current_->slot(index_); }
+
+        pointer operator->() const { return current_->slot(index_); }
+
+        UnrolledListIterator &operator++() {
+            if (current_ && ++index_ == current_->count) {
+                current_ = current_->next;
+                index_ = 0;
+            }
+            return *this;
+        }
+
+        UnrolledListIterator operator++(int) {
+            UnrolledListIterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        UnrolledListIterator &operator--() {
+            if (current_ == nullptr) {
+                if (list_ && list_->tail) {
+                    current_ = list_->tail;
+                    index_ = current_->count - 1;
+                }
+            } else if (index_ == 0) {
+                current_ = current_->prev;
+                if (current_) index_ = current_->count - 1;
+            } else {
+                --index_;
+            }
+            return *this;
+        }
+
+        UnrolledListIterator operator--(int) {
+            UnrolledListIterator temp = *this;
+            --(*this);
+            return temp;
+        }
+
+        friend bool operator==(const UnrolledListIterator &lhs, const UnrolledListIterator &rhs) {
+            return lhs.current_ == rhs.current_ && lhs.index_ == rhs.index_;
+        }
+    };
+
+    using iterator = UnrolledListIterator<false>;
+    using const_iterator = UnrolledListIterator<true>;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    unrolled_list() = default;
+    unrolled_list(std::initializer_list<T> init);
+    unrolled_list(const unrolled_list &other);
+    unrolled_list(unrolled_list &&other) noexcept;
+    unrolled_list &operator=(const unrolled_list &other);
+    unrolled_list &operator=(unrolled_list &&other) noexcept;
+    ~unrolled_list();
+
+    // ===========================================================
+    // 3. Element Access
+    // ===========================================================
+
+    template <typename Self>
+    auto &&front(this Self &&self);
+    template <typename Self>
+    auto &&back(this Self &&self);
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    void clear() noexcept;
+    void swap(unrolled_list &other) noexcept;
+
+    void push_back(const T &value);
+    void push_back(T &&value);
+    void push_front(const T &value);
+    void push_front(T &&value);
+
+    template <typename... Args>
+    void emplace_back(Args &&...args);
+    template <typename... Args>
+    void emplace_front(Args &&...args);
+
+    void pop_back();
+    void pop_front();
+
+    iterator insert(const_iterator pos, const T &value);
+    iterator insert(const_iterator pos, T &&value);
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&...args);
+
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+
+    // ===========================================================
+    // 6. Iterator Interface
+    // ===========================================================
+
+    template <typename Self>
+    auto begin(this Self &&self) noexcept;
+    const_iterator cbegin() const noexcept;
+
+    template <typename Self>
+    auto end(this Self &&self) noexcept;
+    const_iterator cend() const noexcept;
+
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    template <typename Self>
+    auto rbegin(this Self &&self) noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    template <typename Self>
+    auto rend(this Self &&self) noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    // ===========================================================
+    // 7. C++20 Comparison Operations (Spaceship Operator)
+    // ===========================================================
+
+    std::strong_ordering operator<=>(const unrolled_list &other) const;
+    bool operator==(const unrolled_list &other) const;
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    Node *create_node();
+    void destroy_node(Node *ptr) noexcept;
+
+    // Link a fresh empty node after pos (nullptr means at the front)
+    Node *link_node_after(Node *pos);
+    void unlink_node(Node *node) noexcept;
+
+    // Move the upper half of a full node into a new successor node
+    Node *split_node(Node *node);
+    // Move every element of src to the end of dst and free src
+    void absorb_node(Node *dst, Node *src);
+
+    // Construct value at index of a node that has room, shifting the tail right
+    template <typename... Args>
+    void insert_into_node(Node *node, std::size_t index, Args &&...args);
+    // Link a fresh node after pos holding just the new value; if construction throws the node is freed
+    template <typename... Args>
+    Node *emplace_in_new_node(Node *pos, Args &&...args);
+
+    iterator make_iterator(Node *node, std::size_t index) noexcept;
+};
+
+// External swap function, for ADL (Argument Dependent Lookup)
+template <Listable T, std::size_t N>
+void swap(unrolled_list<T, N> &lhs, unrolled_list<T, N> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mys
+
+#include "unrolled_list.tpp"
\ No newline at end of file
@@ -0,0 +1,307 @@
+#pragma once
+
+#include <cstddef>          // for size_t
+#include <initializer_list> // for std::initializer_list
+#include <compare>          // C++20: for operator <=>
+#include <concepts>         // C++20: for requires
+#include <iterator>         // for std::contiguous_iterator_tag
+#include <memory>           // for std::allocator, std::allocator_traits
+#include <type_traits>      // for std::is_trivially_copyable
+#include <utility>          // for std::move, std::forward
+
+namespace mys {
+
+template <typename T>
+concept Vectorable = std::movable<T> && std::destructible<T>;
+
+// Opt-in trait: a type is trivially relocatable when moving it to a new address and
+// ending the lifetime of the source is equivalent to a memcpy of its bytes.
+// Trivially copyable types qualify automatically; others may specialize this trait,
+// e.g. a heap-only string that holds nothing but a pointer and a size.
+// Types holding pointers into themselves (such as std::string with SSO) must not opt in.
+template <typename T>
+struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+namespace detail {
+
+// What vector and small_vector have in common: elements in [begin_, end_) of a buffer that ends
+// at cap_, element access, the modifiers and the relocation helpers behind them. Derived only
+// decides where buffers come from and go to: it provides reallocate(new_cap) for reserve(), and
+// release_buffer() to hand back the current buffer unless it does not own it (small_vector's
+// inline storage).
+template <Vectorable T, typename Allocator, typename Derived>
+class vector_storage {
+protected:
+    using AllocTraits = std::allocator_traits<Allocator>;
+    [[no_unique_address]] Allocator allocator_;
+
+    T *begin_ = nullptr;
+    T *end_ = nullptr;
+    T *cap_ = nullptr;
+
+    vector_storage() = default;
+    explicit vector_storage(const Allocator &alloc) noexcept : allocator_(alloc) {}
+    explicit vector_storage(Allocator &&alloc) noexcept : allocator_(std::move(alloc)) {}
+    ~vector_storage() = default;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+
+    // ===========================================================
+    // 1. Iterator Implementation (C++20 contiguous iterator)
+    // ===========================================================
+    template <bool IsConst>
+    class VectorIterator {
+    private:
+        using Ptr = std::conditional_t<IsConst, const T *, T *>;
+        Ptr current_ = nullptr;
+
+        friend class vector_storage;
+        friend class VectorIterator<!IsConst>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::contiguous_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = Ptr;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        VectorIterator() = default;
+        explicit VectorIterator(Ptr ptr) : current_(ptr) {}
+        VectorIterator(const VectorIterator &) = default;
+        VectorIterator &operator=(const VectorIterator &) = default;
+
+        VectorIterator(const VectorIterator<false> &other)
+            requires IsConst
+            : current_(other.current_) {}
+
+        reference operator*() const { return *current_; }
+        pointer operator->() const { return current_; }
+        reference operator[](difference_type n) const { return current_[n]; }
+
+        VectorIterator &operator++() {
+            ++current_;
+            return *this;
+        }
+        VectorIterator operator++(int) {
+            VectorIterator temp = *this;
+            ++current_;
+            return temp;
+        }
+        VectorIterator &operator--() {
+            --current_;
+            return *this;
+        }
+        VectorIterator operator--(int) {
+            VectorIterator temp = *this;
+            --current_;
+            return temp;
+        }
+
+        VectorIterator &operator+=(difference_type n) {
+            current_ += n;
+            return *this;
+        }
+        VectorIterator &operator-=(difference_type n) {
+            current_ -= n;
+            return *this;
+        }
+
+        friend VectorIterator operator+(VectorIterator it, difference_type n) { return it += n; }
+        friend VectorIterator operator+(difference_type n, VectorIterator it) { return it += n; }
+        friend VectorIterator operator-(VectorIterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const VectorIterator &lhs, const VectorIterator &rhs) { return lhs.current_ - rhs.current_; }
+
+        friend bool operator==(const VectorIterator &lhs, const VectorIterator &rhs) { return lhs.current_ == rhs.current_; }
+        friend std::strong_ordering operator<=>(const VectorIterator &lhs, const VectorIterator &rhs) { return lhs.current_ <=> rhs.current_; }
+    };
+
+    using iterator = VectorIterator<false>;
+    using const_iterator = VectorIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // ===========================================================
+    // 3. Element Access
+    // ===========================================================
+
+    template <typename Self>
+    auto &&at(this Self &&self, std::size_t index);
+    template <typename Self>
+    auto &&operator[](this Self &&self, std::size_t index);
+    template <typename Self>
+    auto &&front(this Self &&self);
+    template <typename Self>
+    auto &&back(this Self &&self);
+    template <typename Self>
+    auto data(this Self &&self) noexcept;
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] std::size_t capacity() const noexcept;
+    [[nodiscard]] std::size_t max_size() const noexcept;
+    void reserve(std::size_t new_cap);
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    void clear() noexcept;
+
+    void push_back(const T &value);
+    void push_back(T &&value);
+
+    template <typename... Args>
+    T &emplace_back(Args &&...args);
+
+    void pop_back();
+
+    iterator insert(const_iterator pos, const T &value);
+    iterator insert(const_iterator pos, T &&value);
+    iterator insert(const_iterator pos, std::size_t count, const T &value);
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&...args);
+
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+
+    void resize(std::size_t count);
+    void resize(std::size_t count, const T &value);
+
+    // ===========================================================
+    // 6. Iterator Interface
+    // ===========================================================
+
+    template <typename Self>
+    auto begin(this Self &&self) noexcept;
+    const_iterator cbegin() const noexcept;
+
+    template <typename Self>
+    auto end(this Self &&self) noexcept;
+    const_iterator cend() const noexcept;
+
+    template <typename Self>
+    auto rbegin(this Self &&self) noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    template <typename Self>
+    auto rend(this Self &&self) noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    // ===========================================================
+    // 7. C++20 Comparison Operations (Spaceship Operator)
+    // ===========================================================
+
+    std::strong_ordering operator<=>(const Derived &other) const;
+    bool operator==(const Derived &other) const;
+
+protected:
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    Derived &derived() noexcept { return static_cast<Derived &>(*this); }
+
+    // Capacity to grow to when at least min_cap elements must fit
+    std::size_t next_capacity(std::size_t min_cap) const noexcept;
+
+    // Move [first, last) into uninitialized dest and end the lifetime of the source:
+    // a single memcpy for trivially relocatable types, move (or copy) + destroy otherwise
+    void relocate(T *first, T *last, T *dest);
+
+    // Release the current buffer through Derived and take new_begin, holding count elements, in its place
+    void adopt_buffer(T *new_begin, std::size_t count, std::size_t new_cap) noexcept;
+
+    // Build the new element in a fresh, larger heap buffer and relocate the rest around it
+    template <typename... Args>
+    T *realloc_insert(T *pos, Args &&...args);
+
+    // Move assignment when other's buffer may not be adopted (the allocators differ and do not
+    // propagate): move the elements over one by one and leave other empty
+    void move_elements_from(Derived &other);
+
+    void destroy_range(T *first, T *last) noexcept;
+    T *to_pointer(const_iterator it) noexcept { return const_cast<T *>(it.current_); }
+};
+
+} // namespace detail
+
+template <Vectorable T, typename Allocator = std::allocator<T>>
+class vector : public detail::vector_storage<T, Allocator, vector<T, Allocator>> {
+private:
+    using Base = detail::vector_storage<T, Allocator, vector>;
+    friend Base;
+
+    using typename Base::AllocTraits;
+    using Base::allocator_;
+    using Base::begin_;
+    using Base::end_;
+    using Base::cap_;
+
+    static constexpr bool nothrow_move_assign =
+        AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value;
+
+public:
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    vector() = default;
+    explicit vector(std::size_t count);
+    vector(std::size_t count, const T &value);
+    template <std::input_iterator InputIt>
+    vector(InputIt first, InputIt last);
+    vector(std::initializer_list<T> init);
+    vector(const vector &other);
+    vector(vector &&other) noexcept;
+    vector &operator=(const vector &other);
+    vector &operator=(vector &&other) noexcept(nothrow_move_assign);
+    ~vector();
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    void shrink_to_fit();
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    void swap(vector &other) noexcept;
+
+private:
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    // Swap in a new buffer of new_cap elements, relocating the current elements into it
+    void reallocate(std::size_t new_cap);
+
+    void release_buffer() noexcept;
+};
+
+// External swap function, for ADL (Argument Dependent Lookup)
+template <Vectorable T, typename Allocator>
+void swap(vector<T, Allocator> &lhs, vector<T, Allocator> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mys
+
+#include "vector.tpp"
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>      // for std::atomic
+#include <cstddef>     // for size_t, ptrdiff_t
+#include <concepts>    // C++20: for requires
+#include <memory>      // for std::allocator, std::allocator_traits
+#include <type_traits> // for std::is_trivially_copyable
+
+namespace mys {
+
+// A thief reads a value before its CAS decides whether the value is its to take, and a losing thief
+// simply drops what it read. That is only sound for values that can be copied bit by bit, so slots
+// are std::atomic<T>; in practice T is a pointer or an index to the actual work.
+template <typename T>
+concept Stealable = std::is_trivially_copyable_v<T> && std::default_initializable<T>;
+
+// Chase-Lev work-stealing deque with the memory orders of Lê, Pop, Cohen and Zappa Nardelli
+// ("Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+//
+// One owner thread pushes and pops at the bottom, LIFO, so recursively spawned work is taken back
+// while it is still hot in cache; only taking the very last element costs a CAS. Any number of
+// thieves take from the top, FIFO, with one CAS each, and so take the oldest and usually largest
+// pieces of work.
+//
+// The ring grows by doubling when the owner pushes onto a full one. A thief may still be reading the
+// old ring, so retired rings are kept until the deque is destroyed; together they are smaller than
+// the current ring. The deque never shrinks.
+//
+// The deque is neither copyable nor movable: other threads hold references into it.
+template <Stealable T, typename Allocator = std::allocator<T>>
+class ws_deque {
+public:
+    static constexpr std::size_t cache_line_size = 64;
+
+private:
+    struct Ring {
+        std::size_t mask;
+        std::atomic<T> *slots;
+        Ring *retired; // the ring this one replaced
+
+        T get(std::ptrdiff_t i) const noexcept { return slots[static_cast<std::size_t>(i) & mask].load(std::memory_order_relaxed); }
+        void put(std::ptrdiff_t i, T value) noexcept { slots[static_cast<std::size_t>(i) & mask].store(value, std::memory_order_relaxed); }
+    };
+
+    using RingAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Ring>;
+    using SlotAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<std::atomic<T>>;
+    [[no_unique_address]] RingAlloc ring_allocator_;
+    [[no_unique_address]] SlotAlloc slot_allocator_;
+
+    // top_ is advanced by thieves (and by the owner for the last element), bottom_ only by the owner
+    alignas(cache_line_size) std::atomic<std::ptrdiff_t> top_{0};
+    alignas(cache_line_size) std::atomic<std::ptrdiff_t> bottom_{0};
+    std::atomic<Ring *> ring_{nullptr};
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    // capacity is rounded up to the next power of two (at least 2); the ring grows past it on demand
+    explicit ws_deque(std::size_t capacity = 64, const Allocator &alloc = Allocator());
+    ws_deque(const ws_deque &) = delete;
+    ws_deque &operator=(const ws_deque &) = delete;
+    ~ws_deque();
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    // Exact on the owner thread, a snapshot elsewhere
+    [[nodiscard]] std::size_t capacity() const noexcept;
+    [[nodiscard]] std::size_t size_approx() const noexcept;
+    [[nodiscard]] bool empty_approx() const noexcept;
+
+    // ===========================================================
+    // 5. Owner Operations (one thread only)
+    // ===========================================================
+
+    // Never fails; grows the ring when it is full
+    void push(T value);
+
+    // Take the most recently pushed value; false when the deque is empty
+    bool try_pop(T &out) noexcept;
+
+    // ===========================================================
+    // 6. Thief Operations (any thread)
+    // ===========================================================
+
+    // Take the oldest value; false when the deque is empty or another thread took that value first.
+    // A thief that loses a race should move on to another victim rather than spin on this one.
+    bool try_steal(T &out) noexcept;
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    Ring *allocate_ring(std::size_t capacity);
+    void deallocate_ring(Ring *ring) noexcept;
+    // Copy the live range [top, bottom) into a ring twice as large and publish it
+    Ring *grow(Ring *ring, std::ptrdiff_t top, std::ptrdiff_t bottom);
+};
+
+} // namespace mys
+
+#include "ws_deque.tpp"
\ No newline at end of file
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <compare>          // C++20: for operator <=>
+#include <concepts>         // C++20: for requires
+#include <cstddef>          // for size_t
+#include <cstdint>          // for std::uintptr_t
+#include <initializer_list> // for std::initializer_list
+#include <iterator>         // for std::bidirectional_iterator_tag
+#include <memory>           // for std::allocator
+#include <type_traits>      // for std::conditional_t
+#include <utility>          // for std::move, std::forward
+
+#include "pool_allocator.h"
+
+namespace mys {
+
+template <typename T>
+concept XorListable = std::movable<T> && std::destructible<T>;
+
+// Doubly linked list whose nodes store the XOR of the prev and next addresses in one word, halving
+// the per-node link overhead of mys::list. It can be traversed from either end, and push/pop at both
+// ends as well as insert/erase through an iterator are O(1).
+//
+// A node alone does not know its neighbours, which changes what an iterator is and what stays O(1):
+// - an iterator holds the pair (prev, current), so besides erasing its element, inserting or erasing
+//   the element right before it also invalidates it;
+// - there is no iterator_to() or erase(const T &): getting from an element to its position, and so
+//   erasing or inserting next to an element known only by reference, is an O(n) walk from an end;
+// - reverse() is O(1): a link word reads the same in both directions, only head and tail swap.
+//
+// The saving shows only when the allocator does not round nodes up. glibc malloc hands out 32 bytes
+// for both a 16-byte xor_list<int> node and a 24-byte list<int> node; mys::pool_allocator slots are
+// exactly sizeof(Node), so use it when many small elements stay resident.
+template <XorListable T, typename Allocator = std::allocator<T>>
+class xor_list {
+private:
+    struct Node {
+        std::uintptr_t link = 0; // address of prev ^ address of next, a missing neighbour counts as 0
+        T val;
+
+        template <typename... Args>
+        Node(Args &&...args) : val(std::forward<Args>(args)...) {}
+    };
+
+    using NodeAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    [[no_unique_address]] NodeAlloc allocator_;
+
+    // Whether move assignment may always adopt other's nodes: their allocator either moves with them
+    // or is known to compare equal. If not, unequal allocators force an element-wise (throwing) move
+    static constexpr bool nothrow_move_assign = std::allocator_traits<NodeAlloc>::propagate_on_container_move_assignment::value ||
+                                                std::allocator_traits<NodeAlloc>::is_always_equal::value;
+
+    Node *head = nullptr;
+    Node *tail = nullptr;
+    std::size_t length = 0;
+
+    static std::uintptr_t address(const Node *node) noexcept { return reinterpret_cast<std::uintptr_t>(node); }
+
+    // The neighbour of node on the side opposite to other
+    static Node *neighbour(const Node *node, const Node *other) noexcept {
+        return reinterpret_cast<Node *>(node->link ^ address(other));
+    }
+
+public:
+    // ===========================================================
+    // 1. Iterator Implementation
+    // ===========================================================
+    template <bool IsConst>
+    class XorIterator {
+    private:
+        using NodePtr = std::conditional_t<IsConst, const Node *, Node *>;
+        // Decoding current_->link needs the node we came from; end() is (tail, nullptr)
+        NodePtr prev_ = nullptr;
+        NodePtr current_ = nullptr;
+
+        friend class xor_list;
+        friend class XorIterator<!IsConst>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        XorIterator() = default;
+        XorIterator(NodePtr prev, NodePtr current) : prev_(prev), current_(current) {}
+        XorIterator(const XorIterator &) = default;
+        XorIterator &operator=(const XorIterator &) = default;
+
+        XorIterator(const XorIterator<false> &other)
+            requires IsConst
+            : prev_(other.prev_), current_(other.current_) {}
+
+        reference operator*() const { return current_->val; }
+
+        pointer operator->() const { return &(current_->val); }
+
+        XorIterator &operator++() {
+            NodePtr next = neighbour(current_, prev_);
+            prev_ = current_;
+            current_ = next;
+            return *this;
+        }
+
+        XorIterator operator++(int) {
+            XorIterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        XorIterator &operator--() {
+            NodePtr before = neighbour(prev_, current_);
+            current_ = prev_;
+            prev_ = before;
+            return *this;
+        }
+
+        XorIterator operator--(int) {
+            XorIterator temp = *this;
+            --*this;
+            return temp;
+        }
+
+        // A position is identified by its element; prev_ only serves to move on from it
+        friend bool operator==(const XorIterator &lhs, const XorIterator &rhs) {
+            return lhs.current_ == rhs.current_;
+        }
+    };
+
+    using iterator = XorIterator<false>;
+    using const_iterator = XorIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using allocator_type = Allocator;
+
+    // ===========================================================
+    // 2. Construction and Destruction
+    // ===========================================================
+
+    xor_list() = default;
+    explicit xor_list(const Allocator &alloc) noexcept;
+    xor_list(std::initializer_list<T> init);
+    xor_list(const xor_list &other);
+    xor_list(xor_list &&other) noexcept;
+    xor_list &operator=(const xor_list &other);
+    xor_list &operator=(xor_list &&other) noexcept(nothrow_move_assign);
+    ~xor_list();
+
+    // ===========================================================
+    // 3. Element Access
+    // ===========================================================
+
+    template <typename Self>
+    auto &&front(this Self &&self);
+    template <typename Self>
+    auto &&back(this Self &&self);
+
+    // ===========================================================
+    // 4. Capacity Query
+    // ===========================================================
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    // Bytes requested from the allocator per element
+    static constexpr std::size_t node_size() noexcept { return sizeof(Node); }
+
+    // ===========================================================
+    // 5. Modifiers
+    // ===========================================================
+
+    void clear() noexcept;
+    void swap(xor_list &other) noexcept;
+
+    void push_back(const T &value);
+    void push_back(T &&value);
+    void push_front(const T &value);
+    void push_front(T &&value);
+
+    template <typename... Args>
+    void emplace_back(Args &&...args);
+    template <typename... Args>
+    void emplace_front(Args &&...args);
+
+    void pop_back();
+    void pop_front();
+
+    // Insert before pos; pos itself is invalidated, use the returned iterator
+    iterator insert(const_iterator pos, const T &value);
+    iterator insert(const_iterator pos, T &&value);
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&...args);
+
+    // Erase at pos; iterators to pos and to the element after it are invalidated
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+
+    // ===========================================================
+    // 6. Iterator Interface
+    // ===========================================================
+
+    template <typename Self>
+    auto begin(this Self &&self) noexcept;
+    const_iterator cbegin() const noexcept;
+
+    template <typename Self>
+    auto end(this Self &&self) noexcept;
+    const_iterator cend() const noexcept;
+
+    template <typename Self>
+    auto rbegin(this Self &&self) noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    template <typename Self>
+    auto rend(this Self &&self) noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    // ===========================================================
+    // 7. C++20 Comparison Operations (Spaceship Operator)
+    // ===========================================================
+
+    std::strong_ordering operator<=>(const xor_list &other) const;
+    bool operator==(const xor_list &other) const;
+
+    // ===========================================================
+    // 8. Other Operations
+    // ===========================================================
+
+    allocator_type get_allocator() const noexcept { return allocator_type(allocator_); }
+
+    // O(1): swaps head and tail; every existing iterator is invalidated
+    void reverse() noexcept;
+
+    template <typename... Args>
+    Node *create_node(Args &&...args);
+    void destroy_node(Node *ptr);
+
+    // Link node between the adjacent nodes prev and next (nullptr at an end) and count it
+    void link_between(Node *prev, Node *next, Node *node) noexcept;
+    // Unlink node from its neighbours prev and next (nullptr at an end) without destroying it
+    void unlink_between(Node *prev, Node *node, Node *next) noexcept;
+};
+
+template <XorListable T, typename Allocator>
+void swap(xor_list<T, Allocator> &lhs, xor_list<T, Allocator> &rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mys
+
+#include "xor_list.tpp"
\ No newline at end of file
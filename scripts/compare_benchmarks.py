@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""运行 Google Benchmark 可执行文件并与保存的基线 JSON 比较。
+
+用法:
+    compare_benchmarks.py --baseline-dir DIR --results-dir DIR [--threshold 0.10] [--update] BIN [BIN ...]
+
+每个 BIN 以 JSON 格式运行，结果写入 <results-dir>/<name>.json；
+基线为 <baseline-dir>/<name>.json。--update 时把本次结果保存为新的基线。
+缺少任何一个基线时不运行基准，直接以非零状态退出，不会自动生成基线。
+任何一项的 cpu_time 比基线慢超过 threshold 时，以非零状态退出。
+"""
+
+import argparse
+import json
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+
+# Google Benchmark 的时间单位换算到纳秒
+UNIT_TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def run_benchmark(binary, out_path, extra_args):
+    cmd = [binary, "--benchmark_out=" + out_path, "--benchmark_out_format=json"] + extra_args
+    print("运行:", " ".join(cmd), flush=True)
+    subprocess.run(cmd, check=True)
+
+
+def load_times(path):
+    """读取 JSON，返回 {基准名: cpu_time(ns)}；重复运行时取中位数。"""
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+    samples = {}
+    for bench in data.get("benchmarks", []):
+        # 跳过 mean/median/stddev 等聚合项以及复杂度拟合项
+        if bench.get("run_type", "iteration") != "iteration":
+            continue
+        name = bench.get("run_name", bench["name"])
+        ns = bench["cpu_time"] * UNIT_TO_NS[bench.get("time_unit", "ns")]
+        samples.setdefault(name, []).append(ns)
+    return {name: statistics.median(times) for name, times in samples.items()}
+
+
+def format_ns(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return f"{ns / scale:.3f} {unit}"
+    return f"{ns:.1f} ns"
+
+
+def compare(name, baseline_path, result_path, threshold):
+    """打印对比表，返回回归的数量。"""
+    baseline = load_times(baseline_path)
+    current = load_times(result_path)
+
+    regressions = 0
+    print(f"\n=== {name} (阈值 {threshold:.0%}) ===")
+    print(f"{'Benchmark':<60} {'Baseline':>12} {'Current':>12} {'Change':>9}")
+    for bench, now in current.items():
+        before = baseline.get(bench)
+        if before is None:
+            print(f"{bench:<60} {'-':>12} {format_ns(now):>12} {'new':>9}")
+            continue
+        change = (now - before) / before if before > 0 else 0.0
+        flag = ""
+        if change > threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        elif change < -threshold:
+            flag = "  improved"
+        print(f"{bench:<60} {format_ns(before):>12} {format_ns(now):>12} {change:>+8.1%}{flag}")
+    for bench in baseline.keys() - current.keys():
+        print(f"{bench:<60} {format_ns(baseline[bench]):>12} {'-':>12} {'missing':>9}")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--baseline-dir", required=True, help="保存基线 JSON 的目录")
+    parser.add_argument("--results-dir", required=True, help="本次结果的输出目录")
+    parser.add_argument("--threshold", type=float, default=0.10, help="判定为回归的相对变慢比例")
+    parser.add_argument("--update", action="store_true", help="把本次结果保存为新的基线")
+    parser.add_argument("--benchmark-arg", action="append", default=[], help="传给基准程序的额外参数，可重复")
+    parser.add_argument("binaries", nargs="+", help="基准可执行文件")
+    args = parser.parse_args()
+
+    names = [os.path.splitext(os.path.basename(binary))[0] for binary in args.binaries]
+    baseline_paths = [os.path.join(args.baseline_dir, name + ".json") for name in names]
+
+    # 没有基线就无从对比：先检查，避免跑完整轮基准后才失败
+    if not args.update:
+        missing = [path for path in baseline_paths if not os.path.exists(path)]
+        if missing:
+            for path in missing:
+                print(f"缺少基线: {path}", file=sys.stderr)
+            print("请先运行 benchmarks_baseline 目标 (或加 --update) 生成基线", file=sys.stderr)
+            return 2
+
+    os.makedirs(args.results_dir, exist_ok=True)
+    if args.update:
+        os.makedirs(args.baseline_dir, exist_ok=True)
+
+    regressions = 0
+    for binary, name, baseline_path in zip(args.binaries, names, baseline_paths):
+        result_path = os.path.join(args.results_dir, name + ".json")
+        run_benchmark(binary, result_path, args.benchmark_arg)
+
+        if args.update:
+            shutil.copyfile(result_path, baseline_path)
+            print(f"{name}: 基线已保存到 {baseline_path}")
+            continue
+        regressions += compare(name, baseline_path, result_path, args.threshold)
+
+    if args.update:
+        return 0
+
+    if regressions:
+        print(f"\n发现 {regressions} 项性能回归 (超过 {args.threshold:.0%})")
+        return 1
+    print("\n没有超过阈值的性能回归")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
\ No newline at end of file
@@ -0,0 +1,306 @@
+#include "concurrent_forward_list.h"
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+concurrent_forward_list<T, Compare, Allocator>::concurrent_forward_list(const Compare &comp, const Allocator &alloc) :
+    allocator_(alloc), comp_(comp), id_(next_id_.fetch_add(1, std::memory_order_relaxed)) {}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+concurrent_forward_list<T, Compare, Allocator>::~concurrent_forward_list() {
+    // 其他线程都已退出，链上的节点（包括已标记、尚未摘下的）和各记录待回收的节点互不重叠，逐一释放
+    Node *node = to_node(head_.next.load(std::memory_order_relaxed));
+    while (node) {
+        Node *next = to_node(node->next.load(std::memory_order_relaxed));
+        destroy_node(node);
+        node = next;
+    }
+
+    Record *record = records_.load(std::memory_order_relaxed);
+    while (record) {
+        for (Node *&bucket : record->limbo) {
+            while (bucket) {
+                Node *next = bucket->retired_next;
+                destroy_node(bucket);
+                bucket = next;
+            }
+        }
+        Record *next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+std::size_t concurrent_forward_list<T, Compare, Allocator>::size_approx() const {
+    Guard guard(this);
+    std::size_t count = 0;
+    for (std::uintptr_t word = head_.next.load(std::memory_order_acquire); to_node(word);) {
+        word = to_node(word)->next.load(std::memory_order_acquire);
+        // 标记位在节点自己的 next 上：已被逻辑删除的节点不计数
+        if (!is_marked(word)) ++count;
+    }
+    return count;
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+bool concurrent_forward_list<T, Compare, Allocator>::empty_approx() const {
+    return size_approx() == 0;
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+bool concurrent_forward_list<T, Compare, Allocator>::insert(const T &value) {
+    return emplace(value);
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+bool concurrent_forward_list<T, Compare, Allocator>::insert(T &&value) {
+    return emplace(std::move(value));
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+template <typename... Args>
+bool concurrent_forward_list<T, Compare, Allocator>::emplace(Args &&...args) {
+    // 在进入临界区之前构造好节点：构造可能抛出，也可能很慢，都不应拖住纪元推进
+    Node *node = std::allocator_traits<NodeAlloc>::allocate(allocator_, 1);
+    try {
+        std::allocator_traits<NodeAlloc>::construct(allocator_, node, std::forward<Args>(args)...);
+    } catch (...) {
+        std::allocator_traits<NodeAlloc>::deallocate(allocator_, node, 1);
+        throw;
+    }
+
+    bool linked;
+    try {
+        linked = link(node);
+    } catch (...) {
+        // 只有比较会抛出，此时节点还没有接入链表
+        destroy_node(node);
+        throw;
+    }
+    if (!linked) destroy_node(node);
+    return linked;
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+bool concurrent_forward_list<T, Compare, Allocator>::erase(const T &key) {
+    Guard guard(this);
+    while (true) {
+        Position pos = search(key, guard.record());
+        if (!pos.found) return false;
+
+        // 先在待删节点自己的 next 上打标记（逻辑删除），之后任何插入都无法接在它后面
+        std::uintptr_t succ = pos.curr->next.load(std::memory_order_acquire);
+        if (is_marked(succ)) continue; // 另一个线程正在删除它，重新查找会替它摘下
+        if (!pos.curr->next.compare_exchange_strong(succ, succ | mark_bit, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            continue;
+        }
+
+        // 再尝试把前驱指向后继（物理删除）；失败说明前驱变了，交给一次查找去摘下
+        std::uintptr_t expected = to_word(pos.curr);
+        if (pos.prev->next.compare_exchange_strong(expected, succ, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            retire(guard.record(), pos.curr);
+        } else {
+            search(key, guard.record());
+        }
+        return true;
+    }
+}
+
+// ===========================================================
+// 7. Lookup
+// ===========================================================
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+bool concurrent_forward_list<T, Compare, Allocator>::contains(const T &key) const {
+    Guard guard(this);
+    // 只读遍历：不帮忙摘除已标记的节点，也就没有任何写操作
+    Node *curr = to_node(head_.next.load(std::memory_order_acquire));
+    while (curr && comp_(curr->val, key)) {
+        curr = to_node(curr->next.load(std::memory_order_acquire));
+    }
+    return curr && !comp_(key, curr->val) && !is_marked(curr->next.load(std::memory_order_acquire));
+}
+
+// ===========================================================
+// 8. Other Operations
+// ===========================================================
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+concurrent_forward_list<T, Compare, Allocator>::Position concurrent_forward_list<T, Compare, Allocator>::search(const T &key,
+                                                                                                             Record *record) {
+    // 找到第一个不小于 key 的未标记节点 curr 及其前驱 prev，沿途摘下遇到的已标记节点；
+    // 摘除失败说明 prev 已被标记或后继已变，从表头重新开始
+    while (true) {
+        NodeBase *prev = &head_;
+        Node *curr = to_node(prev->next.load(std::memory_order_acquire));
+        bool restart = false;
+        while (curr) {
+            std::uintptr_t succ = curr->next.load(std::memory_order_acquire);
+            if (is_marked(succ)) {
+                std::uintptr_t expected = to_word(curr);
+                if (!prev->next.compare_exchange_strong(expected, succ & ~mark_bit, std::memory_order_acq_rel,
+                                                        std::memory_order_relaxed)) {
+                    restart = true;
+                    break;
+                }
+                // 谁摘下谁回收，每个节点恰好回收一次
+                retire(record, curr);
+                curr = to_node(succ);
+                continue;
+            }
+            if (!comp_(curr->val, key)) {
+                return {prev, curr, !comp_(key, curr->val)};
+            }
+            prev = curr;
+            curr = to_node(succ);
+        }
+        if (!restart) return {prev, nullptr, false};
+    }
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+bool concurrent_forward_list<T, Compare, Allocator>::link(Node *node) {
+    Guard guard(this);
+    while (true) {
+        Position pos = search(node->val, guard.record());
+        if (pos.found) return false;
+
+        // 节点尚未发布，next 用 relaxed 写；CAS 的 release 把节点内容一起发布出去
+        std::uintptr_t expected = to_word(pos.curr);
+        node->next.store(expected, std::memory_order_relaxed);
+        if (pos.prev->next.compare_exchange_strong(expected, to_word(node), std::memory_order_release, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+void concurrent_forward_list<T, Compare, Allocator>::destroy_node(Node *node) noexcept {
+    std::allocator_traits<NodeAlloc>::destroy(allocator_, node);
+    std::allocator_traits<NodeAlloc>::deallocate(allocator_, node, 1);
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+concurrent_forward_list<T, Compare, Allocator>::Guard::Guard(const concurrent_forward_list *list) :
+    list_(list), record_(list->acquire_record()) {
+    // 先公开自己所在的纪元，再读链表；seq_cst 栅栏与 try_advance 中的栅栏配对：
+    // 推进纪元的线程要么看到这次登记，要么它之前摘下的节点对这里的读取已不可见
+    record_->epoch.store(list_->epoch_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+concurrent_forward_list<T, Compare, Allocator>::Guard::~Guard() {
+    // release：回收者 acquire 读到 quiescent 后，这次操作中的所有读取都先于释放发生
+    record_->epoch.store(quiescent, std::memory_order_release);
+    record_->in_use.store(false, std::memory_order_release);
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+concurrent_forward_list<T, Compare, Allocator>::Record *concurrent_forward_list<T, Compare, Allocator>::acquire_record() const {
+    // 通常直接认领本线程上次用过的记录
+    RecordCache &cache = cached_record_;
+    bool expected = false;
+    if (cache.list_id == id_ &&
+        cache.record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed)) {
+        return cache.record;
+    }
+
+    Record *record = records_.load(std::memory_order_acquire);
+    for (; record; record = record->next) {
+        expected = false;
+        if (!record->in_use.load(std::memory_order_relaxed) &&
+            record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    if (!record) {
+        // 记录只增不减，并发操作数最多时有多少个就有多少个
+        record = new Record;
+        record->in_use.store(true, std::memory_order_relaxed);
+        record->next = records_.load(std::memory_order_relaxed);
+        while (!records_.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+    cache = {id_, record};
+    return record;
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+void concurrent_forward_list<T, Compare, Allocator>::retire(Record *record, Node *node) noexcept {
+    // 摘下之后再读纪元：此刻仍可能持有该节点的操作所在纪元都不晚于 epoch
+    std::uint64_t epoch = epoch_.load(std::memory_order_acquire);
+    reclaim(record, epoch);
+
+    // reclaim 之后，epoch % 3 号桶要么为空，要么正是本纪元的桶
+    std::size_t bucket = epoch % limbo_buckets;
+    node->retired_next = record->limbo[bucket];
+    record->limbo[bucket] = node;
+    record->limbo_epoch[bucket] = epoch;
+
+    if (++record->retired_since_advance >= advance_interval) {
+        record->retired_since_advance = 0;
+        try_advance(epoch);
+        reclaim(record, epoch_.load(std::memory_order_acquire));
+    }
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+void concurrent_forward_list<T, Compare, Allocator>::try_advance(std::uint64_t epoch) noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (Record *record = records_.load(std::memory_order_acquire); record; record = record->next) {
+        std::uint64_t seen = record->epoch.load(std::memory_order_acquire);
+        if (seen != quiescent && seen != epoch) return;
+    }
+    // 失败说明别的线程已经推进过了
+    epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel, std::memory_order_relaxed);
+}
+
+template <typename T, typename Compare, typename Allocator>
+    requires ConcurrentSortable<T, Compare>
+void concurrent_forward_list<T, Compare, Allocator>::reclaim(Record *record, std::uint64_t epoch) noexcept {
+    // 在纪元 e 回收的节点，纪元推进到 e + 2 时已没有任何操作能持有它
+    for (std::size_t i = 0; i < limbo_buckets; ++i) {
+        if (record->limbo[i] && record->limbo_epoch[i] + 2 <= epoch) {
+            Node *node = record->limbo[i];
+            record->limbo[i] = nullptr;
+            while (node) {
+                Node *next = node->retired_next;
+                destroy_node(node);
+                node = next;
+            }
+        }
+    }
+}
+
+} // namespace mys
\ No newline at end of file
@@ -0,0 +1,516 @@
+#include "deque.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::deque(std::size_t count) : deque() {
+    resize(count);
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::deque(std::size_t count, const T &value) : deque() {
+    resize(count, value);
+}
+
+template <Vectorable T, typename Allocator>
+template <std::input_iterator InputIt>
+deque<T, Allocator>::deque(InputIt first, InputIt last) : deque() {
+    for (; first != last; ++first) {
+        emplace_back(*first);
+    }
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::deque(std::initializer_list<T> init) : deque(init.begin(), init.end()) {}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::deque(const deque &other) : allocator_(AllocTraits::select_on_container_copy_construction(other.allocator_)) {
+    for (const auto &item : other) {
+        emplace_back(item);
+    }
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::deque(deque &&other) noexcept :
+    allocator_(std::move(other.allocator_)), map_(other.map_), map_cap_(other.map_cap_), start_(other.start_), length_(other.length_), spare_(other.spare_) {
+    other.map_ = nullptr;
+    other.map_cap_ = 0;
+    other.start_ = 0;
+    other.length_ = 0;
+    other.spare_ = nullptr;
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator> &deque<T, Allocator>::operator=(const deque &other) {
+    if (this != &other) {
+        deque temp(other);
+        swap(temp);
+    }
+    return *this;
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator> &deque<T, Allocator>::operator=(deque &&other) noexcept {
+    if (this != &other) {
+        deque temp(std::move(other));
+        swap(temp);
+    }
+    return *this;
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::~deque() {
+    clear();
+    shrink_to_fit();
+    if (map_) {
+        MapAlloc map_alloc(allocator_);
+        MapTraits::deallocate(map_alloc, map_, map_cap_);
+    }
+}
+
+// ===========================================================
+// 3. Element Access
+// ===========================================================
+
+template <Vectorable T, typename Allocator>
+template <typename Self>
+auto &&deque<T, Allocator>::at(this Self &&self, std::size_t index) {
+    if (index >= self.length_) {
+        throw std::out_of_range("deque::at");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(*self.element(self.start_ + index));
+}
+
+template <Vectorable T, typename Allocator>
+template <typename Self>
+auto &&deque<T, Allocator>::operator[](this Self &&self, std::size_t index) {
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(*self.element(self.start_ + index));
+}
+
+template <Vectorable T, typename Allocator>
+template <typename Self>
+auto &&deque<T, Allocator>::front(this Self &&self) {
+    if (self.empty()) {
+        throw std::out_of_range("empty");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(*self.element(self.start_));
+}
+
+template <Vectorable T, typename Allocator>
+template <typename Self>
+auto &&deque<T, Allocator>::back(this Self &&self) {
+    if (self.empty()) {
+        throw std::out_of_range("empty");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(*self.element(self.start_ + self.length_ - 1));
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <Vectorable T, typename Allocator>
+bool deque<T, Allocator>::empty() const noexcept {
+    return length_ == 0;
+}
+
+template <Vectorable T, typename Allocator>
+std::size_t deque<T, Allocator>::size() const noexcept {
+    return length_;
+}
+
+template <Vectorable T, typename Allocator>
+std::size_t deque<T, Allocator>::max_size() const noexcept {
+    return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::shrink_to_fit() noexcept {
+    if (spare_) {
+        AllocTraits::deallocate(allocator_, spare_, block_size);
+        spare_ = nullptr;
+    }
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::clear() noexcept {
+    if (length_ == 0) return;
+
+    std::size_t first_block = start_ / block_size;
+    std::size_t last_block = (start_ + length_ - 1) / block_size;
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (std::size_t pos = start_; pos != start_ + length_; ++pos) {
+            AllocTraits::destroy(allocator_, element(pos));
+        }
+    }
+    for (std::size_t b = first_block; b <= last_block; ++b) {
+        release_block(map_[b]);
+        map_[b] = nullptr;
+    }
+    length_ = 0;
+    reset_start();
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::swap(deque &other) noexcept {
+    using std::swap;
+    swap(map_, other.map_);
+    swap(map_cap_, other.map_cap_);
+    swap(start_, other.start_);
+    swap(length_, other.length_);
+    swap(spare_, other.spare_);
+    if constexpr (AllocTraits::propagate_on_container_swap::value) {
+        swap(allocator_, other.allocator_);
+    }
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::push_back(const T &value) {
+    emplace_back(value);
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::push_back(T &&value) {
+    emplace_back(std::move(value));
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::push_front(const T &value) {
+    emplace_front(value);
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::push_front(T &&value) {
+    emplace_front(std::move(value));
+}
+
+template <Vectorable T, typename Allocator>
+template <typename... Args>
+T &deque<T, Allocator>::emplace_back(Args &&...args) {
+    // The slot after the new element must still map inside the map (it is end())
+    if (!map_ || (start_ + length_ + 1) / block_size >= map_cap_) {
+        grow_map();
+    }
+    std::size_t pos = start_ + length_;
+    bool fresh = ensure_block(pos);
+    try {
+        AllocTraits::construct(allocator_, element(pos), std::forward<Args>(args)...);
+    } catch (...) {
+        if (fresh) {
+            release_block(map_[pos / block_size]);
+            map_[pos / block_size] = nullptr;
+        }
+        throw;
+    }
+    ++length_;
+    return *element(pos);
+}
+
+template <Vectorable T, typename Allocator>
+template <typename... Args>
+T &deque<T, Allocator>::emplace_front(Args &&...args) {
+    if (!map_ || start_ == 0) {
+        grow_map();
+    }
+    std::size_t pos = start_ - 1;
+    bool fresh = ensure_block(pos);
+    try {
+        AllocTraits::construct(allocator_, element(pos), std::forward<Args>(args)...);
+    } catch (...) {
+        if (fresh) {
+            release_block(map_[pos / block_size]);
+            map_[pos / block_size] = nullptr;
+        }
+        throw;
+    }
+    start_ = pos;
+    ++length_;
+    return *element(pos);
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::pop_back() {
+    if (empty()) return;
+    --length_;
+    std::size_t pos = start_ + length_;
+    AllocTraits::destroy(allocator_, element(pos));
+
+    // Hand the block back once its last element is gone
+    if (length_ == 0 || pos % block_size == 0) {
+        release_block(map_[pos / block_size]);
+        map_[pos / block_size] = nullptr;
+    }
+    if (length_ == 0) reset_start();
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::pop_front() {
+    if (empty()) return;
+    std::size_t pos = start_;
+    AllocTraits::destroy(allocator_, element(pos));
+    ++start_;
+    --length_;
+
+    if (length_ == 0 || start_ % block_size == 0) {
+        release_block(map_[pos / block_size]);
+        map_[pos / block_size] = nullptr;
+    }
+    if (length_ == 0) reset_start();
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::iterator deque<T, Allocator>::insert(const_iterator pos, const T &value) {
+    return emplace(pos, value);
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::iterator deque<T, Allocator>::insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+}
+
+template <Vectorable T, typename Allocator>
+template <typename... Args>
+deque<T, Allocator>::iterator deque<T, Allocator>::emplace(const_iterator pos, Args &&...args) {
+    std::size_t index = static_cast<std::size_t>(pos - cbegin());
+    if (index == length_) {
+        emplace_back(std::forward<Args>(args)...);
+        return make_iterator(start_ + index);
+    }
+    if (index == 0) {
+        emplace_front(std::forward<Args>(args)...);
+        return make_iterator(start_);
+    }
+
+    // Build the value first: args may refer to an element that is about to shift
+    T value(std::forward<Args>(args)...);
+    if (index < length_ / 2) {
+        // Open the hole by shifting the front part one slot towards the front
+        emplace_front(std::move(front()));
+        iterator first = begin();
+        std::move(first + 2, first + static_cast<std::ptrdiff_t>(index) + 1, first + 1);
+    } else {
+        emplace_back(std::move(back()));
+        iterator first = begin();
+        std::move_backward(first + static_cast<std::ptrdiff_t>(index), first + static_cast<std::ptrdiff_t>(length_) - 2,
+                           first + static_cast<std::ptrdiff_t>(length_) - 1);
+    }
+    *element(start_ + index) = std::move(value);
+    return make_iterator(start_ + index);
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::iterator deque<T, Allocator>::erase(const_iterator pos) {
+    if (pos == cend()) throw std::out_of_range("Erase out of range");
+    return erase(pos, pos + 1);
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::iterator deque<T, Allocator>::erase(const_iterator first, const_iterator last) {
+    std::size_t index = static_cast<std::size_t>(first - cbegin());
+    std::size_t count = static_cast<std::size_t>(last - first);
+    if (count == 0) return make_iterator(start_ + index);
+
+    iterator b = begin();
+    iterator f = b + static_cast<std::ptrdiff_t>(index);
+    iterator l = f + static_cast<std::ptrdiff_t>(count);
+    if (index < (length_ - count) / 2) {
+        // Fewer elements before the gap: shift them back and drop the front
+        std::move_backward(b, f, l);
+        for (std::size_t i = 0; i < count; ++i) {
+            pop_front();
+        }
+    } else {
+        std::move(l, end(), f);
+        for (std::size_t i = 0; i < count; ++i) {
+            pop_back();
+        }
+    }
+    return make_iterator(start_ + index);
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::resize(std::size_t count) {
+    while (length_ > count) {
+        pop_back();
+    }
+    while (length_ < count) {
+        emplace_back();
+    }
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::resize(std::size_t count, const T &value) {
+    while (length_ > count) {
+        pop_back();
+    }
+    if (length_ < count) {
+        T copy(value);
+        while (length_ < count) {
+            emplace_back(copy);
+        }
+    }
+}
+
+// ===========================================================
+// 6. Iterator Interface
+// ===========================================================
+
+template <Vectorable T, typename Allocator>
+template <typename Self>
+auto deque<T, Allocator>::begin(this Self &&self) noexcept {
+    constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
+    return DequeIterator<is_const>(self.make_iterator(self.start_));
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::const_iterator deque<T, Allocator>::cbegin() const noexcept {
+    return const_iterator(make_iterator(start_));
+}
+
+template <Vectorable T, typename Allocator>
+template <typename Self>
+auto deque<T, Allocator>::end(this Self &&self) noexcept {
+    constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
+    return DequeIterator<is_const>(self.make_iterator(self.start_ + self.length_));
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::const_iterator deque<T, Allocator>::cend() const noexcept {
+    return const_iterator(make_iterator(start_ + length_));
+}
+
+template <Vectorable T, typename Allocator>
+template <typename Self>
+auto deque<T, Allocator>::rbegin(this Self &&self) noexcept {
+    return std::reverse_iterator(self.end());
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::crbegin() const noexcept {
+    return const_reverse_iterator(cend());
+}
+
+template <Vectorable T, typename Allocator>
+template <typename Self>
+auto deque<T, Allocator>::rend(this Self &&self) noexcept {
+    return std::reverse_iterator(self.begin());
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::crend() const noexcept {
+    return const_reverse_iterator(cbegin());
+}
+
+// ===========================================================
+// 7. C++20 Comparison Operations (Spaceship Operator)
+// ===========================================================
+
+template <Vectorable T, typename Allocator>
+std::strong_ordering deque<T, Allocator>::operator<=>(const deque &other) const {
+    auto it1 = begin();
+    auto it2 = other.begin();
+    for (; it1 != end() && it2 != other.end(); ++it1, ++it2) {
+        auto cmp = std::compare_strong_order_fallback(*it1, *it2);
+        if (cmp != 0) return cmp;
+    }
+    return length_ <=> other.length_;
+}
+
+template <Vectorable T, typename Allocator>
+bool deque<T, Allocator>::operator==(const deque &other) const {
+    if (length_ != other.length_) return false;
+    return std::equal(begin(), end(), other.begin());
+}
+
+// ===========================================================
+// Helper Functions
+// ===========================================================
+
+template <Vectorable T, typename Allocator>
+T *deque<T, Allocator>::acquire_block() {
+    if (spare_) {
+        T *block = spare_;
+        spare_ = nullptr;
+        return block;
+    }
+    return AllocTraits::allocate(allocator_, block_size);
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::release_block(T *block) noexcept {
+    if (!spare_) {
+        spare_ = block;
+    } else {
+        AllocTraits::deallocate(allocator_, block, block_size);
+    }
+}
+
+template <Vectorable T, typename Allocator>
+bool deque<T, Allocator>::ensure_block(std::size_t pos) {
+    T *&slot = map_[pos / block_size];
+    if (slot) return false;
+    slot = acquire_block();
+    return true;
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::grow_map() {
+    std::size_t first_block = start_ / block_size;
+    std::size_t used = length_ ? (start_ + length_ - 1) / block_size - first_block + 1 : 0;
+
+    // Keep at least as many free slots as used ones, and never fewer than two per side
+    std::size_t new_cap = map_cap_;
+    if (map_cap_ < 2 * (used + 2)) {
+        new_cap = std::max<std::size_t>(8, std::max(map_cap_ * 2, 2 * (used + 2)));
+    }
+    std::size_t new_first = (new_cap - used) / 2;
+
+    if (new_cap != map_cap_) {
+        MapAlloc map_alloc(allocator_);
+        T **new_map = MapTraits::allocate(map_alloc, new_cap);
+        std::fill(new_map, new_map + new_cap, nullptr);
+        if (used) {
+            std::copy(map_ + first_block, map_ + first_block + used, new_map + new_first);
+        }
+        if (map_) {
+            MapTraits::deallocate(map_alloc, map_, map_cap_);
+        }
+        map_ = new_map;
+        map_cap_ = new_cap;
+    } else if (new_first != first_block) {
+        // Only block pointers move; the elements stay where they are
+        std::memmove(map_ + new_first, map_ + first_block, used * sizeof(T *));
+        std::fill(map_, map_ + new_first, nullptr);
+        std::fill(map_ + new_first + used, map_ + map_cap_, nullptr);
+    }
+    start_ = new_first * block_size + start_ % block_size;
+}
+
+template <Vectorable T, typename Allocator>
+void deque<T, Allocator>::reset_start() noexcept {
+    start_ = map_cap_ / 2 * block_size;
+}
+
+template <Vectorable T, typename Allocator>
+deque<T, Allocator>::iterator deque<T, Allocator>::make_iterator(std::size_t pos) const noexcept {
+    if (!map_) return iterator();
+    return iterator(map_ + pos / block_size, pos % block_size);
+}
+
+} // namespace mys
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "forward_list.h"
 #include <stdexcept>
+#include <cstdint>
 #include <algorithm>
 #include <functional>
 
@@ -9,9 +10,9 @@ namespace mys {
 // Helper Functions
 // ===========================================================
 
-template <ForwardListable T, typename Alloc>
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
 template <typename... Args>
-typename forward_list<T, Alloc>::Node *forward_list<T, Alloc>::create_node(Args &&...args) {
+typename forward_list<T, Alloc, Instr, TrackTail>::Node *forward_list<T, Alloc, Instr, TrackTail>::create_node(Args &&...args) {
     Node *ptr = allocator_.allocate(1);
     try {
         std::allocator_traits<NodeAlloc>::construct(allocator_, ptr, std::forward<Args>(args)...);
@@ -19,51 +20,213 @@ typename forward_list<T, Alloc>::Node *forward_list<T, Alloc>::create_node(Args
         allocator_.deallocate(ptr, 1);
         throw;
     }
+    MYS_INSTRUMENT(on_allocate(1));
     return ptr;
 }
 
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::destroy_node(Node *ptr) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::destroy_node(Node *ptr) {
     std::allocator_traits<NodeAlloc>::destroy(allocator_, ptr);
     allocator_.deallocate(ptr, 1);
+    MYS_INSTRUMENT(on_deallocate(1));
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <typename Iter, typename Sent>
+typename forward_list<T, Alloc, Instr, TrackTail>::Chain forward_list<T, Alloc, Instr, TrackTail>::build_chain(Iter first, Sent last) {
+    Chain chain;
+    try {
+        for (; first != last; ++first) {
+            Node *node = create_node(*first);
+            if (chain.last != nullptr) {
+                chain.last->next = node;
+            } else {
+                chain.first = node;
+            }
+            chain.last = node;
+            ++chain.count;
+        }
+    } catch (...) {
+        destroy_chain(chain.first);
+        throw;
+    }
+    return chain;
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::destroy_chain(NodeBase *first) noexcept {
+    while (first != nullptr) {
+        NodeBase *next = first->next;
+        destroy_node(static_cast<Node *>(first));
+        first = next;
+    }
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+typename forward_list<T, Alloc, Instr, TrackTail>::NodeBase *forward_list<T, Alloc, Instr, TrackTail>::link_chain_after(NodeBase *pos, const Chain &chain) noexcept {
+    if (chain.count == 0) return pos;
+
+    chain.last->next = pos->next;
+    pos->next = chain.first;
+    relink_tail(pos, chain.last);
+    length_ += chain.count;
+    MYS_INSTRUMENT(on_length(length_));
+    return chain.last;
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::replace_with_chain(const Chain &chain) noexcept {
+    // 先摘下旧链再销毁：不能走 clear()，池分配器的整体释放会连新链一起回收
+    NodeBase *old = head_.next;
+    head_.next = nullptr;
+    length_ = 0;
+    unlink_tail(&head_);
+    link_chain_after(&head_, chain);
+    destroy_chain(old);
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+typename forward_list<T, Alloc, Instr, TrackTail>::NodeBase *forward_list<T, Alloc, Instr, TrackTail>::split_after(NodeBase *first, std::size_t n) noexcept {
+    if (first == nullptr) return nullptr;
+    for (std::size_t i = 1; i < n && first->next != nullptr; ++i) {
+        first = first->next;
+    }
+    NodeBase *rest = first->next;
+    first->next = nullptr;
+    return rest;
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <typename Compare>
+typename forward_list<T, Alloc, Instr, TrackTail>::NodeBase *forward_list<T, Alloc, Instr, TrackTail>::merge_runs(NodeBase *tail, NodeBase *a, NodeBase *b, Compare &comp) {
+    // 只有 b 严格小于 a 时才取 b，保证稳定性
+    try {
+        while (a != nullptr && b != nullptr) {
+            if (comp(static_cast<Node *>(b)->val, static_cast<Node *>(a)->val)) {
+                tail->next = b;
+                b = b->next;
+            } else {
+                tail->next = a;
+                a = a->next;
+            }
+            tail = tail->next;
+        }
+    } catch (...) {
+        // 已归并的前缀止于 tail，a、b 仍是完整的链，依次接上即可
+        tail->next = a;
+        while (tail->next != nullptr) {
+            tail = tail->next;
+        }
+        tail->next = b;
+        throw;
+    }
+    tail->next = (a != nullptr) ? a : b;
+    while (tail->next != nullptr) {
+        tail = tail->next;
+    }
+    return tail;
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::relink_tail(NodeBase *pos, NodeBase *last) noexcept {
+    if constexpr (TrackTail) {
+        if (pos == before_end_) before_end_ = last;
+    }
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::unlink_tail(NodeBase *prev) noexcept {
+    if constexpr (TrackTail) {
+        if (prev->next == nullptr) before_end_ = prev;
+    }
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::steal_nodes(forward_list &other) noexcept {
+    head_.next = std::exchange(other.head_.next, nullptr);
+    length_ = std::exchange(other.length_, 0);
+    if constexpr (TrackTail) {
+        // 空表的 before_end_ 指向各自的 head_
+        before_end_ = other.before_end_;
+        unlink_tail(&head_);
+        other.before_end_ = &other.head_;
+    }
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::reset_tail_from([[maybe_unused]] NodeBase *from) noexcept {
+    if constexpr (TrackTail) {
+        while (from->next != nullptr) {
+            from = from->next;
+        }
+        before_end_ = from;
+    }
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::check_allocator(const forward_list &other, const char *what) const {
+    if constexpr (!std::allocator_traits<NodeAlloc>::is_always_equal::value) {
+        if (allocator_ != other.allocator_) throw std::invalid_argument(what);
+    }
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+typename forward_list<T, Alloc, Instr, TrackTail>::NodeBase *forward_list<T, Alloc, Instr, TrackTail>::last_node() noexcept {
+    if constexpr (TrackTail) {
+        return before_end_;
+    } else {
+        NodeBase *last = &head_;
+        while (last->next != nullptr) {
+            last = last->next;
+        }
+        return last;
+    }
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+bool forward_list<T, Alloc, Instr, TrackTail>::adjacent(const NodeBase *node, const NodeBase *next) noexcept {
+    // 允许一个缓存行的间隙，malloc 的块头和 slab 的对齐填充都算作相邻
+    std::uintptr_t end = reinterpret_cast<std::uintptr_t>(node) + sizeof(Node);
+    std::uintptr_t start = reinterpret_cast<std::uintptr_t>(next);
+    return start >= end && start - end <= 64;
 }
 
 // ===========================================================
 // Construction and Destruction
 // ===========================================================
 
-template <ForwardListable T, typename Alloc>
-forward_list<T, Alloc>::forward_list() {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail>::forward_list() : forward_list(Alloc()) {}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail>::forward_list(const Alloc &alloc) noexcept : allocator_(alloc) {
     head_.next = nullptr;
     length_ = 0;
+    if constexpr (TrackTail) {
+        before_end_ = &head_;
+    }
 }
 
-template <ForwardListable T, typename Alloc>
-forward_list<T, Alloc>::forward_list(std::initializer_list<T> init) : forward_list() {
-    // 逆序插入，保证顺序正确，或者维护一个 tail 指针进行尾插
-    // 这里为了效率使用 insert_after 配合 before_begin 顺序插入
-    auto it = before_begin();
-    for (const auto &item : init) {
-        it = insert_after(it, item);
-    }
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail>::forward_list(std::initializer_list<T> init) : forward_list() {
+    link_chain_after(&head_, build_chain(init.begin(), init.end()));
 }
 
-template <ForwardListable T, typename Alloc>
-forward_list<T, Alloc>::forward_list(const forward_list &other) : forward_list() {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail>::forward_list(const forward_list &other) : forward_list() {
     // 深拷贝
-    auto it = before_begin();
-    for (const auto &item : other) {
-        it = insert_after(it, item);
-    }
+    link_chain_after(&head_, build_chain(other.begin(), other.end()));
 }
 
-template <ForwardListable T, typename Alloc>
-forward_list<T, Alloc>::forward_list(forward_list &&other) noexcept : forward_list() {
-    swap(other);
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail>::forward_list(forward_list &&other) noexcept :
+    forward_list(Alloc(other.allocator_)) {
+    // 节点连同分配器一起转移
+    steal_nodes(other);
 }
 
-template <ForwardListable T, typename Alloc>
-forward_list<T, Alloc> &forward_list<T, Alloc>::operator=(const forward_list &other) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail> &forward_list<T, Alloc, Instr, TrackTail>::operator=(const forward_list &other) {
     if (this != &other) {
         forward_list temp(other);
         swap(temp);
@@ -71,17 +234,28 @@ forward_list<T, Alloc> &forward_list<T, Alloc>::operator=(const forward_list &ot
     return *this;
 }
 
-template <ForwardListable T, typename Alloc>
-forward_list<T, Alloc> &forward_list<T, Alloc>::operator=(forward_list &&other) noexcept {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail> &forward_list<T, Alloc, Instr, TrackTail>::operator=(forward_list &&other) noexcept(nothrow_move_assign) {
     if (this != &other) {
+        if constexpr (!nothrow_move_assign) {
+            // 分配器不传播且不相等：other 的节点不能由本表释放，只能逐个移动元素
+            if (allocator_ != other.allocator_) {
+                assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+                return *this;
+            }
+        }
         clear();
-        swap(other);
+        if constexpr (std::allocator_traits<NodeAlloc>::propagate_on_container_move_assignment::value) {
+            allocator_ = std::move(other.allocator_);
+        }
+        steal_nodes(other);
     }
     return *this;
 }
 
-template <ForwardListable T, typename Alloc>
-forward_list<T, Alloc>::~forward_list() {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail>::~forward_list() {
     clear();
 }
 
@@ -89,9 +263,9 @@ forward_list<T, Alloc>::~forward_list() {
 // Element Access
 // ===========================================================
 
-template <ForwardListable T, typename Alloc>
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
 template <typename Self>
-auto &&forward_list<T, Alloc>::front(this Self &&self) {
+auto &&forward_list<T, Alloc, Instr, TrackTail>::front(this Self &&self) {
     // 假设非空，调用者需保证
     // head_.next 是 NodeBase*，需要转为 Node* 才能访问 val
     return static_cast<std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const Node *, Node *>>(self.head_.next)->val;
@@ -101,22 +275,39 @@ auto &&forward_list<T, Alloc>::front(this Self &&self) {
 // Capacity Query
 // ===========================================================
 
-template <ForwardListable T, typename Alloc>
-bool forward_list<T, Alloc>::empty() const noexcept {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+bool forward_list<T, Alloc, Instr, TrackTail>::empty() const noexcept {
     return head_.next == nullptr;
 }
 
-template <ForwardListable T, typename Alloc>
-std::size_t forward_list<T, Alloc>::size() const noexcept {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+std::size_t forward_list<T, Alloc, Instr, TrackTail>::size() const noexcept {
     return length_;
 }
 
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <typename Self>
+auto &&forward_list<T, Alloc, Instr, TrackTail>::instrumentation(this Self &&self) noexcept {
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const Instr &, Instr &>;
+    return static_cast<ReturnType>(self.instrumentation_);
+}
+
 // ===========================================================
 // Modifiers
 // ===========================================================
 
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::clear() noexcept {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::clear() noexcept {
+    // 节点无需析构时，直接让池分配器整体归还 slab，不再逐个遍历
+    if constexpr (std::is_trivially_destructible_v<Node> && BulkReleasable<NodeAlloc>) {
+        if (allocator_.release()) {
+            MYS_INSTRUMENT(on_deallocate(length_));
+            head_.next = nullptr;
+            length_ = 0;
+            unlink_tail(&head_);
+            return;
+        }
+    }
     NodeBase *curr = head_.next;
     while (curr != nullptr) {
         NodeBase *next = curr->next;
@@ -126,84 +317,167 @@ void forward_list<T, Alloc>::clear() noexcept {
     }
     head_.next = nullptr;
     length_ = 0;
+    unlink_tail(&head_);
 }
 
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::swap(forward_list &other) noexcept {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::swap(forward_list &other) noexcept {
     using std::swap;
     swap(head_.next, other.head_.next); // 交换哨兵指向的第一个节点
     swap(length_, other.length_);
+    if constexpr (TrackTail) {
+        // 空表的 before_end_ 指向自己的 head_，交换后要重新指回
+        swap(before_end_, other.before_end_);
+        unlink_tail(&head_);
+        other.unlink_tail(&other.head_);
+    }
     // allocator 的 swap 取决于 allocator_traits，这里简化处理
     if constexpr (std::allocator_traits<Alloc>::propagate_on_container_swap::value) {
         swap(allocator_, other.allocator_);
     }
 }
 
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::push_front(const T &value) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::push_front(const T &value) {
     insert_after(before_begin(), value);
 }
 
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::push_front(T &&value) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::push_front(T &&value) {
     insert_after(before_begin(), std::move(value));
 }
 
-template <ForwardListable T, typename Alloc>
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
 template <typename... Args>
-void forward_list<T, Alloc>::emplace_front(Args &&...args) {
+void forward_list<T, Alloc, Instr, TrackTail>::emplace_front(Args &&...args) {
     emplace_after(before_begin(), std::forward<Args>(args)...);
 }
 
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::pop_front() {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::push_back(const T &value)
+    requires TrackTail
+{
+    insert_after(before_end(), value);
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::push_back(T &&value)
+    requires TrackTail
+{
+    insert_after(before_end(), std::move(value));
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <typename... Args>
+void forward_list<T, Alloc, Instr, TrackTail>::emplace_back(Args &&...args)
+    requires TrackTail
+{
+    emplace_after(before_end(), std::forward<Args>(args)...);
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::pop_front() {
     erase_after(before_begin());
 }
 
-template <ForwardListable T, typename Alloc>
-typename forward_list<T, Alloc>::iterator forward_list<T, Alloc>::insert_after(const_iterator pos, const T &value) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+typename forward_list<T, Alloc, Instr, TrackTail>::iterator forward_list<T, Alloc, Instr, TrackTail>::insert_after(const_iterator pos, const T &value) {
     Node *new_node = create_node(value);
     NodeBase *prev = get_node_base(pos);
 
     new_node->next = prev->next;
     prev->next = new_node;
+    relink_tail(prev, new_node);
 
     length_++;
+    MYS_INSTRUMENT(on_length(length_));
     return iterator(new_node);
 }
 
-template <ForwardListable T, typename Alloc>
-typename forward_list<T, Alloc>::iterator forward_list<T, Alloc>::insert_after(const_iterator pos, T &&value) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+typename forward_list<T, Alloc, Instr, TrackTail>::iterator forward_list<T, Alloc, Instr, TrackTail>::insert_after(const_iterator pos, T &&value) {
     Node *new_node = create_node(std::move(value));
     NodeBase *prev = get_node_base(pos);
 
     new_node->next = prev->next;
     prev->next = new_node;
+    relink_tail(prev, new_node);
 
     length_++;
+    MYS_INSTRUMENT(on_length(length_));
     return iterator(new_node);
 }
 
-template <ForwardListable T, typename Alloc>
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
 template <typename... Args>
-typename forward_list<T, Alloc>::iterator forward_list<T, Alloc>::emplace_after(const_iterator pos, Args &&...args) {
+typename forward_list<T, Alloc, Instr, TrackTail>::iterator forward_list<T, Alloc, Instr, TrackTail>::emplace_after(const_iterator pos, Args &&...args) {
     Node *new_node = create_node(std::forward<Args>(args)...);
     NodeBase *prev = get_node_base(pos);
 
     new_node->next = prev->next;
     prev->next = new_node;
+    relink_tail(prev, new_node);
 
     length_++;
+    MYS_INSTRUMENT(on_length(length_));
     return iterator(new_node);
 }
 
-template <ForwardListable T, typename Alloc>
-typename forward_list<T, Alloc>::iterator forward_list<T, Alloc>::erase_after(const_iterator pos) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <std::input_iterator InputIt>
+void forward_list<T, Alloc, Instr, TrackTail>::assign(InputIt first, InputIt last) {
+    replace_with_chain(build_chain(first, last));
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::assign(std::initializer_list<T> init) {
+    assign(init.begin(), init.end());
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <ForwardListRange<T> R>
+void forward_list<T, Alloc, Instr, TrackTail>::assign_range(R &&rg) {
+    replace_with_chain(build_chain(std::ranges::begin(rg), std::ranges::end(rg)));
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <std::input_iterator InputIt>
+typename forward_list<T, Alloc, Instr, TrackTail>::iterator forward_list<T, Alloc, Instr, TrackTail>::insert_after(const_iterator pos, InputIt first, InputIt last) {
+    return iterator(link_chain_after(get_node_base(pos), build_chain(first, last)));
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+typename forward_list<T, Alloc, Instr, TrackTail>::iterator forward_list<T, Alloc, Instr, TrackTail>::insert_after(const_iterator pos, std::initializer_list<T> init) {
+    return insert_after(pos, init.begin(), init.end());
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <ForwardListRange<T> R>
+typename forward_list<T, Alloc, Instr, TrackTail>::iterator forward_list<T, Alloc, Instr, TrackTail>::insert_range_after(const_iterator pos, R &&rg) {
+    return iterator(link_chain_after(get_node_base(pos), build_chain(std::ranges::begin(rg), std::ranges::end(rg))));
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <ForwardListRange<T> R>
+void forward_list<T, Alloc, Instr, TrackTail>::prepend_range(R &&rg) {
+    link_chain_after(&head_, build_chain(std::ranges::begin(rg), std::ranges::end(rg)));
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <ForwardListRange<T> R>
+void forward_list<T, Alloc, Instr, TrackTail>::append_range(R &&rg) {
+    link_chain_after(last_node(), build_chain(std::ranges::begin(rg), std::ranges::end(rg)));
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+typename forward_list<T, Alloc, Instr, TrackTail>::iterator forward_list<T, Alloc, Instr, TrackTail>::erase_after(const_iterator pos) {
     NodeBase *prev = get_node_base(pos);
     NodeBase *curr = prev->next;
 
     if (curr) {
+        MYS_INSTRUMENT(on_erase());
         prev->next = curr->next;
+        unlink_tail(prev);
         destroy_node(static_cast<Node *>(curr));
         length_--;
         return iterator(prev->next);
@@ -211,13 +485,23 @@ typename forward_list<T, Alloc>::iterator forward_list<T, Alloc>::erase_after(co
     return end();
 }
 
-template <ForwardListable T, typename Alloc>
-typename forward_list<T, Alloc>::iterator forward_list<T, Alloc>::erase_after(const_iterator first, const_iterator last) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+typename forward_list<T, Alloc, Instr, TrackTail>::iterator forward_list<T, Alloc, Instr, TrackTail>::erase_after(const_iterator first, const_iterator last) {
     NodeBase *prev = get_node_base(first);
-    while (prev->next != last.current_) {
-        erase_after(iterator(prev));
+    NodeBase *stop = get_node_base(last);
+
+    // 整段摘下只改一次 next，再逐个销毁
+    NodeBase *curr = prev->next;
+    prev->next = stop;
+    unlink_tail(prev);
+    while (curr != stop) {
+        NodeBase *next = curr->next;
+        MYS_INSTRUMENT(on_erase());
+        destroy_node(static_cast<Node *>(curr));
+        length_--;
+        curr = next;
     }
-    return iterator(const_cast<NodeBase *>(last.current_));
+    return iterator(stop);
 }
 
 // ===========================================================
@@ -225,9 +509,9 @@ typename forward_list<T, Alloc>::iterator forward_list<T, Alloc>::erase_after(co
 // ===========================================================
 
 // 返回指向 head_ 哨兵节点的迭代器
-template <ForwardListable T, typename Alloc>
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
 template <typename Self>
-auto forward_list<T, Alloc>::before_begin(this Self &&self) noexcept {
+auto forward_list<T, Alloc, Instr, TrackTail>::before_begin(this Self &&self) noexcept {
     // 根据 self 的 const 属性决定使用 iterator 还是 const_iterator
     using Iter = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
 
@@ -235,74 +519,94 @@ auto forward_list<T, Alloc>::before_begin(this Self &&self) noexcept {
     return Iter(&self.head_);
 }
 
-template <ForwardListable T, typename Alloc>
-forward_list<T, Alloc>::const_iterator forward_list<T, Alloc>::cbefore_begin() const noexcept {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail>::const_iterator forward_list<T, Alloc, Instr, TrackTail>::cbefore_begin() const noexcept {
     return const_iterator(&head_);
 }
 
-template <ForwardListable T, typename Alloc>
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
 template <typename Self>
-auto forward_list<T, Alloc>::begin(this Self &&self) noexcept {
+auto forward_list<T, Alloc, Instr, TrackTail>::begin(this Self &&self) noexcept {
     using Iter = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
     return Iter(self.head_.next);
 }
 
-template <ForwardListable T, typename Alloc>
-forward_list<T, Alloc>::const_iterator forward_list<T, Alloc>::cbegin() const noexcept {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail>::const_iterator forward_list<T, Alloc, Instr, TrackTail>::cbegin() const noexcept {
     return const_iterator(head_.next);
 }
 
-template <ForwardListable T, typename Alloc>
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
 template <typename Self>
-auto forward_list<T, Alloc>::end(this Self &&self) noexcept {
+auto forward_list<T, Alloc, Instr, TrackTail>::end(this Self &&self) noexcept {
     using Iter = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
     return Iter(nullptr);
 }
 
-template <ForwardListable T, typename Alloc>
-forward_list<T, Alloc>::const_iterator forward_list<T, Alloc>::cend() const noexcept {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail>::const_iterator forward_list<T, Alloc, Instr, TrackTail>::cend() const noexcept {
     return const_iterator(nullptr);
 }
 
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <typename Self>
+auto forward_list<T, Alloc, Instr, TrackTail>::before_end(this Self &&self) noexcept
+    requires TrackTail
+{
+    using Iter = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+    return Iter(self.before_end_);
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+forward_list<T, Alloc, Instr, TrackTail>::const_iterator forward_list<T, Alloc, Instr, TrackTail>::cbefore_end() const noexcept
+    requires TrackTail
+{
+    return const_iterator(before_end_);
+}
+
 // ===========================================================
 // Operations
 // ===========================================================
 
 // 1. Splice entire list: moves all elements from other to *this after pos
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::splice_after(const_iterator pos, forward_list &other) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::splice_after(const_iterator pos, forward_list &other) {
     if (other.empty()) return;
     if (this == &other) return; // 不能 splice 自身
+    check_allocator(other, "forward_list::splice_after: allocators differ");
 
     NodeBase *prev = get_node_base(pos);
     NodeBase *other_head = &other.head_;
     NodeBase *other_first = other_head->next;
 
-    // 找到 other 的最后一个节点
-    NodeBase *other_last = other_first;
-    while (other_last->next != nullptr) {
-        other_last = other_last->next;
+    // 找到 other 的最后一个节点：跟踪尾部时 O(1)，否则需要遍历
+    NodeBase *other_last = other.last_node();
+    if constexpr (!TrackTail) {
+        MYS_INSTRUMENT(on_visit(other.length_));
     }
 
     // 链接
     other_last->next = prev->next;
     prev->next = other_first;
+    relink_tail(prev, other_last);
 
     // 清空 other
     other_head->next = nullptr;
+    other.unlink_tail(other_head);
 
     length_ += other.length_;
     other.length_ = 0;
+    MYS_INSTRUMENT(on_length(length_));
 }
 
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::splice_after(const_iterator pos, forward_list &&other) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::splice_after(const_iterator pos, forward_list &&other) {
     splice_after(pos, other);
 }
 
 // 2. Splice single element: moves element *after* it from other to *this after pos
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::splice_after(const_iterator pos, forward_list &other, const_iterator it) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::splice_after(const_iterator pos, forward_list &other, const_iterator it) {
     NodeBase *pos_ptr = get_node_base(pos);
     NodeBase *it_ptr = get_node_base(it); // 这里的 it 指向要移动的节点的前一个节点
 
@@ -310,26 +614,32 @@ void forward_list<T, Alloc>::splice_after(const_iterator pos, forward_list &othe
 
     NodeBase *node_to_move = it_ptr->next;
     if (!node_to_move) return;
+    if (this != &other) check_allocator(other, "forward_list::splice_after: allocators differ");
 
     // 从 other 中断开
     it_ptr->next = node_to_move->next;
+    other.unlink_tail(it_ptr);
 
     // 插入到 this
     node_to_move->next = pos_ptr->next;
     pos_ptr->next = node_to_move;
+    relink_tail(pos_ptr, node_to_move);
 
     other.length_--;
     length_++;
+    MYS_INSTRUMENT(on_visit(1));
+    MYS_INSTRUMENT(on_length(length_));
 }
 
 // 3. Splice range: moves (first, last) from other to *this after pos
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::splice_after(const_iterator pos, forward_list &other, const_iterator first, const_iterator last) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::splice_after(const_iterator pos, forward_list &other, const_iterator first, const_iterator last) {
     NodeBase *pos_ptr = get_node_base(pos);
     NodeBase *first_ptr = get_node_base(first);
     NodeBase *last_ptr = get_node_base(last); // last 是开区间，不移动
 
     if (first_ptr == last_ptr || first_ptr->next == last_ptr) return;
+    if (this != &other) check_allocator(other, "forward_list::splice_after: allocators differ");
 
     // 找到要移动范围的尾部节点 (即 last 之前的一个节点)
     NodeBase *range_tail = first_ptr->next;
@@ -344,27 +654,32 @@ void forward_list<T, Alloc>::splice_after(const_iterator pos, forward_list &othe
 
     // 从 other 断开
     first_ptr->next = last_ptr;
+    other.unlink_tail(first_ptr);
 
     // 接入 this
     range_tail->next = pos_ptr->next;
     pos_ptr->next = range_head;
+    relink_tail(pos_ptr, range_tail);
 
     other.length_ -= count;
     length_ += count;
+    MYS_INSTRUMENT(on_visit(count));
+    MYS_INSTRUMENT(on_length(length_));
 }
 
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::remove(const T &value) {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::remove(const T &value) {
     remove_if([&value](const T &v) { return v == value; });
 }
 
-template <ForwardListable T, typename Alloc>
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
 template <typename Predicate>
-void forward_list<T, Alloc>::remove_if(Predicate pred) {
+void forward_list<T, Alloc, Instr, TrackTail>::remove_if(Predicate pred) {
     iterator prev = before_begin();
     iterator curr = begin();
 
     while (curr != end()) {
+        MYS_INSTRUMENT(on_visit(1));
         if (pred(*curr)) {
             curr = erase_after(prev);
         } else {
@@ -374,14 +689,14 @@ void forward_list<T, Alloc>::remove_if(Predicate pred) {
     }
 }
 
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::unique() {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::unique() {
     unique(std::equal_to<T>());
 }
 
-template <ForwardListable T, typename Alloc>
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
 template <typename BinaryPredicate>
-void forward_list<T, Alloc>::unique(BinaryPredicate pred) {
+void forward_list<T, Alloc, Instr, TrackTail>::unique(BinaryPredicate pred) {
     iterator curr = begin();
     iterator last = end();
 
@@ -392,6 +707,7 @@ void forward_list<T, Alloc>::unique(BinaryPredicate pred) {
         ++next_node;
         if (next_node == last) break;
 
+        MYS_INSTRUMENT(on_visit(1));
         if (pred(*curr, *next_node)) {
             erase_after(curr);
         } else {
@@ -400,14 +716,19 @@ void forward_list<T, Alloc>::unique(BinaryPredicate pred) {
     }
 }
 
-template <ForwardListable T, typename Alloc>
-void forward_list<T, Alloc>::reverse() noexcept {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::reverse() noexcept {
     if (empty()) return;
 
     NodeBase *prev = nullptr;
     NodeBase *curr = head_.next;
     NodeBase *next = nullptr;
 
+    // 原来的首节点成为新的尾部
+    if constexpr (TrackTail) {
+        before_end_ = curr;
+    }
+
     while (curr != nullptr) {
         next = curr->next; // 保存下一个
         curr->next = prev; // 反转指针
@@ -418,12 +739,132 @@ void forward_list<T, Alloc>::reverse() noexcept {
     head_.next = prev; // 更新头节点
 }
 
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::compact() {
+    // 旧节点摘下后先挂在 retired 上，全部新节点分配完才释放，分配器不会把旧槽位再交回来
+    NodeBase *retired = nullptr;
+    try {
+        for (NodeBase *prev = &head_, *old = head_.next; old != nullptr; old = prev->next) {
+            Node *node = create_node(std::move_if_noexcept(static_cast<Node *>(old)->val));
+            // 新节点原地顶替旧节点，每一步之后链表都是完整的
+            node->next = old->next;
+            prev->next = node;
+            relink_tail(old, node);
+            old->next = retired;
+            retired = old;
+            prev = node;
+        }
+    } catch (...) {
+        destroy_chain(retired);
+        throw;
+    }
+    destroy_chain(retired);
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+double forward_list<T, Alloc, Instr, TrackTail>::fragmentation() const noexcept {
+    if (length_ < 2) return 0.0;
+
+    std::size_t scattered = 0;
+    for (const NodeBase *node = head_.next; node->next != nullptr; node = node->next) {
+        scattered += !adjacent(node, node->next);
+    }
+    return static_cast<double>(scattered) / static_cast<double>(length_ - 1);
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+bool forward_list<T, Alloc, Instr, TrackTail>::compact_if(double threshold) {
+    if (fragmentation() <= threshold) return false;
+    compact();
+    return true;
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::merge(forward_list &other) {
+    merge(other, std::less<T>());
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::merge(forward_list &&other) {
+    merge(other, std::less<T>());
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <typename Compare>
+void forward_list<T, Alloc, Instr, TrackTail>::merge(forward_list &other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    check_allocator(other, "forward_list::merge: allocators differ");
+
+    // 先把 other 的节点整体转到 *this 名下，比较器抛出时它们也留在 *this 中
+    NodeBase *a = head_.next;
+    NodeBase *b = other.head_.next;
+    length_ += other.length_;
+    MYS_INSTRUMENT(on_length(length_));
+    other.head_.next = nullptr;
+    other.length_ = 0;
+    other.unlink_tail(&other.head_);
+
+    try {
+        [[maybe_unused]] NodeBase *last = merge_runs(&head_, a, b, comp);
+        if constexpr (TrackTail) {
+            before_end_ = last;
+        }
+    } catch (...) {
+        reset_tail_from(&head_);
+        throw;
+    }
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <typename Compare>
+void forward_list<T, Alloc, Instr, TrackTail>::merge(forward_list &&other, Compare comp) {
+    merge(other, comp);
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+void forward_list<T, Alloc, Instr, TrackTail>::sort() {
+    sort(std::less<T>());
+}
+
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+template <typename Compare>
+void forward_list<T, Alloc, Instr, TrackTail>::sort(Compare comp) {
+    if (length_ < 2) return;
+
+    NodeBase *tail = &head_;
+    NodeBase *curr = nullptr;
+    try {
+        // 每一轮把相邻的两段长度为 width 的有序段归并成一段
+        for (std::size_t width = 1; width < length_; width *= 2) {
+            tail = &head_;
+            curr = head_.next;
+            while (curr != nullptr) {
+                NodeBase *left = curr;
+                NodeBase *right = split_after(left, width);
+                curr = split_after(right, width);
+                tail = merge_runs(tail, left, right, comp);
+            }
+            if constexpr (TrackTail) {
+                before_end_ = tail;
+            }
+        }
+    } catch (...) {
+        // 被打断的两段已由 merge_runs 接回，再接上本轮尚未处理的部分；元素顺序未指定
+        while (tail->next != nullptr) {
+            tail = tail->next;
+        }
+        tail->next = curr;
+        reset_tail_from(tail);
+        throw;
+    }
+}
+
 // ===========================================================
 // Comparison Operators
 // ===========================================================
 
-template <ForwardListable T, typename Alloc>
-std::strong_ordering forward_list<T, Alloc>::operator<=>(const forward_list &other) const {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+std::strong_ordering forward_list<T, Alloc, Instr, TrackTail>::operator<=>(const forward_list &other) const {
     auto it1 = begin();
     auto it2 = other.begin();
     auto end1 = end();
@@ -439,8 +880,8 @@ std::strong_ordering forward_list<T, Alloc>::operator<=>(const forward_list &oth
     return (it1 == end1 && it2 == end2) ? std::strong_ordering::equal : (it1 == end1) ? std::strong_ordering::less : std::strong_ordering::greater;
 }
 
-template <ForwardListable T, typename Alloc>
-bool forward_list<T, Alloc>::operator==(const forward_list &other) const {
+template <ForwardListable T, typename Alloc, ListInstrumentation Instr, bool TrackTail>
+bool forward_list<T, Alloc, Instr, TrackTail>::operator==(const forward_list &other) const {
     if (length_ != other.length_) return false; // 优化：如果长度不同直接返回 false
 
     auto it1 = begin();
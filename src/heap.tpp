@@ -0,0 +1,259 @@
+#include "heap.h"
+#include <stdexcept>
+
+namespace mys {
+
+// ===========================================================
+// 3. Element Access
+// ===========================================================
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+const T &heap<T, Compare, D, Allocator>::top() const {
+    if (empty()) {
+        throw std::out_of_range("empty");
+    }
+    return entries_[0].value;
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+const T &heap<T, Compare, D, Allocator>::value(handle h) const {
+    check_handle(h);
+    return entries_[position_[h.id]].value;
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+bool heap<T, Compare, D, Allocator>::contains(handle h) const noexcept {
+    return h.id < position_.size() && position_[h.id] != npos;
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+bool heap<T, Compare, D, Allocator>::empty() const noexcept {
+    return entries_.empty();
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+std::size_t heap<T, Compare, D, Allocator>::size() const noexcept {
+    return entries_.size();
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+void heap<T, Compare, D, Allocator>::reserve(std::size_t new_cap) {
+    entries_.reserve(new_cap);
+    position_.reserve(new_cap);
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+void heap<T, Compare, D, Allocator>::clear() noexcept {
+    entries_.clear();
+    position_.clear();
+    free_ids_.clear();
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+heap<T, Compare, D, Allocator>::handle heap<T, Compare, D, Allocator>::push(const T &value) {
+    return emplace(value);
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+heap<T, Compare, D, Allocator>::handle heap<T, Compare, D, Allocator>::push(T &&value) {
+    return emplace(std::move(value));
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+template <typename... Args>
+heap<T, Compare, D, Allocator>::handle heap<T, Compare, D, Allocator>::emplace(Args &&...args) {
+    entries_.emplace_back(Entry{T(std::forward<Args>(args)...), npos});
+    std::size_t id;
+    try {
+        id = allocate_id();
+    } catch (...) {
+        entries_.pop_back();
+        throw;
+    }
+    std::size_t index = entries_.size() - 1;
+    entries_[index].id = id;
+    position_[id] = index;
+    try {
+        sift_up(index);
+    } catch (...) {
+        // The entry is back at the end: drop it and hand the id back without allocating
+        entries_.pop_back();
+        if (id == position_.size() - 1) {
+            position_.pop_back();
+        } else {
+            position_[id] = npos;
+            free_ids_.push_back(id);
+        }
+        throw;
+    }
+    return handle{id};
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+void heap<T, Compare, D, Allocator>::pop() {
+    if (empty()) return;
+    erase(handle{entries_[0].id});
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+void heap<T, Compare, D, Allocator>::update(handle h, T value) {
+    check_handle(h);
+    std::size_t index = position_[h.id];
+    std::swap(entries_[index].value, value);
+    try {
+        if (sift_up(index) == index) {
+            sift_down(index);
+        }
+    } catch (...) {
+        // The entry is back at index; value still holds the old one
+        entries_[index].value = std::move(value);
+        throw;
+    }
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+void heap<T, Compare, D, Allocator>::decrease_key(handle h, T value) {
+    check_handle(h);
+    std::size_t index = position_[h.id];
+    std::swap(entries_[index].value, value);
+    try {
+        sift_up(index);
+    } catch (...) {
+        entries_[index].value = std::move(value);
+        throw;
+    }
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+void heap<T, Compare, D, Allocator>::erase(handle h) {
+    check_handle(h);
+    // Recycle the id first: apart from Compare it is the only step that can throw
+    free_ids_.push_back(h.id);
+
+    std::size_t index = position_[h.id];
+    position_[h.id] = npos;
+    std::size_t last = entries_.size() - 1;
+    if (index == last) {
+        entries_.pop_back();
+        return;
+    }
+
+    // Fill the hole with the last entry and let it find its place in either direction
+    Entry removed = std::move(entries_[index]);
+    place(index, std::move(entries_[last]));
+    entries_.pop_back();
+    try {
+        if (sift_up(index) == index) {
+            sift_down(index);
+        }
+    } catch (...) {
+        // The last entry is back at index: return it to the end (within capacity, so this cannot
+        // reallocate) and restore the erased one
+        entries_.emplace_back(std::move(entries_[index]));
+        position_[entries_[last].id] = last;
+        place(index, std::move(removed));
+        position_[h.id] = index;
+        free_ids_.pop_back();
+        throw;
+    }
+}
+
+// ===========================================================
+// Helper Functions
+// ===========================================================
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+std::size_t heap<T, Compare, D, Allocator>::sift_up(std::size_t index) {
+    if (index == 0) return 0;
+
+    std::size_t start = index;
+    Entry hole = std::move(entries_[index]);
+    try {
+        while (index > 0) {
+            std::size_t parent = (index - 1) / D;
+            if (!comp_(entries_[parent].value, hole.value)) break;
+            place(index, std::move(entries_[parent]));
+            index = parent;
+        }
+    } catch (...) {
+        // Every entry on the path moved down one level: rotate them back up through hole
+        for (std::size_t cur = start; cur != index; cur = (cur - 1) / D) {
+            std::swap(hole, entries_[cur]);
+            position_[entries_[cur].id] = cur;
+        }
+        place(index, std::move(hole));
+        throw;
+    }
+    place(index, std::move(hole));
+    return index;
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+std::size_t heap<T, Compare, D, Allocator>::sift_down(std::size_t index) {
+    std::size_t n = entries_.size();
+    if (D * index + 1 >= n) return index;
+
+    std::size_t start = index;
+    Entry hole = std::move(entries_[index]);
+    try {
+        for (;;) {
+            std::size_t first = D * index + 1;
+            if (first >= n) break;
+
+            // Pick the highest-priority child; all D children are contiguous in memory
+            std::size_t last = first + D < n ? first + D : n;
+            std::size_t best = first;
+            for (std::size_t child = first + 1; child < last; ++child) {
+                if (comp_(entries_[best].value, entries_[child].value)) best = child;
+            }
+            if (!comp_(hole.value, entries_[best].value)) break;
+            place(index, std::move(entries_[best]));
+            index = best;
+        }
+    } catch (...) {
+        // Every entry on the path moved up one level: move them back down, then refill start
+        while (index != start) {
+            std::size_t parent = (index - 1) / D;
+            place(index, std::move(entries_[parent]));
+            index = parent;
+        }
+        place(start, std::move(hole));
+        throw;
+    }
+    place(index, std::move(hole));
+    return index;
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+void heap<T, Compare, D, Allocator>::place(std::size_t index, Entry &&entry) {
+    entries_[index] = std::move(entry);
+    position_[entries_[index].id] = index;
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+std::size_t heap<T, Compare, D, Allocator>::allocate_id() {
+    if (!free_ids_.empty()) {
+        std::size_t id = free_ids_.back();
+        free_ids_.pop_back();
+        return id;
+    }
+    position_.push_back(npos);
+    return position_.size() - 1;
+}
+
+template <std::movable T, typename Compare, std::size_t D, typename Allocator>
+void heap<T, Compare, D, Allocator>::check_handle(handle h) const {
+    if (!contains(h)) {
+        throw std::out_of_range("invalid heap handle");
+    }
+}
+
+} // namespace mys
\ No newline at end of file
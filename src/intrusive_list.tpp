@@ -0,0 +1,279 @@
+#include "intrusive_list.h"
+#include <stdexcept>
+#include <utility>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook>::intrusive_list(intrusive_list &&other) noexcept : head_(other.head_), length(other.length) {
+    // The boundary hooks still point at other's sentinel
+    head_.reattach(length == 0);
+    other.length = 0;
+    other.head_.reattach(true);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook> &intrusive_list<T, Hook>::operator=(intrusive_list &&other) noexcept {
+    if (this != &other) {
+        clear();
+        head_ = other.head_;
+        length = other.length;
+        head_.reattach(length == 0);
+        other.length = 0;
+        other.head_.reattach(true);
+    }
+    return *this;
+}
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook>::~intrusive_list() {
+    clear();
+}
+
+// ===========================================================
+// 3. Element Access
+// ===========================================================
+
+template <typename T, list_hook<T> T::*Hook>
+template <typename Self>
+auto &&intrusive_list<T, Hook>::front(this Self &&self) {
+    if (self.empty()) {
+        throw std::out_of_range("empty");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(*owner(self.head_.next));
+}
+
+template <typename T, list_hook<T> T::*Hook>
+template <typename Self>
+auto &&intrusive_list<T, Hook>::back(this Self &&self) {
+    if (self.empty()) {
+        throw std::out_of_range("empty");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(*owner(self.head_.prev));
+}
+
+template <typename T, list_hook<T> T::*Hook>
+template <typename Self>
+auto intrusive_list<T, Hook>::iterator_to(this Self &&self, const T &value) noexcept {
+    constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
+    return IntrusiveIterator<is_const>(&hook(const_cast<T &>(value)));
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <typename T, list_hook<T> T::*Hook>
+bool intrusive_list<T, Hook>::empty() const noexcept {
+    return length == 0;
+}
+
+template <typename T, list_hook<T> T::*Hook>
+std::size_t intrusive_list<T, Hook>::size() const noexcept {
+    return length;
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <typename T, list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::clear() noexcept {
+    // Reset every hook so the elements can be linked into another list afterwards
+    NodeBase *cur = head_.next;
+    while (cur != &head_) {
+        NodeBase *next = cur->next;
+        *cur = NodeBase{};
+        cur = next;
+    }
+    length = 0;
+    head_.reattach(true);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::swap(intrusive_list &other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(length, other.length);
+    head_.reattach(length == 0);
+    other.head_.reattach(other.length == 0);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::push_back(T &value) {
+    link_value(&head_, value);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::push_front(T &value) {
+    link_value(head_.next, value);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::pop_back() noexcept {
+    if (empty()) return;
+    erase(*owner(head_.prev));
+}
+
+template <typename T, list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::pop_front() noexcept {
+    if (empty()) return;
+    erase(*owner(head_.next));
+}
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(const_iterator pos, T &value) {
+    return link_value(const_cast<NodeBase *>(pos.current_), value);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(const_iterator pos) {
+    if (pos.current_ == &head_) throw std::out_of_range("Erase out of range");
+    return erase(*const_cast<T *>(owner(pos.current_)));
+}
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(const_iterator first, const_iterator last) {
+    auto it = first;
+    while (it != last) {
+        it = erase(it);
+    }
+    return iterator(const_cast<NodeBase *>(last.current_));
+}
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(T &value) noexcept {
+    NodeBase *node = &hook(value);
+    NodeBase *next = node->next;
+    // A single-node unlink nulls both of its links, which marks the hook as free again
+    NodeBase::unlink_range(node, node);
+    length--;
+    return iterator(next);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list &other) noexcept {
+    if (this == &other || other.empty()) return;
+    NodeBase *first = other.head_.next;
+    NodeBase *last = other.head_.prev;
+    NodeBase::unlink_range(first, last);
+    NodeBase::link_range(const_cast<NodeBase *>(pos.current_), first, last);
+    length += other.length;
+    other.length = 0;
+}
+
+template <typename T, list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list &other, const_iterator it) noexcept {
+    NodeBase *node = const_cast<NodeBase *>(it.current_);
+    NodeBase *before = const_cast<NodeBase *>(pos.current_);
+    if (node == before || node->next == before) return; // already in place
+    NodeBase::unlink_range(node, node);
+    NodeBase::link_range(before, node, node);
+    other.length--;
+    length++;
+}
+
+template <typename T, list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list &other, const_iterator first, const_iterator last) noexcept {
+    if (first == last) return;
+    NodeBase *range_first = const_cast<NodeBase *>(first.current_);
+    NodeBase *range_last = last.current_->prev;
+
+    // Moving within one list leaves the size unchanged; otherwise the range has to be counted
+    if (this != &other) {
+        std::size_t count = 1;
+        for (NodeBase *cur = range_first; cur != range_last; cur = cur->next) {
+            ++count;
+        }
+        other.length -= count;
+        length += count;
+    }
+    NodeBase::unlink_range(range_first, range_last);
+    NodeBase::link_range(const_cast<NodeBase *>(pos.current_), range_first, range_last);
+}
+
+// ===========================================================
+// 6. Iterator Interface
+// ===========================================================
+
+template <typename T, list_hook<T> T::*Hook>
+template <typename Self>
+auto intrusive_list<T, Hook>::begin(this Self &&self) noexcept {
+    constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
+    return IntrusiveIterator<is_const>(self.head_.next);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::cbegin() const noexcept {
+    return const_iterator(head_.next);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+template <typename Self>
+auto intrusive_list<T, Hook>::end(this Self &&self) noexcept {
+    constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
+    return IntrusiveIterator<is_const>(&self.head_);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::cend() const noexcept {
+    return const_iterator(&head_);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+template <typename Self>
+auto intrusive_list<T, Hook>::rbegin(this Self &&self) noexcept {
+    return std::reverse_iterator(self.end());
+}
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook>::const_reverse_iterator intrusive_list<T, Hook>::crbegin() const noexcept {
+    return const_reverse_iterator(end());
+}
+
+template <typename T, list_hook<T> T::*Hook>
+template <typename Self>
+auto intrusive_list<T, Hook>::rend(this Self &&self) noexcept {
+    return std::reverse_iterator(self.begin());
+}
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook>::const_reverse_iterator intrusive_list<T, Hook>::crend() const noexcept {
+    return const_reverse_iterator(begin());
+}
+
+// ===========================================================
+// Helper Functions
+// ===========================================================
+
+template <typename T, list_hook<T> T::*Hook>
+T *intrusive_list<T, Hook>::owner(NodeBase *node) noexcept {
+    return const_cast<T *>(owner(static_cast<const NodeBase *>(node)));
+}
+
+template <typename T, list_hook<T> T::*Hook>
+const T *intrusive_list<T, Hook>::owner(const NodeBase *node) noexcept {
+    // Measure the hook's offset on raw storage: only the member's address is formed, nothing is
+    // read, and the compiler folds the whole computation into a constant
+    alignas(T) unsigned char storage[sizeof(T)];
+    auto *probe = reinterpret_cast<T *>(storage);
+    std::ptrdiff_t offset = reinterpret_cast<unsigned char *>(&(probe->*Hook)) - storage;
+    auto *hook_bytes = reinterpret_cast<const unsigned char *>(static_cast<const list_hook<T> *>(node));
+    return reinterpret_cast<const T *>(hook_bytes - offset);
+}
+
+template <typename T, list_hook<T> T::*Hook>
+intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::link_value(NodeBase *pos, T &value) {
+    list_hook<T> &node = hook(value);
+    if (node.is_linked()) throw std::invalid_argument("Hook already linked");
+    NodeBase::link_range(pos, &node, &node);
+    length++;
+    return iterator(&node);
+}
+
+} // namespace mys
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "list.h"
 #include <initializer_list>
+#include <cstdint>
 #include <memory>
+#include <functional>
+#include <stdexcept>
 
 namespace mys {
 
@@ -8,55 +11,62 @@ namespace mys {
 // 2. Construction and Destruction (Lifecycle Management)
 // ===========================================================
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::list(std::initializer_list<T> init) : list() {
-    for (auto &x : init) {
-        push_back(x);
-    }
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::list(const Allocator &alloc) noexcept : allocator_(alloc) {}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::list(std::initializer_list<T> init) : list() {
+    append_range(init);
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::list(const list &other) : list() {
-    for (const auto &item : other) {
-        push_back(item);
-    }
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::list(const list &other) : list() {
+    append_range(other);
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::list(list &&other) noexcept :
-    head(other.head), tail(other.tail), length(other.length), allocator_(std::move(other.allocator_)) {
-    other.head = nullptr;
-    other.tail = nullptr;
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::list(list &&other) noexcept :
+    allocator_(std::move(other.allocator_)), head_(other.head_), length(other.length) {
+    reattach_head();
     other.length = 0;
+    other.reattach_head();
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator> &list<T, Allocator>::operator=(const list &other) {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation> &list<T, Allocator, Instrumentation>::operator=(const list &other) {
     if (this != &other) {
-        clear();
-        for (const auto &item : other) {
-            push_back(item);
-        }
+        assign_range(other);
     }
     return *this;
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator> &list<T, Allocator>::operator=(list &&other) noexcept {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation> &list<T, Allocator, Instrumentation>::operator=(list &&other) noexcept(nothrow_move_assign) {
     if (this != &other) {
+        if constexpr (!nothrow_move_assign) {
+            // 分配器不传播且不相等：节点不能转移，只能逐个移动元素到自己的节点里
+            if (allocator_ != other.allocator_) {
+                assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+                return *this;
+            }
+        }
         clear();
-        head = other.head;
-        tail = other.tail;
+        // 接管的节点由 other 的分配器分配，必须连同分配器一起转移
+        if constexpr (std::allocator_traits<NodeAlloc>::propagate_on_container_move_assignment::value) {
+            allocator_ = std::move(other.allocator_);
+        }
+        head_ = other.head_;
         length = other.length;
-        other.head = nullptr;
-        other.tail = nullptr;
+        reattach_head();
         other.length = 0;
+        other.reattach_head();
     }
     return *this;
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::~list() {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::~list() {
     clear();
 }
 
@@ -64,272 +74,205 @@ list<T, Allocator>::~list() {
 // 3. Element Access
 // ===========================================================
 
-template <Listable T, typename Allocator>
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
 template <typename Self>
-auto &&list<T, Allocator>::front(this Self &&self) {
+auto &&list<T, Allocator, Instrumentation>::front(this Self &&self) {
     if (self.empty()) {
         throw std::out_of_range("empty");
     }
     using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
-    return static_cast<ReturnType>(self.head->val);
+    return static_cast<ReturnType>(static_cast<Node *>(self.head_.next)->val);
     // #include<utility>
-    // return std::forward_like<Self>(self.head->val);
+    // return std::forward_like<Self>(static_cast<Node *>(self.head_.next)->val);
 }
 
-template <Listable T, typename Allocator>
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
 template <typename Self>
-auto &&list<T, Allocator>::back(this Self &&self) {
+auto &&list<T, Allocator, Instrumentation>::back(this Self &&self) {
     if (self.empty()) {
         throw std::out_of_range("empty");
     }
     using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
-    return static_cast<ReturnType>(self.tail->val);
+    return static_cast<ReturnType>(static_cast<Node *>(self.head_.prev)->val);
 }
 
 // ===========================================================
 // 4. Capacity Query
 // ===========================================================
 
-template <Listable T, typename Allocator>
-bool list<T, Allocator>::empty() const noexcept {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+bool list<T, Allocator, Instrumentation>::empty() const noexcept {
     return length == 0;
 }
 
-template <Listable T, typename Allocator>
-std::size_t list<T, Allocator>::size() const noexcept {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+std::size_t list<T, Allocator, Instrumentation>::size() const noexcept {
     return length;
 }
 
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <typename Self>
+auto &&list<T, Allocator, Instrumentation>::instrumentation(this Self &&self) noexcept {
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const Instrumentation &, Instrumentation &>;
+    return static_cast<ReturnType>(self.instrumentation_);
+}
+
 // ===========================================================
 // 5. Modifiers
 // ===========================================================
 
-template <Listable T, typename Allocator>
-void list<T, Allocator>::clear() noexcept {
-    while (head) {
-        Node *cur = head;
-        head = head->next;
-        destroy_node(cur);
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::clear() noexcept {
+    // 节点无需析构时，直接让池分配器整体归还 slab，不再逐个遍历
+    if constexpr (std::is_trivially_destructible_v<Node> && BulkReleasable<NodeAlloc>) {
+        if (allocator_.release()) {
+            MYS_INSTRUMENT(on_deallocate(length));
+            length = 0;
+            reattach_head();
+            return;
+        }
     }
-    tail = nullptr;
-    length = 0;
+    destroy_chain(release_chain());
 }
 
-template <Listable T, typename Allocator>
-void list<T, Allocator>::swap(list &other) noexcept {
-    std::swap(head, other.head);
-    std::swap(tail, other.tail);
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::swap(list &other) noexcept {
+    std::swap(head_, other.head_);
     std::swap(length, other.length);
     std::swap(allocator_, other.allocator_);
+    reattach_head();
+    other.reattach_head();
 }
 
-template <Listable T, typename Allocator>
-void list<T, Allocator>::push_back(const T &value) {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::push_back(const T &value) {
     // Node *p = new Node(value);
-    Node *p = create_node(value);
-    if (head == nullptr) {
-        head = p;
-        tail = p;
-    } else {
-        tail->next = p;
-        p->prev = tail;
-        tail = p;
-    }
-    length++;
+    link_node(&head_, create_node(value));
 }
 
-template <Listable T, typename Allocator>
-void list<T, Allocator>::push_back(T &&value) {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::push_back(T &&value) {
     // Node *p = new Node(value);
-    Node *p = create_node(std::move(value));
-    if (head == nullptr) {
-        head = p;
-        tail = p;
-    } else {
-        tail->next = p;
-        p->prev = tail;
-        tail = p;
-    }
-    length++;
+    link_node(&head_, create_node(std::move(value)));
 }
 
-template <Listable T, typename Allocator>
-void list<T, Allocator>::push_front(const T &value) {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::push_front(const T &value) {
     // Node *p = new Node(value);
-    Node *p = create_node(value);
-    if (head == nullptr) {
-        head = p;
-        tail = p;
-    } else {
-        p->next = head;
-        head->prev = p;
-        head = p;
-    }
-    length++;
+    link_node(head_.next, create_node(value));
 }
 
-template <Listable T, typename Allocator>
-void list<T, Allocator>::push_front(T &&value) {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::push_front(T &&value) {
     // Node *p = new Node(value);
-    Node *p = create_node(std::move(value));
-    if (head == nullptr) {
-        head = p;
-        tail = p;
-    } else {
-        p->next = head;
-        head->prev = p;
-        head = p;
-    }
-    length++;
+    link_node(head_.next, create_node(std::move(value)));
 }
 
-template <Listable T, typename Allocator>
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
 template <typename... Args>
-void list<T, Allocator>::emplace_back(Args &&...args) {
-    Node *p = create_node(std::forward<Args>(args)...);
-    if (head == nullptr) {
-        head = p;
-        tail = p;
-    } else {
-        tail->next = p;
-        p->prev = tail;
-        tail = p;
-    }
-    length++;
+void list<T, Allocator, Instrumentation>::emplace_back(Args &&...args) {
+    link_node(&head_, create_node(std::forward<Args>(args)...));
 }
 
-template <Listable T, typename Allocator>
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
 template <typename... Args>
-void list<T, Allocator>::emplace_front(Args &&...args) {
-    Node *p = create_node(std::forward<Args>(args)...);
-    if (head == nullptr) {
-        head = p;
-        tail = p;
-    } else {
-        p->next = head;
-        head->prev = p;
-        head = p;
-    }
-    length++;
+void list<T, Allocator, Instrumentation>::emplace_front(Args &&...args) {
+    link_node(head_.next, create_node(std::forward<Args>(args)...));
 }
 
-template <Listable T, typename Allocator>
-void list<T, Allocator>::pop_back() {
-    if (!tail) return;
-    Node *p = tail;
-    tail = tail->prev;
-    if (tail)
-        tail->next = nullptr;
-    else
-        head = nullptr;
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::pop_back() {
+    // 空表上 pop 保持为空操作：否则会把哨兵当作节点释放
+    if (length == 0) return;
+    NodeBase *p = head_.prev;
+    NodeBase::unlink_node(p);
     destroy_node(p);
     length--;
 }
 
-template <Listable T, typename Allocator>
-void list<T, Allocator>::pop_front() {
-    if (!head) return;
-    Node *p = head;
-    head = head->next;
-    if (head)
-        head->prev = nullptr;
-    else
-        tail = nullptr;
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::pop_front() {
+    if (length == 0) return;
+    NodeBase *p = head_.next;
+    NodeBase::unlink_node(p);
     destroy_node(p);
     length--;
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::iterator list<T, Allocator>::insert(const_iterator pos, const T &value) {
-    if (pos == begin()) {
-        emplace_front(value);
-        return begin();
-    } else if (pos == end()) {
-        emplace_back(value);
-        return iterator(tail, this);
-    } else {
-        Node *newnode = create_node(value);
-        Node *cur = const_cast<Node *>(pos.current_);
-        Node *pre = pos.current_->prev;
-        cur->prev = newnode;
-        newnode->next = cur;
-        pre->next = newnode;
-        newnode->prev = pre;
-        length++;
-        return iterator(newnode, this);
-    }
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::iterator list<T, Allocator, Instrumentation>::insert(const_iterator pos, const T &value) {
+    return iterator(link_node(const_cast<NodeBase *>(pos.current_), create_node(value)));
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::iterator list<T, Allocator>::insert(const_iterator pos, T &&value) {
-    if (pos == begin()) {
-        emplace_front(std::move(value));
-        return begin();
-    } else if (pos == end()) {
-        emplace_back(std::move(value));
-        return iterator(tail, this);
-    } else {
-        Node *newnode = create_node(std::move(value));
-        Node *cur = const_cast<Node *>(pos.current_);
-        Node *pre = pos.current_->prev;
-        cur->prev = newnode;
-        newnode->next = cur;
-        pre->next = newnode;
-        newnode->prev = pre;
-        length++;
-        return iterator(newnode, this);
-    }
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::iterator list<T, Allocator, Instrumentation>::insert(const_iterator pos, T &&value) {
+    return iterator(link_node(const_cast<NodeBase *>(pos.current_), create_node(std::move(value))));
 }
 
 // emplace_front
-template <Listable T, typename Allocator>
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
 template <typename... Args>
-list<T, Allocator>::iterator list<T, Allocator>::emplace(const_iterator pos, Args &&...args) {
-    if (pos == begin()) {
-        emplace_front(std::forward<Args>(args)...);
-        return begin();
-    } else if (pos == end()) {
-        emplace_back(std::forward<Args>(args)...);
-        return iterator(tail, this);
-    } else {
-        Node *newnode = create_node(std::forward<Args>(args)...);
-        Node *cur = const_cast<Node *>(pos.current_);
-        Node *pre = cur->prev;
-        cur->prev = newnode;
-        newnode->next = cur;
-        pre->next = newnode;
-        newnode->prev = pre;
-        length++;
-        return iterator(newnode, this);
-    }
+list<T, Allocator, Instrumentation>::iterator list<T, Allocator, Instrumentation>::emplace(const_iterator pos, Args &&...args) {
+    return iterator(link_node(const_cast<NodeBase *>(pos.current_), create_node(std::forward<Args>(args)...)));
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::iterator list<T, Allocator>::erase(const_iterator pos) {
-    if (pos.current_ == nullptr) throw std::out_of_range("Erase out of range");
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <std::input_iterator InputIt>
+void list<T, Allocator, Instrumentation>::assign(InputIt first, InputIt last) {
+    replace_with_chain(build_chain(first, last));
+}
 
-    Node *to_delete = const_cast<Node *>(pos.current_);
-    Node *prev_node = to_delete->prev;
-    Node *next_node = to_delete->next;
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::assign(std::initializer_list<T> init) {
+    assign(init.begin(), init.end());
+}
 
-    // 处理前驱节点链接
-    if (prev_node) {
-        prev_node->next = next_node;
-    } else {
-        // 删除的是头节点
-        head = next_node;
-    }
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <ListRange<T> R>
+void list<T, Allocator, Instrumentation>::assign_range(R &&rg) {
+    replace_with_chain(build_chain(std::ranges::begin(rg), std::ranges::end(rg)));
+}
 
-    // 处理后继节点链接
-    if (next_node) {
-        next_node->prev = prev_node;
-    } else {
-        // 删除的是尾节点
-        tail = prev_node;
-    }
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <std::input_iterator InputIt>
+list<T, Allocator, Instrumentation>::iterator list<T, Allocator, Instrumentation>::insert(const_iterator pos, InputIt first, InputIt last) {
+    Chain chain = build_chain(first, last);
+    return iterator(link_chain(const_cast<NodeBase *>(pos.current_), chain));
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::iterator list<T, Allocator, Instrumentation>::insert(const_iterator pos, std::initializer_list<T> init) {
+    return insert(pos, init.begin(), init.end());
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <ListRange<T> R>
+list<T, Allocator, Instrumentation>::iterator list<T, Allocator, Instrumentation>::insert_range(const_iterator pos, R &&rg) {
+    Chain chain = build_chain(std::ranges::begin(rg), std::ranges::end(rg));
+    return iterator(link_chain(const_cast<NodeBase *>(pos.current_), chain));
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <ListRange<T> R>
+void list<T, Allocator, Instrumentation>::append_range(R &&rg) {
+    link_chain(&head_, build_chain(std::ranges::begin(rg), std::ranges::end(rg)));
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <ListRange<T> R>
+void list<T, Allocator, Instrumentation>::prepend_range(R &&rg) {
+    link_chain(head_.next, build_chain(std::ranges::begin(rg), std::ranges::end(rg)));
+}
 
-    // 保存下一个节点的指针用于返回
-    iterator result(next_node, this);
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::iterator list<T, Allocator, Instrumentation>::erase(const_iterator pos) {
+    if (pos.current_ == &head_) throw std::out_of_range("Erase out of range");
+    MYS_INSTRUMENT(on_erase());
+
+    NodeBase *to_delete = const_cast<NodeBase *>(pos.current_);
+    // 保存下一个节点的指针用于返回；前后都至少是哨兵，摘除无需分支
+    iterator result(to_delete->next);
+    NodeBase::unlink_node(to_delete);
 
     // 销毁被删除的节点
     destroy_node(to_delete);
@@ -338,70 +281,77 @@ list<T, Allocator>::iterator list<T, Allocator>::erase(const_iterator pos) {
     return result;
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::iterator list<T, Allocator>::erase(const_iterator first, const_iterator last) {
-    Node *current = const_cast<Node *>(first.current_);
-    if (current == nullptr) throw std::out_of_range("Erase out of range");
-    if (first == last) return iterator(current, this);
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::iterator list<T, Allocator, Instrumentation>::erase(const_iterator first, const_iterator last) {
+    NodeBase *current = const_cast<NodeBase *>(first.current_);
+    if (current == &head_) throw std::out_of_range("Erase out of range");
+    if (first == last) return iterator(current);
+
+    // 整段摘下只修一次前后链接，再逐个销毁
+    NodeBase *stop = const_cast<NodeBase *>(last.current_);
+    NodeBase::unlink_range(current, stop->prev);
 
-    auto it = first;
-    while (it != last) {
-        it = erase(it);
+    while (current) {
+        NodeBase *next = current->next;
+        MYS_INSTRUMENT(on_erase());
+        destroy_node(current);
+        length--;
+        current = next;
     }
 
-    return iterator(const_cast<Node *>(last.current_), this);
+    return iterator(stop);
 }
 
 // ===========================================================
 // 6. Iterator Interface
 // ===========================================================
 
-template <Listable T, typename Allocator>
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
 template <typename Self>
-auto list<T, Allocator>::begin(this Self &&self) noexcept {
+auto list<T, Allocator, Instrumentation>::begin(this Self &&self) noexcept {
     // using BaseSelf = std::remove_reference_t<Self>;
     // using IterType = std::conditional_t<std::is_const_v<BaseSelf>, const_iterator, iterator>;
-    // return IterType(self.head);
+    // return IterType(self.head_.next);
     constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
-    return ListIterator<is_const>(self.head, &self);
+    return ListIterator<is_const>(self.head_.next);
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::const_iterator list<T, Allocator>::cbegin() const noexcept {
-    return const_iterator(head, this);
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::const_iterator list<T, Allocator, Instrumentation>::cbegin() const noexcept {
+    return const_iterator(head_.next);
 }
 
-template <Listable T, typename Allocator>
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
 template <typename Self>
-auto list<T, Allocator>::end(this Self &&self) noexcept {
+auto list<T, Allocator, Instrumentation>::end(this Self &&self) noexcept {
     constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
-    return ListIterator<is_const>(nullptr, &self);
+    return ListIterator<is_const>(&self.head_);
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::const_iterator list<T, Allocator>::cend() const noexcept {
-    return const_iterator(nullptr, this);
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::const_iterator list<T, Allocator, Instrumentation>::cend() const noexcept {
+    return const_iterator(&head_);
 }
 
-template <Listable T, typename Allocator>
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
 template <typename Self>
-auto list<T, Allocator>::rbegin(this Self &&self) noexcept {
+auto list<T, Allocator, Instrumentation>::rbegin(this Self &&self) noexcept {
     return std::reverse_iterator(self.end()); // 利用 CTAD
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::const_reverse_iterator list<T, Allocator>::crbegin() const noexcept {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::const_reverse_iterator list<T, Allocator, Instrumentation>::crbegin() const noexcept {
     return const_reverse_iterator(end());
 }
 
-template <Listable T, typename Allocator>
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
 template <typename Self>
-auto list<T, Allocator>::rend(this Self &&self) noexcept {
+auto list<T, Allocator, Instrumentation>::rend(this Self &&self) noexcept {
     return std::reverse_iterator(self.begin());
 }
 
-template <Listable T, typename Allocator>
-list<T, Allocator>::const_reverse_iterator list<T, Allocator>::crend() const noexcept {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::const_reverse_iterator list<T, Allocator, Instrumentation>::crend() const noexcept {
     return const_reverse_iterator(begin());
 }
 
@@ -415,8 +365,8 @@ concept ThreeWayComparable = requires(const T &a, const T &b) {
     { a <=> b } -> std::convertible_to<std::strong_ordering>;
 };
 
-template <Listable T, typename Allocator>
-std::strong_ordering list<T, Allocator>::operator<=>(const list &other) const {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+std::strong_ordering list<T, Allocator, Instrumentation>::operator<=>(const list &other) const {
     auto it1 = begin();
     auto it2 = other.begin();
 
@@ -434,18 +384,279 @@ std::strong_ordering list<T, Allocator>::operator<=>(const list &other) const {
     return size() <=> other.size();
 }
 
-template <Listable T, typename Allocator>
-bool list<T, Allocator>::operator==(const list &other) const {
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+bool list<T, Allocator, Instrumentation>::operator==(const list &other) const {
     return (*this <=> other) == std::strong_ordering::equal;
 }
 
+// ===========================================================
+// 8. Other Operations
+// ===========================================================
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::merge(list &other) {
+    merge(other, std::less<T>());
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::merge(list &&other) {
+    merge(other, std::less<T>());
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <typename Compare>
+void list<T, Allocator, Instrumentation>::merge(list &other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    check_allocator(other, "list::merge: allocators differ");
+
+    std::size_t total = length + other.length;
+    NodeBase *a = release_chain();
+    NodeBase *b = other.release_chain();
+    // 两条链已经摘下，无论比较器是否抛出，所有节点最终都归 *this 所有
+    length = total;
+    MYS_INSTRUMENT(on_length(length));
+    try {
+        close_chain(merge_runs(&head_, a, b, comp));
+    } catch (...) {
+        close_chain(&head_);
+        throw;
+    }
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <typename Compare>
+void list<T, Allocator, Instrumentation>::merge(list &&other, Compare comp) {
+    merge(other, comp);
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::sort() {
+    sort(std::less<T>());
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <typename Compare>
+void list<T, Allocator, Instrumentation>::sort(Compare comp) {
+    if (length < 2) return;
+
+    // Open the ring into a null-terminated chain hanging off head_, close it again at the end
+    head_.prev->next = nullptr;
+    NodeBase *last = &head_;
+    NodeBase *curr = nullptr;
+
+    try {
+        // Each pass merges adjacent sorted runs of length width into runs of 2 * width
+        for (std::size_t width = 1; width < length; width *= 2) {
+            last = &head_;
+            curr = head_.next;
+            while (curr) {
+                NodeBase *left = curr;
+                NodeBase *right = split_after(left, width);
+                curr = split_after(right, width);
+                last = merge_runs(last, left, right, comp);
+            }
+        }
+    } catch (...) {
+        // merge_runs already hung the two interrupted runs after last; append the unvisited runs
+        // and close the ring, leaving every element in the list in some unspecified order
+        NodeBase *tail = last;
+        while (tail->next) tail = tail->next;
+        tail->next = curr;
+        close_chain(last);
+        throw;
+    }
+    close_chain(last);
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::splice(const_iterator pos, list &other) {
+    if (this == &other || other.empty()) return;
+    check_allocator(other, "list::splice: allocators differ");
+
+    Chain chain{other.head_.next, other.head_.prev, other.length};
+    other.length = 0;
+    other.reattach_head();
+    link_chain(const_cast<NodeBase *>(pos.current_), chain);
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::splice(const_iterator pos, list &&other) {
+    splice(pos, other);
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::splice(const_iterator pos, list &other, const_iterator it) {
+    NodeBase *node = const_cast<NodeBase *>(it.current_);
+    NodeBase *before = const_cast<NodeBase *>(pos.current_);
+    // 移到自己前面或后继前面都不改变顺序
+    if (node == before || node->next == before) return;
+    if (this != &other) check_allocator(other, "list::splice: allocators differ");
+
+    NodeBase::unlink_range(node, node);
+    other.length--;
+    link_chain(before, Chain{node, node, 1});
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::splice(const_iterator pos, list &&other, const_iterator it) {
+    splice(pos, other, it);
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::splice(const_iterator pos, list &other, const_iterator first, const_iterator last) {
+    if (first == last) return;
+
+    NodeBase *range_first = const_cast<NodeBase *>(first.current_);
+    NodeBase *range_last = last.current_->prev;
+    NodeBase *before = const_cast<NodeBase *>(pos.current_);
+
+    // 同一链表内只需重连，长度不变；跨链表才需要数出移动的节点数
+    if (this == &other) {
+        NodeBase::unlink_range(range_first, range_last);
+        NodeBase::link_range(before, range_first, range_last);
+        return;
+    }
+    check_allocator(other, "list::splice: allocators differ");
+
+    std::size_t count = 1;
+    for (NodeBase *cur = range_first; cur != range_last; cur = cur->next) {
+        ++count;
+    }
+    MYS_INSTRUMENT(on_visit(count));
+
+    NodeBase::unlink_range(range_first, range_last);
+    other.length -= count;
+    link_chain(before, Chain{range_first, range_last, count});
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::splice(const_iterator pos, list &&other, const_iterator first, const_iterator last) {
+    splice(pos, other, first, last);
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+std::size_t list<T, Allocator, Instrumentation>::remove(const T &value) {
+    return remove_if([&value](const T &v) { return v == value; });
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <typename Predicate>
+std::size_t list<T, Allocator, Instrumentation>::remove_if(Predicate pred) {
+    // 先把命中的节点按原顺序摘下串成一条链，扫描结束后再统一销毁
+    NodeBase *removed = nullptr;
+    NodeBase **removed_tail = &removed;
+    std::size_t count = 0;
+    NodeBase *cur = head_.next;
+    while (cur != &head_) {
+        NodeBase *next = cur->next;
+        MYS_INSTRUMENT(on_visit(1));
+        if (pred(static_cast<Node *>(cur)->val)) {
+            MYS_INSTRUMENT(on_erase());
+            NodeBase::unlink_range(cur, cur);
+            *removed_tail = cur;
+            removed_tail = &cur->next;
+            ++count;
+        }
+        cur = next;
+    }
+    length -= count;
+    destroy_chain(removed);
+    return count;
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+std::size_t list<T, Allocator, Instrumentation>::unique() {
+    return unique(std::equal_to<T>());
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <typename BinaryPredicate>
+std::size_t list<T, Allocator, Instrumentation>::unique(BinaryPredicate pred) {
+    if (length == 0) return 0;
+
+    NodeBase *removed = nullptr;
+    NodeBase **removed_tail = &removed;
+    std::size_t count = 0;
+    Node *kept = static_cast<Node *>(head_.next);
+    NodeBase *cur = kept->next;
+    while (cur != &head_) {
+        NodeBase *next = cur->next;
+        MYS_INSTRUMENT(on_visit(1));
+        if (pred(kept->val, static_cast<Node *>(cur)->val)) {
+            MYS_INSTRUMENT(on_erase());
+            NodeBase::unlink_range(cur, cur);
+            *removed_tail = cur;
+            removed_tail = &cur->next;
+            ++count;
+        } else {
+            kept = static_cast<Node *>(cur);
+        }
+        cur = next;
+    }
+    length -= count;
+    destroy_chain(removed);
+    return count;
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::reverse() noexcept {
+    // 连同哨兵一起交换 prev/next，首尾自然对调
+    NodeBase *cur = &head_;
+    do {
+        std::swap(cur->prev, cur->next);
+        cur = cur->prev;
+    } while (cur != &head_);
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::compact() {
+    // 旧节点摘下后先挂在 retired 上，全部新节点分配完才释放，分配器不会把旧槽位再交回来
+    NodeBase *retired = nullptr;
+    try {
+        for (NodeBase *old = head_.next; old != &head_;) {
+            NodeBase *next = old->next;
+            Node *node = create_node(std::move_if_noexcept(static_cast<Node *>(old)->val));
+            // 新节点原地顶替旧节点，每一步之后链表都是完整的
+            node->prev = old->prev;
+            node->next = next;
+            old->prev->next = node;
+            next->prev = node;
+            old->next = retired;
+            retired = old;
+            old = next;
+        }
+    } catch (...) {
+        destroy_chain(retired);
+        throw;
+    }
+    destroy_chain(retired);
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+double list<T, Allocator, Instrumentation>::fragmentation() const noexcept {
+    if (length < 2) return 0.0;
+
+    std::size_t scattered = 0;
+    for (const NodeBase *node = head_.next; node->next != &head_; node = node->next) {
+        scattered += !adjacent(node, node->next);
+    }
+    return static_cast<double>(scattered) / static_cast<double>(length - 1);
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+bool list<T, Allocator, Instrumentation>::compact_if(double threshold) {
+    if (fragmentation() <= threshold) return false;
+    compact();
+    return true;
+}
+
 // ===========================================================
 // Helper Functions
 // ===========================================================
 
-template <Listable T, typename Allocator>
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
 template <typename... Args>
-list<T, Allocator>::Node *list<T, Allocator>::create_node(Args &&...args) {
+list<T, Allocator, Instrumentation>::Node *list<T, Allocator, Instrumentation>::create_node(Args &&...args) {
     Node *ptr = std::allocator_traits<NodeAlloc>::allocate(allocator_, 1);
     try {
         std::construct_at(ptr, std::forward<Args>(args)...);
@@ -453,16 +664,160 @@ list<T, Allocator>::Node *list<T, Allocator>::create_node(Args &&...args) {
         std::allocator_traits<NodeAlloc>::deallocate(allocator_, ptr, 1);
         throw;
     }
+    MYS_INSTRUMENT(on_allocate(1));
     return ptr;
 }
 
-template <Listable T, typename Allocator>
-void list<T, Allocator>::destroy_node(Node *ptr) {
-    if (!ptr) return;
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::destroy_node(NodeBase *base) {
+    if (!base) return;
+    Node *ptr = static_cast<Node *>(base);
     // ptr->~Node();
     std::allocator_traits<NodeAlloc>::destroy(allocator_, ptr);
     // free(ptr)
     std::allocator_traits<NodeAlloc>::deallocate(allocator_, ptr, 1);
+    MYS_INSTRUMENT(on_deallocate(1));
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <typename Iter, typename Sent>
+list<T, Allocator, Instrumentation>::Chain list<T, Allocator, Instrumentation>::build_chain(Iter first, Sent last) {
+    Chain chain;
+    try {
+        for (; first != last; ++first) {
+            Node *node = create_node(*first);
+            node->prev = chain.last;
+            if (chain.last) {
+                chain.last->next = node;
+            } else {
+                chain.first = node;
+            }
+            chain.last = node;
+            ++chain.count;
+        }
+    } catch (...) {
+        destroy_chain(chain.first);
+        throw;
+    }
+    return chain;
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::destroy_chain(NodeBase *first) noexcept {
+    while (first) {
+        NodeBase *next = first->next;
+        destroy_node(first);
+        first = next;
+    }
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::Node *list<T, Allocator, Instrumentation>::link_node(NodeBase *pos, Node *node) noexcept {
+    NodeBase::link_range(pos, node, node);
+    length++;
+    MYS_INSTRUMENT(on_length(length));
+    return node;
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::NodeBase *list<T, Allocator, Instrumentation>::link_chain(NodeBase *pos, const Chain &chain) noexcept {
+    if (chain.count == 0) return pos;
+
+    NodeBase::link_range(pos, chain.first, chain.last);
+    length += chain.count;
+    MYS_INSTRUMENT(on_length(length));
+    return chain.first;
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::replace_with_chain(const Chain &chain) noexcept {
+    // 先摘下旧链再销毁：不能走 clear()，池分配器的整体释放会连新链一起回收
+    NodeBase *old = release_chain();
+    link_chain(&head_, chain);
+    destroy_chain(old);
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::NodeBase *list<T, Allocator, Instrumentation>::release_chain() noexcept {
+    if (length == 0) return nullptr;
+
+    NodeBase *first = head_.next;
+    head_.prev->next = nullptr;
+    first->prev = nullptr;
+    length = 0;
+    reattach_head();
+    return first;
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::reattach_head() noexcept {
+    head_.reattach(length == 0);
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::check_allocator(const list &other, const char *what) const {
+    if constexpr (!std::allocator_traits<NodeAlloc>::is_always_equal::value) {
+        if (allocator_ != other.allocator_) throw std::invalid_argument(what);
+    }
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+void list<T, Allocator, Instrumentation>::close_chain(NodeBase *tail) noexcept {
+    while (tail->next) {
+        tail->next->prev = tail;
+        tail = tail->next;
+    }
+    tail->next = &head_;
+    head_.prev = tail;
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+bool list<T, Allocator, Instrumentation>::adjacent(const NodeBase *node, const NodeBase *next) noexcept {
+    // 允许一个缓存行的间隙，malloc 的块头和 slab 的对齐填充都算作相邻
+    std::uintptr_t end = reinterpret_cast<std::uintptr_t>(node) + sizeof(Node);
+    std::uintptr_t start = reinterpret_cast<std::uintptr_t>(next);
+    return start >= end && start - end <= 64;
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+list<T, Allocator, Instrumentation>::NodeBase *list<T, Allocator, Instrumentation>::split_after(NodeBase *first, std::size_t n) noexcept {
+    if (!first) return nullptr;
+    for (std::size_t i = 1; i < n && first->next; ++i) {
+        first = first->next;
+    }
+    NodeBase *rest = first->next;
+    first->next = nullptr;
+    return rest;
+}
+
+template <Listable T, typename Allocator, ListInstrumentation Instrumentation>
+template <typename Compare>
+list<T, Allocator, Instrumentation>::NodeBase *list<T, Allocator, Instrumentation>::merge_runs(NodeBase *tail, NodeBase *a, NodeBase *b, Compare &comp) {
+    // Take from b only when it is strictly less than a, which keeps the merge stable
+    try {
+        while (a && b) {
+            NodeBase *&pick = comp(static_cast<Node *>(b)->val, static_cast<Node *>(a)->val) ? b : a;
+            NodeBase *node = pick;
+            pick = pick->next;
+
+            tail->next = node;
+            node->prev = tail;
+            tail = node;
+        }
+    } catch (...) {
+        // Nothing has been lost yet: the merged prefix ends at tail and a, b are intact chains
+        tail->next = a;
+        while (tail->next) tail = tail->next;
+        tail->next = b;
+        throw;
+    }
+    for (NodeBase *rest = a ? a : b; rest; rest = rest->next) {
+        tail->next = rest;
+        rest->prev = tail;
+        tail = rest;
+    }
+    tail->next = nullptr;
+    return tail;
 }
 
 } // namespace mys
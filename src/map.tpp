@@ -0,0 +1,918 @@
+#include "map.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::map(const Compare &comp, const Allocator &alloc) :
+    comp_(comp), leaf_allocator_(alloc), inner_allocator_(alloc) {}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <std::input_iterator InputIt>
+map<Key, T, Compare, Fanout, Allocator>::map(InputIt first, InputIt last, const Compare &comp, const Allocator &alloc) :
+    map(comp, alloc) {
+    insert(first, last);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <std::input_iterator InputIt>
+map<Key, T, Compare, Fanout, Allocator>::map(sorted_unique_t, InputIt first, InputIt last, const Compare &comp, const Allocator &alloc) :
+    map(comp, alloc) {
+    bulk_load(first, last);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::map(std::initializer_list<value_type> init, const Compare &comp, const Allocator &alloc) :
+    map(init.begin(), init.end(), comp, alloc) {}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::map(const map &other) :
+    comp_(other.comp_), leaf_allocator_(LeafTraits::select_on_container_copy_construction(other.leaf_allocator_)),
+    inner_allocator_(InnerTraits::select_on_container_copy_construction(other.inner_allocator_)) {
+    // The source is already sorted, so copying is a bulk load
+    bulk_load(other.begin(), other.end());
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::map(map &&other) noexcept :
+    comp_(std::move(other.comp_)), leaf_allocator_(std::move(other.leaf_allocator_)), inner_allocator_(std::move(other.inner_allocator_)),
+    root_(other.root_), first_leaf_(other.first_leaf_), last_leaf_(other.last_leaf_), size_(other.size_) {
+    other.root_ = nullptr;
+    other.first_leaf_ = nullptr;
+    other.last_leaf_ = nullptr;
+    other.size_ = 0;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator> &map<Key, T, Compare, Fanout, Allocator>::operator=(const map &other) {
+    if (this != &other) {
+        map temp(other);
+        swap(temp);
+    }
+    return *this;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator> &map<Key, T, Compare, Fanout, Allocator>::operator=(map &&other) noexcept {
+    if (this != &other) {
+        map temp(std::move(other));
+        swap(temp);
+    }
+    return *this;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::~map() {
+    clear();
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <std::input_iterator InputIt>
+void map<Key, T, Compare, Fanout, Allocator>::assign(sorted_unique_t, InputIt first, InputIt last) {
+    map temp(sorted_unique, first, last, comp_, get_allocator());
+    swap(temp);
+}
+
+// ===========================================================
+// 3. Element Access and Lookup
+// ===========================================================
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename Self>
+auto &&map<Key, T, Compare, Fanout, Allocator>::at(this Self &&self, const Key &key) {
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    if (Leaf *leaf = self.find_leaf(key)) {
+        std::size_t pos = self.leaf_lower_bound(leaf, key);
+        if (pos < leaf->count && !self.comp_(key, leaf->keys.data[pos])) {
+            return static_cast<ReturnType>(leaf->values.data[pos]);
+        }
+    }
+    throw std::out_of_range("map::at");
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+T &map<Key, T, Compare, Fanout, Allocator>::operator[](const Key &key) {
+    return try_emplace(key).first->second;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+T &map<Key, T, Compare, Fanout, Allocator>::operator[](Key &&key) {
+    return try_emplace(std::move(key)).first->second;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename Self>
+auto map<Key, T, Compare, Fanout, Allocator>::find(this Self &&self, const Key &key) {
+    using It = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+    if (Leaf *leaf = self.find_leaf(key)) {
+        std::size_t pos = self.leaf_lower_bound(leaf, key);
+        if (pos < leaf->count && !self.comp_(key, leaf->keys.data[pos])) {
+            return It(leaf, pos, &self);
+        }
+    }
+    return It(self.end());
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+bool map<Key, T, Compare, Fanout, Allocator>::contains(const Key &key) const {
+    if (Leaf *leaf = find_leaf(key)) {
+        std::size_t pos = leaf_lower_bound(leaf, key);
+        return pos < leaf->count && !comp_(key, leaf->keys.data[pos]);
+    }
+    return false;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+std::size_t map<Key, T, Compare, Fanout, Allocator>::count(const Key &key) const {
+    return contains(key) ? 1 : 0;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename Self>
+auto map<Key, T, Compare, Fanout, Allocator>::lower_bound(this Self &&self, const Key &key) {
+    using It = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+    Leaf *leaf = self.find_leaf(key);
+    if (!leaf) {
+        return It(self.end());
+    }
+    std::size_t pos = self.leaf_lower_bound(leaf, key);
+    if (pos == leaf->count) {
+        // Everything in this leaf is smaller; the answer is the first element of the next one
+        leaf = leaf->next;
+        pos = 0;
+    }
+    return It(leaf, pos, &self);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename Self>
+auto map<Key, T, Compare, Fanout, Allocator>::upper_bound(this Self &&self, const Key &key) {
+    using It = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+    Leaf *leaf = self.find_leaf(key);
+    if (!leaf) {
+        return It(self.end());
+    }
+    const Key *keys = leaf->keys.data;
+    std::size_t pos = static_cast<std::size_t>(std::upper_bound(keys, keys + leaf->count, key, self.comp_) - keys);
+    if (pos == leaf->count) {
+        leaf = leaf->next;
+        pos = 0;
+    }
+    return It(leaf, pos, &self);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename Self>
+auto map<Key, T, Compare, Fanout, Allocator>::equal_range(this Self &&self, const Key &key) {
+    auto first = self.lower_bound(key);
+    auto last = first;
+    if (last != self.end() && !self.comp_(key, (*last).first)) {
+        ++last;
+    }
+    return std::pair(first, last);
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+bool map<Key, T, Compare, Fanout, Allocator>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+std::size_t map<Key, T, Compare, Fanout, Allocator>::size() const noexcept {
+    return size_;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+std::size_t map<Key, T, Compare, Fanout, Allocator>::max_size() const noexcept {
+    return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(value_type);
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::clear() noexcept {
+    destroy_inner_nodes(root_);
+    for (Leaf *leaf = first_leaf_; leaf != nullptr;) {
+        Leaf *next = leaf->next;
+        std::destroy_n(leaf->keys.data, leaf->count);
+        std::destroy_n(leaf->values.data, leaf->count);
+        deallocate_leaf(leaf);
+        leaf = next;
+    }
+    root_ = nullptr;
+    first_leaf_ = nullptr;
+    last_leaf_ = nullptr;
+    size_ = 0;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::swap(map &other) noexcept {
+    using std::swap;
+    swap(comp_, other.comp_);
+    swap(root_, other.root_);
+    swap(first_leaf_, other.first_leaf_);
+    swap(last_leaf_, other.last_leaf_);
+    swap(size_, other.size_);
+    if constexpr (LeafTraits::propagate_on_container_swap::value) {
+        swap(leaf_allocator_, other.leaf_allocator_);
+        swap(inner_allocator_, other.inner_allocator_);
+    }
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+std::pair<typename map<Key, T, Compare, Fanout, Allocator>::iterator, bool>
+map<Key, T, Compare, Fanout, Allocator>::insert(const value_type &value) {
+    return try_emplace_impl(value.first, value.second);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+std::pair<typename map<Key, T, Compare, Fanout, Allocator>::iterator, bool>
+map<Key, T, Compare, Fanout, Allocator>::insert(value_type &&value) {
+    return try_emplace_impl(std::move(value.first), std::move(value.second));
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <std::input_iterator InputIt>
+void map<Key, T, Compare, Fanout, Allocator>::insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+        emplace(*first);
+    }
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::insert(std::initializer_list<value_type> ilist) {
+    insert(ilist.begin(), ilist.end());
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename M>
+std::pair<typename map<Key, T, Compare, Fanout, Allocator>::iterator, bool>
+map<Key, T, Compare, Fanout, Allocator>::insert_or_assign(const Key &key, M &&obj) {
+    auto result = try_emplace(key, std::forward<M>(obj));
+    if (!result.second) {
+        result.first->second = std::forward<M>(obj);
+    }
+    return result;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename M>
+std::pair<typename map<Key, T, Compare, Fanout, Allocator>::iterator, bool>
+map<Key, T, Compare, Fanout, Allocator>::insert_or_assign(Key &&key, M &&obj) {
+    auto result = try_emplace(std::move(key), std::forward<M>(obj));
+    if (!result.second) {
+        result.first->second = std::forward<M>(obj);
+    }
+    return result;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename... Args>
+std::pair<typename map<Key, T, Compare, Fanout, Allocator>::iterator, bool>
+map<Key, T, Compare, Fanout, Allocator>::emplace(Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    return try_emplace_impl(std::move(value.first), std::move(value.second));
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename... Args>
+std::pair<typename map<Key, T, Compare, Fanout, Allocator>::iterator, bool>
+map<Key, T, Compare, Fanout, Allocator>::try_emplace(const Key &key, Args &&...args) {
+    return try_emplace_impl(key, std::forward<Args>(args)...);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename... Args>
+std::pair<typename map<Key, T, Compare, Fanout, Allocator>::iterator, bool>
+map<Key, T, Compare, Fanout, Allocator>::try_emplace(Key &&key, Args &&...args) {
+    return try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::iterator map<Key, T, Compare, Fanout, Allocator>::erase(iterator pos) {
+    return erase(const_iterator(pos));
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::iterator map<Key, T, Compare, Fanout, Allocator>::erase(const_iterator pos) {
+    // Keys are unique, so descending by the element's own key rebuilds the path to its leaf
+    Path path;
+    Leaf *leaf = find_leaf(pos.leaf_->keys.data[pos.index_], &path);
+    return erase_at(path, leaf, pos.index_);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::iterator map<Key, T, Compare, Fanout, Allocator>::erase(const_iterator first, const_iterator last) {
+    // Each erase may rebalance and invalidate last, so count the elements first
+    auto count = std::distance(first, last);
+    iterator it(const_cast<Leaf *>(first.leaf_), first.index_, this);
+    while (count-- > 0) {
+        it = erase(it);
+    }
+    return it;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+std::size_t map<Key, T, Compare, Fanout, Allocator>::erase(const Key &key) {
+    Path path;
+    Leaf *leaf = find_leaf(key, &path);
+    if (!leaf) return 0;
+    std::size_t pos = leaf_lower_bound(leaf, key);
+    if (pos == leaf->count || comp_(key, leaf->keys.data[pos])) return 0;
+    erase_at(path, leaf, pos);
+    return 1;
+}
+
+// ===========================================================
+// 6. Iterator Interface
+// ===========================================================
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename Self>
+auto map<Key, T, Compare, Fanout, Allocator>::begin(this Self &&self) noexcept {
+    using It = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+    if (self.size_ == 0) {
+        return It(self.end());
+    }
+    return It(self.first_leaf_, 0, &self);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::const_iterator map<Key, T, Compare, Fanout, Allocator>::cbegin() const noexcept {
+    return begin();
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename Self>
+auto map<Key, T, Compare, Fanout, Allocator>::end(this Self &&self) noexcept {
+    using It = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+    return It(nullptr, 0, &self);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::const_iterator map<Key, T, Compare, Fanout, Allocator>::cend() const noexcept {
+    return end();
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename Self>
+auto map<Key, T, Compare, Fanout, Allocator>::rbegin(this Self &&self) noexcept {
+    return std::reverse_iterator(self.end());
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::const_reverse_iterator map<Key, T, Compare, Fanout, Allocator>::crbegin() const noexcept {
+    return const_reverse_iterator(end());
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename Self>
+auto map<Key, T, Compare, Fanout, Allocator>::rend(this Self &&self) noexcept {
+    return std::reverse_iterator(self.begin());
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::const_reverse_iterator map<Key, T, Compare, Fanout, Allocator>::crend() const noexcept {
+    return const_reverse_iterator(begin());
+}
+
+// ===========================================================
+// 7. Comparison Operations
+// ===========================================================
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+bool map<Key, T, Compare, Fanout, Allocator>::operator==(const map &other) const {
+    return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+}
+
+// ===========================================================
+// Helper Functions
+// ===========================================================
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::Leaf *map<Key, T, Compare, Fanout, Allocator>::find_leaf(const Key &key, Path *path) const {
+    NodeBase *node = root_;
+    if (!node) return nullptr;
+    while (!node->is_leaf) {
+        Inner *inner = static_cast<Inner *>(node);
+        // Separators equal to key belong to the right-hand child
+        const Key *keys = inner->keys.data;
+        std::size_t index = static_cast<std::size_t>(std::upper_bound(keys, keys + inner->count - 1, key, comp_) - keys);
+        if (path) {
+            path->steps[path->depth++] = {inner, index};
+        }
+        node = inner->children[index];
+    }
+    return static_cast<Leaf *>(node);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+std::size_t map<Key, T, Compare, Fanout, Allocator>::leaf_lower_bound(const Leaf *leaf, const Key &key) const {
+    const Key *keys = leaf->keys.data;
+    return static_cast<std::size_t>(std::lower_bound(keys, keys + leaf->count, key, comp_) - keys);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename K, typename... Args>
+std::pair<typename map<Key, T, Compare, Fanout, Allocator>::iterator, bool>
+map<Key, T, Compare, Fanout, Allocator>::try_emplace_impl(K &&key_arg, Args &&...args) {
+    if (!root_) {
+        Leaf *leaf = create_leaf();
+        root_ = first_leaf_ = last_leaf_ = leaf;
+    }
+
+    Path path;
+    Leaf *leaf = find_leaf(key_arg, &path);
+    std::size_t pos = leaf_lower_bound(leaf, key_arg);
+    if (pos < leaf->count && !comp_(key_arg, leaf->keys.data[pos])) {
+        return {iterator(leaf, pos, this), false};
+    }
+
+    // Allocate every node the split cascade will need before touching the tree, so that running out
+    // of memory leaves it unchanged. Full inner nodes from the bottom of the path split as well, and
+    // if the cascade reaches the root, a new root is needed on top.
+    Leaf *new_leaf = nullptr;
+    Inner *new_inners[max_height + 1];
+    std::size_t inner_needed = 0;
+    std::size_t inner_ready = 0;
+    auto release_spares = [&]() noexcept {
+        if (new_leaf) deallocate_leaf(new_leaf);
+        for (std::size_t i = 0; i < inner_ready; ++i) deallocate_inner(new_inners[i]);
+    };
+    if (leaf->count == Fanout) {
+        std::size_t level = path.depth;
+        while (level > 0 && path.steps[level - 1].node->count == Fanout) {
+            --level;
+            ++inner_needed;
+        }
+        if (level == 0) ++inner_needed;
+        try {
+            new_leaf = create_leaf();
+            for (; inner_ready < inner_needed; ++inner_ready) {
+                new_inners[inner_ready] = create_inner();
+            }
+        } catch (...) {
+            release_spares();
+            throw;
+        }
+    }
+
+    open_gap(leaf->keys.data, pos, leaf->count);
+    open_gap(leaf->values.data, pos, leaf->count);
+    try {
+        std::construct_at(leaf->keys.data + pos, std::forward<K>(key_arg));
+        try {
+            std::construct_at(leaf->values.data + pos, std::forward<Args>(args)...);
+        } catch (...) {
+            std::destroy_at(leaf->keys.data + pos);
+            throw;
+        }
+    } catch (...) {
+        close_gap(leaf->keys.data, pos, leaf->count + 1);
+        close_gap(leaf->values.data, pos, leaf->count + 1);
+        release_spares();
+        throw;
+    }
+    ++leaf->count;
+    ++size_;
+
+    if (!new_leaf) {
+        return {iterator(leaf, pos, this), true};
+    }
+
+    // The separator copy is the last step that can fail; undo the insertion if it does
+    constexpr std::size_t left_count = (Fanout + 1) / 2;
+    Slots<Key, 1> separator;
+    try {
+        std::construct_at(separator.data, leaf->keys.data[left_count]);
+    } catch (...) {
+        std::destroy_at(leaf->keys.data + pos);
+        std::destroy_at(leaf->values.data + pos);
+        close_gap(leaf->keys.data, pos, leaf->count);
+        close_gap(leaf->values.data, pos, leaf->count);
+        --leaf->count;
+        --size_;
+        release_spares();
+        throw;
+    }
+
+    split_leaf(leaf, new_leaf);
+    iterator result = pos < left_count ? iterator(leaf, pos, this) : iterator(new_leaf, pos - left_count, this);
+
+    NodeBase *child = new_leaf;
+    std::size_t next_inner = 0;
+    for (std::size_t level = path.depth;;) {
+        if (level == 0) {
+            // The root itself split: grow the tree by one level
+            Inner *root = new_inners[next_inner++];
+            std::construct_at(root->keys.data, std::move(*separator.data));
+            std::destroy_at(separator.data);
+            root->children[0] = root_;
+            root->children[1] = child;
+            root->count = 2;
+            root_ = root;
+            break;
+        }
+        auto [parent, index] = path.steps[--level];
+        insert_child(parent, index + 1, std::move(*separator.data), child);
+        std::destroy_at(separator.data);
+        if (parent->count <= Fanout) break;
+
+        Inner *right = new_inners[next_inner++];
+        split_inner(parent, right, *separator.data);
+        child = right;
+    }
+    return {result, true};
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::split_leaf(Leaf *leaf, Leaf *right) noexcept {
+    constexpr std::size_t left_count = (Fanout + 1) / 2;
+    std::size_t moved = leaf->count - left_count;
+    for (std::size_t i = 0; i < moved; ++i) {
+        relocate(right->keys.data + i, leaf->keys.data + left_count + i);
+        relocate(right->values.data + i, leaf->values.data + left_count + i);
+    }
+    right->count = moved;
+    leaf->count = left_count;
+
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next) {
+        leaf->next->prev = right;
+    } else {
+        last_leaf_ = right;
+    }
+    leaf->next = right;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::split_inner(Inner *node, Inner *right, Key &separator) noexcept {
+    // node holds Fanout + 1 children; the key between the two halves moves up into separator
+    constexpr std::size_t left_count = (Fanout + 1) / 2;
+    relocate(&separator, node->keys.data + left_count - 1);
+    std::size_t moved = node->count - left_count;
+    for (std::size_t i = 0; i < moved; ++i) {
+        right->children[i] = node->children[left_count + i];
+    }
+    for (std::size_t i = 0; i + 1 < moved; ++i) {
+        relocate(right->keys.data + i, node->keys.data + left_count + i);
+    }
+    right->count = moved;
+    node->count = left_count;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::insert_child(Inner *node, std::size_t index, Key &&separator, NodeBase *child) noexcept {
+    open_gap(node->keys.data, index - 1, node->count - 1);
+    std::construct_at(node->keys.data + index - 1, std::move(separator));
+    std::copy_backward(node->children + index, node->children + node->count, node->children + node->count + 1);
+    node->children[index] = child;
+    ++node->count;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::remove_child(Inner *node, std::size_t index) noexcept {
+    std::destroy_at(node->keys.data + index - 1);
+    close_gap(node->keys.data, index - 1, node->count - 1);
+    std::copy(node->children + index + 1, node->children + node->count, node->children + index);
+    --node->count;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::iterator map<Key, T, Compare, Fanout, Allocator>::erase_at(Path &path, Leaf *leaf, std::size_t pos) {
+    std::destroy_at(leaf->keys.data + pos);
+    std::destroy_at(leaf->values.data + pos);
+    close_gap(leaf->keys.data, pos, leaf->count);
+    close_gap(leaf->values.data, pos, leaf->count);
+    --leaf->count;
+    --size_;
+
+    // Position of the element after the erased one; successor == leaf->count means the first
+    // element of the next leaf. Rebalancing keeps it up to date as elements move.
+    std::size_t successor = pos;
+    if (path.depth == 0) {
+        if (leaf->count == 0) {
+            deallocate_leaf(leaf);
+            root_ = nullptr;
+            first_leaf_ = nullptr;
+            last_leaf_ = nullptr;
+            return end();
+        }
+    } else if (leaf->count < min_count) {
+        rebalance_leaf(path, leaf, successor);
+    }
+
+    if (successor == leaf->count) {
+        leaf = leaf->next;
+        successor = 0;
+    }
+    return iterator(leaf, successor, this);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::rebalance_leaf(Path &path, Leaf *&leaf, std::size_t &successor) {
+    auto [parent, index] = path.steps[path.depth - 1];
+    Leaf *left = index > 0 ? static_cast<Leaf *>(parent->children[index - 1]) : nullptr;
+    Leaf *right = index + 1 < parent->count ? static_cast<Leaf *>(parent->children[index + 1]) : nullptr;
+
+    // Borrowing needs a copy of the new separator. If that copy fails the leaf simply stays
+    // underfull: search does not depend on occupancy, and a later merge still fits.
+    if (left && left->count > min_count) {
+        std::size_t last = left->count - 1;
+        try {
+            Key separator(left->keys.data[last]);
+            open_gap(leaf->keys.data, 0, leaf->count);
+            open_gap(leaf->values.data, 0, leaf->count);
+            relocate(leaf->keys.data, left->keys.data + last);
+            relocate(leaf->values.data, left->values.data + last);
+            --left->count;
+            ++leaf->count;
+            ++successor;
+            parent->keys.data[index - 1] = std::move(separator);
+        } catch (...) {
+        }
+        return;
+    }
+    if (right && right->count > min_count) {
+        try {
+            Key separator(right->keys.data[1]);
+            relocate(leaf->keys.data + leaf->count, right->keys.data);
+            relocate(leaf->values.data + leaf->count, right->values.data);
+            close_gap(right->keys.data, 0, right->count);
+            close_gap(right->values.data, 0, right->count);
+            --right->count;
+            ++leaf->count;
+            parent->keys.data[index] = std::move(separator);
+        } catch (...) {
+        }
+        return;
+    }
+
+    // Neither neighbour can spare an element: merge with one of them
+    Leaf *a = left ? left : leaf;
+    Leaf *b = left ? leaf : right;
+    if (left) {
+        successor += left->count;
+        leaf = left;
+    }
+    for (std::size_t i = 0; i < b->count; ++i) {
+        relocate(a->keys.data + a->count + i, b->keys.data + i);
+        relocate(a->values.data + a->count + i, b->values.data + i);
+    }
+    a->count += b->count;
+    unlink_leaf(b);
+    deallocate_leaf(b);
+    remove_child(parent, left ? index : index + 1);
+    rebalance_inner(path, path.depth);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::rebalance_inner(Path &path, std::size_t level) noexcept {
+    // path.steps[level - 1] is the node that just lost a child
+    Inner *node = path.steps[level - 1].node;
+    if (level == 1) {
+        // The root may shrink to a single child, which then takes its place
+        if (node->count == 1) {
+            root_ = node->children[0];
+            deallocate_inner(node);
+        }
+        return;
+    }
+    if (node->count >= min_count) return;
+
+    auto [parent, index] = path.steps[level - 2];
+    Inner *left = index > 0 ? static_cast<Inner *>(parent->children[index - 1]) : nullptr;
+    Inner *right = index + 1 < parent->count ? static_cast<Inner *>(parent->children[index + 1]) : nullptr;
+
+    if (left && left->count > min_count) {
+        // Rotate right through the parent: the separator comes down, left's last key goes up
+        open_gap(node->keys.data, 0, node->count - 1);
+        std::construct_at(node->keys.data, std::move(parent->keys.data[index - 1]));
+        std::copy_backward(node->children, node->children + node->count, node->children + node->count + 1);
+        node->children[0] = left->children[left->count - 1];
+        ++node->count;
+        parent->keys.data[index - 1] = std::move(left->keys.data[left->count - 2]);
+        std::destroy_at(left->keys.data + left->count - 2);
+        --left->count;
+        return;
+    }
+    if (right && right->count > min_count) {
+        // Rotate left through the parent
+        std::construct_at(node->keys.data + node->count - 1, std::move(parent->keys.data[index]));
+        node->children[node->count] = right->children[0];
+        ++node->count;
+        parent->keys.data[index] = std::move(right->keys.data[0]);
+        std::destroy_at(right->keys.data);
+        close_gap(right->keys.data, 0, right->count - 1);
+        std::copy(right->children + 1, right->children + right->count, right->children);
+        --right->count;
+        return;
+    }
+
+    // Merge b into a, pulling the separator between them down
+    Inner *a = left ? left : node;
+    Inner *b = left ? node : right;
+    std::size_t b_index = left ? index : index + 1;
+    std::construct_at(a->keys.data + a->count - 1, std::move(parent->keys.data[b_index - 1]));
+    for (std::size_t i = 0; i + 1 < b->count; ++i) {
+        relocate(a->keys.data + a->count + i, b->keys.data + i);
+    }
+    for (std::size_t i = 0; i < b->count; ++i) {
+        a->children[a->count + i] = b->children[i];
+    }
+    a->count += b->count;
+    deallocate_inner(b);
+    remove_child(parent, b_index);
+    rebalance_inner(path, level - 1);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::unlink_leaf(Leaf *leaf) noexcept {
+    if (leaf->prev) {
+        leaf->prev->next = leaf->next;
+    } else {
+        first_leaf_ = leaf->next;
+    }
+    if (leaf->next) {
+        leaf->next->prev = leaf->prev;
+    } else {
+        last_leaf_ = leaf->prev;
+    }
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <std::input_iterator InputIt>
+void map<Key, T, Compare, Fanout, Allocator>::bulk_load(InputIt first, InputIt last) {
+    // *this is empty. Fill leaves left to right, then build each inner level from the one below.
+    try {
+        Leaf *leaf = nullptr;
+        for (; first != last; ++first) {
+            if (!leaf || leaf->count == Fanout) {
+                Leaf *next = create_leaf();
+                next->prev = last_leaf_;
+                if (last_leaf_) {
+                    last_leaf_->next = next;
+                } else {
+                    first_leaf_ = next;
+                }
+                last_leaf_ = leaf = next;
+            }
+            auto &&item = *first;
+            std::construct_at(leaf->keys.data + leaf->count, std::forward<decltype(item)>(item).first);
+            try {
+                std::construct_at(leaf->values.data + leaf->count, std::forward<decltype(item)>(item).second);
+            } catch (...) {
+                std::destroy_at(leaf->keys.data + leaf->count);
+                throw;
+            }
+            ++leaf->count;
+            ++size_;
+        }
+        if (!first_leaf_) return;
+
+        if (last_leaf_ != first_leaf_ && last_leaf_->count < min_count) {
+            // Even out the last two leaves so that both are at least half full
+            Leaf *prev = last_leaf_->prev;
+            std::size_t moved = (prev->count + last_leaf_->count) / 2 - last_leaf_->count;
+            for (std::size_t i = last_leaf_->count; i-- > 0;) {
+                relocate(last_leaf_->keys.data + i + moved, last_leaf_->keys.data + i);
+                relocate(last_leaf_->values.data + i + moved, last_leaf_->values.data + i);
+            }
+            for (std::size_t i = 0; i < moved; ++i) {
+                relocate(last_leaf_->keys.data + i, prev->keys.data + prev->count - moved + i);
+                relocate(last_leaf_->values.data + i, prev->values.data + prev->count - moved + i);
+            }
+            prev->count -= moved;
+            last_leaf_->count += moved;
+        }
+
+        // Each entry pairs a node with the smallest key below it, which becomes its separator
+        vector<NodeBase *> level;
+        vector<const Key *> lowest;
+        for (Leaf *node = first_leaf_; node; node = node->next) {
+            level.push_back(node);
+            lowest.push_back(node->keys.data);
+        }
+
+        vector<Inner *> built;
+        built.reserve(level.size());
+        try {
+            while (level.size() > 1) {
+                // Spread the children evenly over as few nodes as possible; each then gets at least
+                // Fanout / 2 of them
+                std::size_t total = level.size();
+                std::size_t groups = (total + Fanout - 1) / Fanout;
+                vector<NodeBase *> next_level;
+                vector<const Key *> next_lowest;
+                next_level.reserve(groups);
+                next_lowest.reserve(groups);
+
+                std::size_t child = 0;
+                for (std::size_t g = 0; g < groups; ++g) {
+                    std::size_t take = total / groups + (g < total % groups ? 1 : 0);
+                    Inner *node = create_inner();
+                    built.push_back(node);
+                    node->children[0] = level[child];
+                    node->count = 1;
+                    for (std::size_t i = 1; i < take; ++i) {
+                        std::construct_at(node->keys.data + i - 1, *lowest[child + i]);
+                        node->children[i] = level[child + i];
+                        ++node->count;
+                    }
+                    next_level.push_back(node);
+                    next_lowest.push_back(lowest[child]);
+                    child += take;
+                }
+                level = std::move(next_level);
+                lowest = std::move(next_lowest);
+            }
+        } catch (...) {
+            for (Inner *node : built) {
+                std::destroy_n(node->keys.data, node->count - 1);
+                deallocate_inner(node);
+            }
+            throw;
+        }
+        root_ = level[0];
+    } catch (...) {
+        // Only leaves are reachable at this point; clear() frees them through the chain
+        root_ = nullptr;
+        clear();
+        throw;
+    }
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::Leaf *map<Key, T, Compare, Fanout, Allocator>::create_leaf() {
+    Leaf *leaf = LeafTraits::allocate(leaf_allocator_, 1);
+    std::construct_at(leaf);
+    return leaf;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+map<Key, T, Compare, Fanout, Allocator>::Inner *map<Key, T, Compare, Fanout, Allocator>::create_inner() {
+    Inner *node = InnerTraits::allocate(inner_allocator_, 1);
+    std::construct_at(node);
+    return node;
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::deallocate_leaf(Leaf *leaf) noexcept {
+    std::destroy_at(leaf);
+    LeafTraits::deallocate(leaf_allocator_, leaf, 1);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::deallocate_inner(Inner *node) noexcept {
+    std::destroy_at(node);
+    InnerTraits::deallocate(inner_allocator_, node, 1);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+void map<Key, T, Compare, Fanout, Allocator>::destroy_inner_nodes(NodeBase *node) noexcept {
+    if (!node || node->is_leaf) return;
+    Inner *inner = static_cast<Inner *>(node);
+    for (std::size_t i = 0; i < inner->count; ++i) {
+        destroy_inner_nodes(inner->children[i]);
+    }
+    std::destroy_n(inner->keys.data, inner->count - 1);
+    deallocate_inner(inner);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename U>
+void map<Key, T, Compare, Fanout, Allocator>::relocate(U *dst, U *src) noexcept {
+    std::construct_at(dst, std::move(*src));
+    std::destroy_at(src);
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename U>
+void map<Key, T, Compare, Fanout, Allocator>::open_gap(U *data, std::size_t pos, std::size_t count) noexcept {
+    for (std::size_t i = count; i > pos; --i) {
+        relocate(data + i, data + i - 1);
+    }
+}
+
+template <std::copyable Key, std::movable T, typename Compare, std::size_t Fanout, typename Allocator>
+template <typename U>
+void map<Key, T, Compare, Fanout, Allocator>::close_gap(U *data, std::size_t pos, std::size_t count) noexcept {
+    for (std::size_t i = pos; i + 1 < count; ++i) {
+        relocate(data + i, data + i + 1);
+    }
+}
+
+} // namespace mys
\ No newline at end of file
@@ -0,0 +1,219 @@
+#include "mpmc_queue.h"
+#include <bit>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <Queueable T, typename Allocator>
+mpmc_queue<T, Allocator>::mpmc_queue(std::size_t capacity, const Allocator &alloc) : allocator_(alloc) {
+    std::size_t cap = round_up_capacity(capacity);
+    slots_ = SlotTraits::allocate(allocator_, cap);
+    for (std::size_t i = 0; i < cap; ++i) {
+        SlotTraits::construct(allocator_, slots_ + i, i);
+    }
+    mask_ = cap - 1;
+}
+
+template <Queueable T, typename Allocator>
+mpmc_queue<T, Allocator>::~mpmc_queue() {
+    // No other thread may use the queue any more, so plain loads are enough
+    std::size_t head = dequeue_pos_.load(std::memory_order_relaxed);
+    std::size_t tail = enqueue_pos_.load(std::memory_order_relaxed);
+    for (std::size_t pos = head; pos != tail; ++pos) {
+        std::destroy_at(slots_[pos & mask_].value());
+    }
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        SlotTraits::destroy(allocator_, slots_ + i);
+    }
+    SlotTraits::deallocate(allocator_, slots_, mask_ + 1);
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <Queueable T, typename Allocator>
+std::size_t mpmc_queue<T, Allocator>::capacity() const noexcept {
+    return mask_ + 1;
+}
+
+template <Queueable T, typename Allocator>
+std::size_t mpmc_queue<T, Allocator>::size_approx() const noexcept {
+    std::size_t head = dequeue_pos_.load(std::memory_order_relaxed);
+    std::size_t tail = enqueue_pos_.load(std::memory_order_relaxed);
+    // The two loads are not atomic together; clamp what a racing snapshot can produce
+    if (tail < head) return 0;
+    return tail - head > mask_ + 1 ? mask_ + 1 : tail - head;
+}
+
+template <Queueable T, typename Allocator>
+bool mpmc_queue<T, Allocator>::empty_approx() const noexcept {
+    return size_approx() == 0;
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <Queueable T, typename Allocator>
+bool mpmc_queue<T, Allocator>::try_push(const T &value) {
+    return try_emplace(value);
+}
+
+template <Queueable T, typename Allocator>
+bool mpmc_queue<T, Allocator>::try_push(T &&value) {
+    return try_emplace(std::move(value));
+}
+
+template <Queueable T, typename Allocator>
+template <typename... Args>
+bool mpmc_queue<T, Allocator>::try_emplace(Args &&...args) {
+    if constexpr (!std::is_nothrow_constructible_v<T, Args &&...>) {
+        // Build the value before claiming a slot; only the (noexcept) move happens afterwards
+        T value(std::forward<Args>(args)...);
+        return try_emplace(std::move(value));
+    } else {
+        std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Slot *slot;
+        for (;;) {
+            slot = &slots_[pos & mask_];
+            std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                // The consumer of the previous lap has not freed this slot yet: full
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        std::construct_at(slot->value(), std::forward<Args>(args)...);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+}
+
+template <Queueable T, typename Allocator>
+bool mpmc_queue<T, Allocator>::try_pop(T &out) {
+    std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Slot *slot;
+    for (;;) {
+        slot = &slots_[pos & mask_];
+        std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+        if (diff == 0) {
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            // The producer for this position has not published yet: empty
+            return false;
+        } else {
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Hand the slot to the producer of the next lap even if the assignment throws
+    struct Release {
+        Slot *slot;
+        std::size_t seq;
+        ~Release() {
+            std::destroy_at(slot->value());
+            slot->sequence.store(seq, std::memory_order_release);
+        }
+    } release{slot, pos + mask_ + 1};
+    out = std::move(*slot->value());
+    return true;
+}
+
+template <Queueable T, typename Allocator>
+template <std::input_iterator InputIt>
+    requires std::is_nothrow_constructible_v<T, std::iter_reference_t<InputIt>>
+std::size_t mpmc_queue<T, Allocator>::try_push_n(InputIt first, std::size_t count) {
+    if (count == 0) return 0;
+
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    std::size_t claimed;
+    for (;;) {
+        // Count how many consecutive slots starting at pos are free on this lap
+        claimed = 0;
+        while (claimed < count) {
+            std::size_t seq = slots_[(pos + claimed) & mask_].sequence.load(std::memory_order_acquire);
+            if (seq != pos + claimed) break;
+            ++claimed;
+        }
+        if (claimed == 0) {
+            std::size_t seq = slots_[pos & mask_].sequence.load(std::memory_order_acquire);
+            if (static_cast<std::ptrdiff_t>(seq - pos) < 0) return 0;
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+            continue;
+        }
+        // One CAS claims the whole run
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed)) break;
+    }
+
+    for (std::size_t i = 0; i < claimed; ++i, ++first) {
+        Slot &slot = slots_[(pos + i) & mask_];
+        std::construct_at(slot.value(), *first);
+        slot.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    return claimed;
+}
+
+template <Queueable T, typename Allocator>
+template <typename OutputIt>
+std::size_t mpmc_queue<T, Allocator>::try_pop_n(OutputIt out, std::size_t max_count) {
+    if (max_count == 0) return 0;
+
+    std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    std::size_t claimed;
+    for (;;) {
+        // Count how many consecutive slots starting at pos have been published
+        claimed = 0;
+        while (claimed < max_count) {
+            std::size_t seq = slots_[(pos + claimed) & mask_].sequence.load(std::memory_order_acquire);
+            if (seq != pos + claimed + 1) break;
+            ++claimed;
+        }
+        if (claimed == 0) {
+            std::size_t seq = slots_[pos & mask_].sequence.load(std::memory_order_acquire);
+            if (static_cast<std::ptrdiff_t>(seq - (pos + 1)) < 0) return 0;
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + claimed, std::memory_order_relaxed)) break;
+    }
+
+    std::size_t i = 0;
+    try {
+        for (; i < claimed; ++i) {
+            Slot &slot = slots_[(pos + i) & mask_];
+            *out = std::move(*slot.value());
+            ++out;
+            std::destroy_at(slot.value());
+            slot.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+        }
+    } catch (...) {
+        // Every claimed slot must go back to the producers, or the ring stalls
+        for (; i < claimed; ++i) {
+            Slot &slot = slots_[(pos + i) & mask_];
+            std::destroy_at(slot.value());
+            slot.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+        }
+        throw;
+    }
+    return claimed;
+}
+
+// ===========================================================
+// Helper Functions
+// ===========================================================
+
+template <Queueable T, typename Allocator>
+std::size_t mpmc_queue<T, Allocator>::round_up_capacity(std::size_t capacity) noexcept {
+    return std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity);
+}
+
+} // namespace mys
\ No newline at end of file
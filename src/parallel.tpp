@@ -0,0 +1,291 @@
+#include "parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <optional>
+#include <thread>
+
+namespace mys::parallel {
+
+// ===========================================================
+// chunk_index
+// ===========================================================
+
+template <Partitionable Container>
+chunk_index<Container>::chunk_index(Container &container, std::size_t grain) :
+    container_(&container), grain_(std::max<std::size_t>(grain, 1)) {
+    rebuild();
+}
+
+template <Partitionable Container>
+void chunk_index<Container>::rebuild() {
+    bounds_.clear();
+    const std::size_t n = container_->size();
+    if (n == 0) return;
+    bounds_.reserve((n - 1) / grain_);
+
+    // 只沿链接前进、不读元素；第一个块的起点和最后一个块的终点用时再取，不必记录
+    auto it = container_->begin();
+    for (std::size_t start = grain_; start < n; start += grain_) {
+        for (std::size_t step = 0; step < grain_; ++step) {
+            ++it;
+        }
+        bounds_.push_back(it);
+    }
+}
+
+template <Partitionable Container>
+std::size_t chunk_index<Container>::chunks() const noexcept {
+    return container_->empty() ? 0 : bounds_.size() + 1;
+}
+
+template <Partitionable Container>
+std::size_t chunk_index<Container>::grain() const noexcept {
+    return grain_;
+}
+
+template <Partitionable Container>
+chunk_index<Container>::iterator chunk_index<Container>::chunk_begin(std::size_t i) const {
+    return i == 0 ? container_->begin() : bounds_[i - 1];
+}
+
+template <Partitionable Container>
+chunk_index<Container>::iterator chunk_index<Container>::chunk_end(std::size_t i) const {
+    return i == bounds_.size() ? container_->end() : bounds_[i];
+}
+
+namespace detail {
+
+// 块处理函数的统一形式：fn(i, first, last, count) 处理第 i 块中从 first 起、至多 count 个、不越过 last 的元素，
+// 返回处理完后的位置。索引版本已知块的终点，count 不设限；容器版本只知道起点，靠 count 截止
+constexpr std::size_t unbounded = std::numeric_limits<std::size_t>::max();
+
+inline std::size_t thread_count(const options &opts, std::size_t chunks) {
+    std::size_t threads = opts.threads != 0 ? opts.threads : std::thread::hardware_concurrency();
+    return std::clamp<std::size_t>(threads, 1, std::max<std::size_t>(chunks, 1));
+}
+
+// 在 threads 个线程上各运行一次 work(worker)：调用线程本身是 0 号，其余作为任务提交给线程池
+// 任一线程抛出异常后置位 failed，其余线程不再领取新块；等全部任务结束后再重新抛出，任务引用着这里的局部变量
+template <typename Work>
+void run_workers(std::size_t threads, const options &opts, std::atomic<bool> &failed, Work &work) {
+    thread_pool &pool = opts.pool ? *opts.pool : thread_pool::shared();
+    thread_pool::task_group group;
+    auto guarded = [&](std::size_t worker) {
+        try {
+            work(worker);
+        } catch (...) {
+            failed.store(true, std::memory_order_relaxed);
+            throw;
+        }
+    };
+
+    // 提交失败时 0 号仍要运行：容器版本的其他任务在等它发布块起点，它看到 failed 后会唤醒它们退出
+    std::exception_ptr error;
+    try {
+        for (std::size_t w = 1; w < threads; ++w) {
+            pool.spawn(group, [&guarded, w] { guarded(w); });
+        }
+    } catch (...) {
+        failed.store(true, std::memory_order_relaxed);
+        error = std::current_exception();
+    }
+    try {
+        guarded(0);
+    } catch (...) {
+        if (!error) error = std::current_exception();
+    }
+    pool.wait(group);
+    if (error) std::rethrow_exception(error);
+}
+
+// 按事先建好的索引分块：各线程从共享计数器逐个领取
+template <typename Container, typename ChunkFn>
+void run_index(const chunk_index<Container> &index, const options &opts, ChunkFn &fn) {
+    const std::size_t chunks = index.chunks();
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> failed{false};
+    auto work = [&](std::size_t) {
+        for (std::size_t i = next.fetch_add(1, std::memory_order_relaxed); i < chunks && !failed.load(std::memory_order_relaxed);
+             i = next.fetch_add(1, std::memory_order_relaxed)) {
+            fn(i, index.chunk_begin(i), index.chunk_end(i), unbounded);
+        }
+    };
+    run_workers(thread_count(opts, chunks), opts, failed, work);
+}
+
+// 直接对容器分块：找块起点的那一遍和处理块重叠进行
+// 调用线程沿链接前进，每走 grain 步发布一个块起点，工作线程领取已发布的块；走完后调用线程也参与处理。
+// 单线程时不需要记录起点，按同样的块顺序一遍处理完
+template <typename Container, typename ChunkFn>
+void run_stream(Container &container, const options &opts, ChunkFn &fn) {
+    using Iterator = decltype(container.begin());
+    const std::size_t n = container.size();
+    const std::size_t grain = std::max<std::size_t>(opts.grain, 1);
+    const std::size_t chunks = (n + grain - 1) / grain;
+    const std::size_t threads = thread_count(opts, chunks);
+
+    if (threads == 1) {
+        Iterator it = container.begin();
+        const Iterator last = container.end();
+        for (std::size_t i = 0; i < chunks; ++i) {
+            it = fn(i, it, last, grain);
+        }
+        return;
+    }
+
+    // published 是已写入 starts 的块数；中途失败时置为 aborted，唤醒仍在等待的线程
+    constexpr std::size_t aborted = std::numeric_limits<std::size_t>::max();
+    std::vector<Iterator> starts(chunks);
+    std::atomic<std::size_t> published{0};
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> failed{false};
+    const Iterator last = container.end();
+
+    auto process = [&] {
+        for (std::size_t i = next.fetch_add(1, std::memory_order_relaxed); i < chunks && !failed.load(std::memory_order_relaxed);
+             i = next.fetch_add(1, std::memory_order_relaxed)) {
+            std::size_t ready = published.load(std::memory_order_acquire);
+            while (ready <= i) {
+                published.wait(ready, std::memory_order_acquire);
+                ready = published.load(std::memory_order_acquire);
+            }
+            if (ready == aborted) return;
+            fn(i, starts[i], last, grain);
+        }
+    };
+
+    auto abort = [&] {
+        published.store(aborted, std::memory_order_release);
+        published.notify_all();
+    };
+
+    auto work = [&](std::size_t worker) {
+        if (worker == 0) {
+            try {
+                Iterator it = container.begin();
+                for (std::size_t k = 0; k < chunks; ++k) {
+                    if (failed.load(std::memory_order_relaxed)) {
+                        abort();
+                        return;
+                    }
+                    starts[k] = it;
+                    published.store(k + 1, std::memory_order_release);
+                    published.notify_all();
+                    for (std::size_t step = 0; step < grain && k + 1 < chunks; ++step) {
+                        ++it;
+                    }
+                }
+            } catch (...) {
+                abort();
+                throw;
+            }
+        }
+        process();
+    };
+    run_workers(threads, opts, failed, work);
+}
+
+// 每个块各自从第一个元素起折叠，不使用 init；再按块的顺序合并，结合方式与顺序折叠一致，结果与线程数和调度无关
+// 块在容器改动后可能为空，此时没有部分结果
+template <typename T, typename BinaryOp, typename UnaryOp, typename Run>
+T fold_chunks(std::size_t chunks, T init, BinaryOp &reduce_op, UnaryOp &transform_op, Run run) {
+    std::vector<std::optional<T>> partial(chunks);
+    auto fn = [&](std::size_t i, auto it, auto last, std::size_t count) {
+        if (count == 0 || it == last) return it;
+        T acc = transform_op(*it);
+        for (++it, --count; count != 0 && it != last; ++it, --count) {
+            acc = reduce_op(std::move(acc), transform_op(*it));
+        }
+        partial[i].emplace(std::move(acc));
+        return it;
+    };
+    run(fn);
+
+    for (std::optional<T> &p : partial) {
+        if (p) init = reduce_op(std::move(init), std::move(*p));
+    }
+    return init;
+}
+
+template <typename F>
+auto visit_chunk(F &f) {
+    return [&f](std::size_t, auto it, auto last, std::size_t count) {
+        for (; count != 0 && it != last; ++it, --count) {
+            f(*it);
+        }
+        return it;
+    };
+}
+
+template <typename T>
+auto identity_as() {
+    return [](const auto &value) -> T { return value; };
+}
+
+template <typename Predicate>
+auto count_matches(Predicate &pred) {
+    return [&pred](const auto &value) -> std::size_t { return pred(value) ? 1 : 0; };
+}
+
+inline std::size_t stream_chunks(std::size_t n, const options &opts) {
+    const std::size_t grain = std::max<std::size_t>(opts.grain, 1);
+    return (n + grain - 1) / grain;
+}
+
+} // namespace detail
+
+// ===========================================================
+// Algorithms over a prebuilt index
+// ===========================================================
+
+template <typename Container, typename F>
+void for_each(const chunk_index<Container> &index, F f, options opts) {
+    auto fn = detail::visit_chunk(f);
+    detail::run_index(index, opts, fn);
+}
+
+template <typename Container, typename T, typename BinaryOp, typename UnaryOp>
+T transform_reduce(const chunk_index<Container> &index, T init, BinaryOp reduce_op, UnaryOp transform_op, options opts) {
+    return detail::fold_chunks(index.chunks(), std::move(init), reduce_op, transform_op,
+                               [&](auto &fn) { detail::run_index(index, opts, fn); });
+}
+
+template <typename Container, typename T, typename BinaryOp>
+T reduce(const chunk_index<Container> &index, T init, BinaryOp op, options opts) {
+    return parallel::transform_reduce(index, std::move(init), std::move(op), detail::identity_as<T>(), opts);
+}
+
+template <typename Container, typename Predicate>
+std::size_t count_if(const chunk_index<Container> &index, Predicate pred, options opts) {
+    return parallel::transform_reduce(index, std::size_t{0}, std::plus<>{}, detail::count_matches(pred), opts);
+}
+
+// ===========================================================
+// Algorithms over a container
+// ===========================================================
+
+template <Partitionable Container, typename F>
+void for_each(Container &container, F f, options opts) {
+    auto fn = detail::visit_chunk(f);
+    detail::run_stream(container, opts, fn);
+}
+
+template <Partitionable Container, typename T, typename BinaryOp, typename UnaryOp>
+T transform_reduce(const Container &container, T init, BinaryOp reduce_op, UnaryOp transform_op, options opts) {
+    return detail::fold_chunks(detail::stream_chunks(container.size(), opts), std::move(init), reduce_op, transform_op,
+                               [&](auto &fn) { detail::run_stream(container, opts, fn); });
+}
+
+template <Partitionable Container, typename T, typename BinaryOp>
+T reduce(const Container &container, T init, BinaryOp op, options opts) {
+    return parallel::transform_reduce(container, std::move(init), std::move(op), detail::identity_as<T>(), opts);
+}
+
+template <Partitionable Container, typename Predicate>
+std::size_t count_if(const Container &container, Predicate pred, options opts) {
+    return parallel::transform_reduce(container, std::size_t{0}, std::plus<>{}, detail::count_matches(pred), opts);
+}
+
+} // namespace mys::parallel
\ No newline at end of file
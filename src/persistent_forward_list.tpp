@@ -0,0 +1,283 @@
+#include "persistent_forward_list.h"
+#include <stdexcept>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction
+// ===========================================================
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+persistent_forward_list<T, Allocator, AtomicRefCount>::persistent_forward_list(const Allocator &alloc) : allocator_(alloc) {}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+template <std::input_iterator InputIt>
+persistent_forward_list<T, Allocator, AtomicRefCount>::persistent_forward_list(InputIt first, InputIt last, const Allocator &alloc) :
+    allocator_(alloc) {
+    // 节点尚未共享，可以从前往后建链，直接填写上一个节点的 next
+    Node **link = &head_;
+    try {
+        for (; first != last; ++first) {
+            *link = create_node(nullptr, *first);
+            link = &(*link)->next;
+            ++length_;
+        }
+    } catch (...) {
+        release(head_);
+        throw;
+    }
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+persistent_forward_list<T, Allocator, AtomicRefCount>::persistent_forward_list(std::initializer_list<T> init, const Allocator &alloc) :
+    persistent_forward_list(init.begin(), init.end(), alloc) {}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+persistent_forward_list<T, Allocator, AtomicRefCount>::persistent_forward_list(const persistent_forward_list &other) noexcept :
+    allocator_(other.allocator_), head_(other.head_), length_(other.length_) {
+    retain(head_);
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+persistent_forward_list<T, Allocator, AtomicRefCount>::persistent_forward_list(persistent_forward_list &&other) noexcept :
+    allocator_(std::move(other.allocator_)), head_(std::exchange(other.head_, nullptr)), length_(std::exchange(other.length_, 0)) {}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+persistent_forward_list<T, Allocator, AtomicRefCount> &persistent_forward_list<T, Allocator, AtomicRefCount>::operator=(
+    const persistent_forward_list &other) noexcept {
+    if (this != &other) {
+        // 先持有新版本再放下旧版本：两者共享节点时不会中途释放
+        retain(other.head_);
+        release(head_);
+        // 旧节点已用原分配器释放，此后持有的节点来自 other 的分配器
+        allocator_ = other.allocator_;
+        head_ = other.head_;
+        length_ = other.length_;
+    }
+    return *this;
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+persistent_forward_list<T, Allocator, AtomicRefCount> &persistent_forward_list<T, Allocator, AtomicRefCount>::operator=(
+    persistent_forward_list &&other) noexcept {
+    if (this != &other) {
+        release(head_);
+        allocator_ = std::move(other.allocator_);
+        head_ = std::exchange(other.head_, nullptr);
+        length_ = std::exchange(other.length_, 0);
+    }
+    return *this;
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+persistent_forward_list<T, Allocator, AtomicRefCount>::~persistent_forward_list() {
+    release(head_);
+}
+
+// ===========================================================
+// 3. Element Access
+// ===========================================================
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+const T &persistent_forward_list<T, Allocator, AtomicRefCount>::front() const {
+    if (empty()) {
+        throw std::out_of_range("empty");
+    }
+    return head_->val;
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+bool persistent_forward_list<T, Allocator, AtomicRefCount>::empty() const noexcept {
+    return head_ == nullptr;
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+std::size_t persistent_forward_list<T, Allocator, AtomicRefCount>::size() const noexcept {
+    return length_;
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+void persistent_forward_list<T, Allocator, AtomicRefCount>::clear() noexcept {
+    release(std::exchange(head_, nullptr));
+    length_ = 0;
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+void persistent_forward_list<T, Allocator, AtomicRefCount>::swap(persistent_forward_list &other) noexcept {
+    std::swap(allocator_, other.allocator_);
+    std::swap(head_, other.head_);
+    std::swap(length_, other.length_);
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+void persistent_forward_list<T, Allocator, AtomicRefCount>::push_front(const T &value) {
+    emplace_front(value);
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+void persistent_forward_list<T, Allocator, AtomicRefCount>::push_front(T &&value) {
+    emplace_front(std::move(value));
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+template <typename... Args>
+void persistent_forward_list<T, Allocator, AtomicRefCount>::emplace_front(Args &&...args) {
+    // 原来 head_ 持有的计数转给新节点的 next，不需要增减
+    head_ = create_node(head_, std::forward<Args>(args)...);
+    ++length_;
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+void persistent_forward_list<T, Allocator, AtomicRefCount>::pop_front() {
+    if (empty()) return;
+    Node *old = head_;
+    Node *next = old->next;
+    if (unique(old)) {
+        // 只有本版本持有 old：它对 next 的计数直接转给 head_，释放 old 时不再递减
+        destroy_node(old);
+    } else {
+        // 其他版本还在用 old：先持有 next 再放下 old，old 可能恰好在此时变为无人持有
+        retain(next);
+        release(old);
+    }
+    head_ = next;
+    --length_;
+}
+
+// ===========================================================
+// 6. Iterator Interface
+// ===========================================================
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+typename persistent_forward_list<T, Allocator, AtomicRefCount>::const_iterator
+persistent_forward_list<T, Allocator, AtomicRefCount>::begin() const noexcept {
+    return const_iterator(head_);
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+typename persistent_forward_list<T, Allocator, AtomicRefCount>::const_iterator
+persistent_forward_list<T, Allocator, AtomicRefCount>::cbegin() const noexcept {
+    return const_iterator(head_);
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+typename persistent_forward_list<T, Allocator, AtomicRefCount>::const_iterator
+persistent_forward_list<T, Allocator, AtomicRefCount>::end() const noexcept {
+    return const_iterator(nullptr);
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+typename persistent_forward_list<T, Allocator, AtomicRefCount>::const_iterator
+persistent_forward_list<T, Allocator, AtomicRefCount>::cend() const noexcept {
+    return const_iterator(nullptr);
+}
+
+// ===========================================================
+// 7. Comparison Operators
+// ===========================================================
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+bool persistent_forward_list<T, Allocator, AtomicRefCount>::operator==(const persistent_forward_list &other) const {
+    if (length_ != other.length_) return false;
+
+    // 长度相同时共享的尾部出现在相同位置，走到同一个节点即可断定其余部分相等
+    const Node *a = head_;
+    const Node *b = other.head_;
+    while (a != b) {
+        if (!(a->val == b->val)) return false;
+        a = a->next;
+        b = b->next;
+    }
+    return true;
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+std::strong_ordering persistent_forward_list<T, Allocator, AtomicRefCount>::operator<=>(const persistent_forward_list &other) const {
+    const Node *a = head_;
+    const Node *b = other.head_;
+    while (a != b) {
+        if (!a) return std::strong_ordering::less;
+        if (!b) return std::strong_ordering::greater;
+        auto cmp = std::compare_strong_order_fallback(a->val, b->val);
+        if (cmp != 0) return cmp;
+        a = a->next;
+        b = b->next;
+    }
+    return std::strong_ordering::equal;
+}
+
+// ===========================================================
+// 8. Other Operations
+// ===========================================================
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+bool persistent_forward_list<T, Allocator, AtomicRefCount>::shares_with(const persistent_forward_list &other) const noexcept {
+    return head_ == other.head_;
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+void persistent_forward_list<T, Allocator, AtomicRefCount>::retain(Node *node) noexcept {
+    if (!node) return;
+    if constexpr (AtomicRefCount) {
+        // 调用者已持有一个计数，节点不会在此期间被释放，不需要同步
+        node->refs.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        ++node->refs;
+    }
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+void persistent_forward_list<T, Allocator, AtomicRefCount>::release(Node *node) noexcept {
+    // 循环而不是递归：释放一个节点只是把它对后继的计数继续往下放
+    while (node) {
+        if constexpr (AtomicRefCount) {
+            // release 让本线程之前的访问先于释放；最后一个放手的线程用 acquire 看到其他线程的访问
+            if (node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        } else {
+            if (--node->refs != 0) return;
+        }
+        Node *next = node->next;
+        destroy_node(node);
+        node = next;
+    }
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+bool persistent_forward_list<T, Allocator, AtomicRefCount>::unique(const Node *node) noexcept {
+    if constexpr (AtomicRefCount) {
+        // 计数为 1 时只剩本版本，没有其他线程能再增加它
+        return node->refs.load(std::memory_order_acquire) == 1;
+    } else {
+        return node->refs == 1;
+    }
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+template <typename... Args>
+typename persistent_forward_list<T, Allocator, AtomicRefCount>::Node *
+persistent_forward_list<T, Allocator, AtomicRefCount>::create_node(Node *next, Args &&...args) {
+    Node *ptr = std::allocator_traits<NodeAlloc>::allocate(allocator_, 1);
+    try {
+        std::allocator_traits<NodeAlloc>::construct(allocator_, ptr, next, std::forward<Args>(args)...);
+    } catch (...) {
+        std::allocator_traits<NodeAlloc>::deallocate(allocator_, ptr, 1);
+        throw;
+    }
+    return ptr;
+}
+
+template <PersistentListable T, typename Allocator, bool AtomicRefCount>
+void persistent_forward_list<T, Allocator, AtomicRefCount>::destroy_node(Node *node) noexcept {
+    std::allocator_traits<NodeAlloc>::destroy(allocator_, node);
+    std::allocator_traits<NodeAlloc>::deallocate(allocator_, node, 1);
+}
+
+} // namespace mys
\ No newline at end of file
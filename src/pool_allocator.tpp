@@ -0,0 +1,166 @@
+#include "pool_allocator.h"
+
+namespace mys {
+
+namespace detail {
+
+// ===========================================================
+// Pool
+// ===========================================================
+
+template <std::size_t SlabSize>
+pool_resource<SlabSize>::Pool::Pool(std::size_t size, std::size_t align) noexcept : slot_size(size), slot_align(align) {}
+
+template <std::size_t SlabSize>
+pool_resource<SlabSize>::Pool::~Pool() {
+    release_slabs();
+}
+
+template <std::size_t SlabSize>
+void *pool_resource<SlabSize>::Pool::take() {
+    // 优先复用空闲链表
+    if (free_list) {
+        FreeSlot *slot = free_list;
+        free_list = slot->next;
+        return slot;
+    }
+    if (cursor == limit) {
+        add_slab();
+    }
+    void *slot = cursor;
+    cursor += slot_size;
+    return slot;
+}
+
+template <std::size_t SlabSize>
+void pool_resource<SlabSize>::Pool::give_back(void *ptr) noexcept {
+    FreeSlot *slot = static_cast<FreeSlot *>(ptr);
+    slot->next = free_list;
+    free_list = slot;
+}
+
+template <std::size_t SlabSize>
+void pool_resource<SlabSize>::Pool::add_slab() {
+    std::size_t header = (sizeof(SlabHeader) + slot_align - 1) / slot_align * slot_align;
+    std::size_t slots = SlabSize > header + slot_size ? (SlabSize - header) / slot_size : 1;
+    void *raw = ::operator new(header + slots * slot_size, std::align_val_t{slot_align});
+    SlabHeader *slab = static_cast<SlabHeader *>(raw);
+    slab->next = slabs;
+    slabs = slab;
+    cursor = static_cast<std::byte *>(raw) + header;
+    limit = cursor + slots * slot_size;
+}
+
+template <std::size_t SlabSize>
+void pool_resource<SlabSize>::Pool::release_slabs() noexcept {
+    while (slabs) {
+        SlabHeader *next = slabs->next;
+        ::operator delete(static_cast<void *>(slabs), std::align_val_t{slot_align});
+        slabs = next;
+    }
+    free_list = nullptr;
+    cursor = nullptr;
+    limit = nullptr;
+}
+
+// ===========================================================
+// Resource
+// ===========================================================
+
+template <std::size_t SlabSize>
+pool_resource<SlabSize>::~pool_resource() {
+    while (pools_) {
+        Pool *next = pools_->next_pool;
+        delete pools_;
+        pools_ = next;
+    }
+}
+
+template <std::size_t SlabSize>
+typename pool_resource<SlabSize>::Pool *pool_resource<SlabSize>::find(std::size_t slot_size, std::size_t slot_align) const noexcept {
+    for (Pool *pool = pools_; pool; pool = pool->next_pool) {
+        if (pool->slot_size == slot_size && pool->slot_align == slot_align) return pool;
+    }
+    return nullptr;
+}
+
+template <std::size_t SlabSize>
+typename pool_resource<SlabSize>::Pool *pool_resource<SlabSize>::pool_for(std::size_t slot_size, std::size_t slot_align) {
+    if (Pool *pool = find(slot_size, slot_align)) return pool;
+    Pool *pool = new Pool(slot_size, slot_align);
+    pool->next_pool = pools_;
+    pools_ = pool;
+    return pool;
+}
+
+template <std::size_t SlabSize>
+void pool_resource<SlabSize>::release_all() noexcept {
+    for (Pool *pool = pools_; pool; pool = pool->next_pool) {
+        pool->release_slabs();
+    }
+}
+
+} // namespace detail
+
+// ===========================================================
+// Construction
+// ===========================================================
+
+template <typename T, std::size_t SlabSize>
+pool_allocator<T, SlabSize>::pool_allocator(pool_allocator &&other) noexcept :
+    resource_(std::move(other.resource_)), pool_(std::exchange(other.pool_, nullptr)) {}
+
+template <typename T, std::size_t SlabSize>
+pool_allocator<T, SlabSize> &pool_allocator<T, SlabSize>::operator=(pool_allocator &&other) noexcept {
+    if (this != &other) {
+        resource_ = std::move(other.resource_);
+        pool_ = std::exchange(other.pool_, nullptr);
+    }
+    return *this;
+}
+
+// ===========================================================
+// Allocation
+// ===========================================================
+
+template <typename T, std::size_t SlabSize>
+T *pool_allocator<T, SlabSize>::allocate(std::size_t n) {
+    if (n != 1) {
+        return std::allocator<T>().allocate(n);
+    }
+    return static_cast<T *>(own_pool(true)->take());
+}
+
+template <typename T, std::size_t SlabSize>
+void pool_allocator<T, SlabSize>::deallocate(T *ptr, std::size_t n) noexcept {
+    if (n != 1) {
+        std::allocator<T>().deallocate(ptr, n);
+        return;
+    }
+    // 没有子池说明 ptr 不可能来自本资源；槽位仍归原资源所有，随其析构一并回收
+    Pool *pool = own_pool(false);
+    if (!pool) return;
+    pool->give_back(ptr);
+}
+
+template <typename T, std::size_t SlabSize>
+bool pool_allocator<T, SlabSize>::release() noexcept {
+    if (!resource_) return true;
+    if (resource_.use_count() != 1) return false;
+    resource_->release_all();
+    return true;
+}
+
+template <typename T, std::size_t SlabSize>
+typename pool_allocator<T, SlabSize>::Pool *pool_allocator<T, SlabSize>::own_pool(bool create) {
+    if (pool_) return pool_;
+    if (!resource_) {
+        // 只有被移动后的分配器没有资源，首次分配时再创建
+        if (!create) return nullptr;
+        resource_ = std::make_shared<Resource>();
+    }
+    pool_ = create ? resource_->pool_for(slot_size(), slot_align()) : resource_->find(slot_size(), slot_align());
+    return pool_;
+}
+
+} // namespace mys
\ No newline at end of file
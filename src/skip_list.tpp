@@ -0,0 +1,438 @@
+#include "skip_list.h"
+#include <algorithm>
+#include <bit>
+#include <new>
+#include <type_traits>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::skip_list(const Compare &comp, const Allocator &alloc) : allocator_(alloc), comp_(comp) {}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+template <std::input_iterator InputIt>
+skip_list<Key, Compare, Allocator>::skip_list(InputIt first, InputIt last, const Compare &comp, const Allocator &alloc) :
+    allocator_(alloc), comp_(comp) {
+    insert(first, last);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::skip_list(std::initializer_list<Key> init, const Compare &comp, const Allocator &alloc) :
+    allocator_(alloc), comp_(comp) {
+    insert(init.begin(), init.end());
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::skip_list(const skip_list &other) :
+    allocator_(std::allocator_traits<UnitAlloc>::select_on_container_copy_construction(other.allocator_)), comp_(other.comp_),
+    rng_(other.rng_) {
+    // 源已有序且无重复，逐个追加到各层末尾即可，不需要查找
+    NodeBase *last[max_height];
+    std::fill(last, last + max_height, head());
+    try {
+        for (const Key &key : other) {
+            append(key, last);
+        }
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::skip_list(skip_list &&other) noexcept :
+    allocator_(other.allocator_), comp_(other.comp_), height_(other.height_), size_(other.size_), rng_(other.rng_) {
+    // 链接只指向塔底，不会指回哨兵，哨兵可以整体搬走
+    std::copy(other.head_, other.head_ + max_height, head_);
+    std::fill(other.head_, other.head_ + max_height, NodeBase{});
+    other.height_ = 1;
+    other.size_ = 0;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator> &skip_list<Key, Compare, Allocator>::operator=(const skip_list &other) {
+    if (this != &other) {
+        skip_list temp(other);
+        swap(temp);
+    }
+    return *this;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator> &skip_list<Key, Compare, Allocator>::operator=(skip_list &&other) noexcept {
+    if (this != &other) {
+        clear();
+        swap(other);
+    }
+    return *this;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::~skip_list() {
+    clear();
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+void skip_list<Key, Compare, Allocator>::seed(std::uint64_t value) noexcept {
+    // xorshift 的状态不能为 0
+    rng_ = value != 0 ? value : default_seed;
+}
+
+// ===========================================================
+// 3. Lookup
+// ===========================================================
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::iterator skip_list<Key, Compare, Allocator>::find(const Key &key) const {
+    NodeBase *node = lower_bound_node(key);
+    return node && !comp_(key, *key_of(node)) ? iterator(node) : end();
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+bool skip_list<Key, Compare, Allocator>::contains(const Key &key) const {
+    return find(key) != end();
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+std::size_t skip_list<Key, Compare, Allocator>::count(const Key &key) const {
+    return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::iterator skip_list<Key, Compare, Allocator>::lower_bound(const Key &key) const {
+    return iterator(lower_bound_node(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::iterator skip_list<Key, Compare, Allocator>::upper_bound(const Key &key) const {
+    NodeBase *node = lower_bound_node(key);
+    // 键唯一，等于 key 的至多一个
+    if (node && !comp_(key, *key_of(node))) node = node->next;
+    return iterator(node);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+const Key &skip_list<Key, Compare, Allocator>::front() const {
+    return *key_of(head_[0].next);
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+bool skip_list<Key, Compare, Allocator>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+std::size_t skip_list<Key, Compare, Allocator>::size() const noexcept {
+    return size_;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+std::size_t skip_list<Key, Compare, Allocator>::levels() const noexcept {
+    return height_;
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+void skip_list<Key, Compare, Allocator>::clear() noexcept {
+    NodeBase *node = head_[0].next;
+    while (node) {
+        NodeBase *next = node->next;
+        destroy_node(node);
+        node = next;
+    }
+    std::fill(head_, head_ + max_height, NodeBase{});
+    height_ = 1;
+    size_ = 0;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+void skip_list<Key, Compare, Allocator>::swap(skip_list &other) noexcept {
+    using std::swap;
+    swap(allocator_, other.allocator_);
+    swap(comp_, other.comp_);
+    swap(head_, other.head_);
+    swap(height_, other.height_);
+    swap(size_, other.size_);
+    swap(rng_, other.rng_);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+std::pair<typename skip_list<Key, Compare, Allocator>::iterator, bool> skip_list<Key, Compare, Allocator>::insert(const Key &key) {
+    return insert_unique(key);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+std::pair<typename skip_list<Key, Compare, Allocator>::iterator, bool> skip_list<Key, Compare, Allocator>::insert(Key &&key) {
+    return insert_unique(std::move(key));
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+template <std::input_iterator InputIt>
+void skip_list<Key, Compare, Allocator>::insert(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+        // 解引用得到的就是键时先查找再分配，否则只能先构造出键
+        if constexpr (std::is_same_v<std::remove_cvref_t<std::iter_reference_t<InputIt>>, Key>) {
+            insert_unique(*first);
+        } else {
+            emplace(*first);
+        }
+    }
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+void skip_list<Key, Compare, Allocator>::insert(std::initializer_list<Key> init) {
+    insert(init.begin(), init.end());
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+template <typename... Args>
+std::pair<typename skip_list<Key, Compare, Allocator>::iterator, bool> skip_list<Key, Compare, Allocator>::emplace(Args &&...args) {
+    NodeBase *node = create_node(random_height(), std::forward<Args>(args)...);
+    NodeBase *update[max_height];
+    try {
+        find_predecessors(*key_of(node), update);
+    } catch (...) {
+        destroy_node(node);
+        throw;
+    }
+
+    NodeBase *existing = update[0][0].next;
+    if (existing && !comp_(*key_of(node), *key_of(existing))) {
+        destroy_node(node);
+        return {iterator(existing), false};
+    }
+    link_node(node, update);
+    return {iterator(node), true};
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::iterator skip_list<Key, Compare, Allocator>::erase(const_iterator pos) {
+    iterator next(pos.current_->next);
+    erase(*pos);
+    return next;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+std::size_t skip_list<Key, Compare, Allocator>::erase(const Key &key) {
+    NodeBase *update[max_height];
+    find_predecessors(key, update);
+    NodeBase *node = update[0][0].next;
+    if (!node || comp_(key, *key_of(node))) return 0;
+
+    // 各层前驱的链接越过该塔；塔有多高就摘多少层
+    const std::size_t height = height_of(node);
+    for (std::size_t level = 0; level < height; ++level) {
+        update[level][level].next = node[level].next;
+    }
+    destroy_node(node);
+    --size_;
+    while (height_ > 1 && !head_[height_ - 1].next) {
+        --height_;
+    }
+    return 1;
+}
+
+// ===========================================================
+// 6. Iterator Interface
+// ===========================================================
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::iterator skip_list<Key, Compare, Allocator>::begin() const noexcept {
+    return iterator(head_[0].next);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::const_iterator skip_list<Key, Compare, Allocator>::cbegin() const noexcept {
+    return begin();
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::iterator skip_list<Key, Compare, Allocator>::end() const noexcept {
+    return iterator(nullptr);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::const_iterator skip_list<Key, Compare, Allocator>::cend() const noexcept {
+    return end();
+}
+
+// ===========================================================
+// 7. Comparison Operations
+// ===========================================================
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+bool skip_list<Key, Compare, Allocator>::operator==(const skip_list &other) const {
+    return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+}
+
+// ===========================================================
+// 8. Other Operations
+// ===========================================================
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+std::size_t skip_list<Key, Compare, Allocator>::units_for(std::size_t height) noexcept {
+    return (tower_offset + height * sizeof(NodeBase) + sizeof(Unit) - 1) / sizeof(Unit);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+std::size_t skip_list<Key, Compare, Allocator>::random_height() noexcept {
+    rng_ ^= rng_ << 13;
+    rng_ ^= rng_ >> 7;
+    rng_ ^= rng_ << 17;
+    // 每两个连续的 0 位升高一层：升高的概率为 1/4
+    std::size_t height = 1 + static_cast<std::size_t>(std::countr_zero(rng_)) / 2;
+    return std::min(height, max_height);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+void skip_list<Key, Compare, Allocator>::find_predecessors(const Key &key, NodeBase **update) const {
+    // 从最高层开始，每层尽量向右走，然后下降一层；x 始终是某座塔（或哨兵）的底部。
+    // stop 是上一层停下时比较过的塔：下一层走到它时结果已知，不必再读它的键
+    NodeBase *x = head();
+    NodeBase *stop = nullptr;
+    for (std::size_t level = height_; level-- > 0;) {
+        NodeBase *next = x[level].next;
+        for (; next != stop && comp_(*key_of(next), key); next = x[level].next) {
+            x = next;
+        }
+        stop = next;
+        update[level] = x;
+    }
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+skip_list<Key, Compare, Allocator>::NodeBase *skip_list<Key, Compare, Allocator>::lower_bound_node(const Key &key) const {
+    NodeBase *x = head();
+    NodeBase *stop = nullptr;
+    for (std::size_t level = height_; level-- > 0;) {
+        NodeBase *next = x[level].next;
+        for (; next != stop && comp_(*key_of(next), key); next = x[level].next) {
+            x = next;
+        }
+        stop = next;
+    }
+    return stop;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+template <typename... Args>
+skip_list<Key, Compare, Allocator>::NodeBase *skip_list<Key, Compare, Allocator>::create_node(std::size_t height, Args &&...args) {
+    // 一次分配：键在前，高度字节紧挨塔底之前，塔的各层链接在后
+    const std::size_t units = units_for(height);
+    Unit *block = std::allocator_traits<UnitAlloc>::allocate(allocator_, units);
+    unsigned char *bytes = reinterpret_cast<unsigned char *>(block);
+    KeyAlloc key_allocator(allocator_);
+    try {
+        std::allocator_traits<KeyAlloc>::construct(key_allocator, reinterpret_cast<Key *>(bytes), std::forward<Args>(args)...);
+    } catch (...) {
+        std::allocator_traits<UnitAlloc>::deallocate(allocator_, block, units);
+        throw;
+    }
+    NodeBase *node = reinterpret_cast<NodeBase *>(bytes + tower_offset);
+    for (std::size_t level = 0; level < height; ++level) {
+        ::new (static_cast<void *>(node + level)) NodeBase{};
+    }
+    height_of(node) = static_cast<unsigned char>(height);
+    return node;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+void skip_list<Key, Compare, Allocator>::destroy_node(NodeBase *node) noexcept {
+    const std::size_t units = units_for(height_of(node));
+    KeyAlloc key_allocator(allocator_);
+    std::allocator_traits<KeyAlloc>::destroy(key_allocator, key_of(node));
+    std::allocator_traits<UnitAlloc>::deallocate(allocator_, reinterpret_cast<Unit *>(key_of(node)), units);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+template <typename K>
+std::pair<typename skip_list<Key, Compare, Allocator>::iterator, bool> skip_list<Key, Compare, Allocator>::insert_unique(K &&key) {
+    // 键已经在手，先查找：重复时不分配节点
+    NodeBase *update[max_height];
+    find_predecessors(key, update);
+    NodeBase *existing = update[0][0].next;
+    if (existing && !comp_(key, *key_of(existing))) {
+        return {iterator(existing), false};
+    }
+    NodeBase *node = create_node(random_height(), std::forward<K>(key));
+    link_node(node, update);
+    return {iterator(node), true};
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+void skip_list<Key, Compare, Allocator>::link_node(NodeBase *node, NodeBase **update) noexcept {
+    // 新塔比现有层数高时，多出的层以哨兵为前驱
+    const std::size_t height = height_of(node);
+    for (; height_ < height; ++height_) {
+        update[height_] = head();
+    }
+    for (std::size_t level = 0; level < height; ++level) {
+        node[level].next = update[level][level].next;
+        update[level][level].next = node;
+    }
+    ++size_;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+    requires SkipListable<Key, Compare>
+void skip_list<Key, Compare, Allocator>::append(const Key &key, NodeBase **last) {
+    // last[level] 是该层当前的最后一座塔，新塔接在它们后面，前驱就是 last 本身
+    NodeBase *node = create_node(random_height(), key);
+    link_node(node, last);
+    for (std::size_t level = 0; level < height_of(node); ++level) {
+        last[level] = node;
+    }
+}
+
+} // namespace mys
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "small_vector.h"
+#include <algorithm>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <Vectorable T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(std::size_t count) : small_vector() {
+    this->resize(count);
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(std::size_t count, const T &value) : small_vector() {
+    this->resize(count, value);
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+template <std::input_iterator InputIt>
+small_vector<T, N, Allocator>::small_vector(InputIt first, InputIt last) : small_vector() {
+    if constexpr (std::forward_iterator<InputIt>) {
+        this->reserve(static_cast<std::size_t>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+        this->emplace_back(*first);
+    }
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(std::initializer_list<T> init) : small_vector(init.begin(), init.end()) {}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(const small_vector &other) :
+    Base(AllocTraits::select_on_container_copy_construction(other.allocator_)) {
+    point_at_inline();
+    this->reserve(other.size());
+    for (const auto &item : other) {
+        AllocTraits::construct(allocator_, end_, item);
+        ++end_;
+    }
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::small_vector(small_vector &&other) noexcept(std::is_nothrow_move_constructible_v<T>) :
+    Base(std::move(other.allocator_)) {
+    point_at_inline();
+    steal(other);
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator> &small_vector<T, N, Allocator>::operator=(const small_vector &other) {
+    if (this != &other) {
+        this->clear();
+        this->reserve(other.size());
+        for (const auto &item : other) {
+            AllocTraits::construct(allocator_, end_, item);
+            ++end_;
+        }
+    }
+    return *this;
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator> &small_vector<T, N, Allocator>::operator=(small_vector &&other) noexcept(nothrow_move_assign) {
+    if (this == &other) return *this;
+
+    if constexpr (!AllocTraits::propagate_on_container_move_assignment::value && !AllocTraits::is_always_equal::value) {
+        // other's heap buffer belongs to an allocator we must not free through
+        if (allocator_ != other.allocator_) {
+            this->move_elements_from(other);
+            return *this;
+        }
+    }
+    this->clear();
+    release_heap();
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+        allocator_ = std::move(other.allocator_);
+    }
+    steal(other);
+    return *this;
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+small_vector<T, N, Allocator>::~small_vector() {
+    this->clear();
+    release_buffer();
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <Vectorable T, std::size_t N, typename Allocator>
+bool small_vector<T, N, Allocator>::is_inline() const noexcept {
+    return begin_ == inline_data();
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::shrink_to_fit() {
+    if (is_inline() || this->capacity() == this->size()) return;
+    // Fall back into the inline buffer when the elements fit again
+    reallocate(this->size() <= N ? N : this->size());
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <Vectorable T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::swap(small_vector &other) noexcept(nothrow_move_assign) {
+    if (is_inline() || other.is_inline()) {
+        // Inline elements cannot trade places by pointer: relocate them through a temporary
+        small_vector temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+        return;
+    }
+    using std::swap;
+    swap(begin_, other.begin_);
+    swap(end_, other.end_);
+    swap(cap_, other.cap_);
+    if constexpr (AllocTraits::propagate_on_container_swap::value) {
+        swap(allocator_, other.allocator_);
+    }
+}
+
+// ===========================================================
+// Helper Functions
+// ===========================================================
+
+template <Vectorable T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::point_at_inline() noexcept {
+    begin_ = inline_data();
+    end_ = inline_data();
+    cap_ = inline_data() + N;
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::reallocate(std::size_t new_cap) {
+    std::size_t count = this->size();
+    bool to_inline = new_cap <= N;
+    if (to_inline && is_inline()) return;
+
+    T *new_begin = to_inline ? inline_data() : AllocTraits::allocate(allocator_, new_cap);
+    try {
+        this->relocate(begin_, end_, new_begin);
+    } catch (...) {
+        if (!to_inline) AllocTraits::deallocate(allocator_, new_begin, new_cap);
+        throw;
+    }
+    this->adopt_buffer(new_begin, count, to_inline ? N : new_cap);
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::release_buffer() noexcept {
+    if (!is_inline()) {
+        AllocTraits::deallocate(allocator_, begin_, this->capacity());
+    }
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::release_heap() noexcept {
+    release_buffer();
+    point_at_inline();
+}
+
+template <Vectorable T, std::size_t N, typename Allocator>
+void small_vector<T, N, Allocator>::steal(small_vector &other) {
+    if (other.is_inline()) {
+        // At most N elements to move, straight into our own inline buffer
+        this->relocate(other.begin_, other.end_, begin_);
+        end_ = begin_ + other.size();
+        other.end_ = other.begin_;
+        return;
+    }
+    begin_ = other.begin_;
+    end_ = other.end_;
+    cap_ = other.cap_;
+    other.point_at_inline();
+}
+
+} // namespace mys
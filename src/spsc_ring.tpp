@@ -0,0 +1,140 @@
+#include "spsc_ring.h"
+#include <algorithm>
+#include <bit>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <RingStorable T, typename Allocator>
+spsc_ring<T, Allocator>::spsc_ring(std::size_t capacity, const Allocator &alloc) : allocator_(alloc) {
+    std::size_t cap = std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity);
+    slots_ = AllocTraits::allocate(allocator_, cap);
+    std::size_t i = 0;
+    try {
+        for (; i < cap; ++i) {
+            AllocTraits::construct(allocator_, slots_ + i);
+        }
+    } catch (...) {
+        for (std::size_t k = 0; k < i; ++k) {
+            AllocTraits::destroy(allocator_, slots_ + k);
+        }
+        AllocTraits::deallocate(allocator_, slots_, cap);
+        throw;
+    }
+    mask_ = cap - 1;
+}
+
+template <RingStorable T, typename Allocator>
+spsc_ring<T, Allocator>::~spsc_ring() {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        AllocTraits::destroy(allocator_, slots_ + i);
+    }
+    AllocTraits::deallocate(allocator_, slots_, mask_ + 1);
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <RingStorable T, typename Allocator>
+std::size_t spsc_ring<T, Allocator>::capacity() const noexcept {
+    return mask_ + 1;
+}
+
+template <RingStorable T, typename Allocator>
+std::size_t spsc_ring<T, Allocator>::size_approx() const noexcept {
+    std::size_t head = head_.load(std::memory_order_acquire);
+    std::size_t tail = tail_.load(std::memory_order_acquire);
+    return tail >= head ? tail - head : 0;
+}
+
+template <RingStorable T, typename Allocator>
+bool spsc_ring<T, Allocator>::empty_approx() const noexcept {
+    return size_approx() == 0;
+}
+
+// ===========================================================
+// 5. Producer Operations
+// ===========================================================
+
+template <RingStorable T, typename Allocator>
+bool spsc_ring<T, Allocator>::try_push(const T &value) {
+    return push_impl(value);
+}
+
+template <RingStorable T, typename Allocator>
+bool spsc_ring<T, Allocator>::try_push(T &&value) {
+    return push_impl(std::move(value));
+}
+
+template <RingStorable T, typename Allocator>
+template <typename U>
+bool spsc_ring<T, Allocator>::push_impl(U &&value) {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ > mask_) {
+        // Looks full: only now look at the consumer's index
+        cached_head_ = head_.load(std::memory_order_acquire);
+        if (tail - cached_head_ > mask_) return false;
+    }
+    slots_[tail & mask_] = std::forward<U>(value);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <RingStorable T, typename Allocator>
+std::span<T> spsc_ring<T, Allocator>::reserve(std::size_t n) {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    std::size_t free = mask_ + 1 - (tail - cached_head_);
+    if (free < n) {
+        cached_head_ = head_.load(std::memory_order_acquire);
+        free = mask_ + 1 - (tail - cached_head_);
+    }
+    std::size_t index = tail & mask_;
+    std::size_t count = std::min({n, free, mask_ + 1 - index});
+    return std::span<T>(slots_ + index, count);
+}
+
+template <RingStorable T, typename Allocator>
+void spsc_ring<T, Allocator>::commit(std::size_t n) noexcept {
+    tail_.store(tail_.load(std::memory_order_relaxed) + n, std::memory_order_release);
+}
+
+// ===========================================================
+// 6. Consumer Operations
+// ===========================================================
+
+template <RingStorable T, typename Allocator>
+bool spsc_ring<T, Allocator>::try_pop(T &out) {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+        // Looks empty: only now look at the producer's index
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (head == cached_tail_) return false;
+    }
+    out = std::move(slots_[head & mask_]);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <RingStorable T, typename Allocator>
+std::span<T> spsc_ring<T, Allocator>::peek(std::size_t n) {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    std::size_t available = cached_tail_ - head;
+    if (available < n) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        available = cached_tail_ - head;
+    }
+    std::size_t index = head & mask_;
+    std::size_t count = std::min({n, available, mask_ + 1 - index});
+    return std::span<T>(slots_ + index, count);
+}
+
+template <RingStorable T, typename Allocator>
+void spsc_ring<T, Allocator>::release(std::size_t n) noexcept {
+    head_.store(head_.load(std::memory_order_relaxed) + n, std::memory_order_release);
+}
+
+} // namespace mys
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include "thread_pool.h"
+#include <algorithm>
+#include <functional>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+inline thread_pool::thread_pool(std::size_t threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // 所有 deque 建好之后再启动线程，线程启动后 workers_ 不再改变
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    threads_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        threads_.emplace_back([this, i] { worker_loop(i); });
+    }
+}
+
+inline thread_pool::~thread_pool() {
+    stop_.store(true);
+    work_epoch_.fetch_add(1);
+    work_epoch_.notify_all();
+    threads_.clear();
+
+    // 正常情况下所有任务组都已等待完毕，这里只回收异常路径上遗留的任务
+    Task *task;
+    for (auto &worker : workers_) {
+        while (worker->deque.try_pop(task)) {
+            delete task;
+        }
+    }
+    while (!injected_.empty()) {
+        delete injected_.front();
+        injected_.pop_front();
+    }
+}
+
+inline thread_pool &thread_pool::shared() {
+    static thread_pool pool(std::max(2u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+inline std::size_t thread_pool::size() const noexcept {
+    return workers_.size();
+}
+
+// ===========================================================
+// 5. Fork / Join
+// ===========================================================
+
+template <typename F>
+void thread_pool::spawn(task_group &group, F &&f) {
+    Task *task = new TaskImpl<std::decay_t<F>>(&group, std::forward<F>(f));
+    group.pending_.fetch_add(1, std::memory_order_relaxed);
+
+    std::size_t self = current_worker();
+    try {
+        if (self != no_worker) {
+            workers_[self]->deque.push(task);
+        } else {
+            std::lock_guard lock(injected_mutex_);
+            injected_.push_back(task);
+            injected_size_.fetch_add(1, std::memory_order_release);
+        }
+    } catch (...) {
+        // 扩容失败时任务没有入队，撤销计数
+        group.pending_.fetch_sub(1, std::memory_order_relaxed);
+        delete task;
+        throw;
+    }
+    wake(idle_, work_epoch_, false);
+}
+
+inline void thread_pool::wait(task_group &group) {
+    const std::size_t self = current_worker();
+    while (!group.done()) {
+        // 外部线程只等待：它执行的任务再 spawn 会进入 FIFO 的注入队列，取回来的总是最老的任务，
+        // 一层层嵌套在它的栈上近似广度优先地展开整棵任务树
+        if (self != no_worker) {
+            if (Task *task = find_task(self)) {
+                execute(task);
+                continue;
+            }
+        }
+        // 无事可做时先登记再检查一遍，与 wake() 配对，不会错过唤醒
+        waiters_.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::uint64_t seen = done_epoch_.load();
+        if (!group.done()) {
+            done_epoch_.wait(seen);
+        }
+        waiters_.fetch_sub(1);
+    }
+
+    // 复位后任务组可以再次使用
+    if (group.failed_.load(std::memory_order_acquire)) {
+        std::exception_ptr error = std::exchange(group.error_, nullptr);
+        group.failed_.store(false, std::memory_order_relaxed);
+        std::rethrow_exception(error);
+    }
+}
+
+// ===========================================================
+// 8. Other Operations
+// ===========================================================
+
+inline std::size_t thread_pool::current_worker() const noexcept {
+    return current_pool_ == this ? current_index_ : no_worker;
+}
+
+inline thread_pool::Task *thread_pool::find_task(std::size_t self) noexcept {
+    Task *task = nullptr;
+    if (self != no_worker && workers_[self]->deque.try_pop(task)) {
+        return task;
+    }
+
+    if (injected_size_.load(std::memory_order_acquire) != 0) {
+        std::lock_guard lock(injected_mutex_);
+        if (!injected_.empty()) {
+            task = injected_.front();
+            injected_.pop_front();
+            injected_size_.fetch_sub(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+
+    // 从随机的受害者开始轮一圈；窃取失败（包括竞争失败）就换下一个，不在同一个 deque 上重试
+    const std::size_t n = workers_.size();
+    const std::size_t start = random_index(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t victim = start + i < n ? start + i : start + i - n;
+        if (victim != self && workers_[victim]->deque.try_steal(task)) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+inline std::size_t thread_pool::random_index(std::size_t n) noexcept {
+    if (rng_ == 0) {
+        rng_ = std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+    }
+    rng_ ^= rng_ << 13;
+    rng_ ^= rng_ >> 7;
+    rng_ ^= rng_ << 17;
+    return static_cast<std::size_t>(rng_ % n);
+}
+
+inline void thread_pool::execute(Task *task) noexcept {
+    task_group *group = task->group;
+    try {
+        task->run();
+    } catch (...) {
+        if (!group->failed_.exchange(true, std::memory_order_relaxed)) {
+            group->error_ = std::current_exception();
+        }
+    }
+    delete task;
+    // 计数归零后等待者随时可能销毁任务组，之后只能访问线程池自身
+    if (group->pending_.fetch_sub(1) == 1) {
+        wake(waiters_, done_epoch_, true);
+    }
+}
+
+inline void thread_pool::wake(std::atomic<std::size_t> &count, std::atomic<std::uint64_t> &epoch, bool all) noexcept {
+    // 与睡眠者"先登记、再检查"的顺序配对：要么这里看到睡眠者并推进 epoch，要么睡眠者的检查看到新状态
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (count.load() != 0) {
+        epoch.fetch_add(1);
+        if (all) {
+            epoch.notify_all();
+        } else {
+            epoch.notify_one();
+        }
+    }
+}
+
+inline void thread_pool::worker_loop(std::size_t self) {
+    current_pool_ = this;
+    current_index_ = self;
+
+    constexpr int spins_before_sleep = 16;
+    int idle = 0;
+    while (true) {
+        if (Task *task = find_task(self)) {
+            execute(task);
+            idle = 0;
+            continue;
+        }
+        // 先让出几次 CPU 再睡，避免 fork/join 间隙里频繁睡眠和唤醒
+        if (++idle < spins_before_sleep) {
+            std::this_thread::yield();
+            continue;
+        }
+        idle_.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::uint64_t seen = work_epoch_.load();
+        if (stop_.load()) {
+            idle_.fetch_sub(1);
+            return;
+        }
+        if (Task *task = find_task(self)) {
+            idle_.fetch_sub(1);
+            execute(task);
+            idle = 0;
+            continue;
+        }
+        work_epoch_.wait(seen);
+        idle_.fetch_sub(1);
+    }
+}
+
+} // namespace mys
\ No newline at end of file
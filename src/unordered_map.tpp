@@ -0,0 +1,678 @@
+#include "unordered_map.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(std::size_t bucket_count, const Hash &hash, const KeyEqual &equal,
+                                                               const Allocator &alloc) :
+    hash_(hash), equal_(equal), allocator_(alloc) {
+    if (bucket_count > 0) {
+        rehash(bucket_count);
+    }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <std::input_iterator InputIt>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(InputIt first, InputIt last, std::size_t bucket_count, const Hash &hash,
+                                                               const KeyEqual &equal, const Allocator &alloc) :
+    unordered_map(bucket_count, hash, equal, alloc) {
+    insert(first, last);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(std::initializer_list<value_type> init, std::size_t bucket_count,
+                                                               const Hash &hash, const KeyEqual &equal, const Allocator &alloc) :
+    unordered_map(init.begin(), init.end(), bucket_count, hash, equal, alloc) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(const unordered_map &other) :
+    hash_(other.hash_), equal_(other.equal_), allocator_(AllocTraits::select_on_container_copy_construction(other.allocator_)) {
+    if (other.empty()) return;
+
+    resize(capacity_for(other.size_));
+    try {
+        // Keys are known to be distinct, so each one only needs a free slot
+        for (const auto &item : other) {
+            std::size_t hash = hash_of(item.first);
+            std::size_t index = find_first_free(hash);
+            AllocTraits::construct(allocator_, slots_ + index, item);
+            set_full(index, hash);
+        }
+    } catch (...) {
+        destroy_and_deallocate();
+        throw;
+    }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::unordered_map(unordered_map &&other) noexcept :
+    hash_(std::move(other.hash_)), equal_(std::move(other.equal_)), allocator_(std::move(other.allocator_)), ctrl_(other.ctrl_),
+    slots_(other.slots_), capacity_(other.capacity_), size_(other.size_), growth_left_(other.growth_left_) {
+    other.ctrl_ = nullptr;
+    other.slots_ = nullptr;
+    other.capacity_ = 0;
+    other.size_ = 0;
+    other.growth_left_ = 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator> &unordered_map<Key, T, Hash, KeyEqual, Allocator>::operator=(const unordered_map &other) {
+    if (this != &other) {
+        unordered_map temp(other);
+        swap(temp);
+    }
+    return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator> &unordered_map<Key, T, Hash, KeyEqual, Allocator>::operator=(unordered_map &&other) noexcept {
+    if (this != &other) {
+        unordered_map temp(std::move(other));
+        swap(temp);
+    }
+    return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::~unordered_map() {
+    destroy_and_deallocate();
+}
+
+// ===========================================================
+// 3. Element Access and Lookup
+// ===========================================================
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename Self>
+auto &&unordered_map<Key, T, Hash, KeyEqual, Allocator>::at(this Self &&self, const Key &key) {
+    std::size_t index = self.find_index(key, self.hash_of(key));
+    if (index == npos) {
+        throw std::out_of_range("unordered_map::at");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(self.slots_[index].second);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+T &unordered_map<Key, T, Hash, KeyEqual, Allocator>::operator[](const Key &key) {
+    return try_emplace(key).first->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+T &unordered_map<Key, T, Hash, KeyEqual, Allocator>::operator[](Key &&key) {
+    return try_emplace(std::move(key)).first->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename Self>
+auto unordered_map<Key, T, Hash, KeyEqual, Allocator>::find(this Self &&self, const Key &key) {
+    using It = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+    std::size_t index = self.find_index(key, self.hash_of(key));
+    if (index == npos) {
+        return It(self.end());
+    }
+    return It(self.ctrl_ + index, self.slots_ + index);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K>
+    requires TransparentLookup<Hash, KeyEqual>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator unordered_map<Key, T, Hash, KeyEqual, Allocator>::find(const K &key) {
+    std::size_t index = find_index(key, hash_of(key));
+    return index == npos ? end() : iterator_at(index);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K>
+    requires TransparentLookup<Hash, KeyEqual>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator unordered_map<Key, T, Hash, KeyEqual, Allocator>::find(const K &key) const {
+    std::size_t index = find_index(key, hash_of(key));
+    return index == npos ? end() : const_iterator(ctrl_ + index, slots_ + index);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+bool unordered_map<Key, T, Hash, KeyEqual, Allocator>::contains(const Key &key) const {
+    return find_index(key, hash_of(key)) != npos;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K>
+    requires TransparentLookup<Hash, KeyEqual>
+bool unordered_map<Key, T, Hash, KeyEqual, Allocator>::contains(const K &key) const {
+    return find_index(key, hash_of(key)) != npos;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::size_t unordered_map<Key, T, Hash, KeyEqual, Allocator>::count(const Key &key) const {
+    return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K>
+    requires TransparentLookup<Hash, KeyEqual>
+std::size_t unordered_map<Key, T, Hash, KeyEqual, Allocator>::count(const K &key) const {
+    return contains(key) ? 1 : 0;
+}
+
+// ===========================================================
+// 4. Capacity Query and Bucket Interface
+// ===========================================================
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+bool unordered_map<Key, T, Hash, KeyEqual, Allocator>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::size_t unordered_map<Key, T, Hash, KeyEqual, Allocator>::size() const noexcept {
+    return size_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::size_t unordered_map<Key, T, Hash, KeyEqual, Allocator>::max_size() const noexcept {
+    return std::min<std::size_t>(AllocTraits::max_size(allocator_), std::numeric_limits<std::ptrdiff_t>::max() / sizeof(value_type));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::size_t unordered_map<Key, T, Hash, KeyEqual, Allocator>::bucket_count() const noexcept {
+    return capacity_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+float unordered_map<Key, T, Hash, KeyEqual, Allocator>::load_factor() const noexcept {
+    return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(capacity_);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::rehash(std::size_t count) {
+    std::size_t new_capacity = count == 0 ? 0 : std::bit_ceil(std::max(count, Group::width));
+    new_capacity = std::max(new_capacity, capacity_for(size_));
+    if (new_capacity == 0) {
+        destroy_and_deallocate();
+        return;
+    }
+    resize(new_capacity);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::reserve(std::size_t count) {
+    if (count > max_size()) throw std::length_error("unordered_map::reserve");
+    if (count <= size_ + growth_left_) return;
+    // Tombstones may be all that is in the way, in which case a rebuild at the same size is enough
+    resize(std::max(capacity_for(count), capacity_));
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::clear() noexcept {
+    if (capacity_ == 0) return;
+    for (std::size_t i = 0; i < capacity_; ++i) {
+        if (ctrl_[i] >= 0) {
+            AllocTraits::destroy(allocator_, slots_ + i);
+        }
+    }
+    std::fill_n(ctrl_, capacity_, detail::ctrl_empty);
+    size_ = 0;
+    growth_left_ = max_load(capacity_);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::swap(unordered_map &other) noexcept {
+    using std::swap;
+    swap(hash_, other.hash_);
+    swap(equal_, other.equal_);
+    swap(ctrl_, other.ctrl_);
+    swap(slots_, other.slots_);
+    swap(capacity_, other.capacity_);
+    swap(size_, other.size_);
+    swap(growth_left_, other.growth_left_);
+    if constexpr (AllocTraits::propagate_on_container_swap::value) {
+        swap(allocator_, other.allocator_);
+    }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(const value_type &value) {
+    return emplace_key(value.first, hash_of(value.first), value);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(value_type &&value) {
+    // value is only moved from once its slot is known, so looking up through value.first is safe
+    return emplace_key(value.first, hash_of(value.first), std::move(value));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename P>
+    requires std::constructible_from<std::pair<const Key, T>, P &&>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(P &&value) {
+    return emplace(std::forward<P>(value));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <std::input_iterator InputIt>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(InputIt first, InputIt last) {
+    if constexpr (std::forward_iterator<InputIt>) {
+        reserve(size_ + static_cast<std::size_t>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+        emplace(*first);
+    }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert(std::initializer_list<value_type> ilist) {
+    insert(ilist.begin(), ilist.end());
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename M>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert_or_assign(const Key &key, M &&obj) {
+    auto result = try_emplace(key, std::forward<M>(obj));
+    if (!result.second) {
+        result.first->second = std::forward<M>(obj);
+    }
+    return result;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename M>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::insert_or_assign(Key &&key, M &&obj) {
+    auto result = try_emplace(std::move(key), std::forward<M>(obj));
+    if (!result.second) {
+        result.first->second = std::forward<M>(obj);
+    }
+    return result;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::emplace(Args &&...args) {
+    // The key is only known after construction, so build the element once up front;
+    // try_emplace avoids this when the key is at hand
+    value_type value(std::forward<Args>(args)...);
+    return emplace_key(value.first, hash_of(value.first), std::move(value));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::try_emplace(const Key &key, Args &&...args) {
+    return emplace_key(key, hash_of(key), std::piecewise_construct, std::forward_as_tuple(key),
+                       std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::try_emplace(Key &&key, Args &&...args) {
+    return emplace_key(key, hash_of(key), std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                       std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator unordered_map<Key, T, Hash, KeyEqual, Allocator>::erase(iterator pos) {
+    return erase(const_iterator(pos));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator unordered_map<Key, T, Hash, KeyEqual, Allocator>::erase(const_iterator pos) {
+    std::size_t index = static_cast<std::size_t>(pos.ctrl_ - ctrl_);
+    erase_at(index);
+    iterator next = iterator_at(index);
+    next.skip_free();
+    return next;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator unordered_map<Key, T, Hash, KeyEqual, Allocator>::erase(const_iterator first,
+                                                                                                                  const_iterator last) {
+    while (first != last) {
+        first = erase(first);
+    }
+    return iterator_at(static_cast<std::size_t>(last.ctrl_ - ctrl_));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::size_t unordered_map<Key, T, Hash, KeyEqual, Allocator>::erase(const Key &key) {
+    std::size_t index = find_index(key, hash_of(key));
+    if (index == npos) return 0;
+    erase_at(index);
+    return 1;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K>
+    requires TransparentLookup<Hash, KeyEqual> &&
+             (!std::convertible_to<K, typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator>) &&
+             (!std::convertible_to<K, typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator>)
+std::size_t unordered_map<Key, T, Hash, KeyEqual, Allocator>::erase(K &&key) {
+    std::size_t index = find_index(key, hash_of(key));
+    if (index == npos) return 0;
+    erase_at(index);
+    return 1;
+}
+
+// ===========================================================
+// 6. Iterator Interface
+// ===========================================================
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename Self>
+auto unordered_map<Key, T, Hash, KeyEqual, Allocator>::begin(this Self &&self) noexcept {
+    using It = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+    if (self.size_ == 0) {
+        return It(self.end());
+    }
+    It it(self.ctrl_, self.slots_);
+    it.skip_free();
+    return it;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator unordered_map<Key, T, Hash, KeyEqual, Allocator>::cbegin() const noexcept {
+    return begin();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename Self>
+auto unordered_map<Key, T, Hash, KeyEqual, Allocator>::end(this Self &&self) noexcept {
+    using It = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+    return It(self.ctrl_ + self.capacity_, self.slots_ + self.capacity_);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator unordered_map<Key, T, Hash, KeyEqual, Allocator>::cend() const noexcept {
+    return end();
+}
+
+// ===========================================================
+// 7. Comparison Operations
+// ===========================================================
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+bool unordered_map<Key, T, Hash, KeyEqual, Allocator>::operator==(const unordered_map &other) const {
+    if (size_ != other.size_) return false;
+    for (const auto &item : *this) {
+        std::size_t index = other.find_index(item.first, other.hash_of(item.first));
+        if (index == npos || !(other.slots_[index].second == item.second)) return false;
+    }
+    return true;
+}
+
+// ===========================================================
+// Helper Functions
+// ===========================================================
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K>
+std::size_t unordered_map<Key, T, Hash, KeyEqual, Allocator>::hash_of(const K &key) const {
+    // MurmurHash3 finalizer: spreads every input bit over the whole word
+    auto h = static_cast<std::uint64_t>(hash_(key));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::size_t unordered_map<Key, T, Hash, KeyEqual, Allocator>::capacity_for(std::size_t count) noexcept {
+    if (count == 0) return 0;
+    std::size_t capacity = Group::width;
+    while (max_load(capacity) < count) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K>
+std::size_t unordered_map<Key, T, Hash, KeyEqual, Allocator>::find_index(const K &key, std::size_t hash) const {
+    if (size_ == 0) return npos;
+
+    const ctrl_t tag = h2(hash);
+    const std::size_t group_mask = capacity_ / Group::width - 1;
+    std::size_t group = (hash >> 7) & group_mask;
+    // Step by 1, 2, 3, ... groups: with a power-of-two group count this visits every group once
+    for (std::size_t step = 1;; ++step) {
+        std::size_t offset = group * Group::width;
+        Group g(ctrl_ + offset);
+        for (std::uint32_t bits = g.match(tag); bits != 0; bits &= bits - 1) {
+            std::size_t index = offset + static_cast<std::size_t>(std::countr_zero(bits));
+            if (equal_(slots_[index].first, key)) return index;
+        }
+        // An empty slot means the key was never pushed further along the sequence
+        if (g.match_empty() != 0) return npos;
+        group = (group + step) & group_mask;
+    }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K>
+std::pair<std::size_t, bool> unordered_map<Key, T, Hash, KeyEqual, Allocator>::find_or_prepare_insert(const K &key, std::size_t hash) {
+    if (capacity_ == 0) {
+        resize(Group::width);
+    }
+
+    const ctrl_t tag = h2(hash);
+    const std::size_t group_mask = capacity_ / Group::width - 1;
+    std::size_t group = (hash >> 7) & group_mask;
+    std::size_t target = npos;
+    for (std::size_t step = 1;; ++step) {
+        std::size_t offset = group * Group::width;
+        Group g(ctrl_ + offset);
+        for (std::uint32_t bits = g.match(tag); bits != 0; bits &= bits - 1) {
+            std::size_t index = offset + static_cast<std::size_t>(std::countr_zero(bits));
+            if (equal_(slots_[index].first, key)) return {index, true};
+        }
+        // Remember the first reusable slot, but keep probing until the key is known to be absent
+        if (target == npos) {
+            if (std::uint32_t free = g.match_empty_or_deleted(); free != 0) {
+                target = offset + static_cast<std::size_t>(std::countr_zero(free));
+            }
+        }
+        if (g.match_empty() != 0) break;
+        group = (group + step) & group_mask;
+    }
+
+    // Reusing a tombstone does not use up growth; taking an empty slot does
+    if (growth_left_ == 0 && ctrl_[target] == detail::ctrl_empty) {
+        rehash_for_insert();
+        target = find_first_free(hash);
+    }
+    return {target, false};
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+std::size_t unordered_map<Key, T, Hash, KeyEqual, Allocator>::find_first_free(std::size_t hash) const noexcept {
+    const std::size_t group_mask = capacity_ / Group::width - 1;
+    std::size_t group = (hash >> 7) & group_mask;
+    for (std::size_t step = 1;; ++step) {
+        std::size_t offset = group * Group::width;
+        if (std::uint32_t free = Group(ctrl_ + offset).match_empty_or_deleted(); free != 0) {
+            return offset + static_cast<std::size_t>(std::countr_zero(free));
+        }
+        group = (group + step) & group_mask;
+    }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+template <typename K, typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual, Allocator>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual, Allocator>::emplace_key(const K &key, std::size_t hash, Args &&...args) {
+    auto [index, found] = find_or_prepare_insert(key, hash);
+    if (!found) {
+        AllocTraits::construct(allocator_, slots_ + index, std::forward<Args>(args)...);
+        set_full(index, hash);
+    }
+    return {iterator_at(index), !found};
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::set_full(std::size_t index, std::size_t hash) noexcept {
+    if (ctrl_[index] == detail::ctrl_empty) {
+        --growth_left_;
+    }
+    ctrl_[index] = h2(hash);
+    ++size_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::erase_at(std::size_t index) noexcept {
+    AllocTraits::destroy(allocator_, slots_ + index);
+    --size_;
+
+    // A group that still has an empty slot has never been full, so no probe sequence runs through
+    // it and the slot can become empty again. Otherwise a tombstone keeps longer chains intact.
+    std::size_t offset = index & ~(Group::width - 1);
+    if (Group(ctrl_ + offset).match_empty() != 0) {
+        ctrl_[index] = detail::ctrl_empty;
+        ++growth_left_;
+    } else {
+        ctrl_[index] = detail::ctrl_deleted;
+    }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::rehash_for_insert() {
+    if (capacity_ > 0 && size_ * 32 <= capacity_ * 25) {
+        // Live elements fill at most 25/32 of the slots, so tombstones take up at least 3/32:
+        // cleaning them up frees enough room that rebuilding at the same size stays amortized O(1)
+        resize(capacity_);
+    } else {
+        resize(capacity_ == 0 ? Group::width : capacity_ * 2);
+    }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::resize(std::size_t new_capacity) {
+    // Everything that can throw happens while the old table is still whole: the allocations, then a
+    // first pass that hashes every element and claims its slot in the new control array. The second
+    // pass moves elements only when that cannot throw and copies them otherwise, so a failure at any
+    // point leaves the map exactly as it was.
+    CtrlAlloc ctrl_alloc(allocator_);
+    IndexAlloc index_alloc(allocator_);
+    ctrl_t *new_ctrl = CtrlTraits::allocate(ctrl_alloc, new_capacity + 1);
+    value_type *new_slots = nullptr;
+    std::size_t *targets = nullptr; // new index of each element, in old slot order
+    try {
+        new_slots = AllocTraits::allocate(allocator_, new_capacity);
+        if (size_ > 0) targets = IndexTraits::allocate(index_alloc, size_);
+    } catch (...) {
+        if (new_slots) AllocTraits::deallocate(allocator_, new_slots, new_capacity);
+        CtrlTraits::deallocate(ctrl_alloc, new_ctrl, new_capacity + 1);
+        throw;
+    }
+    std::fill_n(new_ctrl, new_capacity, detail::ctrl_empty);
+    new_ctrl[new_capacity] = detail::ctrl_sentinel;
+
+    ctrl_t *old_ctrl = ctrl_;
+    value_type *old_slots = slots_;
+    std::size_t old_capacity = capacity_;
+    std::size_t old_size = size_;
+    std::size_t old_growth_left = growth_left_;
+    auto abandon = [&] {
+        ctrl_ = old_ctrl;
+        slots_ = old_slots;
+        capacity_ = old_capacity;
+        size_ = old_size;
+        growth_left_ = old_growth_left;
+        if (targets) IndexTraits::deallocate(index_alloc, targets, old_size);
+        AllocTraits::deallocate(allocator_, new_slots, new_capacity);
+        CtrlTraits::deallocate(ctrl_alloc, new_ctrl, new_capacity + 1);
+    };
+
+    // find_first_free and set_full work on the members, so point them at the new control bytes
+    ctrl_ = new_ctrl;
+    capacity_ = new_capacity;
+    size_ = 0;
+    growth_left_ = max_load(new_capacity);
+    try {
+        std::size_t placed = 0;
+        for (std::size_t i = 0; i < old_capacity; ++i) {
+            if (old_ctrl[i] < 0) continue;
+            std::size_t hash = hash_of(old_slots[i].first);
+            std::size_t index = find_first_free(hash);
+            set_full(index, hash);
+            targets[placed++] = index;
+        }
+    } catch (...) {
+        abandon();
+        throw;
+    }
+
+    constexpr bool nothrow_relocate = std::is_nothrow_move_constructible_v<Key> && std::is_nothrow_move_constructible_v<T>;
+    std::size_t built = 0;
+    try {
+        for (std::size_t i = 0; i < old_capacity; ++i) {
+            if (old_ctrl[i] < 0) continue;
+            value_type &item = old_slots[i];
+            value_type *slot = new_slots + targets[built];
+            if constexpr (nothrow_relocate || !std::is_copy_constructible_v<value_type>) {
+                // The source is destroyed right after, so its key may be moved despite being const
+                AllocTraits::construct(allocator_, slot, std::piecewise_construct,
+                                       std::forward_as_tuple(std::move(const_cast<Key &>(item.first))),
+                                       std::forward_as_tuple(std::move(item.second)));
+            } else {
+                AllocTraits::construct(allocator_, slot, std::as_const(item));
+            }
+            ++built;
+        }
+    } catch (...) {
+        // Drop what was built and keep the old table. After a throwing copy every source is intact; a
+        // move-only type whose move threw leaves the entries moved so far valid but unspecified
+        for (std::size_t k = 0; k < built; ++k) {
+            AllocTraits::destroy(allocator_, new_slots + targets[k]);
+        }
+        abandon();
+        throw;
+    }
+
+    slots_ = new_slots;
+    if (targets) IndexTraits::deallocate(index_alloc, targets, old_size);
+    if (old_ctrl) {
+        for (std::size_t i = 0; i < old_capacity; ++i) {
+            if (old_ctrl[i] >= 0) AllocTraits::destroy(allocator_, old_slots + i);
+        }
+        AllocTraits::deallocate(allocator_, old_slots, old_capacity);
+        CtrlTraits::deallocate(ctrl_alloc, old_ctrl, old_capacity + 1);
+    }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+void unordered_map<Key, T, Hash, KeyEqual, Allocator>::destroy_and_deallocate() noexcept {
+    if (ctrl_ == nullptr) return;
+    for (std::size_t i = 0; i < capacity_; ++i) {
+        if (ctrl_[i] >= 0) {
+            AllocTraits::destroy(allocator_, slots_ + i);
+        }
+    }
+    CtrlAlloc ctrl_alloc(allocator_);
+    AllocTraits::deallocate(allocator_, slots_, capacity_);
+    CtrlTraits::deallocate(ctrl_alloc, ctrl_, capacity_ + 1);
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growth_left_ = 0;
+}
+
+} // namespace mys
\ No newline at end of file
@@ -0,0 +1,477 @@
+#include "unrolled_list.h"
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::unrolled_list(std::initializer_list<T> init) : unrolled_list() {
+    for (auto &x : init) {
+        push_back(x);
+    }
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::unrolled_list(const unrolled_list &other) : unrolled_list() {
+    for (const auto &item : other) {
+        push_back(item);
+    }
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::unrolled_list(unrolled_list &&other) noexcept :
+    allocator_(std::move(other.allocator_)), head(other.head), tail(other.tail), length(other.length) {
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.length = 0;
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator> &unrolled_list<T, N, Allocator>::operator=(const unrolled_list &other) {
+    if (this != &other) {
+        unrolled_list temp(other);
+        swap(temp);
+    }
+    return *this;
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator> &unrolled_list<T, N, Allocator>::operator=(unrolled_list &&other) noexcept {
+    if (this != &other) {
+        clear();
+        if constexpr (std::allocator_traits<NodeAlloc>::propagate_on_container_move_assignment::value) {
+            allocator_ = std::move(other.allocator_);
+        }
+        head = other.head;
+        tail = other.tail;
+        length = other.length;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.length = 0;
+    }
+    return *this;
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::~unrolled_list() {
+    clear();
+}
+
+// ===========================================================
+// 3. Element Access
+// ===========================================================
+
+template <Listable T, std::size_t N, typename Allocator>
+template <typename Self>
+auto &&unrolled_list<T, N, Allocator>::front(this Self &&self) {
+    if (self.empty()) {
+        throw std::out_of_range("empty");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(*self.head->slot(0));
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+template <typename Self>
+auto &&unrolled_list<T, N, Allocator>::back(this Self &&self) {
+    if (self.empty()) {
+        throw std::out_of_range("empty");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(*self.tail->slot(self.tail->count - 1));
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <Listable T, std::size_t N, typename Allocator>
+bool unrolled_list<T, N, Allocator>::empty() const noexcept {
+    return length == 0;
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+std::size_t unrolled_list<T, N, Allocator>::size() const noexcept {
+    return length;
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <Listable T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::clear() noexcept {
+    while (head) {
+        Node *cur = head;
+        head = head->next;
+        destroy_node(cur);
+    }
+    tail = nullptr;
+    length = 0;
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::swap(unrolled_list &other) noexcept {
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(length, other.length);
+    std::swap(allocator_, other.allocator_);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::push_back(const T &value) {
+    emplace(cend(), value);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::push_back(T &&value) {
+    emplace(cend(), std::move(value));
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::push_front(const T &value) {
+    emplace(cbegin(), value);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::push_front(T &&value) {
+    emplace(cbegin(), std::move(value));
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+template <typename... Args>
+void unrolled_list<T, N, Allocator>::emplace_back(Args &&...args) {
+    emplace(cend(), std::forward<Args>(args)...);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+template <typename... Args>
+void unrolled_list<T, N, Allocator>::emplace_front(Args &&...args) {
+    emplace(cbegin(), std::forward<Args>(args)...);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::pop_back() {
+    if (!tail) return;
+    std::destroy_at(tail->slot(tail->count - 1));
+    --tail->count;
+    --length;
+    if (tail->count == 0) {
+        Node *p = tail;
+        unlink_node(p);
+        destroy_node(p);
+    }
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::pop_front() {
+    if (!head) return;
+    erase(cbegin());
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::insert(const_iterator pos, const T &value) {
+    return emplace(pos, value);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+template <typename... Args>
+unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::emplace(const_iterator pos, Args &&...args) {
+    Node *node = const_cast<Node *>(pos.current_);
+    std::size_t index = pos.index_;
+
+    // end(): append to the tail node, opening a new one when it is full
+    if (node == nullptr) {
+        if (!tail || tail->count == N) {
+            Node *fresh = emplace_in_new_node(tail, std::forward<Args>(args)...);
+            return iterator(fresh, 0, this);
+        }
+        insert_into_node(tail, tail->count, std::forward<Args>(args)...);
+        return iterator(tail, tail->count - 1, this);
+    }
+
+    // Inserting before the first element of a node: appending to the previous node needs no shifting
+    if (index == 0 && node->prev && node->prev->count < N) {
+        Node *prev = node->prev;
+        insert_into_node(prev, prev->count, std::forward<Args>(args)...);
+        return iterator(prev, prev->count - 1, this);
+    }
+
+    if (node->count == N) {
+        if (index == 0) {
+            Node *fresh = emplace_in_new_node(node->prev, std::forward<Args>(args)...);
+            return iterator(fresh, 0, this);
+        }
+        // Build the value before splitting, args may refer to an element that is about to move
+        T value(std::forward<Args>(args)...);
+        Node *upper = split_node(node);
+        if (index > node->count) {
+            index -= node->count;
+            node = upper;
+        }
+        insert_into_node(node, index, std::move(value));
+        return iterator(node, index, this);
+    }
+
+    insert_into_node(node, index, std::forward<Args>(args)...);
+    return iterator(node, index, this);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::erase(const_iterator pos) {
+    if (pos.current_ == nullptr) throw std::out_of_range("Erase out of range");
+
+    Node *node = const_cast<Node *>(pos.current_);
+    std::size_t index = pos.index_;
+
+    // Shift the tail of the node left over the erased slot
+    std::size_t last = node->count - 1;
+    for (std::size_t i = index; i < last; ++i) {
+        *node->slot(i) = std::move(*node->slot(i + 1));
+    }
+    std::destroy_at(node->slot(last));
+    --node->count;
+    --length;
+
+    if (node->count == 0) {
+        Node *next = node->next;
+        unlink_node(node);
+        destroy_node(node);
+        return iterator(next, 0, this);
+    }
+
+    // Keep nodes at least half full by merging with a neighbour that fits
+    if (node->count < min_fill) {
+        if (node->next && node->count + node->next->count <= N) {
+            absorb_node(node, node->next);
+        } else if (node->prev && node->prev->count + node->count <= N) {
+            Node *prev = node->prev;
+            index += prev->count;
+            absorb_node(prev, node);
+            node = prev;
+        }
+    }
+    return make_iterator(node, index);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::erase(const_iterator first, const_iterator last) {
+    if (first.current_ == nullptr) throw std::out_of_range("Erase out of range");
+
+    // Merging may move the element last refers to, so count the span first
+    std::size_t count = 0;
+    for (auto it = first; it != last; ++it) {
+        ++count;
+    }
+
+    iterator it(const_cast<Node *>(first.current_), first.index_, this);
+    while (count--) {
+        it = erase(it);
+    }
+    return it;
+}
+
+// ===========================================================
+// 6. Iterator Interface
+// ===========================================================
+
+template <Listable T, std::size_t N, typename Allocator>
+template <typename Self>
+auto unrolled_list<T, N, Allocator>::begin(this Self &&self) noexcept {
+    constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
+    return UnrolledListIterator<is_const>(self.head, 0, &self);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::const_iterator unrolled_list<T, N, Allocator>::cbegin() const noexcept {
+    return const_iterator(head, 0, this);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+template <typename Self>
+auto unrolled_list<T, N, Allocator>::end(this Self &&self) noexcept {
+    constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
+    return UnrolledListIterator<is_const>(nullptr, 0, &self);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::const_iterator unrolled_list<T, N, Allocator>::cend() const noexcept {
+    return const_iterator(nullptr, 0, this);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+template <typename Self>
+auto unrolled_list<T, N, Allocator>::rbegin(this Self &&self) noexcept {
+    return std::reverse_iterator(self.end());
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::const_reverse_iterator unrolled_list<T, N, Allocator>::crbegin() const noexcept {
+    return const_reverse_iterator(cend());
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+template <typename Self>
+auto unrolled_list<T, N, Allocator>::rend(this Self &&self) noexcept {
+    return std::reverse_iterator(self.begin());
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::const_reverse_iterator unrolled_list<T, N, Allocator>::crend() const noexcept {
+    return const_reverse_iterator(cbegin());
+}
+
+// ===========================================================
+// 7. C++20 Comparison Operations (Spaceship Operator)
+// ===========================================================
+
+template <Listable T, std::size_t N, typename Allocator>
+std::strong_ordering unrolled_list<T, N, Allocator>::operator<=>(const unrolled_list &other) const {
+    auto it1 = begin();
+    auto it2 = other.begin();
+
+    while (it1 != end() && it2 != other.end()) {
+        if constexpr (ThreeWayComparable<T>) {
+            if (auto cmp = *it1 <=> *it2; cmp != 0) return cmp;
+        } else {
+            if (*it1 < *it2) return std::strong_ordering::less;
+            if (*it1 > *it2) return std::strong_ordering::greater;
+        }
+        ++it1;
+        ++it2;
+    }
+    return size() <=> other.size();
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+bool unrolled_list<T, N, Allocator>::operator==(const unrolled_list &other) const {
+    if (length != other.length) return false;
+    return (*this <=> other) == std::strong_ordering::equal;
+}
+
+// ===========================================================
+// Helper Functions
+// ===========================================================
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::Node *unrolled_list<T, N, Allocator>::create_node() {
+    Node *ptr = std::allocator_traits<NodeAlloc>::allocate(allocator_, 1);
+    std::construct_at(ptr);
+    return ptr;
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::destroy_node(Node *ptr) noexcept {
+    if (!ptr) return;
+    std::destroy_n(ptr->slot(0), ptr->count);
+    std::destroy_at(ptr);
+    std::allocator_traits<NodeAlloc>::deallocate(allocator_, ptr, 1);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::Node *unrolled_list<T, N, Allocator>::link_node_after(Node *pos) {
+    Node *node = create_node();
+    Node *next = pos ? pos->next : head;
+    node->prev = pos;
+    node->next = next;
+    if (pos)
+        pos->next = node;
+    else
+        head = node;
+    if (next)
+        next->prev = node;
+    else
+        tail = node;
+    return node;
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::unlink_node(Node *node) noexcept {
+    if (node->prev)
+        node->prev->next = node->next;
+    else
+        head = node->next;
+    if (node->next)
+        node->next->prev = node->prev;
+    else
+        tail = node->prev;
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::Node *unrolled_list<T, N, Allocator>::split_node(Node *node) {
+    Node *upper = link_node_after(node);
+    std::size_t half = node->count / 2;
+    for (std::size_t i = half; i < node->count; ++i) {
+        std::construct_at(upper->slot(upper->count), std::move(*node->slot(i)));
+        ++upper->count;
+    }
+    std::destroy(node->slot(half), node->slot(0) + node->count);
+    node->count = half;
+    return upper;
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+void unrolled_list<T, N, Allocator>::absorb_node(Node *dst, Node *src) {
+    for (std::size_t i = 0; i < src->count; ++i) {
+        std::construct_at(dst->slot(dst->count), std::move(*src->slot(i)));
+        ++dst->count;
+    }
+    unlink_node(src);
+    destroy_node(src);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+template <typename... Args>
+void unrolled_list<T, N, Allocator>::insert_into_node(Node *node, std::size_t index, Args &&...args) {
+    if (index == node->count) {
+        std::construct_at(node->slot(index), std::forward<Args>(args)...);
+        ++node->count;
+        ++length;
+        return;
+    }
+
+    // Build the value first: args may refer to an element of this node
+    T value(std::forward<Args>(args)...);
+    std::construct_at(node->slot(node->count), std::move(*node->slot(node->count - 1)));
+    ++node->count;
+    ++length;
+    for (std::size_t i = node->count - 2; i > index; --i) {
+        *node->slot(i) = std::move(*node->slot(i - 1));
+    }
+    *node->slot(index) = std::move(value);
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+template <typename... Args>
+unrolled_list<T, N, Allocator>::Node *unrolled_list<T, N, Allocator>::emplace_in_new_node(Node *pos, Args &&...args) {
+    Node *fresh = link_node_after(pos);
+    try {
+        insert_into_node(fresh, 0, std::forward<Args>(args)...);
+    } catch (...) {
+        // An empty node must never stay linked: back() and iteration assume count > 0
+        unlink_node(fresh);
+        destroy_node(fresh);
+        throw;
+    }
+    return fresh;
+}
+
+template <Listable T, std::size_t N, typename Allocator>
+unrolled_list<T, N, Allocator>::iterator unrolled_list<T, N, Allocator>::make_iterator(Node *node, std::size_t index) noexcept {
+    if (node && index == node->count) {
+        return iterator(node->next, 0, this);
+    }
+    return iterator(node, index, this);
+}
+
+} // namespace mys
\ No newline at end of file
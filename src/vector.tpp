@@ -0,0 +1,561 @@
+#include "vector.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace mys {
+
+namespace detail {
+
+// ===========================================================
+// 3. Element Access
+// ===========================================================
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename Self>
+auto &&vector_storage<T, Allocator, Derived>::at(this Self &&self, std::size_t index) {
+    if (index >= self.size()) {
+        throw std::out_of_range("vector::at");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(self.begin_[index]);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename Self>
+auto &&vector_storage<T, Allocator, Derived>::operator[](this Self &&self, std::size_t index) {
+    // 与 std::vector 一致，不做边界检查
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(self.begin_[index]);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename Self>
+auto &&vector_storage<T, Allocator, Derived>::front(this Self &&self) {
+    if (self.empty()) {
+        throw std::out_of_range("empty");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(*self.begin_);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename Self>
+auto &&vector_storage<T, Allocator, Derived>::back(this Self &&self) {
+    if (self.empty()) {
+        throw std::out_of_range("empty");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(*(self.end_ - 1));
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename Self>
+auto vector_storage<T, Allocator, Derived>::data(this Self &&self) noexcept {
+    using Ptr = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T *, T *>;
+    return static_cast<Ptr>(self.begin_);
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <Vectorable T, typename Allocator, typename Derived>
+bool vector_storage<T, Allocator, Derived>::empty() const noexcept {
+    return begin_ == end_;
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+std::size_t vector_storage<T, Allocator, Derived>::size() const noexcept {
+    return static_cast<std::size_t>(end_ - begin_);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+std::size_t vector_storage<T, Allocator, Derived>::capacity() const noexcept {
+    return static_cast<std::size_t>(cap_ - begin_);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+std::size_t vector_storage<T, Allocator, Derived>::max_size() const noexcept {
+    return std::min<std::size_t>(AllocTraits::max_size(allocator_), std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T));
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+void vector_storage<T, Allocator, Derived>::reserve(std::size_t new_cap) {
+    if (new_cap > max_size()) throw std::length_error("vector::reserve");
+    if (new_cap > capacity()) {
+        derived().reallocate(new_cap);
+    }
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <Vectorable T, typename Allocator, typename Derived>
+void vector_storage<T, Allocator, Derived>::clear() noexcept {
+    destroy_range(begin_, end_);
+    end_ = begin_;
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+void vector_storage<T, Allocator, Derived>::push_back(const T &value) {
+    emplace_back(value);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+void vector_storage<T, Allocator, Derived>::push_back(T &&value) {
+    emplace_back(std::move(value));
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename... Args>
+T &vector_storage<T, Allocator, Derived>::emplace_back(Args &&...args) {
+    if (end_ != cap_) {
+        AllocTraits::construct(allocator_, end_, std::forward<Args>(args)...);
+        ++end_;
+        return *(end_ - 1);
+    }
+    return *realloc_insert(end_, std::forward<Args>(args)...);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+void vector_storage<T, Allocator, Derived>::pop_back() {
+    if (empty()) return;
+    --end_;
+    AllocTraits::destroy(allocator_, end_);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+vector_storage<T, Allocator, Derived>::iterator vector_storage<T, Allocator, Derived>::insert(const_iterator pos, const T &value) {
+    return emplace(pos, value);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+vector_storage<T, Allocator, Derived>::iterator vector_storage<T, Allocator, Derived>::insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+vector_storage<T, Allocator, Derived>::iterator vector_storage<T, Allocator, Derived>::insert(const_iterator pos, std::size_t count, const T &value) {
+    std::size_t index = static_cast<std::size_t>(to_pointer(pos) - begin_);
+    if (count == 0) return iterator(begin_ + index);
+
+    // value may alias an element that is about to move
+    T copy(value);
+    if (size() + count > capacity()) {
+        reserve(next_capacity(size() + count));
+    }
+
+    // Append the copies, then rotate them into place
+    std::size_t old_size = size();
+    for (std::size_t i = 0; i < count; ++i) {
+        emplace_back(copy);
+    }
+    std::rotate(begin_ + index, begin_ + old_size, end_);
+    return iterator(begin_ + index);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename... Args>
+vector_storage<T, Allocator, Derived>::iterator vector_storage<T, Allocator, Derived>::emplace(const_iterator pos, Args &&...args) {
+    T *p = to_pointer(pos);
+    if (end_ == cap_) {
+        return iterator(realloc_insert(p, std::forward<Args>(args)...));
+    }
+    if (p == end_) {
+        AllocTraits::construct(allocator_, end_, std::forward<Args>(args)...);
+        ++end_;
+        return iterator(p);
+    }
+
+    // Build the value first: args may refer to an element that is about to shift
+    T value(std::forward<Args>(args)...);
+    if constexpr (is_trivially_relocatable_v<T>) {
+        // Open a hole with one memmove, then move the new value into it
+        std::memmove(static_cast<void *>(p + 1), static_cast<const void *>(p), static_cast<std::size_t>(end_ - p) * sizeof(T));
+        try {
+            AllocTraits::construct(allocator_, p, std::move(value));
+        } catch (...) {
+            std::memmove(static_cast<void *>(p), static_cast<const void *>(p + 1), static_cast<std::size_t>(end_ - p) * sizeof(T));
+            throw;
+        }
+        ++end_;
+    } else {
+        AllocTraits::construct(allocator_, end_, std::move(*(end_ - 1)));
+        ++end_;
+        std::move_backward(p, end_ - 2, end_ - 1);
+        *p = std::move(value);
+    }
+    return iterator(p);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+vector_storage<T, Allocator, Derived>::iterator vector_storage<T, Allocator, Derived>::erase(const_iterator pos) {
+    if (to_pointer(pos) == end_) throw std::out_of_range("Erase out of range");
+    return erase(pos, pos + 1);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+vector_storage<T, Allocator, Derived>::iterator vector_storage<T, Allocator, Derived>::erase(const_iterator first, const_iterator last) {
+    T *f = to_pointer(first);
+    T *l = to_pointer(last);
+    if (f == l) return iterator(f);
+
+    if constexpr (is_trivially_relocatable_v<T>) {
+        // Destroy the erased span, then close the gap with one memmove
+        destroy_range(f, l);
+        std::memmove(static_cast<void *>(f), static_cast<const void *>(l), static_cast<std::size_t>(end_ - l) * sizeof(T));
+        end_ -= (l - f);
+    } else {
+        T *new_end = std::move(l, end_, f);
+        destroy_range(new_end, end_);
+        end_ = new_end;
+    }
+    return iterator(f);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+void vector_storage<T, Allocator, Derived>::resize(std::size_t count) {
+    if (count <= size()) {
+        destroy_range(begin_ + count, end_);
+        end_ = begin_ + count;
+        return;
+    }
+    reserve(count);
+    while (size() < count) {
+        AllocTraits::construct(allocator_, end_);
+        ++end_;
+    }
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+void vector_storage<T, Allocator, Derived>::resize(std::size_t count, const T &value) {
+    if (count <= size()) {
+        destroy_range(begin_ + count, end_);
+        end_ = begin_ + count;
+        return;
+    }
+    T copy(value);
+    reserve(count);
+    while (size() < count) {
+        AllocTraits::construct(allocator_, end_, copy);
+        ++end_;
+    }
+}
+
+// ===========================================================
+// 6. Iterator Interface
+// ===========================================================
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename Self>
+auto vector_storage<T, Allocator, Derived>::begin(this Self &&self) noexcept {
+    constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
+    return VectorIterator<is_const>(self.begin_);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+vector_storage<T, Allocator, Derived>::const_iterator vector_storage<T, Allocator, Derived>::cbegin() const noexcept {
+    return const_iterator(begin_);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename Self>
+auto vector_storage<T, Allocator, Derived>::end(this Self &&self) noexcept {
+    constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
+    return VectorIterator<is_const>(self.end_);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+vector_storage<T, Allocator, Derived>::const_iterator vector_storage<T, Allocator, Derived>::cend() const noexcept {
+    return const_iterator(end_);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename Self>
+auto vector_storage<T, Allocator, Derived>::rbegin(this Self &&self) noexcept {
+    return std::reverse_iterator(self.end());
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+vector_storage<T, Allocator, Derived>::const_reverse_iterator vector_storage<T, Allocator, Derived>::crbegin() const noexcept {
+    return const_reverse_iterator(cend());
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename Self>
+auto vector_storage<T, Allocator, Derived>::rend(this Self &&self) noexcept {
+    return std::reverse_iterator(self.begin());
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+vector_storage<T, Allocator, Derived>::const_reverse_iterator vector_storage<T, Allocator, Derived>::crend() const noexcept {
+    return const_reverse_iterator(cbegin());
+}
+
+// ===========================================================
+// 7. C++20 Comparison Operations (Spaceship Operator)
+// ===========================================================
+
+template <Vectorable T, typename Allocator, typename Derived>
+std::strong_ordering vector_storage<T, Allocator, Derived>::operator<=>(const Derived &other) const {
+    std::size_t n = std::min(size(), other.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        auto cmp = std::compare_strong_order_fallback(begin_[i], other.begin_[i]);
+        if (cmp != 0) return cmp;
+    }
+    return size() <=> other.size();
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+bool vector_storage<T, Allocator, Derived>::operator==(const Derived &other) const {
+    if (size() != other.size()) return false;
+    return std::equal(begin_, end_, other.begin_);
+}
+
+// ===========================================================
+// Helper Functions
+// ===========================================================
+
+template <Vectorable T, typename Allocator, typename Derived>
+std::size_t vector_storage<T, Allocator, Derived>::next_capacity(std::size_t min_cap) const noexcept {
+    std::size_t grown = capacity() ? capacity() * 2 : 1;
+    return std::max(grown, min_cap);
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+void vector_storage<T, Allocator, Derived>::relocate(T *first, T *last, T *dest) {
+    if constexpr (is_trivially_relocatable_v<T>) {
+        if (first != last) {
+            std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), static_cast<std::size_t>(last - first) * sizeof(T));
+        }
+    } else {
+        // move_if_noexcept keeps the strong guarantee for types whose move may throw
+        T *cur = dest;
+        try {
+            for (T *it = first; it != last; ++it, ++cur) {
+                AllocTraits::construct(allocator_, cur, std::move_if_noexcept(*it));
+            }
+        } catch (...) {
+            destroy_range(dest, cur);
+            throw;
+        }
+        destroy_range(first, last);
+    }
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+void vector_storage<T, Allocator, Derived>::adopt_buffer(T *new_begin, std::size_t count, std::size_t new_cap) noexcept {
+    derived().release_buffer();
+    begin_ = new_begin;
+    end_ = new_begin + count;
+    cap_ = new_begin + new_cap;
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+template <typename... Args>
+T *vector_storage<T, Allocator, Derived>::realloc_insert(T *pos, Args &&...args) {
+    std::size_t index = static_cast<std::size_t>(pos - begin_);
+    std::size_t count = size();
+    if (count == max_size()) throw std::length_error("vector");
+
+    std::size_t new_cap = next_capacity(count + 1);
+    T *new_begin = AllocTraits::allocate(allocator_, new_cap);
+    T *slot = new_begin + index;
+
+    // Construct the new element first so args may still refer to existing elements
+    try {
+        AllocTraits::construct(allocator_, slot, std::forward<Args>(args)...);
+    } catch (...) {
+        AllocTraits::deallocate(allocator_, new_begin, new_cap);
+        throw;
+    }
+
+    if constexpr (is_trivially_relocatable_v<T>) {
+        relocate(begin_, pos, new_begin);
+        relocate(pos, end_, slot + 1);
+    } else {
+        // Relocate both halves without touching the old buffer until both succeed
+        T *cur = new_begin;
+        try {
+            for (T *it = begin_; it != pos; ++it, ++cur) {
+                AllocTraits::construct(allocator_, cur, std::move_if_noexcept(*it));
+            }
+            cur = slot + 1;
+            for (T *it = pos; it != end_; ++it, ++cur) {
+                AllocTraits::construct(allocator_, cur, std::move_if_noexcept(*it));
+            }
+        } catch (...) {
+            if (cur > slot) {
+                destroy_range(new_begin, slot + 1);
+                destroy_range(slot + 1, cur);
+            } else {
+                destroy_range(new_begin, cur);
+                AllocTraits::destroy(allocator_, slot);
+            }
+            AllocTraits::deallocate(allocator_, new_begin, new_cap);
+            throw;
+        }
+        destroy_range(begin_, end_);
+    }
+
+    adopt_buffer(new_begin, count + 1, new_cap);
+    return slot;
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+void vector_storage<T, Allocator, Derived>::move_elements_from(Derived &other) {
+    clear();
+    reserve(other.size());
+    for (T *it = other.begin_; it != other.end_; ++it) {
+        AllocTraits::construct(allocator_, end_, std::move(*it));
+        ++end_;
+    }
+    other.clear();
+}
+
+template <Vectorable T, typename Allocator, typename Derived>
+void vector_storage<T, Allocator, Derived>::destroy_range(T *first, T *last) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (; first != last; ++first) {
+            AllocTraits::destroy(allocator_, first);
+        }
+    }
+}
+
+} // namespace detail
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <Vectorable T, typename Allocator>
+vector<T, Allocator>::vector(std::size_t count) : vector() {
+    this->resize(count);
+}
+
+template <Vectorable T, typename Allocator>
+vector<T, Allocator>::vector(std::size_t count, const T &value) : vector() {
+    this->resize(count, value);
+}
+
+template <Vectorable T, typename Allocator>
+template <std::input_iterator InputIt>
+vector<T, Allocator>::vector(InputIt first, InputIt last) : vector() {
+    if constexpr (std::forward_iterator<InputIt>) {
+        this->reserve(static_cast<std::size_t>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+        this->emplace_back(*first);
+    }
+}
+
+template <Vectorable T, typename Allocator>
+vector<T, Allocator>::vector(std::initializer_list<T> init) : vector(init.begin(), init.end()) {}
+
+template <Vectorable T, typename Allocator>
+vector<T, Allocator>::vector(const vector &other) : Base(AllocTraits::select_on_container_copy_construction(other.allocator_)) {
+    this->reserve(other.size());
+    for (const auto &item : other) {
+        AllocTraits::construct(allocator_, end_, item);
+        ++end_;
+    }
+}
+
+template <Vectorable T, typename Allocator>
+vector<T, Allocator>::vector(vector &&other) noexcept : Base(std::move(other.allocator_)) {
+    begin_ = std::exchange(other.begin_, nullptr);
+    end_ = std::exchange(other.end_, nullptr);
+    cap_ = std::exchange(other.cap_, nullptr);
+}
+
+template <Vectorable T, typename Allocator>
+vector<T, Allocator> &vector<T, Allocator>::operator=(const vector &other) {
+    if (this != &other) {
+        vector temp(other);
+        swap(temp);
+    }
+    return *this;
+}
+
+template <Vectorable T, typename Allocator>
+vector<T, Allocator> &vector<T, Allocator>::operator=(vector &&other) noexcept(nothrow_move_assign) {
+    if (this == &other) return *this;
+
+    if constexpr (!nothrow_move_assign) {
+        // other's buffer belongs to an allocator we must not free through
+        if (allocator_ != other.allocator_) {
+            this->move_elements_from(other);
+            return *this;
+        }
+    }
+    this->clear();
+    release_buffer();
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+        allocator_ = std::move(other.allocator_);
+    }
+    begin_ = std::exchange(other.begin_, nullptr);
+    end_ = std::exchange(other.end_, nullptr);
+    cap_ = std::exchange(other.cap_, nullptr);
+    return *this;
+}
+
+template <Vectorable T, typename Allocator>
+vector<T, Allocator>::~vector() {
+    this->clear();
+    release_buffer();
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <Vectorable T, typename Allocator>
+void vector<T, Allocator>::shrink_to_fit() {
+    if (this->capacity() > this->size()) {
+        reallocate(this->size());
+    }
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <Vectorable T, typename Allocator>
+void vector<T, Allocator>::swap(vector &other) noexcept {
+    using std::swap;
+    swap(begin_, other.begin_);
+    swap(end_, other.end_);
+    swap(cap_, other.cap_);
+    if constexpr (AllocTraits::propagate_on_container_swap::value) {
+        swap(allocator_, other.allocator_);
+    }
+}
+
+// ===========================================================
+// Helper Functions
+// ===========================================================
+
+template <Vectorable T, typename Allocator>
+void vector<T, Allocator>::reallocate(std::size_t new_cap) {
+    std::size_t count = this->size();
+    T *new_begin = new_cap ? AllocTraits::allocate(allocator_, new_cap) : nullptr;
+    try {
+        this->relocate(begin_, end_, new_begin);
+    } catch (...) {
+        AllocTraits::deallocate(allocator_, new_begin, new_cap);
+        throw;
+    }
+    this->adopt_buffer(new_begin, count, new_cap);
+}
+
+template <Vectorable T, typename Allocator>
+void vector<T, Allocator>::release_buffer() noexcept {
+    if (begin_) {
+        AllocTraits::deallocate(allocator_, begin_, this->capacity());
+    }
+}
+
+} // namespace mys
@@ -0,0 +1,158 @@
+#include "ws_deque.h"
+#include <bit>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <Stealable T, typename Allocator>
+ws_deque<T, Allocator>::ws_deque(std::size_t capacity, const Allocator &alloc) :
+    ring_allocator_(alloc), slot_allocator_(alloc) {
+    ring_.store(allocate_ring(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity)), std::memory_order_relaxed);
+}
+
+template <Stealable T, typename Allocator>
+ws_deque<T, Allocator>::~ws_deque() {
+    // 其他线程都已不再访问，连同被替换下来的旧环一起释放
+    Ring *ring = ring_.load(std::memory_order_relaxed);
+    while (ring) {
+        Ring *retired = ring->retired;
+        deallocate_ring(ring);
+        ring = retired;
+    }
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <Stealable T, typename Allocator>
+std::size_t ws_deque<T, Allocator>::capacity() const noexcept {
+    return ring_.load(std::memory_order_relaxed)->mask + 1;
+}
+
+template <Stealable T, typename Allocator>
+std::size_t ws_deque<T, Allocator>::size_approx() const noexcept {
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::ptrdiff_t top = top_.load(std::memory_order_relaxed);
+    // 两次读取不是同时发生的；所有者弹出时 bottom 可能暂时比 top 小 1
+    return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+}
+
+template <Stealable T, typename Allocator>
+bool ws_deque<T, Allocator>::empty_approx() const noexcept {
+    return size_approx() == 0;
+}
+
+// ===========================================================
+// 5. Owner Operations
+// ===========================================================
+
+template <Stealable T, typename Allocator>
+void ws_deque<T, Allocator>::push(T value) {
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+    Ring *ring = ring_.load(std::memory_order_relaxed);
+    if (bottom - top > static_cast<std::ptrdiff_t>(ring->mask)) {
+        ring = grow(ring, top, bottom);
+    }
+    ring->put(bottom, value);
+    // 先写槽位再以 release 发布新的 bottom，窃取者 acquire 读到 bottom 后一定能读到值
+    bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+template <Stealable T, typename Allocator>
+bool ws_deque<T, Allocator>::try_pop(T &out) noexcept {
+    // 先把 bottom 减一占住最后一个元素，再读 top；中间的 seq_cst 栅栏与 try_steal 中的栅栏配对，
+    // 保证所有者和窃取者至少有一方看到对方的修改
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Ring *ring = ring_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::ptrdiff_t top = top_.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+        // 已经空了，恢复 bottom
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+    T value = ring->get(bottom);
+    if (top == bottom) {
+        // 只剩一个元素时可能与窃取者竞争，用 CAS 在 top 上决出归属
+        bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        if (!won) return false;
+    }
+    out = value;
+    return true;
+}
+
+// ===========================================================
+// 6. Thief Operations
+// ===========================================================
+
+template <Stealable T, typename Allocator>
+bool ws_deque<T, Allocator>::try_steal(T &out) noexcept {
+    std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::ptrdiff_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) return false;
+
+    // 先读值再用 CAS 认领；CAS 失败说明值已被别人取走，读到的副本直接丢弃
+    Ring *ring = ring_.load(std::memory_order_acquire);
+    T value = ring->get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+// ===========================================================
+// 8. Other Operations
+// ===========================================================
+
+template <Stealable T, typename Allocator>
+ws_deque<T, Allocator>::Ring *ws_deque<T, Allocator>::allocate_ring(std::size_t capacity) {
+    Ring *ring = std::allocator_traits<RingAlloc>::allocate(ring_allocator_, 1);
+    std::atomic<T> *slots;
+    try {
+        slots = std::allocator_traits<SlotAlloc>::allocate(slot_allocator_, capacity);
+    } catch (...) {
+        std::allocator_traits<RingAlloc>::deallocate(ring_allocator_, ring, 1);
+        throw;
+    }
+    for (std::size_t i = 0; i < capacity; ++i) {
+        std::allocator_traits<SlotAlloc>::construct(slot_allocator_, slots + i);
+    }
+    std::allocator_traits<RingAlloc>::construct(ring_allocator_, ring, Ring{capacity - 1, slots, nullptr});
+    return ring;
+}
+
+template <Stealable T, typename Allocator>
+void ws_deque<T, Allocator>::deallocate_ring(Ring *ring) noexcept {
+    std::size_t capacity = ring->mask + 1;
+    for (std::size_t i = 0; i < capacity; ++i) {
+        std::allocator_traits<SlotAlloc>::destroy(slot_allocator_, ring->slots + i);
+    }
+    std::allocator_traits<SlotAlloc>::deallocate(slot_allocator_, ring->slots, capacity);
+    std::allocator_traits<RingAlloc>::destroy(ring_allocator_, ring);
+    std::allocator_traits<RingAlloc>::deallocate(ring_allocator_, ring, 1);
+}
+
+template <Stealable T, typename Allocator>
+ws_deque<T, Allocator>::Ring *ws_deque<T, Allocator>::grow(Ring *ring, std::ptrdiff_t top, std::ptrdiff_t bottom) {
+    // 下标是单调增长的绝对位置，新环中元素仍在各自的 i & mask 处，top/bottom 不需要调整
+    Ring *bigger = allocate_ring((ring->mask + 1) * 2);
+    for (std::ptrdiff_t i = top; i < bottom; ++i) {
+        bigger->put(i, ring->get(i));
+    }
+    // 旧环可能还有窃取者在读，挂在新环上等析构时再释放
+    bigger->retired = ring;
+    ring_.store(bigger, std::memory_order_release);
+    return bigger;
+}
+
+} // namespace mys
\ No newline at end of file
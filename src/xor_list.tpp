@@ -0,0 +1,383 @@
+#include "xor_list.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace mys {
+
+// ===========================================================
+// 2. Construction and Destruction (Lifecycle Management)
+// ===========================================================
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::xor_list(const Allocator &alloc) noexcept : allocator_(alloc) {}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::xor_list(std::initializer_list<T> init) : xor_list() {
+    for (const T &value : init) {
+        push_back(value);
+    }
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::xor_list(const xor_list &other) : xor_list() {
+    for (const T &value : other) {
+        push_back(value);
+    }
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::xor_list(xor_list &&other) noexcept :
+    allocator_(std::move(other.allocator_)), head(other.head), tail(other.tail), length(other.length) {
+    // 链接字只记录节点之间的地址，整条链可以原样转移
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.length = 0;
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator> &xor_list<T, Allocator>::operator=(const xor_list &other) {
+    if (this != &other) {
+        // 先完整拷贝再交换，拷贝失败时原内容不变
+        xor_list copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator> &xor_list<T, Allocator>::operator=(xor_list &&other) noexcept(nothrow_move_assign) {
+    if (this != &other) {
+        if constexpr (!nothrow_move_assign) {
+            // other 的节点只能由 other 的分配器释放：改为把元素逐个移动到自己分配的节点中
+            if (allocator_ != other.allocator_) {
+                clear();
+                for (T &value : other) {
+                    push_back(std::move(value));
+                }
+                other.clear();
+                return *this;
+            }
+        }
+        clear();
+        // 接管的节点由 other 的分配器分配，必须连同分配器一起转移
+        if constexpr (std::allocator_traits<NodeAlloc>::propagate_on_container_move_assignment::value) {
+            allocator_ = std::move(other.allocator_);
+        }
+        head = other.head;
+        tail = other.tail;
+        length = other.length;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.length = 0;
+    }
+    return *this;
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::~xor_list() {
+    clear();
+}
+
+// ===========================================================
+// 3. Element Access
+// ===========================================================
+
+template <XorListable T, typename Allocator>
+template <typename Self>
+auto &&xor_list<T, Allocator>::front(this Self &&self) {
+    if (self.empty()) {
+        throw std::out_of_range("empty");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(self.head->val);
+}
+
+template <XorListable T, typename Allocator>
+template <typename Self>
+auto &&xor_list<T, Allocator>::back(this Self &&self) {
+    if (self.empty()) {
+        throw std::out_of_range("empty");
+    }
+    using ReturnType = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const T &, T &>;
+    return static_cast<ReturnType>(self.tail->val);
+}
+
+// ===========================================================
+// 4. Capacity Query
+// ===========================================================
+
+template <XorListable T, typename Allocator>
+bool xor_list<T, Allocator>::empty() const noexcept {
+    return length == 0;
+}
+
+template <XorListable T, typename Allocator>
+std::size_t xor_list<T, Allocator>::size() const noexcept {
+    return length;
+}
+
+// ===========================================================
+// 5. Modifiers
+// ===========================================================
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::clear() noexcept {
+    // 节点无需析构时，直接让池分配器整体归还 slab，不再逐个遍历
+    if constexpr (std::is_trivially_destructible_v<Node> && BulkReleasable<NodeAlloc>) {
+        if (allocator_.release()) {
+            head = nullptr;
+            tail = nullptr;
+            length = 0;
+            return;
+        }
+    }
+    // 解码下一个节点只需要前驱的地址值，所以先算出 next 再释放当前节点
+    std::uintptr_t prev = 0;
+    Node *cur = head;
+    while (cur) {
+        Node *next = reinterpret_cast<Node *>(cur->link ^ prev);
+        prev = address(cur);
+        destroy_node(cur);
+        cur = next;
+    }
+    head = nullptr;
+    tail = nullptr;
+    length = 0;
+}
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::swap(xor_list &other) noexcept {
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(length, other.length);
+    std::swap(allocator_, other.allocator_);
+}
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::push_back(const T &value) {
+    emplace_back(value);
+}
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::push_back(T &&value) {
+    emplace_back(std::move(value));
+}
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::push_front(const T &value) {
+    emplace_front(value);
+}
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::push_front(T &&value) {
+    emplace_front(std::move(value));
+}
+
+template <XorListable T, typename Allocator>
+template <typename... Args>
+void xor_list<T, Allocator>::emplace_back(Args &&...args) {
+    link_between(tail, nullptr, create_node(std::forward<Args>(args)...));
+}
+
+template <XorListable T, typename Allocator>
+template <typename... Args>
+void xor_list<T, Allocator>::emplace_front(Args &&...args) {
+    link_between(nullptr, head, create_node(std::forward<Args>(args)...));
+}
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::pop_back() {
+    if (!tail) return;
+    Node *node = tail;
+    unlink_between(neighbour(node, nullptr), node, nullptr);
+    destroy_node(node);
+}
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::pop_front() {
+    if (!head) return;
+    Node *node = head;
+    unlink_between(nullptr, node, neighbour(node, nullptr));
+    destroy_node(node);
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::iterator xor_list<T, Allocator>::insert(const_iterator pos, const T &value) {
+    return emplace(pos, value);
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::iterator xor_list<T, Allocator>::insert(const_iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+}
+
+template <XorListable T, typename Allocator>
+template <typename... Args>
+xor_list<T, Allocator>::iterator xor_list<T, Allocator>::emplace(const_iterator pos, Args &&...args) {
+    Node *prev = const_cast<Node *>(pos.prev_);
+    Node *node = create_node(std::forward<Args>(args)...);
+    link_between(prev, const_cast<Node *>(pos.current_), node);
+    return iterator(prev, node);
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::iterator xor_list<T, Allocator>::erase(const_iterator pos) {
+    if (pos.current_ == nullptr) throw std::out_of_range("Erase out of range");
+
+    Node *prev = const_cast<Node *>(pos.prev_);
+    Node *node = const_cast<Node *>(pos.current_);
+    Node *next = neighbour(node, prev);
+    unlink_between(prev, node, next);
+    destroy_node(node);
+    return iterator(prev, next);
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::iterator xor_list<T, Allocator>::erase(const_iterator first, const_iterator last) {
+    // last 的前驱会随删除而改变，只用它的 current_ 判断终点；返回的迭代器带着正确的前驱
+    iterator it(const_cast<Node *>(first.prev_), const_cast<Node *>(first.current_));
+    while (it.current_ != last.current_) {
+        it = erase(it);
+    }
+    return it;
+}
+
+// ===========================================================
+// 6. Iterator Interface
+// ===========================================================
+
+template <XorListable T, typename Allocator>
+template <typename Self>
+auto xor_list<T, Allocator>::begin(this Self &&self) noexcept {
+    constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
+    return XorIterator<is_const>(nullptr, self.head);
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::const_iterator xor_list<T, Allocator>::cbegin() const noexcept {
+    return const_iterator(nullptr, head);
+}
+
+template <XorListable T, typename Allocator>
+template <typename Self>
+auto xor_list<T, Allocator>::end(this Self &&self) noexcept {
+    // 从 end() 后退时以 tail 为当前节点、以空指针为后继解码
+    constexpr bool is_const = std::is_const_v<std::remove_reference_t<Self>>;
+    return XorIterator<is_const>(self.tail, nullptr);
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::const_iterator xor_list<T, Allocator>::cend() const noexcept {
+    return const_iterator(tail, nullptr);
+}
+
+template <XorListable T, typename Allocator>
+template <typename Self>
+auto xor_list<T, Allocator>::rbegin(this Self &&self) noexcept {
+    return std::reverse_iterator(self.end());
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::const_reverse_iterator xor_list<T, Allocator>::crbegin() const noexcept {
+    return const_reverse_iterator(end());
+}
+
+template <XorListable T, typename Allocator>
+template <typename Self>
+auto xor_list<T, Allocator>::rend(this Self &&self) noexcept {
+    return std::reverse_iterator(self.begin());
+}
+
+template <XorListable T, typename Allocator>
+xor_list<T, Allocator>::const_reverse_iterator xor_list<T, Allocator>::crend() const noexcept {
+    return const_reverse_iterator(begin());
+}
+
+// ===========================================================
+// 7. C++20 Comparison Operations (Spaceship Operator)
+// ===========================================================
+
+template <XorListable T, typename Allocator>
+std::strong_ordering xor_list<T, Allocator>::operator<=>(const xor_list &other) const {
+    auto it1 = begin();
+    auto it2 = other.begin();
+    auto end1 = end();
+    auto end2 = other.end();
+
+    while (it1 != end1 && it2 != end2) {
+        auto cmp = std::compare_strong_order_fallback(*it1, *it2);
+        if (cmp != 0) return cmp;
+        ++it1;
+        ++it2;
+    }
+    return size() <=> other.size();
+}
+
+template <XorListable T, typename Allocator>
+bool xor_list<T, Allocator>::operator==(const xor_list &other) const {
+    return size() == other.size() && std::equal(begin(), end(), other.begin());
+}
+
+// ===========================================================
+// 8. Other Operations
+// ===========================================================
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::reverse() noexcept {
+    // prev ^ next 与方向无关，交换两端即完成反转
+    std::swap(head, tail);
+}
+
+template <XorListable T, typename Allocator>
+template <typename... Args>
+xor_list<T, Allocator>::Node *xor_list<T, Allocator>::create_node(Args &&...args) {
+    Node *ptr = std::allocator_traits<NodeAlloc>::allocate(allocator_, 1);
+    try {
+        std::construct_at(ptr, std::forward<Args>(args)...);
+    } catch (...) {
+        std::allocator_traits<NodeAlloc>::deallocate(allocator_, ptr, 1);
+        throw;
+    }
+    return ptr;
+}
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::destroy_node(Node *ptr) {
+    std::allocator_traits<NodeAlloc>::destroy(allocator_, ptr);
+    std::allocator_traits<NodeAlloc>::deallocate(allocator_, ptr, 1);
+}
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::link_between(Node *prev, Node *next, Node *node) noexcept {
+    // 在 prev 的链接字里把 next 换成 node，在 next 的链接字里把 prev 换成 node
+    node->link = address(prev) ^ address(next);
+    if (prev) {
+        prev->link ^= address(next) ^ address(node);
+    } else {
+        head = node;
+    }
+    if (next) {
+        next->link ^= address(prev) ^ address(node);
+    } else {
+        tail = node;
+    }
+    length++;
+}
+
+template <XorListable T, typename Allocator>
+void xor_list<T, Allocator>::unlink_between(Node *prev, Node *node, Node *next) noexcept {
+    if (prev) {
+        prev->link ^= address(node) ^ address(next);
+    } else {
+        head = next;
+    }
+    if (next) {
+        next->link ^= address(node) ^ address(prev);
+    } else {
+        tail = prev;
+    }
+    length--;
+}
+
+} // namespace mys
\ No newline at end of file
@@ -0,0 +1,7 @@
+# 比较两份目标文件的大小：cmake -DINSTRUMENTED=<obj> -DSTRIPPED=<obj> -P compare_code_size.cmake
+file(SIZE "${INSTRUMENTED}" instrumented_size)
+file(SIZE "${STRIPPED}" stripped_size)
+message(STATUS "default instantiation: ${instrumented_size} bytes, hooks stripped: ${stripped_size} bytes")
+if(NOT instrumented_size EQUAL stripped_size)
+    message(FATAL_ERROR "no_instrumentation changes the generated code")
+endif()
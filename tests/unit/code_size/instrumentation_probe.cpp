@@ -0,0 +1,29 @@
+// 插桩零开销探针：tests/unit/CMakeLists.txt 把本文件编译两次，
+// 一次正常编译，一次定义 MYS_STRIP_INSTRUMENTATION 去掉全部钩子调用。
+// 默认实例化 (no_instrumentation) 下两份目标文件的大小必须相同。
+#include "forward_list.h"
+#include "list.h"
+#include <string>
+
+template class mys::list<int>;
+template class mys::list<std::string>;
+template class mys::forward_list<int>;
+template class mys::forward_list<std::string>;
+
+// 成员模板不会被显式实例化，这里逐个调用
+void probe_list(mys::list<int> &l, mys::list<int> &other) {
+    l.emplace_back(1);
+    l.emplace_front(2);
+    l.emplace(l.begin(), 3);
+    l.sort();
+    l.merge(other);
+}
+
+void probe_forward_list(mys::forward_list<int> &l, mys::forward_list<int> &other) {
+    l.emplace_front(1);
+    l.emplace_after(l.before_begin(), 2);
+    l.remove_if([](int v) { return v < 0; });
+    l.unique();
+    l.sort();
+    l.merge(other);
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "concurrent_forward_list.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+void test_single_thread() {
+    std::cout << "\n=== Testing single-threaded set operations ===" << std::endl;
+
+    mys::concurrent_forward_list<int> list;
+    assert(list.empty_approx());
+    assert(!list.contains(1));
+    assert(!list.erase(1));
+
+    for (int v : {5, 1, 9, 3, 7}) {
+        assert(list.insert(v));
+    }
+    // 重复插入不改变集合
+    assert(!list.insert(3));
+    assert(list.size_approx() == 5);
+    for (int v = 0; v <= 10; ++v) {
+        assert(list.contains(v) == (v % 2 == 1));
+    }
+    std::cout << "Insert keeps one copy of each value: OK" << std::endl;
+
+    assert(list.erase(1));
+    assert(list.erase(9));
+    assert(!list.erase(9));
+    assert(list.size_approx() == 3);
+    assert(!list.contains(1) && list.contains(3) && !list.contains(9));
+    std::cout << "Erase at both ends: OK" << std::endl;
+
+    // 大量删除会跨过多个纪元，让回收真正发生
+    for (int round = 0; round < 10; ++round) {
+        for (int v = 100; v < 400; ++v) {
+            assert(list.insert(v));
+        }
+        for (int v = 100; v < 400; ++v) {
+            assert(list.erase(v));
+        }
+    }
+    assert(list.size_approx() == 3);
+    std::cout << "Repeated insert/erase with reclamation: OK" << std::endl;
+}
+
+void test_custom_compare() {
+    std::cout << "\n=== Testing custom comparator and non-trivial values ===" << std::endl;
+
+    mys::concurrent_forward_list<std::string, std::greater<std::string>> list;
+    assert(list.emplace(3, 'b'));
+    assert(list.insert(std::string("a")));
+    assert(list.insert("c"));
+    assert(!list.emplace("bbb"));
+    assert(list.contains("bbb"));
+    assert(list.erase("a"));
+    assert(list.size_approx() == 2);
+
+    // 构造抛出时节点被释放，集合不变
+    struct Throwing {
+        int key;
+        explicit Throwing(int k) : key(k) {
+            if (k < 0) throw std::runtime_error("negative");
+        }
+        bool operator<(const Throwing &other) const { return key < other.key; }
+    };
+    mys::concurrent_forward_list<Throwing> throwing;
+    assert(throwing.emplace(1));
+    bool threw = false;
+    try {
+        throwing.emplace(-1);
+    } catch (const std::runtime_error &) {
+        threw = true;
+    }
+    assert(threw);
+    assert(throwing.size_approx() == 1);
+    std::cout << "Comparator, emplace and throwing construction: OK" << std::endl;
+}
+
+void test_concurrent() {
+    std::cout << "\n=== Testing concurrent insert/erase/contains ===" << std::endl;
+
+    constexpr int threads = 4;
+    constexpr int per_thread = 2000;
+
+    // 每个线程负责 t, t + threads, ... 这些键：插入、删除一半、再查找，其余线程同时在做同样的事
+    mys::concurrent_forward_list<int> list;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&list, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                assert(list.insert(i * threads + t));
+            }
+            for (int i = 0; i < per_thread; i += 2) {
+                assert(list.erase(i * threads + t));
+            }
+            for (int i = 0; i < per_thread; ++i) {
+                assert(list.contains(i * threads + t) == (i % 2 == 1));
+            }
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+    assert(list.size_approx() == static_cast<std::size_t>(threads * per_thread / 2));
+    std::cout << "Disjoint keys from " << threads << " threads: OK" << std::endl;
+
+    // 所有线程争抢同一小组键：每次成功插入对应恰好一次成功删除
+    mys::concurrent_forward_list<int> contended;
+    std::atomic<long long> balance{0};
+    workers.clear();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&contended, &balance, t] {
+            for (int i = 0; i < 20000; ++i) {
+                int key = (i * 7 + t) % 16;
+                if ((i + t) % 2 == 0) {
+                    if (contended.insert(key)) balance.fetch_add(1);
+                } else {
+                    if (contended.erase(key)) balance.fetch_sub(1);
+                }
+                (void)contended.contains(key);
+            }
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+    assert(static_cast<long long>(contended.size_approx()) == balance.load());
+    std::cout << "Contended keys keep insert/erase balanced: OK" << std::endl;
+}
+
+void test_reclamation() {
+    std::cout << "\n=== Testing that every node is destroyed ===" << std::endl;
+
+    // 统计存活的值：回收和析构合起来必须恰好销毁每个构造出来的值
+    static std::atomic<int> live{0};
+    struct Counted {
+        int key;
+        explicit Counted(int k) : key(k) { live.fetch_add(1); }
+        Counted(const Counted &other) : key(other.key) { live.fetch_add(1); }
+        Counted(Counted &&other) noexcept : key(other.key) { live.fetch_add(1); }
+        Counted &operator=(const Counted &) = default;
+        Counted &operator=(Counted &&) noexcept = default;
+        ~Counted() { live.fetch_sub(1); }
+        bool operator<(const Counted &other) const { return key < other.key; }
+    };
+
+    {
+        mys::concurrent_forward_list<Counted> list;
+        std::vector<std::thread> workers;
+        for (int t = 0; t < 3; ++t) {
+            workers.emplace_back([&list, t] {
+                for (int i = 0; i < 5000; ++i) {
+                    list.emplace((i + t) % 64);
+                    list.erase(Counted((i * 3 + t) % 64));
+                }
+            });
+        }
+        for (auto &w : workers) {
+            w.join();
+        }
+    }
+    assert(live.load() == 0);
+    std::cout << "No node leaked or destroyed twice: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::concurrent_forward_list implementation..." << std::endl;
+
+    try {
+        test_single_thread();
+        test_custom_compare();
+        test_concurrent();
+        test_reclamation();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+#include "deque.h"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <memory>
+#include <algorithm>
+
+// 计数分配器：统计当前未归还的内存块数
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    static inline int outstanding = 0;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U> &) noexcept {}
+
+    T *allocate(std::size_t n) {
+        ++outstanding;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept {
+        --outstanding;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(const CountingAllocator &, const CountingAllocator &) { return true; }
+};
+
+static_assert(std::random_access_iterator<mys::deque<int>::iterator>);
+static_assert(std::random_access_iterator<mys::deque<int>::const_iterator>);
+
+void test_push_pop() {
+    std::cout << "\n=== Testing push/pop at both ends ===" << std::endl;
+
+    mys::deque<int> d;
+    assert(d.empty());
+    assert(d.begin() == d.end());
+
+    const int n = 10000;
+    for (int i = 0; i < n; ++i) {
+        d.push_back(i);
+        d.push_front(-i - 1);
+    }
+    assert(d.size() == 2 * n);
+    assert(d.front() == -n);
+    assert(d.back() == n - 1);
+    for (int i = 0; i < 2 * n; ++i) {
+        assert(d[i] == i - n);
+    }
+    std::cout << "push_front/push_back and operator[]: OK" << std::endl;
+
+    // 扩容只移动块指针，已有元素的地址保持不变
+    int *addr = &d[n];
+    for (int i = 0; i < n; ++i) {
+        d.push_front(0);
+        d.push_back(0);
+    }
+    assert(addr == &d[2 * n]);
+    std::cout << "Elements never relocate: OK" << std::endl;
+
+    while (!d.empty()) {
+        d.pop_front();
+        if (!d.empty()) d.pop_back();
+    }
+    d.push_back(1);
+    assert(d.front() == 1 && d.back() == 1);
+
+    bool thrown = false;
+    try {
+        (void)d.at(1);
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "pop until empty and reuse: OK" << std::endl;
+}
+
+void test_iterators() {
+    std::cout << "\n=== Testing iterators ===" << std::endl;
+
+    mys::deque<int> d;
+    for (int i = 0; i < 3000; ++i) {
+        d.push_back(i);
+    }
+
+    auto it = d.begin();
+    it += 2500;
+    assert(*it == 2500);
+    it -= 2000;
+    assert(*it == 500);
+    assert(it[1000] == 1500);
+    assert(d.end() - d.begin() == 3000);
+    assert(d.begin() < d.end());
+
+    std::reverse(d.begin(), d.end());
+    assert(d.front() == 2999);
+    std::sort(d.begin(), d.end());
+    assert(std::is_sorted(d.cbegin(), d.cend()));
+
+    int expected = 2999;
+    for (auto rit = d.rbegin(); rit != d.rend(); ++rit) {
+        assert(*rit == expected--);
+    }
+    std::cout << "Random access iteration and std algorithms: OK" << std::endl;
+}
+
+void test_insert_erase() {
+    std::cout << "\n=== Testing insert/erase ===" << std::endl;
+
+    mys::deque<std::string> d{"a", "b", "d", "e"};
+    auto it = d.insert(d.begin() + 2, "c");
+    assert(*it == "c");
+    d.insert(d.begin() + 1, d[4]);
+    assert((d == mys::deque<std::string>{"a", "e", "b", "c", "d", "e"}));
+
+    it = d.erase(d.begin() + 1);
+    assert(*it == "b");
+    it = d.erase(d.begin() + 3, d.end());
+    assert(it == d.end());
+    assert((d == mys::deque<std::string>{"a", "b", "c"}));
+
+    mys::deque<int> big;
+    for (int i = 0; i < 5000; ++i) {
+        big.push_back(i);
+    }
+    big.erase(big.begin() + 10, big.begin() + 4000);
+    assert(big.size() == 1010);
+    assert(big[9] == 9 && big[10] == 4000);
+    big.erase(big.begin() + 1000, big.end());
+    assert(big.back() == 4989);
+    std::cout << "insert/erase: OK" << std::endl;
+}
+
+void test_steady_state_memory() {
+    std::cout << "\n=== Testing sliding window memory ===" << std::endl;
+
+    {
+        mys::deque<int, CountingAllocator<int>> window;
+        for (int i = 0; i < 10000; ++i) {
+            window.push_back(i);
+        }
+        for (int i = 0; i < 1000; ++i) {
+            window.push_back(i);
+            window.pop_front();
+        }
+        int baseline = CountingAllocator<int>::outstanding;
+
+        // 稳态下滑动窗口不再增长
+        for (int i = 0; i < 1000000; ++i) {
+            window.push_back(i);
+            window.pop_front();
+        }
+        assert(CountingAllocator<int>::outstanding == baseline);
+        assert(window.size() == 10000);
+        assert(window.back() == 999999);
+    }
+    assert(CountingAllocator<int>::outstanding == 0);
+    std::cout << "Memory stays flat: OK" << std::endl;
+}
+
+void test_copy_move_compare() {
+    std::cout << "\n=== Testing copy/move/compare ===" << std::endl;
+
+    mys::deque<int> a{1, 2, 3};
+    mys::deque<int> b(a);
+    assert(a == b);
+    b.push_back(4);
+    assert(a < b);
+
+    mys::deque<int> c(std::move(b));
+    assert(b.empty() && c.size() == 4);
+    b = c;
+    assert(b == c);
+    c = std::move(a);
+    assert(c.size() == 3 && a.empty());
+    swap(b, c);
+    assert(b.size() == 3 && c.size() == 4);
+
+    mys::deque<std::unique_ptr<int>> owners;
+    owners.push_back(std::make_unique<int>(1));
+    owners.emplace_front(std::make_unique<int>(0));
+    assert(*owners.front() == 0);
+    std::cout << "Copy, move and <=>: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::deque implementation..." << std::endl;
+
+    try {
+        test_push_pop();
+        test_iterators();
+        test_insert_erase();
+        test_steady_state_memory();
+        test_copy_move_compare();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
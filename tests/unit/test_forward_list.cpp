@@ -3,6 +3,14 @@
 #include <cassert>
 #include <string>
 #include <algorithm>
+#include <deque>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 // 测试辅助函数
 template <typename T>
@@ -73,6 +81,72 @@ void test_constructors_and_assignment() {
     std::cout << "Move assignment: OK" << std::endl;
 }
 
+// 每个实例带编号、移动赋值不传播的分配器；live 按编号统计未释放的节点，用错分配器释放时计数会失衡
+template <typename T>
+struct TaggedAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    static inline int next_id = 0;
+    static inline int live[16] = {};
+    int id;
+
+    TaggedAllocator() : id(next_id++ % 16) {}
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U> &other) noexcept : id(other.id) {}
+
+    T *allocate(std::size_t n) {
+        ++live[id];
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept {
+        --live[id];
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(const TaggedAllocator &lhs, const TaggedAllocator &rhs) { return lhs.id == rhs.id; }
+};
+
+template <typename List>
+void check_move_assignment_allocators() {
+    {
+        List a{1, 2, 3};
+        List b{9};
+        const int *first = &a.front();
+        b = std::move(a);
+        assert(b.size() == 3 && b.front() == 1);
+        assert(&b.front() != first);
+        assert(a.empty() && a.begin() == a.end());
+
+        // 分配器相等时直接接管节点，移动构造连同分配器一起接管
+        List c(b.get_allocator());
+        first = &b.front();
+        c = std::move(b);
+        assert(&c.front() == first && b.empty());
+        List d(std::move(c));
+        assert(&d.front() == first && c.empty());
+        d.push_front(0);
+        assert(d.size() == 4);
+    }
+    for (int count : TaggedAllocator<int>::live) {
+        assert(count == 0);
+    }
+}
+
+// 分配器不相等且不传播时的移动赋值：只能逐个移动元素
+void test_move_assignment_allocators() {
+    std::cout << "\n=== Testing move assignment with unequal allocators ===" << std::endl;
+    check_move_assignment_allocators<mys::forward_list<int, TaggedAllocator<int>>>();
+    using TailList = mys::forward_list<int, TaggedAllocator<int>, mys::no_instrumentation, true>;
+    check_move_assignment_allocators<TailList>();
+    TailList t{1, 2};
+    TailList u;
+    u = std::move(t);
+    assert(*u.before_end() == 2);
+    u.push_back(3);
+    assert(*u.before_end() == 3 && u.size() == 3);
+    std::cout << "Element-wise move: OK" << std::endl;
+}
+
 void test_element_access() {
     std::cout << "\n=== Testing Element Access ===" << std::endl;
 
@@ -304,6 +378,313 @@ void test_operations() {
     std::cout << "reverse: OK" << std::endl;
 }
 
+void test_sort_and_merge() {
+    std::cout << "\n=== Testing Sort and Merge ===" << std::endl;
+
+    mys::forward_list<int> list = {5, 3, 9, 1, 7, 2, 8, 6, 4, 0};
+    list.sort();
+    int expected = 0;
+    for (const auto &item : list) {
+        assert(item == expected++);
+    }
+    assert(list.size() == 10);
+    std::cout << "sort: OK" << std::endl;
+
+    list.sort([](int a, int b) { return a > b; });
+    assert(list.front() == 9);
+    std::cout << "sort with comparator: OK" << std::endl;
+
+    // 稳定性：相等的键保持原有相对顺序
+    mys::forward_list<std::pair<int, int>> pairs = {{2, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 4}, {2, 5}};
+    pairs.sort([](const auto &a, const auto &b) { return a.first < b.first; });
+    int last_key = -1, last_seq = -1;
+    for (const auto &[key, seq] : pairs) {
+        if (key == last_key) assert(seq > last_seq);
+        last_key = key;
+        last_seq = seq;
+    }
+    std::cout << "sort stability: OK" << std::endl;
+
+    mys::forward_list<int> a = {1, 3, 5, 7};
+    mys::forward_list<int> b = {2, 4, 6, 8, 10};
+    a.merge(b);
+    assert(a.size() == 9);
+    assert(b.empty());
+    int merged[] = {1, 2, 3, 4, 5, 6, 7, 8, 10};
+    int i = 0;
+    for (const auto &item : a) {
+        assert(item == merged[i++]);
+    }
+    std::cout << "merge: OK" << std::endl;
+}
+
+void test_range_operations() {
+    std::cout << "\n=== Testing Range Operations ===" << std::endl;
+
+    std::vector<int> src = {3, 4, 5};
+    mys::forward_list<int> list;
+    list.append_range(src);
+    list.prepend_range(std::vector<int>{1, 2});
+    list.append_range(std::views::iota(6, 8));
+    int expected[] = {1, 2, 3, 4, 5, 6, 7};
+    int i = 0;
+    for (const auto &item : list) {
+        assert(item == expected[i++]);
+    }
+    assert(list.size() == 7);
+    std::cout << "append_range / prepend_range: OK" << std::endl;
+
+    // insert_range_after 返回最后一个插入的元素，空范围返回 pos
+    auto it = list.insert_range_after(list.begin(), std::vector<int>{10, 11});
+    assert(*it == 11);
+    assert(*std::next(it) == 2);
+    assert(list.insert_after(it, src.begin(), src.begin()) == it);
+    it = list.insert_after(list.before_begin(), {-1, 0});
+    assert(*it == 0 && list.front() == -1);
+    assert(list.size() == 11);
+    std::cout << "insert_range_after: OK" << std::endl;
+
+    list.assign_range(std::views::iota(0, 3));
+    assert(list.size() == 3 && list.front() == 0);
+    list.assign(src.begin(), src.end());
+    assert(list.size() == 3 && list.front() == 3);
+    list.assign({42});
+    assert(list.size() == 1 && list.front() == 42);
+    std::cout << "assign / assign_range: OK" << std::endl;
+
+    // 区间删除 (first, last) 一次摘下
+    mys::forward_list<int> e = {0, 1, 2, 3, 4, 5};
+    auto after = e.erase_after(e.begin(), std::next(e.begin(), 4));
+    assert(*after == 4 && e.size() == 3);
+    assert(e.erase_after(e.before_begin(), e.end()) == e.end());
+    assert(e.empty());
+    std::cout << "erase_after range: OK" << std::endl;
+
+    // 强异常保证：构造失败时原内容不变
+    struct Fragile {
+        int value;
+        Fragile(int v) : value(v) {}
+        Fragile(const Fragile &other) : value(other.value) {
+            if (value < 0) throw std::runtime_error("copy failed");
+        }
+        Fragile(Fragile &&) noexcept = default;
+        Fragile &operator=(const Fragile &) = default;
+        Fragile &operator=(Fragile &&) noexcept = default;
+    };
+    mys::forward_list<Fragile> f;
+    f.emplace_front(2);
+    f.emplace_front(1);
+    std::vector<Fragile> bad;
+    bad.reserve(3);
+    bad.emplace_back(7);
+    bad.emplace_back(8);
+    bad.emplace_back(-1);
+    bool thrown = false;
+    try {
+        f.assign_range(bad);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(f.size() == 2 && f.front().value == 1);
+    std::cout << "strong exception guarantee: OK" << std::endl;
+}
+
+// 检查 before_end() 指向最后一个元素，且内容与参照模型一致
+template <typename List>
+void check_tail(const List &list, const std::deque<int> &model) {
+    assert(list.size() == model.size());
+    assert(std::equal(list.begin(), list.end(), model.begin(), model.end()));
+    if (model.empty()) {
+        assert(list.before_end() == list.before_begin());
+    } else {
+        assert(*list.before_end() == model.back());
+        assert(std::next(list.before_end()) == list.end());
+    }
+}
+
+// 比较器中途抛出时所有节点仍留在链表中，跟踪尾部时 before_end() 依然正确
+template <typename List>
+void check_throwing_comparator() {
+    std::deque<int> values(50);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(7));
+    std::vector<int> sorted(values.begin(), values.end());
+    std::sort(sorted.begin(), sorted.end());
+
+    auto check = [&](const List &list) {
+        std::deque<int> model(list.begin(), list.end());
+        if constexpr (requires { list.before_end(); }) {
+            check_tail(list, model);
+        }
+        std::sort(model.begin(), model.end());
+        assert(std::equal(model.begin(), model.end(), sorted.begin(), sorted.end()));
+    };
+
+    for (int fail_at : {0, 1, 10, 100, 200}) {
+        int calls = 0;
+        auto comp = [&](int a, int b) {
+            if (calls++ == fail_at) throw std::runtime_error("compare failed");
+            return a < b;
+        };
+
+        List list;
+        list.assign(values.begin(), values.end());
+        try {
+            list.sort(comp);
+        } catch (const std::runtime_error &) {
+        }
+        check(list);
+
+        calls = 0;
+        List a, b;
+        a.assign(sorted.begin(), sorted.begin() + 25);
+        b.assign(sorted.begin() + 25, sorted.end());
+        try {
+            a.merge(b, comp);
+        } catch (const std::runtime_error &) {
+        }
+        assert(b.empty());
+        check(a);
+    }
+}
+
+void test_throwing_comparator() {
+    std::cout << "\n=== Testing Sort/Merge With Throwing Comparator ===" << std::endl;
+    check_throwing_comparator<mys::forward_list<int>>();
+    check_throwing_comparator<mys::tail_forward_list<int>>();
+    std::cout << "throwing comparator: OK" << std::endl;
+}
+
+void test_tail_tracking() {
+    std::cout << "\n=== Testing Tail Tracking ===" << std::endl;
+
+    static_assert(sizeof(mys::tail_forward_list<int>) == sizeof(mys::forward_list<int>) + sizeof(void *));
+
+    mys::tail_forward_list<int> queue;
+    std::deque<int> model;
+    check_tail(queue, model);
+    for (int i = 0; i < 5; ++i) {
+        queue.push_back(i);
+        model.push_back(i);
+    }
+    queue.emplace_back(5);
+    model.push_back(5);
+    check_tail(queue, model);
+    while (!queue.empty()) {
+        queue.pop_front();
+        model.pop_front();
+        check_tail(queue, model);
+    }
+    queue.push_back(42);
+    model.push_back(42);
+    check_tail(queue, model);
+    std::cout << "push_back / pop_front: OK" << std::endl;
+
+    // 整表拼接到末尾
+    mys::tail_forward_list<int> other = {7, 8, 9};
+    queue.splice_after(queue.before_end(), other);
+    model.insert(model.end(), {7, 8, 9});
+    check_tail(queue, model);
+    check_tail(other, {});
+    other.push_back(1);
+    check_tail(other, {1});
+    std::cout << "splice_after at before_end: OK" << std::endl;
+
+    // 随机操作序列：每一步后检查尾指针
+    std::mt19937 gen(2024);
+    mys::tail_forward_list<int> list;
+    model.clear();
+    for (int step = 0; step < 4000; ++step) {
+        int op = static_cast<int>(gen() % 14);
+        int value = static_cast<int>(gen() % 8);
+        std::size_t at = model.empty() ? 0 : gen() % model.size();
+        auto pos = std::next(list.before_begin(), static_cast<std::ptrdiff_t>(at));
+        switch (op) {
+        case 0:
+        case 1:
+            list.push_back(value);
+            model.push_back(value);
+            break;
+        case 2:
+            list.push_front(value);
+            model.push_front(value);
+            break;
+        case 3:
+            list.insert_after(pos, value);
+            model.insert(model.begin() + static_cast<std::ptrdiff_t>(at), value);
+            break;
+        case 4:
+            if (!model.empty()) {
+                list.erase_after(pos);
+                model.erase(model.begin() + static_cast<std::ptrdiff_t>(at));
+            }
+            break;
+        case 5:
+            list.erase_after(pos, list.end());
+            model.erase(model.begin() + static_cast<std::ptrdiff_t>(at), model.end());
+            break;
+        case 6:
+            list.remove_if([value](int v) { return v == value; });
+            std::erase(model, value);
+            break;
+        case 7:
+            list.unique();
+            model.erase(std::unique(model.begin(), model.end()), model.end());
+            break;
+        case 8:
+            list.reverse();
+            std::reverse(model.begin(), model.end());
+            break;
+        case 9: {
+            // 把尾部一段移到开头 (同一链表内的区间 splice)
+            if (at > 0) {
+                list.splice_after(list.before_begin(), list, pos, list.end());
+                std::rotate(model.begin(), model.begin() + static_cast<std::ptrdiff_t>(at), model.end());
+            }
+            break;
+        }
+        case 10: {
+            // 把最后一个元素移到开头 (单元素 splice)
+            if (model.size() > 1) {
+                auto before_last = std::next(list.before_begin(), static_cast<std::ptrdiff_t>(model.size() - 1));
+                list.splice_after(list.before_begin(), list, before_last);
+                std::rotate(model.begin(), model.end() - 1, model.end());
+            }
+            break;
+        }
+        case 11: {
+            mys::tail_forward_list<int> extra = {value, value + 1};
+            list.sort();
+            extra.sort();
+            list.merge(extra);
+            model.push_back(value);
+            model.push_back(value + 1);
+            std::stable_sort(model.begin(), model.end());
+            break;
+        }
+        case 12: {
+            mys::tail_forward_list<int> extra = {value};
+            list.swap(extra);
+            check_tail(extra, model);
+            list.swap(extra);
+            break;
+        }
+        case 13:
+            if (model.size() > 64) {
+                list.clear();
+                model.clear();
+            } else {
+                list.append_range(std::vector<int>{value, value});
+                model.insert(model.end(), {value, value});
+            }
+            break;
+        }
+        check_tail(list, model);
+    }
+    std::cout << "random operations: OK" << std::endl;
+}
+
 void test_comparison_operators() {
     std::cout << "\n=== Testing Comparison Operators ===" << std::endl;
 
@@ -367,17 +748,74 @@ void test_edge_cases() {
     std::cout << "Large list: OK" << std::endl;
 }
 
+void test_compaction() {
+    std::cout << "\n=== Testing Compaction ===" << std::endl;
+
+    // 按打乱的顺序分配节点再排序，遍历顺序在内存中来回跳；
+    // 池中没有空闲槽位，compact 的新节点从 slab 中顺序切出
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(7));
+    mys::tail_forward_list<int, mys::pool_allocator<int>> list;
+    list.assign(values.begin(), values.end());
+    assert(list.fragmentation() < 0.05);
+    list.sort();
+    assert(list.fragmentation() > 0.9);
+
+    auto before_begin = list.before_begin();
+    list.compact();
+    assert(list.fragmentation() < 0.05);
+    assert(list.before_begin() == before_begin);
+    std::sort(values.begin(), values.end());
+    assert(list.size() == 1000 && std::ranges::equal(list, values));
+    // 尾指针跟着换成新节点
+    assert(*list.before_end() == 999 && std::next(list.before_end()) == list.end());
+    list.push_back(1000);
+    assert(*list.before_end() == 1000);
+    std::cout << "Compact restores traversal order in memory: OK" << std::endl;
+
+    // compact_if 只在超过阈值时整理
+    assert(!list.compact_if(0.5));
+    // 反转后每个节点都在前一个节点之前
+    list.reverse();
+    assert(list.compact_if(0.5));
+    assert(list.front() == 1000 && *list.before_end() == 0);
+    std::cout << "compact_if: OK" << std::endl;
+
+    // 元素被移动而不是拷贝
+    mys::forward_list<std::string> strings;
+    for (int i = 0; i < 50; ++i) {
+        strings.push_front(std::string(32, static_cast<char>('a' + i % 26)));
+    }
+    const char *data = strings.front().data();
+    strings.compact();
+    assert(strings.size() == 50 && strings.front().data() == data);
+    std::cout << "Values are moved, not copied: OK" << std::endl;
+
+    // 空表
+    mys::forward_list<int> empty;
+    empty.compact();
+    assert(empty.empty() && empty.fragmentation() == 0.0);
+    std::cout << "Empty list: OK" << std::endl;
+}
+
 int main() {
     std::cout << "Testing mys::forward_list implementation..." << std::endl;
 
     try {
         test_constructors_and_assignment();
+        test_move_assignment_allocators();
         test_element_access();
         test_capacity_queries();
         test_modifiers();
         test_insert_and_erase();
         test_iterators();
         test_operations();
+        test_sort_and_merge();
+        test_range_operations();
+        test_tail_tracking();
+        test_throwing_comparator();
+        test_compaction();
         test_comparison_operators();
         test_custom_types();
         test_edge_cases();
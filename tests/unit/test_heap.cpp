@@ -0,0 +1,201 @@
+#include "heap.h"
+#include <iostream>
+#include <cassert>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+void test_push_pop() {
+    std::cout << "\n=== Testing push/pop ===" << std::endl;
+
+    mys::heap<int> h;
+    assert(h.empty());
+    for (int v : {5, 1, 9, 3, 7, 9, 0}) {
+        h.push(v);
+    }
+    assert(h.size() == 7);
+
+    std::vector<int> out;
+    while (!h.empty()) {
+        out.push_back(h.top());
+        h.pop();
+    }
+    assert((out == std::vector<int>{9, 9, 7, 5, 3, 1, 0}));
+
+    bool thrown = false;
+    try {
+        (void)h.top();
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Max-heap order: OK" << std::endl;
+
+    mys::heap<std::string, std::greater<std::string>, 2> words;
+    words.emplace("pear");
+    words.emplace("apple");
+    words.emplace("fig");
+    assert(words.top() == "apple");
+    std::cout << "Min-heap with std::greater: OK" << std::endl;
+}
+
+void test_handles() {
+    std::cout << "\n=== Testing handles ===" << std::endl;
+
+    mys::heap<int, std::greater<int>, 4> h;
+    std::vector<mys::heap<int, std::greater<int>, 4>::handle> handles;
+    for (int i = 0; i < 100; ++i) {
+        handles.push_back(h.push(100 + i));
+    }
+    assert(h.top() == 100);
+
+    // 句柄在元素移动后仍然指向原元素
+    for (int i = 0; i < 100; ++i) {
+        assert(h.value(handles[i]) == 100 + i);
+    }
+
+    h.decrease_key(handles[57], 1);
+    assert(h.top() == 1);
+    assert(h.value(handles[57]) == 1);
+
+    h.update(handles[57], 500);
+    assert(h.top() == 100);
+
+    h.erase(handles[0]);
+    assert(!h.contains(handles[0]));
+    assert(h.top() == 101);
+    assert(h.size() == 99);
+
+    bool thrown = false;
+    try {
+        h.erase(handles[0]);
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "decrease_key/update/erase: OK" << std::endl;
+}
+
+// 第 countdown 次比较时抛出异常的比较器，countdown 为负时从不抛出
+struct ThrowingLess {
+    static inline int countdown = -1;
+
+    bool operator()(int a, int b) const {
+        if (countdown >= 0 && countdown-- == 0) throw std::runtime_error("compare");
+        return a < b;
+    }
+};
+
+void test_throwing_compare() {
+    std::cout << "\n=== Testing a throwing comparator ===" << std::endl;
+
+    using Heap = mys::heap<int, ThrowingLess, 2>;
+    using Op = void (*)(Heap &, std::vector<Heap::handle> &);
+    const Op ops[] = {
+        [](Heap &h, std::vector<Heap::handle> &) { h.push(1000); },
+        [](Heap &h, std::vector<Heap::handle> &handles) { h.update(handles[40], 1000); },
+        [](Heap &h, std::vector<Heap::handle> &handles) { h.update(handles[0], -1); },
+        [](Heap &h, std::vector<Heap::handle> &handles) { h.decrease_key(handles[40], 1000); },
+        [](Heap &h, std::vector<Heap::handle> &handles) { h.erase(handles[5]); },
+        [](Heap &h, std::vector<Heap::handle> &) { h.pop(); },
+    };
+
+    for (Op op : ops) {
+        for (int k = 0;; ++k) {
+            Heap h;
+            std::vector<Heap::handle> handles;
+            for (int i = 0; i < 64; ++i) {
+                handles.push_back(h.push((i * 37) % 64));
+            }
+
+            ThrowingLess::countdown = k;
+            bool thrown = false;
+            try {
+                op(h, handles);
+            } catch (const std::runtime_error &) {
+                thrown = true;
+            }
+            ThrowingLess::countdown = -1;
+            if (!thrown) break;
+
+            // 抛出异常后堆保持原样：句柄仍指向原值，弹出顺序不变
+            assert(h.size() == 64);
+            for (int i = 0; i < 64; ++i) {
+                assert(h.value(handles[i]) == (i * 37) % 64);
+            }
+            for (int expected = 63; expected >= 0; --expected) {
+                assert(h.top() == expected);
+                h.pop();
+            }
+        }
+    }
+    std::cout << "Failed operations leave the heap unchanged: OK" << std::endl;
+}
+
+template <std::size_t D>
+void check_random_against_sorted() {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 1000);
+
+    using Heap = mys::heap<int, std::greater<int>, D>;
+    Heap h;
+    std::vector<typename Heap::handle> live;
+    std::vector<int> model;
+
+    for (int step = 0; step < 5000; ++step) {
+        int op = static_cast<int>(gen() % 4);
+        if (op <= 1 || live.empty()) {
+            int v = dist(gen);
+            live.push_back(h.push(v));
+            model.push_back(v);
+        } else if (op == 2) {
+            std::size_t k = gen() % live.size();
+            int old = h.value(live[k]);
+            int v = dist(gen);
+            h.update(live[k], v);
+            *std::find(model.begin(), model.end(), old) = v;
+        } else {
+            std::size_t k = gen() % live.size();
+            int old = h.value(live[k]);
+            h.erase(live[k]);
+            live.erase(live.begin() + static_cast<std::ptrdiff_t>(k));
+            model.erase(std::find(model.begin(), model.end(), old));
+        }
+        assert(h.size() == model.size());
+        if (!model.empty()) {
+            assert(h.top() == *std::min_element(model.begin(), model.end()));
+        }
+    }
+}
+
+void test_random_operations() {
+    std::cout << "\n=== Testing random operations for D = 2/4/8 ===" << std::endl;
+
+    check_random_against_sorted<2>();
+    check_random_against_sorted<4>();
+    check_random_against_sorted<8>();
+    std::cout << "Matches a reference model: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::heap implementation..." << std::endl;
+
+    try {
+        test_push_pop();
+        test_handles();
+        test_throwing_compare();
+        test_random_operations();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "forward_list.h"
+#include "list.h"
+#include <iostream>
+#include <cassert>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using CountedList = mys::list<int, std::allocator<int>, mys::counting_instrumentation>;
+using CountedForwardList = mys::forward_list<int, std::allocator<int>, mys::counting_instrumentation>;
+
+// 默认实例化与显式写出 no_instrumentation 是同一类型，布局与插桩前一致
+static_assert(std::is_same_v<mys::list<int>, mys::list<int, std::allocator<int>, mys::no_instrumentation>>);
+static_assert(std::is_same_v<mys::forward_list<int>, mys::forward_list<int, std::allocator<int>, mys::no_instrumentation>>);
+static_assert(std::is_empty_v<mys::no_instrumentation>);
+static_assert(sizeof(mys::list<int>) == 2 * sizeof(void *) + sizeof(std::size_t));
+static_assert(sizeof(mys::forward_list<int>) == sizeof(void *) + sizeof(std::size_t));
+static_assert(sizeof(mys::list<std::string>) == sizeof(mys::list<std::string, std::allocator<std::string>, mys::no_instrumentation>));
+
+struct TraceLog {
+    std::vector<mys::list_event> events;
+    std::size_t last_length = 0;
+};
+
+void record(void *context, mys::list_event event, std::size_t value) noexcept {
+    auto *log = static_cast<TraceLog *>(context);
+    log->events.push_back(event);
+    if (event == mys::list_event::length) log->last_length = value;
+}
+
+void test_list_counters() {
+    std::cout << "\n=== Testing list counters ===" << std::endl;
+
+    {
+        CountedList l;
+        for (int i = 0; i < 10; ++i) {
+            l.push_back(i);
+        }
+        auto &stats = l.instrumentation();
+        assert(stats.allocations == 10);
+        assert(stats.peak_length == 10);
+
+        l.erase(l.begin());
+        l.erase(std::next(l.begin()), std::next(l.begin(), 4));
+        assert(stats.erase_calls == 4);
+        assert(stats.deallocations == 4);
+        assert(l.size() == 6);
+        assert(stats.peak_length == 10);
+
+        l.pop_front();
+        l.clear();
+        assert(stats.deallocations == 10);
+        assert(stats.allocations == stats.deallocations);
+    }
+
+    // 计数器不随拷贝/移动转移
+    {
+        CountedList a = {1, 2, 3};
+        CountedList b(a);
+        assert(a.instrumentation().allocations == 3);
+        assert(b.instrumentation().allocations == 3);
+        CountedList c(std::move(a));
+        assert(c.instrumentation().allocations == 0);
+        assert(c.size() == 3);
+    }
+
+    std::cout << "List counters: OK" << std::endl;
+}
+
+void test_forward_list_counters() {
+    std::cout << "\n=== Testing forward_list counters ===" << std::endl;
+
+    CountedForwardList l = {1, 1, 2, 3, 3, 3, 4, 5, 6};
+    auto &stats = l.instrumentation();
+    assert(stats.allocations == 9);
+    assert(stats.peak_length == 9);
+
+    stats.reset();
+    l.unique();
+    // 每次比较访问一个后继节点：8 个相邻对
+    assert(stats.nodes_visited == 8);
+    assert(stats.erase_calls == 3);
+    assert(stats.deallocations == 3);
+
+    stats.reset();
+    l.remove_if([](int v) { return v % 2 == 0; });
+    assert(stats.nodes_visited == 6);
+    assert(stats.erase_calls == 3);
+
+    CountedForwardList other = {7, 8, 9};
+    stats.reset();
+    l.splice_after(l.before_begin(), other);
+    assert(stats.nodes_visited == 3);
+    assert(stats.peak_length == 6);
+    assert(other.empty());
+
+    other = {10, 11, 12, 13};
+    stats.reset();
+    l.splice_after(l.before_begin(), other, other.begin(), other.end());
+    assert(stats.nodes_visited == 3);
+    assert(l.size() == 9);
+
+    std::cout << "Forward list counters: OK" << std::endl;
+}
+
+void test_tracer() {
+    std::cout << "\n=== Testing tracer hook ===" << std::endl;
+
+    TraceLog log;
+    CountedForwardList l;
+    l.instrumentation().set_tracer(&record, &log);
+
+    l.push_front(1);
+    l.push_front(2);
+    l.pop_front();
+
+    std::vector<mys::list_event> expected = {
+        mys::list_event::allocate, mys::list_event::length,   // push_front(1)
+        mys::list_event::allocate, mys::list_event::length,   // push_front(2)
+        mys::list_event::erase,    mys::list_event::deallocate // pop_front
+    };
+    assert(log.events == expected);
+    assert(log.last_length == 2);
+
+    l.instrumentation().set_tracer(nullptr);
+    l.push_front(3);
+    assert(log.events.size() == expected.size());
+    assert(l.instrumentation().allocations == 3);
+
+    std::cout << "Tracer hook: OK" << std::endl;
+}
+
+void test_default_is_unchanged() {
+    std::cout << "\n=== Testing default instantiation ===" << std::endl;
+
+    // 默认策略下容器行为不变，swap 仍可通过 ADL 找到
+    mys::list<int> a = {1, 2, 3};
+    mys::list<int> b = {4};
+    swap(a, b);
+    assert(a.size() == 1 && b.size() == 3);
+
+    CountedList c = {1, 2};
+    CountedList d = {3};
+    swap(c, d);
+    assert(c.size() == 1 && d.size() == 2);
+    assert(c.instrumentation().allocations == 2);
+
+    std::cout << "Default instantiation: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing list instrumentation policies..." << std::endl;
+
+    try {
+        test_list_counters();
+        test_forward_list_counters();
+        test_tracer();
+        test_default_is_unchanged();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
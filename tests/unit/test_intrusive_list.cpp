@@ -0,0 +1,218 @@
+#include "intrusive_list.h"
+#include <iostream>
+#include <cassert>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <algorithm>
+
+struct Task {
+    int id = 0;
+    mys::list_hook<Task> run_hook;
+    mys::list_hook<Task> all_hook;
+};
+
+using RunQueue = mys::intrusive_list<Task, &Task::run_hook>;
+using AllTasks = mys::intrusive_list<Task, &Task::all_hook>;
+
+template <typename List>
+std::vector<int> ids(const List &l) {
+    std::vector<int> out;
+    for (const Task &t : l) {
+        out.push_back(t.id);
+    }
+    return out;
+}
+
+void test_basic_operations() {
+    std::cout << "\n=== Testing basic operations ===" << std::endl;
+
+    std::vector<Task> pool(5);
+    for (int i = 0; i < 5; ++i) {
+        pool[i].id = i;
+    }
+
+    RunQueue q;
+    assert(q.empty());
+    q.push_back(pool[1]);
+    q.push_back(pool[2]);
+    q.push_front(pool[0]);
+    q.insert(q.end(), pool[4]);
+    q.insert(q.iterator_to(pool[4]), pool[3]);
+    assert(q.size() == 5);
+    assert((ids(q) == std::vector<int>{0, 1, 2, 3, 4}));
+    assert(q.front().id == 0 && q.back().id == 4);
+    std::cout << "push/insert: OK" << std::endl;
+
+    // 元素可以同时挂在使用不同钩子的两个链表上
+    AllTasks all;
+    for (Task &t : pool) {
+        all.push_front(t);
+    }
+    assert((ids(all) == std::vector<int>{4, 3, 2, 1, 0}));
+
+    // 通过元素本身 O(1) 摘除
+    auto next = q.erase(pool[2]);
+    assert(next->id == 3);
+    assert((ids(q) == std::vector<int>{0, 1, 3, 4}));
+    assert(all.size() == 5);
+    std::cout << "Erase by reference with a second hook: OK" << std::endl;
+
+    std::vector<int> reversed;
+    for (auto it = q.rbegin(); it != q.rend(); ++it) {
+        reversed.push_back(it->id);
+    }
+    assert((reversed == std::vector<int>{4, 3, 1, 0}));
+    std::cout << "Reverse iteration: OK" << std::endl;
+
+    q.pop_front();
+    q.pop_back();
+    assert((ids(q) == std::vector<int>{1, 3}));
+    q.clear();
+    assert(q.empty() && pool[1].run_hook.next == nullptr);
+
+    // 清空后元素可以重新入队
+    q.push_back(pool[1]);
+    assert(q.size() == 1);
+    std::cout << "pop/clear/relink: OK" << std::endl;
+}
+
+void test_splice() {
+    std::cout << "\n=== Testing splice ===" << std::endl;
+
+    std::vector<Task> pool(8);
+    for (int i = 0; i < 8; ++i) {
+        pool[i].id = i;
+    }
+    RunQueue a, b;
+    for (int i = 0; i < 4; ++i) {
+        a.push_back(pool[i]);
+        b.push_back(pool[i + 4]);
+    }
+
+    a.splice(a.iterator_to(pool[2]), b, b.iterator_to(pool[5]), b.iterator_to(pool[7]));
+    assert((ids(a) == std::vector<int>{0, 1, 5, 6, 2, 3}));
+    assert((ids(b) == std::vector<int>{4, 7}));
+    assert(a.size() == 6 && b.size() == 2);
+
+    a.splice(a.begin(), b, b.iterator_to(pool[7]));
+    assert((ids(a) == std::vector<int>{7, 0, 1, 5, 6, 2, 3}));
+
+    // 同一链表内移动区间
+    a.splice(a.end(), a, a.begin(), a.iterator_to(pool[5]));
+    assert((ids(a) == std::vector<int>{5, 6, 2, 3, 7, 0, 1}));
+    assert(a.size() == 7);
+
+    a.splice(a.iterator_to(pool[3]), b);
+    assert((ids(a) == std::vector<int>{5, 6, 2, 4, 3, 7, 0, 1}));
+    assert(b.empty() && a.size() == 8);
+
+    RunQueue moved = std::move(a);
+    assert(a.empty() && moved.size() == 8 && moved.back().id == 1);
+    std::cout << "Splice and move: OK" << std::endl;
+}
+
+void test_linked_hook_rejected() {
+    std::cout << "\n=== Testing double linking ===" << std::endl;
+
+    std::vector<Task> pool(3);
+    for (int i = 0; i < 3; ++i) {
+        pool[i].id = i;
+    }
+    RunQueue a, b;
+    a.push_back(pool[0]);
+    a.push_back(pool[1]);
+
+    // 同一个钩子不能同时挂在两个链表上，也不能在同一链表里挂两次
+    auto rejected = [](auto &&link) {
+        try {
+            link();
+        } catch (const std::invalid_argument &) {
+            return true;
+        }
+        return false;
+    };
+    assert(rejected([&] { a.push_back(pool[0]); }));
+    assert(rejected([&] { a.push_front(pool[1]); }));
+    assert(rejected([&] { b.insert(b.end(), pool[0]); }));
+    assert((ids(a) == std::vector<int>{0, 1}));
+    assert(b.empty());
+
+    // 摘下之后钩子重新可用
+    a.erase(pool[0]);
+    assert(!pool[0].run_hook.is_linked());
+    b.push_back(pool[0]);
+    b.push_front(pool[2]);
+    assert((ids(b) == std::vector<int>{2, 0}));
+    std::cout << "Linked hook rejected: OK" << std::endl;
+
+    // 哨兵随 swap 一起交换后，--end() 仍然落在最后一个元素上
+    a.swap(b);
+    assert((ids(a) == std::vector<int>{2, 0}) && (ids(b) == std::vector<int>{1}));
+    assert((--a.end())->id == 0 && (--b.end())->id == 1);
+    RunQueue empty;
+    b.swap(empty);
+    assert(b.empty() && b.begin() == b.end() && empty.front().id == 1);
+    std::cout << "Swap keeps the sentinel ring: OK" << std::endl;
+}
+
+void test_random_operations() {
+    std::cout << "\n=== Testing random operations ===" << std::endl;
+
+    std::vector<Task> pool(64);
+    for (int i = 0; i < 64; ++i) {
+        pool[i].id = i;
+    }
+    std::vector<bool> linked(64, false);
+    RunQueue q;
+    std::list<int> ref;
+    std::mt19937 gen(42);
+
+    for (int step = 0; step < 20000; ++step) {
+        int id = static_cast<int>(gen() % 64);
+        if (linked[id]) {
+            q.erase(pool[id]);
+            ref.remove(id);
+            linked[id] = false;
+        } else {
+            // 插在一个随机的已有元素之前，或者末尾
+            int before = static_cast<int>(gen() % 64);
+            if (linked[before]) {
+                q.insert(q.iterator_to(pool[before]), pool[id]);
+                ref.insert(std::find(ref.begin(), ref.end(), before), id);
+            } else {
+                q.push_back(pool[id]);
+                ref.push_back(id);
+            }
+            linked[id] = true;
+        }
+        assert(q.size() == ref.size());
+    }
+    assert(ids(q) == std::vector<int>(ref.begin(), ref.end()));
+    std::cout << "Matches std::list: OK" << std::endl;
+}
+
+// 迭代器只保存一个指针：end() 就是哨兵
+static_assert(sizeof(RunQueue::iterator) == sizeof(void *));
+static_assert(sizeof(RunQueue::const_iterator) == sizeof(void *));
+
+int main() {
+    std::cout << "Testing mys::intrusive_list implementation..." << std::endl;
+
+    try {
+        test_basic_operations();
+        test_splice();
+        test_linked_hook_rejected();
+        test_random_operations();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -2,7 +2,14 @@
 #include <iostream>
 #include <string>
 #include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <memory>
+#include <random>
+#include <ranges>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 // 测试用的自定义类型
 struct TestObject {
@@ -155,6 +162,57 @@ void test_move_assignment() {
     std::cout << "Move assignment test passed.\n";
 }
 
+// 每个实例带编号、移动赋值不传播的分配器；live 按编号统计未释放的节点，错配的释放会让计数失衡
+template <typename T>
+struct TaggedAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    static inline int next_id = 0;
+    static inline int live[16] = {};
+    int id;
+
+    TaggedAllocator() : id(next_id++ % 16) {}
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U> &other) noexcept : id(other.id) {}
+
+    T *allocate(std::size_t n) {
+        ++live[id];
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept {
+        --live[id];
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(const TaggedAllocator &lhs, const TaggedAllocator &rhs) { return lhs.id == rhs.id; }
+};
+
+// 测试分配器不相等且不传播时的移动赋值：不能接管节点，只能逐个移动元素
+void test_move_assignment_allocators() {
+    std::cout << "Testing move assignment with unequal allocators...\n";
+    using List = mys::list<std::string, TaggedAllocator<std::string>>;
+    {
+        List a{"x", "y", "z"};
+        List b{"w"};
+        const std::string *first = &a.front();
+        b = std::move(a);
+        assert(b.size() == 3 && b.front() == "x" && b.back() == "z");
+        assert(&b.front() != first);
+        assert(a.empty());
+
+        // 分配器相等时直接接管节点
+        List c(b.get_allocator());
+        c.push_back("v");
+        first = &b.front();
+        c = std::move(b);
+        assert(c.size() == 3 && &c.front() == first);
+    }
+    for (int count : TaggedAllocator<std::string>::live) {
+        assert(count == 0);
+    }
+    std::cout << "Move assignment with unequal allocators test passed.\n";
+}
+
 // 测试元素访问方法
 void test_element_access() {
     std::cout << "Testing element access...\n";
@@ -465,6 +523,446 @@ void test_edge_cases() {
     std::cout << "Edge cases test passed.\n";
 }
 
+// 测试排序与归并
+void test_sort_and_merge() {
+    std::cout << "Testing sort and merge...\n";
+
+    mys::list<int> l{5, 3, 9, 1, 7, 2, 8, 6, 4, 0};
+    l.sort();
+    int expected = 0;
+    for (const auto &x : l) {
+        assert(x == expected++);
+    }
+    assert(l.front() == 0);
+    assert(l.back() == 9);
+
+    // 反向遍历验证 prev 指针已正确重连
+    expected = 9;
+    for (auto it = l.rbegin(); it != l.rend(); ++it) {
+        assert(*it == expected--);
+    }
+
+    // 自定义比较器
+    l.sort([](int a, int b) { return a > b; });
+    assert(l.front() == 9);
+    assert(l.back() == 0);
+
+    // 稳定性：相等的键保持原有相对顺序
+    mys::list<std::pair<int, int>> pairs{{2, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 4}, {2, 5}};
+    pairs.sort([](const auto &a, const auto &b) { return a.first < b.first; });
+    int last_key = -1, last_seq = -1;
+    for (const auto &[key, seq] : pairs) {
+        if (key == last_key) assert(seq > last_seq);
+        last_key = key;
+        last_seq = seq;
+    }
+
+    // merge
+    mys::list<int> a{1, 3, 5, 7};
+    mys::list<int> b{2, 4, 6};
+    a.merge(b);
+    assert(a.size() == 7);
+    assert(b.empty());
+    expected = 1;
+    for (const auto &x : a) {
+        assert(x == expected++);
+    }
+    assert(a.back() == 7);
+    assert(*--a.end() == 7);
+
+    // 合并到空列表
+    mys::list<int> empty;
+    empty.merge(a);
+    assert(empty.size() == 7);
+    assert(empty.back() == 7);
+    std::cout << "Sort and merge test passed.\n";
+}
+
+// 第 n 次拷贝时抛异常，用来检查范围操作的强异常保证
+struct ThrowOnCopy {
+    int value;
+    static int copies_left;
+
+    ThrowOnCopy(int v) : value(v) {}
+    ThrowOnCopy(const ThrowOnCopy &other) : value(other.value) {
+        if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    }
+    ThrowOnCopy(ThrowOnCopy &&) noexcept = default;
+    ThrowOnCopy &operator=(const ThrowOnCopy &) = default;
+    ThrowOnCopy &operator=(ThrowOnCopy &&) noexcept = default;
+};
+
+int ThrowOnCopy::copies_left = -1;
+
+// 测试范围插入与区间删除
+void test_range_operations() {
+    std::cout << "Testing range operations...\n";
+
+    std::vector<int> src{1, 2, 3, 4, 5};
+    mys::list<int> l;
+    l.append_range(src);
+    l.prepend_range(std::vector<int>{-1, 0});
+    assert(l.size() == 7);
+    assert(l.front() == -1 && l.back() == 5);
+
+    // insert_range 返回第一个插入的元素
+    auto it = l.insert_range(std::next(l.begin(), 2), std::vector<int>{10, 11});
+    assert(*it == 10);
+    assert(*std::prev(it) == 0);
+    int expected[] = {-1, 0, 10, 11, 1, 2, 3, 4, 5};
+    int i = 0;
+    for (const auto &x : l) {
+        assert(x == expected[i++]);
+    }
+
+    // 反向遍历检查 prev 指针
+    i = 8;
+    for (auto rit = l.rbegin(); rit != l.rend(); ++rit) {
+        assert(*rit == expected[i--]);
+    }
+
+    // 空范围返回 pos
+    auto end_it = l.insert(l.end(), src.begin(), src.begin());
+    assert(end_it == l.end());
+    l.insert(l.end(), {6, 7});
+    assert(l.back() == 7 && l.size() == 11);
+
+    // 任意 input_range，包括带哨兵的 view
+    l.assign_range(std::views::iota(0, 4));
+    assert(l.size() == 4 && l.front() == 0 && l.back() == 3);
+    l.assign(src.begin(), src.end());
+    assert(l.size() == 5 && l.front() == 1);
+    l.assign({9});
+    assert(l.size() == 1 && l.front() == 9 && l.back() == 9);
+
+    // 区间删除：中间、开头、到末尾
+    mys::list<int> e{0, 1, 2, 3, 4, 5, 6, 7};
+    auto after = e.erase(std::next(e.begin(), 2), std::next(e.begin(), 5));
+    assert(*after == 5 && e.size() == 5);
+    e.erase(e.begin(), std::next(e.begin()));
+    assert(e.front() == 1 && e.size() == 4);
+    assert(e.erase(std::next(e.begin()), e.end()) == e.end());
+    assert(e.size() == 1 && e.front() == 1 && e.back() == 1);
+
+    // 强异常保证：构造失败时原内容不变，已建好的节点全部释放
+    mys::list<ThrowOnCopy> t;
+    t.emplace_back(1);
+    t.emplace_back(2);
+    std::vector<ThrowOnCopy> more{3, 4, 5};
+    for (int fail_at = 0; fail_at < 3; ++fail_at) {
+        ThrowOnCopy::copies_left = fail_at;
+        bool thrown = false;
+        try {
+            t.insert_range(std::next(t.begin()), more);
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+        assert(thrown);
+        ThrowOnCopy::copies_left = fail_at;
+        try {
+            t.assign_range(more);
+            assert(false);
+        } catch (const std::runtime_error &) {
+        }
+        assert(t.size() == 2 && t.front().value == 1 && t.back().value == 2);
+    }
+    ThrowOnCopy::copies_left = -1;
+
+    std::cout << "Range operations test passed.\n";
+}
+
+// 正反两个方向都与期望序列一致，保证 prev/next 重连正确
+void check_links(const mys::list<int> &l, const std::vector<int> &expected) {
+    assert(l.size() == expected.size());
+    assert(std::vector<int>(l.begin(), l.end()) == expected);
+    assert(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>(expected.rbegin(), expected.rend()));
+}
+
+// 比较器中途抛出时所有节点仍留在链表中，正反向遍历都完整
+void test_throwing_comparator() {
+    std::cout << "Testing sort/merge with a throwing comparator...\n";
+
+    std::vector<int> values(50);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(7));
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (int fail_at : {0, 1, 10, 100, 200}) {
+        int calls = 0;
+        auto comp = [&](int a, int b) {
+            if (calls++ == fail_at) throw std::runtime_error("compare failed");
+            return a < b;
+        };
+
+        mys::list<int> l;
+        l.assign(values.begin(), values.end());
+        try {
+            l.sort(comp);
+        } catch (const std::runtime_error &) {
+        }
+        std::vector<int> seen(l.begin(), l.end());
+        assert(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>(seen.rbegin(), seen.rend()));
+        std::sort(seen.begin(), seen.end());
+        assert(seen == sorted);
+
+        calls = 0;
+        mys::list<int> a, b;
+        a.assign(sorted.begin(), sorted.begin() + 25);
+        b.assign(sorted.begin() + 25, sorted.end());
+        try {
+            a.merge(b, comp);
+        } catch (const std::runtime_error &) {
+        }
+        assert(b.empty());
+        seen.assign(a.begin(), a.end());
+        assert(seen.size() == a.size());
+        assert(std::vector<int>(a.rbegin(), a.rend()) == std::vector<int>(seen.rbegin(), seen.rend()));
+        std::sort(seen.begin(), seen.end());
+        assert(seen == sorted);
+    }
+    std::cout << "Throwing comparator test passed.\n";
+}
+
+// 测试 splice / remove / unique / reverse
+void test_relinking_operations() {
+    std::cout << "Testing relinking operations...\n";
+
+    // 整表 splice：节点地址不变，来源链表被清空
+    mys::list<int> a{1, 2, 3};
+    mys::list<int> b{10, 20};
+    const int *moved = &b.front();
+    a.splice(std::next(a.begin()), b);
+    check_links(a, {1, 10, 20, 2, 3});
+    assert(b.empty() && b.begin() == b.end());
+    assert(&*std::next(a.begin()) == moved);
+    a.splice(a.end(), mys::list<int>{4});
+    a.splice(a.begin(), b);
+    check_links(a, {1, 10, 20, 2, 3, 4});
+
+    // 单个元素：跨链表、同链表、移到自己前后为空操作
+    b.splice(b.end(), a, a.begin());
+    check_links(a, {10, 20, 2, 3, 4});
+    check_links(b, {1});
+    a.splice(a.end(), a, a.begin());
+    check_links(a, {20, 2, 3, 4, 10});
+    a.splice(a.begin(), a, a.begin());
+    a.splice(std::next(a.begin()), a, a.begin());
+    check_links(a, {20, 2, 3, 4, 10});
+    a.splice(a.begin(), a, std::prev(a.end()));
+    check_links(a, {10, 20, 2, 3, 4});
+
+    // 区间：跨链表需要更新两边的长度，同链表只重连
+    b.splice(b.begin(), a, std::next(a.begin()), std::next(a.begin(), 3));
+    check_links(a, {10, 3, 4});
+    check_links(b, {20, 2, 1});
+    a.splice(a.begin(), a, std::next(a.begin()), a.end());
+    check_links(a, {3, 4, 10});
+    a.splice(a.end(), b, b.begin(), b.end());
+    check_links(a, {3, 4, 10, 20, 2, 1});
+    assert(b.empty());
+    a.splice(a.begin(), a, a.begin(), a.begin());
+    check_links(a, {3, 4, 10, 20, 2, 1});
+
+    // C++20 风格的返回值
+    mys::list<int> r{1, 2, 2, 3, 2, 4, 5, 5};
+    assert(r.remove(2) == 3);
+    check_links(r, {1, 3, 4, 5, 5});
+    assert(r.remove(42) == 0);
+    // value 引用链表自身的元素
+    assert(r.remove(r.back()) == 2);
+    check_links(r, {1, 3, 4});
+    assert(r.remove_if([](int v) { return v % 2 == 1; }) == 2);
+    check_links(r, {4});
+    assert(r.remove_if([](int) { return true; }) == 1);
+    assert(r.empty());
+
+    mys::list<int> u{1, 1, 2, 2, 2, 3, 1, 1};
+    assert(u.unique() == 4);
+    check_links(u, {1, 2, 3, 1});
+    // 与最后保留的元素比较，而不是与前一个被删的元素比较
+    mys::list<int> w{1, 2, 3, 4, 10, 11, 20};
+    assert(w.unique([](int x, int y) { return y - x < 5; }) == 4);
+    check_links(w, {1, 10, 20});
+    mys::list<int> empty;
+    assert(empty.unique() == 0);
+
+    w.reverse();
+    check_links(w, {20, 10, 1});
+    empty.reverse();
+    assert(empty.empty());
+
+    // 重连操作不构造也不拷贝元素
+    reset_counters();
+    {
+        mys::list<TestObject> x;
+        mys::list<TestObject> y;
+        for (int i = 0; i < 4; ++i) {
+            x.emplace_back(i);
+            y.emplace_back(i);
+        }
+        x.splice(x.begin(), y, std::next(y.begin()), y.end());
+        x.splice(x.end(), y);
+        x.reverse();
+        x.unique();
+        assert(x.remove(TestObject(3)) == 2);
+        assert(TestObject::copies == 0 && TestObject::moves == 0);
+        assert(TestObject::constructions == 9);
+    }
+    assert(TestObject::constructions == TestObject::destructions);
+
+    std::cout << "Relinking operations test passed.\n";
+}
+
+// 迭代器只有一个指针，end() 是哨兵
+static_assert(sizeof(mys::list<int>::iterator) == sizeof(void *));
+static_assert(sizeof(mys::list<int>::const_iterator) == sizeof(void *));
+
+// 测试环形哨兵：移动、交换后两端节点都要指回各自的哨兵
+void test_sentinel_layout() {
+    std::cout << "Testing sentinel layout...\n";
+
+    mys::list<int> a{1, 2, 3};
+    // --end() 不再需要知道所属链表
+    assert(*std::prev(a.end()) == 3);
+    assert(*std::prev(a.cend()) == 3);
+    assert(std::next(std::prev(a.end())) == a.end());
+
+    mys::list<int> empty;
+    assert(empty.begin() == empty.end());
+    assert(std::prev(empty.end()) == empty.end());
+
+    // 移动构造：新对象的哨兵接管节点，原对象回到空环
+    mys::list<int> b(std::move(a));
+    check_links(b, {1, 2, 3});
+    assert(a.empty() && a.begin() == a.end());
+    a.push_back(9);
+    check_links(a, {9});
+
+    // 移动赋值与 swap，包括一方为空
+    mys::list<int> c;
+    c = std::move(b);
+    check_links(c, {1, 2, 3});
+    assert(b.begin() == b.end());
+    c.swap(b);
+    check_links(b, {1, 2, 3});
+    check_links(c, {});
+    b.swap(a);
+    check_links(a, {1, 2, 3});
+    check_links(b, {9});
+
+    // 迭代器在 swap 后仍指向原来的元素，end() 跟随各自的对象
+    auto it = std::next(a.begin());
+    a.swap(b);
+    assert(*it == 2 && std::next(it, 2) == b.end());
+
+    // 清空后哨兵自环，可以继续使用
+    b.clear();
+    assert(b.begin() == b.end());
+    b.push_front(5);
+    b.emplace(b.end(), 6);
+    check_links(b, {5, 6});
+    b.pop_back();
+    b.pop_front();
+    b.pop_front();
+    assert(b.empty() && b.begin() == b.end());
+
+    std::cout << "Sentinel layout test passed.\n";
+}
+
+// 移动构造可能抛异常，compact 只能拷贝；第 n 次拷贝时抛异常
+struct ThrowingMove {
+    int value;
+    static int copies_left;
+
+    ThrowingMove(int v) : value(v) {}
+    ThrowingMove(const ThrowingMove &other) : value(other.value) {
+        if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    }
+    ThrowingMove(ThrowingMove &&other) : value(other.value) {}
+    ThrowingMove &operator=(const ThrowingMove &) = default;
+    ThrowingMove &operator=(ThrowingMove &&) = default;
+};
+
+int ThrowingMove::copies_left = -1;
+
+// 测试 compact：元素与顺序不变，节点按遍历顺序重新分配
+void test_compaction() {
+    std::cout << "Testing compaction...\n";
+
+    // 按打乱的顺序分配节点，sort 只重连指针，遍历顺序在内存中来回跳；
+    // 池中没有空闲槽位，compact 的新节点从 slab 中顺序切出
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+    mys::list<int, mys::pool_allocator<int>> l;
+    l.assign(values.begin(), values.end());
+    assert(l.fragmentation() < 0.05);
+    l.sort();
+    assert(l.fragmentation() > 0.9);
+
+    auto end = l.end();
+    l.compact();
+    assert(l.fragmentation() < 0.05);
+    assert(l.end() == end);
+    std::sort(values.begin(), values.end());
+    assert(l.size() == 1000);
+    assert(std::ranges::equal(l, values));
+    assert(std::ranges::equal(l | std::views::reverse, values | std::views::reverse));
+
+    // compact_if 只在超过阈值时整理
+    assert(!l.compact_if(0.5));
+    l.sort(std::greater<int>());
+    assert(l.compact_if(0.5));
+    // 这次新节点取自上一次释放的空闲槽位，不再保证连续
+    assert(l.front() == 999 && l.back() == 0);
+    std::cout << "  compact lays the nodes out in traversal order\n";
+
+    // 值被移动而不是拷贝，旧节点里的对象全部析构
+    reset_counters();
+    {
+        mys::list<TestObject> t;
+        for (int i = 0; i < 100; ++i) {
+            t.emplace_back(i);
+        }
+        t.compact();
+        assert(TestObject::copies == 0 && TestObject::moves == 100);
+        assert(t.size() == 100 && t.front().value == 0 && t.back().value == 99);
+    }
+    assert(TestObject::constructions + TestObject::moves == TestObject::destructions);
+
+    // 拷贝中途抛异常：元素和顺序保持不变
+    mys::list<ThrowingMove> m;
+    for (int i = 0; i < 10; ++i) {
+        m.emplace_back(i);
+    }
+    ThrowingMove::copies_left = 5;
+    bool threw = false;
+    try {
+        m.compact();
+    } catch (const std::runtime_error &) {
+        threw = true;
+    }
+    ThrowingMove::copies_left = -1;
+    assert(threw && m.size() == 10);
+    int expected = 0;
+    for (const ThrowingMove &item : m) {
+        assert(item.value == expected++);
+    }
+    m.compact();
+    assert(m.size() == 10 && m.back().value == 9);
+
+    // 空表与单元素
+    mys::list<int> empty;
+    empty.compact();
+    assert(empty.empty() && empty.fragmentation() == 0.0);
+    empty.push_back(1);
+    empty.compact();
+    check_links(empty, {1});
+
+    std::cout << "Compaction test passed.\n";
+}
+
 // 测试资源管理
 void test_resource_management() {
     std::cout << "Testing resource management...\n";
@@ -493,6 +991,7 @@ int main() {
         test_move_constructor();
         test_copy_assignment();
         test_move_assignment();
+        test_move_assignment_allocators();
         test_element_access();
         test_capacity();
         test_push_pop_operations();
@@ -504,6 +1003,12 @@ int main() {
         test_swap();
         test_comparison();
         test_edge_cases();
+        test_sort_and_merge();
+        test_range_operations();
+        test_throwing_comparator();
+        test_relinking_operations();
+        test_sentinel_layout();
+        test_compaction();
         test_resource_management();
 
         std::cout << "\nAll tests passed successfully!\n";
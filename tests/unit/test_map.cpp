@@ -0,0 +1,239 @@
+#include "map.h"
+#include <iostream>
+#include <cassert>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+// 把 mys::map 的内容逐项与 std::map 比较，正反两个方向都检查
+template <typename Map, typename Ref>
+void assert_same(const Map &m, const Ref &ref) {
+    assert(m.size() == ref.size());
+    auto it = m.begin();
+    for (const auto &[key, value] : ref) {
+        assert(it != m.end());
+        assert(it->first == key && it->second == value);
+        ++it;
+    }
+    assert(it == m.end());
+
+    auto rit = m.rbegin();
+    for (auto ref_it = ref.rbegin(); ref_it != ref.rend(); ++ref_it, ++rit) {
+        assert((*rit).first == ref_it->first);
+    }
+    assert(rit == m.rend());
+}
+
+void test_basic_operations() {
+    std::cout << "\n=== Testing basic operations ===" << std::endl;
+
+    mys::map<int, std::string> m;
+    assert(m.empty());
+    assert(m.begin() == m.end());
+
+    assert(m.insert({3, "three"}).second);
+    assert(m.emplace(1, "one").second);
+    assert(m.try_emplace(2, "two").second);
+    assert(!m.insert({3, "drei"}).second);
+    assert(m.at(3) == "three");
+    m[4] = "four";
+    assert(m.size() == 4);
+
+    auto [it, inserted] = m.insert_or_assign(1, "uno");
+    assert(!inserted && it->second == "uno");
+
+    std::vector<int> keys;
+    for (const auto &[key, value] : m) {
+        keys.push_back(key);
+    }
+    assert((keys == std::vector<int>{1, 2, 3, 4}));
+
+    bool thrown = false;
+    try {
+        (void)m.at(42);
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "Insert, lookup and ordered iteration: OK" << std::endl;
+
+    assert(m.erase(2) == 1);
+    assert(m.erase(2) == 0);
+    assert(!m.contains(2) && m.count(3) == 1);
+    std::cout << "Erase by key: OK" << std::endl;
+}
+
+void test_bounds() {
+    std::cout << "\n=== Testing lower_bound / upper_bound ===" << std::endl;
+
+    // 小扇出让少量元素就形成多层树，边界经常落在叶子末尾
+    mys::map<int, int, std::less<int>, 4> m;
+    for (int i = 0; i < 200; i += 2) {
+        m.emplace(i, i * 10);
+    }
+
+    for (int k = -1; k <= 200; ++k) {
+        auto lo = m.lower_bound(k);
+        auto hi = m.upper_bound(k);
+        int expected_lo = k < 0 ? 0 : (k + 1) / 2 * 2;
+        int expected_hi = k < 0 ? 0 : k / 2 * 2 + 2;
+        if (expected_lo >= 200) {
+            assert(lo == m.end());
+        } else {
+            assert(lo->first == expected_lo);
+        }
+        if (expected_hi >= 200) {
+            assert(hi == m.end());
+        } else {
+            assert(hi->first == expected_hi);
+        }
+        auto [first, last] = m.equal_range(k);
+        assert(std::distance(first, last) == (k >= 0 && k < 200 && k % 2 == 0 ? 1 : 0));
+    }
+    std::cout << "Bounds across leaf boundaries: OK" << std::endl;
+
+    // 区间扫描：[50, 150) 中的偶数
+    int count = 0;
+    for (auto it = m.lower_bound(50); it != m.lower_bound(150); ++it) {
+        ++count;
+    }
+    assert(count == 50);
+    std::cout << "Range scan: OK" << std::endl;
+}
+
+void test_bulk_load() {
+    std::cout << "\n=== Testing bulk load ===" << std::endl;
+
+    for (int n : {0, 1, 4, 5, 17, 64, 65, 1000, 4097}) {
+        std::vector<std::pair<int, int>> sorted;
+        for (int i = 0; i < n; ++i) {
+            sorted.emplace_back(i * 3, i);
+        }
+        mys::map<int, int, std::less<int>, 4> m(mys::sorted_unique, sorted.begin(), sorted.end());
+        std::map<int, int> ref(sorted.begin(), sorted.end());
+        assert_same(m, ref);
+
+        // 批量构建的树继续插入、删除仍需保持平衡
+        for (int i = 0; i < n; i += 2) {
+            m.erase(i * 3);
+            ref.erase(i * 3);
+            m.emplace(i * 3 + 1, -i);
+            ref.emplace(i * 3 + 1, -i);
+        }
+        assert_same(m, ref);
+    }
+    std::cout << "Sorted construction of various sizes: OK" << std::endl;
+
+    mys::map<int, int> m{{1, 1}, {2, 2}};
+    std::vector<std::pair<int, int>> sorted{{10, 0}, {20, 0}, {30, 0}};
+    m.assign(mys::sorted_unique, sorted.begin(), sorted.end());
+    assert(m.size() == 3 && m.begin()->first == 10);
+
+    mys::map<int, int> copy = m;
+    assert(copy == m);
+    copy[40] = 0;
+    assert(!(copy == m));
+    std::cout << "assign and copy: OK" << std::endl;
+}
+
+void test_iterator_erase() {
+    std::cout << "\n=== Testing erase through iterators ===" << std::endl;
+
+    mys::map<int, int, std::less<int>, 4> m;
+    for (int i = 0; i < 500; ++i) {
+        m.emplace(i, i);
+    }
+    // erase 返回的迭代器必须正好指向下一个元素，即使发生了借位或合并
+    for (auto it = m.begin(); it != m.end();) {
+        if (it->first % 3 != 0) {
+            int next = it->first + 1;
+            it = m.erase(it);
+            assert(it == m.end() || it->first == next);
+        } else {
+            ++it;
+        }
+    }
+    assert(m.size() == 167);
+
+    auto it = m.erase(m.lower_bound(30), m.lower_bound(300));
+    assert(it->first == 300);
+    assert(m.size() == 167 - 90);
+
+    m.erase(m.begin(), m.end());
+    assert(m.empty() && m.begin() == m.end());
+    m.emplace(7, 7);
+    assert(m.size() == 1 && m.begin()->first == 7);
+    std::cout << "Iterator and range erase: OK" << std::endl;
+}
+
+template <std::size_t Fanout>
+void check_random_against_std() {
+    mys::map<int, int, std::less<int>, Fanout> m;
+    std::map<int, int> ref;
+    std::mt19937 gen(Fanout);
+    std::uniform_int_distribution<int> key_dist(0, 3000);
+
+    for (int step = 0; step < 40000; ++step) {
+        int key = key_dist(gen);
+        switch (gen() % 4) {
+        case 0:
+        case 1:
+            assert(m.emplace(key, step).second == ref.emplace(key, step).second);
+            break;
+        case 2:
+            assert(m.erase(key) == ref.erase(key));
+            break;
+        case 3: {
+            auto it = m.lower_bound(key);
+            auto ref_it = ref.lower_bound(key);
+            assert((it == m.end()) == (ref_it == ref.end()));
+            if (ref_it != ref.end()) {
+                assert(it->first == ref_it->first && it->second == ref_it->second);
+            }
+            break;
+        }
+        }
+    }
+    assert_same(m, ref);
+
+    // 全部删除，迫使根节点逐层收缩
+    while (!ref.empty()) {
+        int key = ref.begin()->first;
+        assert(m.erase(key) == 1);
+        ref.erase(ref.begin());
+    }
+    assert(m.empty() && m.begin() == m.end());
+}
+
+void test_random_operations() {
+    std::cout << "\n=== Testing random operations for Fanout = 4/7/32 ===" << std::endl;
+
+    check_random_against_std<4>();
+    check_random_against_std<7>();
+    check_random_against_std<32>();
+    std::cout << "Matches std::map: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::map implementation..." << std::endl;
+
+    try {
+        test_basic_operations();
+        test_bounds();
+        test_bulk_load();
+        test_iterator_erase();
+        test_random_operations();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "mpmc_queue.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+void test_single_thread() {
+    std::cout << "\n=== Testing single-threaded semantics ===" << std::endl;
+
+    mys::mpmc_queue<int> q(5);
+    assert(q.capacity() == 8);
+    assert(q.empty_approx());
+
+    for (int i = 0; i < 8; ++i) {
+        assert(q.try_push(i));
+    }
+    assert(!q.try_push(8));
+    assert(q.size_approx() == 8);
+    std::cout << "Capacity rounding and full queue: OK" << std::endl;
+
+    int value = -1;
+    for (int i = 0; i < 8; ++i) {
+        assert(q.try_pop(value));
+        assert(value == i);
+    }
+    assert(!q.try_pop(value));
+    std::cout << "FIFO order and empty queue: OK" << std::endl;
+
+    // 多圈环绕
+    for (int round = 0; round < 100; ++round) {
+        assert(q.try_push(round));
+        assert(q.try_emplace(round + 1));
+        assert(q.try_pop(value) && value == round);
+        assert(q.try_pop(value) && value == round + 1);
+    }
+    std::cout << "Wrap-around: OK" << std::endl;
+}
+
+void test_bulk() {
+    std::cout << "\n=== Testing bulk push/pop ===" << std::endl;
+
+    mys::mpmc_queue<int> q(16);
+    std::vector<int> input(20);
+    for (int i = 0; i < 20; ++i) {
+        input[i] = i;
+    }
+
+    // 只放得下 16 个
+    assert(q.try_push_n(input.begin(), input.size()) == 16);
+    assert(q.try_push_n(input.begin(), 1) == 0);
+
+    std::vector<int> output;
+    assert(q.try_pop_n(std::back_inserter(output), 10) == 10);
+    assert(q.try_pop_n(std::back_inserter(output), 10) == 6);
+    assert(q.try_pop_n(std::back_inserter(output), 10) == 0);
+    for (int i = 0; i < 16; ++i) {
+        assert(output[i] == i);
+    }
+
+    // 仅部分空闲时批量操作返回实际数量
+    assert(q.try_push_n(input.begin(), 10) == 10);
+    int value;
+    assert(q.try_pop(value) && value == 0);
+    assert(q.try_push_n(input.begin(), 10) == 7);
+    std::cout << "try_push_n/try_pop_n: OK" << std::endl;
+
+    mys::mpmc_queue<std::unique_ptr<std::string>> owners(4);
+    std::vector<std::unique_ptr<std::string>> items;
+    items.push_back(std::make_unique<std::string>("a"));
+    items.push_back(std::make_unique<std::string>("b"));
+    assert(owners.try_push_n(std::make_move_iterator(items.begin()), items.size()) == 2);
+    std::unique_ptr<std::string> out;
+    assert(owners.try_pop(out) && *out == "a");
+    std::cout << "Move-only values: OK" << std::endl;
+}
+
+void test_concurrent() {
+    std::cout << "\n=== Testing concurrent producers/consumers ===" << std::endl;
+
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int per_producer = 50000;
+
+    mys::mpmc_queue<long long> q(1024);
+    std::atomic<long long> sum{0};
+    std::atomic<int> popped{0};
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            std::vector<long long> batch;
+            for (int i = 0; i < per_producer;) {
+                // 交替使用单个与批量接口
+                if (i % 3 == 0) {
+                    if (q.try_push(static_cast<long long>(p) * per_producer + i)) ++i;
+                    else std::this_thread::yield();
+                } else {
+                    batch.clear();
+                    for (int k = i; k < per_producer && k < i + 8; ++k) {
+                        batch.push_back(static_cast<long long>(p) * per_producer + k);
+                    }
+                    std::size_t n = q.try_push_n(batch.begin(), batch.size());
+                    if (n == 0) std::this_thread::yield();
+                    i += static_cast<int>(n);
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::vector<long long> batch;
+            while (popped.load() < producers * per_producer) {
+                batch.clear();
+                std::size_t n = q.try_pop_n(std::back_inserter(batch), 16);
+                if (n == 0) std::this_thread::yield();
+                for (long long v : batch) {
+                    sum += v;
+                }
+                popped += static_cast<int>(n);
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    long long total = static_cast<long long>(producers) * per_producer;
+    assert(popped.load() == total);
+    assert(sum.load() == total * (total - 1) / 2);
+    assert(q.empty_approx());
+    std::cout << "Every item delivered exactly once: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::mpmc_queue implementation..." << std::endl;
+
+    try {
+        test_single_thread();
+        test_bulk();
+        test_concurrent();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
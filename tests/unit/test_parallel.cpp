@@ -0,0 +1,160 @@
+#include "parallel.h"
+#include "forward_list.h"
+#include "list.h"
+#include "xor_list.h"
+#include <iostream>
+#include <cassert>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+template <typename Container>
+Container make_sequence(int n) {
+    Container c;
+    for (int i = 1; i <= n; ++i) {
+        c.push_back(i);
+    }
+    return c;
+}
+
+template <typename Container>
+void check_algorithms(const char *name) {
+    // 覆盖空表、不足一个块、恰好整块和带零头的情况
+    for (int n : {0, 1, 7, 64, 1000}) {
+        Container c;
+        if constexpr (requires { c.push_back(1); }) {
+            c = make_sequence<Container>(n);
+        } else {
+            for (int i = n; i >= 1; --i) {
+                c.push_front(i);
+            }
+        }
+        const long long expected = static_cast<long long>(n) * (n + 1) / 2;
+
+        for (std::size_t threads : {1u, 3u, 8u}) {
+            mys::parallel::options opts{threads, 16};
+            assert(mys::parallel::reduce(c, 0LL, std::plus<>{}, opts) == expected);
+            assert(mys::parallel::transform_reduce(c, 0LL, std::plus<>{}, [](int v) { return 2LL * v; }, opts) ==
+                   2 * expected);
+            assert(mys::parallel::count_if(c, [](int v) { return v % 2 == 0; }, opts) == static_cast<std::size_t>(n / 2));
+
+            Container copy = c;
+            mys::parallel::for_each(copy, [](int &v) { v *= 3; }, opts);
+            int i = 1;
+            for (int v : copy) {
+                assert(v == 3 * i++);
+            }
+        }
+    }
+    std::cout << name << " for_each/reduce/transform_reduce/count_if: OK" << std::endl;
+}
+
+void test_algorithms() {
+    std::cout << "\n=== Testing algorithms over each container ===" << std::endl;
+    check_algorithms<mys::list<int>>("list");
+    check_algorithms<mys::forward_list<int>>("forward_list");
+    check_algorithms<mys::tail_forward_list<int>>("tail_forward_list");
+    check_algorithms<mys::xor_list<int>>("xor_list");
+}
+
+void test_deterministic() {
+    std::cout << "\n=== Testing deterministic results ===" << std::endl;
+
+    // 字符串拼接满足结合律但不满足交换律，结果必须保持元素顺序
+    mys::list<std::string> words;
+    std::string expected;
+    for (int i = 0; i < 500; ++i) {
+        words.push_back(std::to_string(i) + ",");
+        expected += std::to_string(i) + ",";
+    }
+    for (std::size_t threads : {1u, 2u, 5u}) {
+        assert(mys::parallel::reduce(words, std::string(">"), std::plus<>{}, {threads, 7}) == ">" + expected);
+    }
+    std::cout << "Order of a non-commutative operation: OK" << std::endl;
+
+    // 浮点加法不满足结合律：块边界只由 grain 决定，任意线程数得到逐位相同的结果
+    mys::list<double> values;
+    for (int i = 0; i < 20000; ++i) {
+        values.push_back(1.0 / (i + 1));
+    }
+    double single = mys::parallel::reduce(values, 0.0, std::plus<>{}, {1, 256});
+    for (std::size_t threads : {2u, 3u, 7u}) {
+        for (int round = 0; round < 5; ++round) {
+            assert(mys::parallel::reduce(values, 0.0, std::plus<>{}, {threads, 256}) == single);
+        }
+    }
+    std::cout << "Floating point sum independent of thread count: OK" << std::endl;
+}
+
+void test_chunk_index() {
+    std::cout << "\n=== Testing maintained chunk index ===" << std::endl;
+
+    mys::list<int> l = make_sequence<mys::list<int>>(100);
+    mys::parallel::chunk_index index(l, 10);
+    assert(index.chunks() == 10);
+    assert(*index.chunk_begin(3) == 31);
+    assert(index.chunk_end(9) == l.end());
+
+    // 两端的增删和块内部的插入都会被后续调用看到
+    l.push_front(0);
+    l.push_back(101);
+    l.insert(std::next(l.begin(), 50), 1000);
+    l.pop_front();
+    assert(mys::parallel::reduce(index, 0, std::plus<>{}, {4}) == 5050 + 101 + 1000);
+    assert(mys::parallel::count_if(index, [](int v) { return v > 100; }, {4}) == 2);
+
+    index.rebuild();
+    assert(index.chunks() == 11);
+    std::cout << "Index survives insertions away from its boundaries: OK" << std::endl;
+
+    // 第一个块被删空
+    mys::list<int> small = make_sequence<mys::list<int>>(20);
+    mys::parallel::chunk_index small_index(small, 10);
+    for (int i = 0; i < 10; ++i) {
+        small.pop_front();
+    }
+    assert(small_index.chunk_begin(0) == small_index.chunk_end(0));
+    assert(mys::parallel::reduce(small_index, 0, std::plus<>{}, {2}) == 155);
+    small.clear();
+    mys::parallel::chunk_index empty_index(small, 10);
+    assert(empty_index.chunks() == 0);
+    assert(mys::parallel::reduce(empty_index, 42) == 42);
+    std::cout << "Empty chunks and empty containers: OK" << std::endl;
+}
+
+void test_exception() {
+    std::cout << "\n=== Testing exception propagation ===" << std::endl;
+
+    mys::list<int> l = make_sequence<mys::list<int>>(1000);
+    bool caught = false;
+    try {
+        mys::parallel::for_each(l, [](int &v) {
+            if (v == 500) throw std::runtime_error("boom");
+        }, {4, 10});
+    } catch (const std::runtime_error &) {
+        caught = true;
+    }
+    assert(caught);
+    std::cout << "Exception rethrown after all threads joined: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::parallel algorithms..." << std::endl;
+
+    try {
+        test_algorithms();
+        test_deterministic();
+        test_chunk_index();
+        test_exception();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
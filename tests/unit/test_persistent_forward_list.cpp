@@ -0,0 +1,211 @@
+#include "persistent_forward_list.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 统计存活对象个数，检查共享节点最终都被释放且只释放一次
+struct Counted {
+    int value;
+    static std::atomic<int> live;
+
+    Counted(int v) : value(v) { ++live; }
+    Counted(const Counted &other) : value(other.value) { ++live; }
+    ~Counted() { --live; }
+
+    bool operator==(const Counted &other) const { return value == other.value; }
+};
+
+std::atomic<int> Counted::live{0};
+
+template <typename List>
+std::vector<int> values_of(const List &list) {
+    std::vector<int> out;
+    for (const auto &item : list) {
+        out.push_back(item.value);
+    }
+    return out;
+}
+
+void test_basic_operations() {
+    std::cout << "\n=== Testing basic operations ===" << std::endl;
+
+    mys::persistent_forward_list<std::string> list;
+    assert(list.empty() && list.size() == 0 && list.begin() == list.end());
+
+    list.push_front("c");
+    list.push_front(std::string("b"));
+    list.emplace_front(1, 'a');
+    assert(list.size() == 3 && list.front() == "a");
+    assert((std::vector<std::string>(list.begin(), list.end()) == std::vector<std::string>{"a", "b", "c"}));
+
+    list.pop_front();
+    assert(list.size() == 2 && list.front() == "b");
+    list.clear();
+    assert(list.empty());
+
+    // 与其他链表一致：空表 pop_front 什么也不做，front 抛出异常
+    list.pop_front();
+    assert(list.empty() && list.size() == 0);
+    bool threw = false;
+    try {
+        (void)list.front();
+    } catch (const std::out_of_range &) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "push_front / pop_front / clear: OK" << std::endl;
+
+    mys::persistent_forward_list<int> numbers{1, 2, 3};
+    std::vector<int> source{1, 2, 3, 4};
+    mys::persistent_forward_list<int> longer(source.begin(), source.end());
+    assert(numbers.size() == 3 && longer.size() == 4);
+    assert(numbers < longer && numbers != longer);
+    longer.pop_front();
+    assert(longer > numbers);
+    std::cout << "Construction from ranges and comparison: OK" << std::endl;
+}
+
+void test_structural_sharing() {
+    std::cout << "\n=== Testing structural sharing ===" << std::endl;
+
+    mys::persistent_forward_list<int> v1{3, 2, 1};
+    mys::persistent_forward_list<int> snapshot = v1;
+    // 拷贝不复制节点
+    assert(snapshot.shares_with(v1) && &snapshot.front() == &v1.front());
+
+    // 新版本在共享的尾部前面加节点，旧版本不受影响
+    mys::persistent_forward_list<int> v2 = v1;
+    v2.push_front(4);
+    assert(!v2.shares_with(v1));
+    assert(&*std::next(v2.begin()) == &v1.front());
+    assert((std::vector<int>(v1.begin(), v1.end()) == std::vector<int>{3, 2, 1}));
+    assert((std::vector<int>(v2.begin(), v2.end()) == std::vector<int>{4, 3, 2, 1}));
+
+    // pop_front 只是跨过共享的首节点
+    mys::persistent_forward_list<int> v3 = v1;
+    v3.pop_front();
+    assert(&v3.front() == &*std::next(v1.begin()));
+    assert(v1.size() == 3 && v3.size() == 2);
+
+    // 长度相同、共享尾部的两个版本只比较到共享的节点为止
+    mys::persistent_forward_list<int> v4 = v3;
+    v4.push_front(3);
+    assert(v4 == v1 && !v4.shares_with(v1));
+    assert((v4 <=> v1) == std::strong_ordering::equal);
+    std::cout << "Copies share nodes and versions share tails: OK" << std::endl;
+}
+
+void test_lifetime() {
+    std::cout << "\n=== Testing node lifetime ===" << std::endl;
+
+    {
+        mys::persistent_forward_list<Counted> base;
+        for (int i = 0; i < 10; ++i) {
+            base.emplace_front(i);
+        }
+        assert(Counted::live == 10);
+
+        mys::persistent_forward_list<Counted> a = base;
+        a.pop_front();
+        a.pop_front();
+        a.emplace_front(100);
+        assert(Counted::live == 11);
+
+        // base 放手后，只被 base 持有的前两个节点被释放
+        base.clear();
+        assert(Counted::live == 9);
+        assert((values_of(a) == std::vector<int>{100, 7, 6, 5, 4, 3, 2, 1, 0}));
+
+        // 独占的首节点弹出时直接释放
+        a.pop_front();
+        assert(Counted::live == 8);
+
+        mys::persistent_forward_list<Counted> b = a;
+        b = std::move(a);
+        assert(a.empty() && Counted::live == 8);
+        mys::persistent_forward_list<Counted> c;
+        c = b;
+        c.pop_front();
+        swap(b, c);
+        assert(b.size() == 7 && c.size() == 8 && Counted::live == 8);
+    }
+    assert(Counted::live == 0);
+    std::cout << "Nodes are freed once, when the last version lets go: OK" << std::endl;
+
+    // 逐层递归释放会在百万级链表上栈溢出；这里必须是循环
+    {
+        mys::persistent_forward_list<int> chain;
+        for (int i = 0; i < 2000000; ++i) {
+            chain.push_front(i);
+        }
+        mys::persistent_forward_list<int> tail = chain;
+        for (int i = 0; i < 1000; ++i) {
+            tail.pop_front();
+        }
+        chain.clear();
+        assert(tail.size() == 1999000 && tail.front() == 1998999);
+    }
+    std::cout << "Destroying a 2000000-node chain: OK" << std::endl;
+}
+
+void test_shared_snapshots() {
+    std::cout << "\n=== Testing snapshots shared between threads ===" << std::endl;
+
+    // 每个线程不断从同一个基础版本取快照、修改、丢弃，计数必须是原子的
+    {
+        mys::shared_persistent_forward_list<Counted> base;
+        for (int i = 0; i < 1000; ++i) {
+            base.emplace_front(i);
+        }
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&base, t] {
+                mys::shared_persistent_forward_list<Counted> kept;
+                for (int round = 0; round < 2000; ++round) {
+                    mys::shared_persistent_forward_list<Counted> snapshot = base;
+                    for (int i = 0; i <= round % 7; ++i) {
+                        snapshot.pop_front();
+                    }
+                    snapshot.emplace_front(t);
+                    assert(snapshot.size() == std::size_t(1000 - round % 7));
+                    if (round % 3 == 0) {
+                        kept = snapshot;
+                    }
+                }
+                assert(kept.front().value == t);
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        assert(Counted::live == 1000);
+    }
+    assert(Counted::live == 0);
+    std::cout << "Concurrent copies and pops free every node once: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::persistent_forward_list implementation..." << std::endl;
+
+    try {
+        test_basic_operations();
+        test_structural_sharing();
+        test_lifetime();
+        test_shared_snapshots();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,241 @@
+#include "pool_allocator.h"
+#include "list.h"
+#include "forward_list.h"
+#include <iostream>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <set>
+#include <vector>
+
+// 统计构造/析构次数的测试类型（非平凡析构，走逐个销毁路径）
+struct Tracked {
+    static inline int alive = 0;
+    int value;
+
+    Tracked(int v = 0) : value(v) { ++alive; }
+    Tracked(const Tracked &other) : value(other.value) { ++alive; }
+    Tracked(Tracked &&other) noexcept : value(other.value) { ++alive; }
+    Tracked &operator=(const Tracked &) = default;
+    Tracked &operator=(Tracked &&) noexcept = default;
+    ~Tracked() { --alive; }
+};
+
+void test_allocate_and_reuse() {
+    std::cout << "\n=== Testing allocate/deallocate ===" << std::endl;
+
+    mys::pool_allocator<int> alloc;
+    int *a = alloc.allocate(1);
+    int *b = alloc.allocate(1);
+    assert(a != b);
+    *a = 1;
+    *b = 2;
+
+    // 释放后的槽位应被立即复用
+    alloc.deallocate(a, 1);
+    int *c = alloc.allocate(1);
+    assert(c == a);
+    alloc.deallocate(b, 1);
+    alloc.deallocate(c, 1);
+    std::cout << "Free list reuse: OK" << std::endl;
+
+    // 跨越多个 slab 的分配互不重叠
+    mys::pool_allocator<int, 64> small;
+    std::set<int *> seen;
+    for (int i = 0; i < 100; ++i) {
+        int *p = small.allocate(1);
+        assert(seen.insert(p).second);
+    }
+    assert(small.release());
+    std::cout << "Multiple slabs: OK" << std::endl;
+
+    // n > 1 走 std::allocator
+    int *arr = alloc.allocate(8);
+    arr[7] = 7;
+    alloc.deallocate(arr, 8);
+    std::cout << "Array allocation fallback: OK" << std::endl;
+}
+
+void test_equality_and_release() {
+    std::cout << "\n=== Testing equality and release ===" << std::endl;
+
+    mys::pool_allocator<int> a;
+    (void)a.allocate(1);
+    mys::pool_allocator<int> b(a);
+    assert(a == b);
+    // 池被共享时不允许整体释放
+    assert(!a.release());
+
+    mys::pool_allocator<int> c;
+    assert(!(a == c));
+
+    // rebind 共享同一个资源：A a(b); B(a) == b
+    mys::pool_allocator<double> d(a);
+    assert(d == a && a == d);
+    assert(mys::pool_allocator<int>(d) == a);
+    assert(!d.release());
+    // 不同元素类型各用自己规格的子池，rebind 回来的分配器能释放原分配器的内存
+    double *x = d.allocate(1);
+    mys::pool_allocator<double> d2{mys::pool_allocator<int>(d)};
+    d2.deallocate(x, 1);
+    assert(d.allocate(1) == x);
+
+    // 首次分配之前拷贝的分配器也共享同一个池，可以互相释放
+    mys::pool_allocator<int> e;
+    mys::pool_allocator<int> f = e;
+    assert(e == f);
+    int *p = e.allocate(1);
+    f.deallocate(p, 1);
+    assert(e.allocate(1) == p);
+    std::cout << "Equality and shared release: OK" << std::endl;
+}
+
+void test_with_list() {
+    std::cout << "\n=== Testing mys::list with pool_allocator ===" << std::endl;
+
+    mys::list<int, mys::pool_allocator<int>> l;
+    for (int i = 0; i < 1000; ++i) {
+        l.push_back(i);
+    }
+    assert(l.size() == 1000);
+    assert(l.front() == 0);
+    assert(l.back() == 999);
+
+    // clear 走整体释放路径，之后仍可继续使用
+    l.clear();
+    assert(l.empty());
+    l.push_front(5);
+    assert(l.front() == 5);
+
+    // 移动赋值时池随节点一起转移
+    mys::list<int, mys::pool_allocator<int>> other;
+    other.push_back(1);
+    other.push_back(2);
+    l = std::move(other);
+    assert(l.size() == 2);
+    assert(l.back() == 2);
+
+    // 非平凡析构类型逐个析构
+    {
+        mys::list<Tracked, mys::pool_allocator<Tracked>> tl;
+        for (int i = 0; i < 100; ++i) {
+            tl.emplace_back(i);
+        }
+        assert(Tracked::alive == 100);
+        tl.clear();
+        assert(Tracked::alive == 0);
+        tl.emplace_back(1);
+    }
+    assert(Tracked::alive == 0);
+    std::cout << "list with pool_allocator: OK" << std::endl;
+}
+
+void test_with_forward_list() {
+    std::cout << "\n=== Testing mys::forward_list with pool_allocator ===" << std::endl;
+
+    mys::forward_list<std::string, mys::pool_allocator<std::string>> fl;
+    fl.push_front("world");
+    fl.push_front("hello");
+    assert(fl.front() == "hello");
+
+    mys::forward_list<int, mys::pool_allocator<int>> a;
+    mys::forward_list<int, mys::pool_allocator<int>> b;
+    for (int i = 0; i < 10; ++i) {
+        a.push_front(i);
+        b.push_front(i * 10);
+    }
+    a.swap(b);
+    assert(a.front() == 90);
+    assert(b.front() == 9);
+
+    mys::forward_list<int, mys::pool_allocator<int>> c(std::move(a));
+    assert(c.size() == 10);
+    c.clear();
+    assert(c.empty());
+    std::cout << "forward_list with pool_allocator: OK" << std::endl;
+}
+
+void test_splice_and_merge() {
+    std::cout << "\n=== Testing splice/merge between pool-backed lists ===" << std::endl;
+
+    using List = mys::list<int, mys::pool_allocator<int>>;
+    using FList = mys::forward_list<int, mys::pool_allocator<int>>;
+    auto values = [](const auto &l) { return std::vector<int>(l.begin(), l.end()); };
+
+    // 共享同一个分配器的两个链表可以互相转移节点；先析构提供节点的一方也不影响另一方
+    mys::pool_allocator<int> shared;
+    List a(shared);
+    assert(a.get_allocator() == shared);
+    {
+        List b(shared);
+        a.assign({1, 3, 5});
+        b.assign({2, 4, 6, 7});
+        a.merge(b);
+        assert(b.empty());
+        b.assign({8, 9});
+        a.splice(a.end(), b);
+        b.push_back(0);
+        a.splice(a.begin(), b, b.begin());
+        assert(b.empty());
+    }
+    assert((values(a) == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    a.clear();
+    a.push_back(42);
+    assert(a.front() == 42);
+
+    FList fa(shared);
+    {
+        FList fb(shared);
+        fa.assign({1, 4});
+        fb.assign({2, 3});
+        fa.merge(fb);
+        fb.assign({5, 6});
+        fa.splice_after(fa.cbefore_begin(), fb);
+    }
+    assert((values(fa) == std::vector<int>{5, 6, 1, 2, 3, 4}));
+
+    // 各自默认构造的分配器不相等：节点不能跨池转移，拒绝并保持两表不变
+    List c{1, 2};
+    List d{3};
+    auto rejected = [](auto &&op) {
+        try {
+            op();
+        } catch (const std::invalid_argument &) {
+            return true;
+        }
+        return false;
+    };
+    assert(rejected([&] { c.splice(c.end(), d); }));
+    assert(rejected([&] { c.splice(c.end(), d, d.begin()); }));
+    assert(rejected([&] { c.merge(d); }));
+    assert((values(c) == std::vector<int>{1, 2}) && (values(d) == std::vector<int>{3}));
+
+    FList fc{1};
+    FList fd{2, 3};
+    assert(rejected([&] { fc.splice_after(fc.cbefore_begin(), fd); }));
+    assert(rejected([&] { fc.splice_after(fc.cbefore_begin(), fd, fd.cbegin(), fd.cend()); }));
+    assert(rejected([&] { fc.merge(fd); }));
+    assert((values(fc) == std::vector<int>{1}) && (values(fd) == std::vector<int>{2, 3}));
+    std::cout << "Equal allocators relink, unequal ones are rejected: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::pool_allocator implementation..." << std::endl;
+
+    try {
+        test_allocate_and_reuse();
+        test_equality_and_release();
+        test_with_list();
+        test_with_forward_list();
+        test_splice_and_merge();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include "skip_list.h"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+void test_basic_operations() {
+    std::cout << "\n=== Testing basic operations ===" << std::endl;
+
+    mys::skip_list<int> s;
+    assert(s.empty() && s.size() == 0 && s.levels() == 1);
+    assert(s.begin() == s.end());
+    assert(s.find(1) == s.end());
+
+    for (int v : {5, 1, 9, 3, 7}) {
+        auto [it, inserted] = s.insert(v);
+        assert(inserted && *it == v);
+    }
+    auto [dup, inserted] = s.insert(3);
+    assert(!inserted && *dup == 3);
+    assert(s.size() == 5);
+
+    std::vector<int> order(s.begin(), s.end());
+    assert((order == std::vector<int>{1, 3, 5, 7, 9}));
+    assert(s.front() == 1);
+    std::cout << "Insert keeps the keys sorted and unique: OK" << std::endl;
+
+    assert(*s.lower_bound(4) == 5);
+    assert(*s.lower_bound(5) == 5);
+    assert(*s.upper_bound(5) == 7);
+    assert(s.lower_bound(10) == s.end());
+    assert(s.contains(7) && !s.contains(8));
+    assert(s.count(9) == 1 && s.count(0) == 0);
+    std::cout << "find / lower_bound / upper_bound: OK" << std::endl;
+
+    assert(s.erase(1) == 1);
+    assert(s.erase(1) == 0);
+    auto next = s.erase(s.find(5));
+    assert(*next == 7);
+    assert((std::vector<int>(s.begin(), s.end()) == std::vector<int>{3, 7, 9}));
+    std::cout << "Erase by key and by iterator: OK" << std::endl;
+}
+
+void test_against_std_set() {
+    std::cout << "\n=== Testing random operations against std::set ===" << std::endl;
+
+    // 随机插入、删除、查找，每一步都与 std::set 对照
+    mys::skip_list<int> s;
+    std::set<int> ref;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> key(0, 2000);
+    for (int i = 0; i < 20000; ++i) {
+        int k = key(gen);
+        switch (gen() % 3) {
+        case 0:
+            assert(s.insert(k).second == ref.insert(k).second);
+            break;
+        case 1:
+            assert(s.erase(k) == ref.erase(k));
+            break;
+        default: {
+            auto it = s.lower_bound(k);
+            auto rit = ref.lower_bound(k);
+            assert((it == s.end()) == (rit == ref.end()));
+            if (it != s.end()) assert(*it == *rit);
+        }
+        }
+    }
+    assert(s.size() == ref.size());
+    assert(std::equal(s.begin(), s.end(), ref.begin(), ref.end()));
+    std::cout << "Matches std::set after 20000 random operations: OK" << std::endl;
+}
+
+void test_copy_move_and_compare() {
+    std::cout << "\n=== Testing copy, move and comparator ===" << std::endl;
+
+    mys::skip_list<std::string, std::greater<std::string>> s{"b", "d", "a", "c"};
+    assert((std::vector<std::string>(s.begin(), s.end()) == std::vector<std::string>{"d", "c", "b", "a"}));
+    assert(s.emplace(3, 'e').second);
+    assert(s.front() == "eee");
+
+    mys::skip_list<std::string, std::greater<std::string>> copy(s);
+    assert(copy == s);
+    copy.erase("eee");
+    assert(!(copy == s));
+
+    mys::skip_list<std::string, std::greater<std::string>> moved(std::move(copy));
+    assert(copy.empty() && moved.size() == 4);
+    copy = moved;
+    assert(copy == moved);
+    moved = std::move(copy);
+    assert(moved.size() == 4);
+    swap(moved, s);
+    assert(s.size() == 4 && moved.size() == 5);
+    std::cout << "Copy, move, swap and operator==: OK" << std::endl;
+}
+
+void test_deterministic_heights() {
+    std::cout << "\n=== Testing the seedable level generator ===" << std::endl;
+
+    // 相同种子、相同操作得到相同的塔高；塔高约为 log4(n)
+    auto build = [](std::uint64_t seed) {
+        mys::skip_list<int> s;
+        s.seed(seed);
+        for (int i = 0; i < 100000; ++i) {
+            s.insert(i * 7919 % 100003);
+        }
+        return s;
+    };
+    mys::skip_list<int> a = build(1);
+    mys::skip_list<int> b = build(1);
+    assert(a.levels() == b.levels());
+    assert(a.levels() >= 6 && a.levels() <= 16);
+    std::cout << "Levels for 100000 keys: " << a.levels() << " (same for the same seed): OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::skip_list implementation..." << std::endl;
+
+    try {
+        test_basic_operations();
+        test_against_std_set();
+        test_copy_move_and_compare();
+        test_deterministic_heights();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
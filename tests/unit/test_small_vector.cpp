@@ -0,0 +1,196 @@
+#include "small_vector.h"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <memory>
+
+// 计数分配器：记录经过分配器的次数，用来验证内联存储不触发分配
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    static inline int allocations = 0;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U> &) noexcept {}
+
+    T *allocate(std::size_t n) {
+        ++allocations;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept { std::allocator<T>().deallocate(p, n); }
+
+    friend bool operator==(const CountingAllocator &, const CountingAllocator &) { return true; }
+};
+
+// 带状态、移动赋值时不传播的分配器：每个默认构造的实例有独立的 id，
+// 只能释放同一 id 分配的内存，live 记录各 id 尚未归还的块数
+template <typename T>
+struct TaggedAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    static inline int next_id = 0;
+    static inline int live[16] = {};
+    int id;
+
+    TaggedAllocator() : id(next_id++ % 16) {}
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U> &other) noexcept : id(other.id) {}
+
+    T *allocate(std::size_t n) {
+        ++live[id];
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept {
+        --live[id];
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(const TaggedAllocator &lhs, const TaggedAllocator &rhs) { return lhs.id == rhs.id; }
+};
+
+// 统计存活对象数的非平凡类型
+struct Tracked {
+    static inline int alive = 0;
+    int value;
+
+    Tracked(int v = 0) : value(v) { ++alive; }
+    Tracked(const Tracked &other) : value(other.value) { ++alive; }
+    Tracked(Tracked &&other) noexcept : value(other.value) { ++alive; }
+    Tracked &operator=(const Tracked &) = default;
+    Tracked &operator=(Tracked &&) noexcept = default;
+    ~Tracked() { --alive; }
+};
+
+static_assert(std::contiguous_iterator<mys::small_vector<int>::iterator>);
+
+void test_inline_storage() {
+    std::cout << "\n=== Testing inline storage ===" << std::endl;
+
+    CountingAllocator<int>::allocations = 0;
+    mys::small_vector<int, 4, CountingAllocator<int>> v;
+    assert(v.is_inline());
+    assert(v.capacity() == 4);
+
+    for (int i = 0; i < 4; ++i) {
+        v.push_back(i);
+    }
+    assert(v.is_inline());
+    assert(CountingAllocator<int>::allocations == 0);
+    std::cout << "No allocation within N: OK" << std::endl;
+
+    // 第 N+1 个元素溢出到堆上
+    v.push_back(4);
+    assert(!v.is_inline());
+    assert(CountingAllocator<int>::allocations == 1);
+    for (int i = 0; i < 5; ++i) {
+        assert(v[i] == i);
+    }
+    std::cout << "Spill to heap: OK" << std::endl;
+
+    // 缩回 N 以内后 shrink_to_fit 回到内联缓冲区
+    v.pop_back();
+    v.shrink_to_fit();
+    assert(v.is_inline());
+    assert(v.size() == 4 && v.back() == 3);
+    std::cout << "shrink_to_fit back to inline: OK" << std::endl;
+}
+
+void test_move_and_swap() {
+    std::cout << "\n=== Testing move and swap ===" << std::endl;
+
+    // 内联状态：逐个重定位元素
+    mys::small_vector<std::string, 4> a{"x", "y"};
+    mys::small_vector<std::string, 4> b(std::move(a));
+    assert(a.empty());
+    assert(b.size() == 2 && b[1] == "y");
+    assert(b.is_inline());
+
+    // 堆状态：直接接管缓冲区
+    mys::small_vector<std::string, 2> c{"1", "2", "3"};
+    assert(!c.is_inline());
+    const std::string *data = c.data();
+    mys::small_vector<std::string, 2> d(std::move(c));
+    assert(d.data() == data);
+    assert(c.empty() && c.is_inline());
+    std::cout << "Move construction: OK" << std::endl;
+
+    // 一个内联、一个在堆上的交换
+    mys::small_vector<std::string, 2> e{"e"};
+    swap(d, e);
+    assert(d.size() == 1 && d[0] == "e");
+    assert(e.size() == 3 && e.data() == data);
+
+    d = std::move(e);
+    assert(d.size() == 3 && d[2] == "3");
+    assert(e.empty());
+
+    e = d;
+    assert(e == d);
+    std::cout << "Swap and assignment: OK" << std::endl;
+
+    // 分配器不相等且不传播：不能接管对方的堆缓冲区，只能逐个移动元素
+    {
+        using Tagged = mys::small_vector<std::string, 2, TaggedAllocator<std::string>>;
+        Tagged f{"1", "2", "3"};
+        Tagged g;
+        assert(!f.is_inline());
+        const std::string *heap = f.data();
+        g = std::move(f);
+        assert(g.size() == 3 && g[2] == "3");
+        assert(g.data() != heap);
+        assert(f.empty());
+    }
+    for (int count : TaggedAllocator<std::string>::live) {
+        assert(count == 0);
+    }
+    std::cout << "Move assignment with unequal allocators: OK" << std::endl;
+}
+
+void test_modifiers() {
+    std::cout << "\n=== Testing modifiers ===" << std::endl;
+
+    {
+        mys::small_vector<Tracked, 3> v;
+        for (int i = 0; i < 10; ++i) {
+            v.emplace_back(i);
+        }
+        v.insert(v.begin(), Tracked(-1));
+        v.erase(v.begin() + 1, v.begin() + 4);
+        assert(v.size() == 8);
+        assert(v[0].value == -1 && v[1].value == 3);
+        v.resize(2);
+        v.shrink_to_fit();
+        assert(v.is_inline());
+        assert(Tracked::alive == 2);
+    }
+    assert(Tracked::alive == 0);
+
+    mys::small_vector<int, 8> v{1, 2, 3};
+    v.insert(v.begin() + 1, 2, 9);
+    assert((v == mys::small_vector<int, 8>{1, 9, 9, 2, 3}));
+    assert(v.is_inline());
+
+    mys::small_vector<int, 8> w{1, 9, 9, 3};
+    assert(v < w);
+    std::cout << "insert/erase/resize: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::small_vector implementation..." << std::endl;
+
+    try {
+        test_inline_storage();
+        test_move_and_swap();
+        test_modifiers();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "spsc_ring.h"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+
+void test_single_thread() {
+    std::cout << "\n=== Testing single-threaded semantics ===" << std::endl;
+
+    mys::spsc_ring<int> ring(3);
+    assert(ring.capacity() == 4);
+    assert(ring.empty_approx());
+
+    for (int i = 0; i < 4; ++i) {
+        assert(ring.try_push(i));
+    }
+    assert(!ring.try_push(4));
+    assert(ring.size_approx() == 4);
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        assert(ring.try_pop(value) && value == i);
+    }
+    assert(!ring.try_pop(value));
+    std::cout << "Full/empty and FIFO order: OK" << std::endl;
+
+    mys::spsc_ring<std::string> strings(2);
+    for (int round = 0; round < 10; ++round) {
+        std::string s = "round " + std::to_string(round);
+        assert(strings.try_push(std::move(s)));
+        std::string out;
+        assert(strings.try_pop(out) && out == "round " + std::to_string(round));
+    }
+    std::cout << "Wrap-around with strings: OK" << std::endl;
+}
+
+void test_span_api() {
+    std::cout << "\n=== Testing reserve/commit and peek/release ===" << std::endl;
+
+    mys::spsc_ring<int> ring(8);
+
+    // 写入一批但未提交前对消费者不可见
+    auto slots = ring.reserve(5);
+    assert(slots.size() == 5);
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+        slots[i] = static_cast<int>(i);
+    }
+    assert(ring.peek(8).empty());
+    ring.commit(5);
+
+    auto ready = ring.peek(8);
+    assert(ready.size() == 5);
+    assert(ready[4] == 4);
+    ring.release(3);
+    std::cout << "Batch publish and consume: OK" << std::endl;
+
+    // 在环尾处 reserve 只返回到回绕点为止的连续区间
+    slots = ring.reserve(8);
+    assert(slots.size() == 3);
+    ring.commit(3);
+    slots = ring.reserve(8);
+    assert(slots.size() == 3);
+    ring.commit(3);
+    assert(ring.reserve(1).empty());
+
+    ready = ring.peek(8);
+    assert(ready.size() == 5);
+    ring.release(5);
+    ready = ring.peek(8);
+    assert(ready.size() == 3);
+    ring.release(3);
+    assert(ring.empty_approx());
+    std::cout << "Spans stop at the wrap point: OK" << std::endl;
+}
+
+void test_concurrent() {
+    std::cout << "\n=== Testing producer/consumer threads ===" << std::endl;
+
+    constexpr int total = 200000;
+    mys::spsc_ring<int> ring(256);
+
+    std::thread producer([&] {
+        int next = 0;
+        while (next < total) {
+            // 单个与批量写入交替
+            if (next % 2 == 0) {
+                if (ring.try_push(next)) ++next;
+                else std::this_thread::yield();
+                continue;
+            }
+            auto slots = ring.reserve(static_cast<std::size_t>(std::min(16, total - next)));
+            if (slots.empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (auto &slot : slots) {
+                slot = next++;
+            }
+            ring.commit(slots.size());
+        }
+    });
+
+    int expected = 0;
+    while (expected < total) {
+        auto ready = ring.peek(32);
+        if (ready.empty()) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (int v : ready) {
+            assert(v == expected);
+            ++expected;
+        }
+        ring.release(ready.size());
+    }
+    producer.join();
+    assert(ring.empty_approx());
+    std::cout << "Ordered delivery across threads: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::spsc_ring implementation..." << std::endl;
+
+    try {
+        test_single_thread();
+        test_span_api();
+        test_concurrent();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
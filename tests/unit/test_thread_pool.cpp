@@ -0,0 +1,129 @@
+#include "thread_pool.h"
+#include "parallel.h"
+#include "list.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+long long fib(mys::thread_pool &pool, int n) {
+    if (n < 12) {
+        return n < 2 ? n : fib(pool, n - 1) + fib(pool, n - 2);
+    }
+    long long a = 0;
+    mys::thread_pool::task_group group;
+    pool.spawn(group, [&] { a = fib(pool, n - 1); });
+    long long b = fib(pool, n - 2);
+    pool.wait(group);
+    return a + b;
+}
+
+void test_fork_join() {
+    std::cout << "\n=== Testing recursive fork/join ===" << std::endl;
+
+    for (std::size_t threads : {1u, 2u, 4u}) {
+        mys::thread_pool pool(threads);
+        assert(pool.size() == threads);
+        assert(fib(pool, 25) == 75025);
+    }
+    std::cout << "Nested spawn/wait from workers and the caller: OK" << std::endl;
+
+    // 外部线程一次提交大量小任务，任务组可以重复使用
+    mys::thread_pool pool(3);
+    mys::thread_pool::task_group group;
+    std::atomic<int> sum{0};
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 1; i <= 1000; ++i) {
+            pool.spawn(group, [&sum, i] { sum.fetch_add(i); });
+        }
+        pool.wait(group);
+        assert(group.done());
+        assert(sum.load() == 500500 * (round + 1));
+    }
+    std::cout << "Flat spawn from an outside thread, group reuse: OK" << std::endl;
+
+    // 多个外部线程同时使用同一个线程池
+    std::vector<std::thread> callers;
+    std::atomic<long long> total{0};
+    for (int c = 0; c < 3; ++c) {
+        callers.emplace_back([&] { total.fetch_add(fib(pool, 20)); });
+    }
+    for (auto &t : callers) {
+        t.join();
+    }
+    assert(total.load() == 3 * 6765);
+    std::cout << "Concurrent outside callers: OK" << std::endl;
+}
+
+void test_exception() {
+    std::cout << "\n=== Testing exception propagation ===" << std::endl;
+
+    mys::thread_pool pool(2);
+    mys::thread_pool::task_group group;
+    std::atomic<int> ran{0};
+    for (int i = 0; i < 100; ++i) {
+        pool.spawn(group, [&ran, i] {
+            ran.fetch_add(1);
+            if (i % 10 == 0) throw std::runtime_error("task failed");
+        });
+    }
+    bool caught = false;
+    try {
+        pool.wait(group);
+    } catch (const std::runtime_error &) {
+        caught = true;
+    }
+    assert(caught);
+    assert(ran.load() == 100);
+
+    // 异常被取走后任务组恢复正常
+    pool.spawn(group, [&ran] { ran.fetch_add(1); });
+    pool.wait(group);
+    assert(ran.load() == 101);
+    std::cout << "First exception rethrown, other tasks still run: OK" << std::endl;
+}
+
+void test_parallel_on_pool() {
+    std::cout << "\n=== Testing mys::parallel on a given pool ===" << std::endl;
+
+    mys::thread_pool pool(3);
+    mys::list<int> l;
+    for (int i = 1; i <= 10000; ++i) {
+        l.push_back(i);
+    }
+    mys::parallel::options opts{4, 100, &pool};
+    assert(mys::parallel::reduce(l, 0LL, std::plus<>{}, opts) == 50005000LL);
+    mys::parallel::chunk_index index(l, 100);
+    assert(mys::parallel::count_if(index, [](int v) { return v % 2 == 0; }, opts) == 5000);
+
+    // 在线程池的任务里再调用并行算法
+    mys::thread_pool::task_group group;
+    std::atomic<long long> nested{0};
+    for (int i = 0; i < 4; ++i) {
+        pool.spawn(group, [&] { nested.fetch_add(mys::parallel::reduce(l, 0LL, std::plus<>{}, opts)); });
+    }
+    pool.wait(group);
+    assert(nested.load() == 4 * 50005000LL);
+    std::cout << "Algorithms on an explicit pool, nested in tasks: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::thread_pool implementation..." << std::endl;
+
+    try {
+        test_fork_join();
+        test_exception();
+        test_parallel_on_pool();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,312 @@
+#include "unordered_map.h"
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+// tips.md 中 unordered_set 使用的自定义哈希写法
+struct TupleHash {
+    template <class T>
+    static void hash_combine(size_t &seed, const T &val) {
+        seed ^= std::hash<T>{}(val) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    size_t operator()(const std::tuple<int, int, int> &t) const {
+        size_t seed = 0;
+        auto &[a, b, c] = t;
+        hash_combine(seed, a);
+        hash_combine(seed, b);
+        hash_combine(seed, c);
+        return seed;
+    }
+};
+
+// 支持异构查找的字符串哈希
+struct StringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+};
+
+// 所有键都落在同一个位置的最差哈希
+struct ConstantHash {
+    size_t operator()(int) const { return 42; }
+};
+
+// 计数耗尽后抛异常的哈希，budget < 0 表示不限
+struct FlakyHash {
+    static inline int budget = -1;
+    size_t operator()(int key) const {
+        if (budget == 0) throw std::runtime_error("hash budget exhausted");
+        if (budget > 0) --budget;
+        return std::hash<int>{}(key);
+    }
+};
+
+// 移动可能抛异常，扩容时只能拷贝；第 copies_left 次之后的拷贝抛异常
+struct FragileValue {
+    static inline int copies_left = -1;
+    int value;
+    explicit FragileValue(int v) : value(v) {}
+    FragileValue(const FragileValue &other) : value(other.value) {
+        if (copies_left == 0) throw std::runtime_error("copy budget exhausted");
+        if (copies_left > 0) --copies_left;
+    }
+    FragileValue(FragileValue &&other) noexcept(false) : value(other.value) {}
+};
+
+void test_basic_operations() {
+    std::cout << "\n=== Testing basic operations ===" << std::endl;
+
+    mys::unordered_map<int, std::string> m;
+    assert(m.empty());
+    assert(m.find(1) == m.end());
+
+    auto [it, inserted] = m.insert({1, "one"});
+    assert(inserted && it->first == 1 && it->second == "one");
+    assert(!m.insert({1, "uno"}).second);
+    assert(m.at(1) == "one");
+
+    m[2] = "two";
+    m.emplace(3, "three");
+    m.try_emplace(4, 3, 'x');
+    assert(m.size() == 4);
+    assert(m[4] == "xxx");
+    assert(m.contains(3) && m.count(5) == 0);
+
+    m.insert_or_assign(1, "uno");
+    assert(m.at(1) == "uno");
+
+    bool thrown = false;
+    try {
+        (void)m.at(99);
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    assert(m.erase(2) == 1);
+    assert(m.erase(2) == 0);
+    assert(!m.contains(2));
+    assert(m.size() == 3);
+
+    std::size_t visited = 0;
+    for (const auto &[key, value] : m) {
+        assert(m.at(key) == value);
+        ++visited;
+    }
+    assert(visited == m.size());
+    std::cout << "insert/find/erase/iterate: OK" << std::endl;
+}
+
+void test_growth_and_reserve() {
+    std::cout << "\n=== Testing growth and reserve ===" << std::endl;
+
+    mys::unordered_map<int, int> m;
+    for (int i = 0; i < 10000; ++i) {
+        m[i] = i * 2;
+    }
+    assert(m.size() == 10000);
+    assert(m.load_factor() <= m.max_load_factor());
+    for (int i = 0; i < 10000; ++i) {
+        assert(m.at(i) == i * 2);
+    }
+
+    mys::unordered_map<int, int> r;
+    r.reserve(1000);
+    std::size_t buckets = r.bucket_count();
+    assert(buckets * 7 / 8 >= 1000);
+    for (int i = 0; i < 1000; ++i) {
+        r.emplace(i, i);
+    }
+    assert(r.bucket_count() == buckets);
+    std::cout << "Rehash on growth, no rehash after reserve: OK" << std::endl;
+}
+
+void test_tombstone_churn() {
+    std::cout << "\n=== Testing erase/insert churn ===" << std::endl;
+
+    // 固定规模下反复删除与插入，墓碑应被回收而不是无限扩容
+    mys::unordered_map<int, int> m;
+    m.reserve(1000);
+    std::size_t buckets = m.bucket_count();
+    for (int i = 0; i < 1000; ++i) {
+        m.emplace(i, i);
+    }
+    for (int i = 1000; i < 200000; ++i) {
+        assert(m.erase(i - 1000) == 1);
+        m.emplace(i, i);
+    }
+    assert(m.size() == 1000);
+    assert(m.bucket_count() == buckets);
+    for (int i = 199000; i < 200000; ++i) {
+        assert(m.at(i) == i);
+    }
+    std::cout << "Bucket count stays flat: OK" << std::endl;
+}
+
+void test_rehash_exception_safety() {
+    std::cout << "\n=== Testing rehash exception safety ===" << std::endl;
+
+    // 扩容途中哈希抛异常：旧表原样保留
+    mys::unordered_map<int, int, FlakyHash> m;
+    for (int i = 0; i < 100; ++i) {
+        m.emplace(i, i * 3);
+    }
+    std::size_t buckets = m.bucket_count();
+    FlakyHash::budget = 50;
+    bool threw = false;
+    try {
+        m.rehash(buckets * 4);
+    } catch (const std::runtime_error &) {
+        threw = true;
+    }
+    FlakyHash::budget = -1;
+    assert(threw);
+    assert(m.size() == 100);
+    assert(m.bucket_count() == buckets);
+    for (int i = 0; i < 100; ++i) {
+        assert(m.at(i) == i * 3);
+    }
+    for (int i = 100; i < 1000; ++i) {
+        m.emplace(i, i * 3);
+    }
+    assert(m.size() == 1000 && m.at(999) == 2997);
+    std::cout << "Throwing hash keeps every element: OK" << std::endl;
+
+    // 扩容途中元素拷贝抛异常：源元素未被移动，同样原样保留
+    mys::unordered_map<int, FragileValue> f;
+    for (int i = 0; i < 100; ++i) {
+        f.emplace(i, FragileValue(i));
+    }
+    buckets = f.bucket_count();
+    FragileValue::copies_left = 50;
+    threw = false;
+    try {
+        f.rehash(buckets * 4);
+    } catch (const std::runtime_error &) {
+        threw = true;
+    }
+    FragileValue::copies_left = -1;
+    assert(threw);
+    assert(f.size() == 100);
+    assert(f.bucket_count() == buckets);
+    for (int i = 0; i < 100; ++i) {
+        assert(f.at(i).value == i);
+    }
+    std::cout << "Throwing copy keeps every element: OK" << std::endl;
+}
+
+void test_custom_hashers() {
+    std::cout << "\n=== Testing custom hashers ===" << std::endl;
+
+    mys::unordered_map<std::tuple<int, int, int>, int, TupleHash> packets;
+    packets[{1, 2, 3}] = 7;
+    packets[{3, 2, 1}] = 8;
+    assert(packets.at({1, 2, 3}) == 7);
+    assert(packets.size() == 2);
+    std::cout << "TupleHash from tips.md: OK" << std::endl;
+
+    mys::unordered_map<std::string, int, StringHash, std::equal_to<>> words;
+    words["apple"] = 1;
+    words["banana"] = 2;
+    std::string_view key = "banana";
+    assert(words.find(key) != words.end());
+    assert(words.contains("apple"));
+    assert(words.count(std::string_view("cherry")) == 0);
+    assert(words.erase(key) == 1);
+    assert(!words.contains("banana"));
+    std::cout << "Heterogeneous lookup: OK" << std::endl;
+
+    mys::unordered_map<int, int, ConstantHash> clash;
+    for (int i = 0; i < 500; ++i) {
+        clash[i] = i;
+    }
+    for (int i = 0; i < 500; i += 2) {
+        clash.erase(i);
+    }
+    for (int i = 0; i < 500; ++i) {
+        assert(clash.contains(i) == (i % 2 == 1));
+    }
+    std::cout << "Constant hash: OK" << std::endl;
+}
+
+void test_copy_move_compare() {
+    std::cout << "\n=== Testing copy/move/compare ===" << std::endl;
+
+    mys::unordered_map<std::string, int> a{{"x", 1}, {"y", 2}, {"z", 3}};
+    mys::unordered_map<std::string, int> b(a);
+    assert(a == b);
+
+    b["y"] = 20;
+    assert(a != b);
+
+    mys::unordered_map<std::string, int> c(std::move(b));
+    assert(b.empty());
+    assert(c.at("y") == 20);
+
+    a = c;
+    assert(a == c);
+    c.clear();
+    assert(c.empty() && c.find("x") == c.end());
+    std::cout << "Copy/move/==: OK" << std::endl;
+}
+
+void test_random_against_std() {
+    std::cout << "\n=== Testing random operations against std::unordered_map ===" << std::endl;
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> key_dist(0, 5000);
+    mys::unordered_map<int, int> mine;
+    std::unordered_map<int, int> expected;
+
+    for (int step = 0; step < 100000; ++step) {
+        int key = key_dist(gen);
+        switch (gen() % 3) {
+        case 0:
+            mine[key] = step;
+            expected[key] = step;
+            break;
+        case 1:
+            assert(mine.erase(key) == expected.erase(key));
+            break;
+        default: {
+            auto it = mine.find(key);
+            auto jt = expected.find(key);
+            assert((it == mine.end()) == (jt == expected.end()));
+            if (jt != expected.end()) assert(it->second == jt->second);
+        }
+        }
+    }
+    assert(mine.size() == expected.size());
+    for (const auto &[key, value] : mine) {
+        assert(expected.at(key) == value);
+    }
+    std::cout << "Matches std::unordered_map: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::unordered_map implementation..." << std::endl;
+
+    try {
+        test_basic_operations();
+        test_growth_and_reserve();
+        test_tombstone_churn();
+        test_rehash_exception_safety();
+        test_custom_hashers();
+        test_copy_move_compare();
+        test_random_against_std();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,263 @@
+#include "unrolled_list.h"
+#include <iostream>
+#include <string>
+#include <cassert>
+#include <stdexcept>
+#include <list>
+#include <algorithm>
+
+// 统计存活对象数量的测试类型
+struct Counted {
+    static inline int alive = 0;
+    int value;
+
+    Counted(int v = 0) : value(v) { ++alive; }
+    Counted(const Counted &other) : value(other.value) { ++alive; }
+    Counted(Counted &&other) noexcept : value(other.value) { ++alive; }
+    Counted &operator=(const Counted &) = default;
+    Counted &operator=(Counted &&) noexcept = default;
+    ~Counted() { --alive; }
+
+    auto operator<=>(const Counted &) const = default;
+};
+
+template <typename L>
+bool same_as_std(const L &l, const std::list<int> &ref) {
+    return l.size() == ref.size() && std::equal(l.begin(), l.end(), ref.begin(), ref.end()) &&
+           std::equal(l.rbegin(), l.rend(), ref.rbegin(), ref.rend());
+}
+
+// 测试构造与赋值
+void test_constructors() {
+    std::cout << "Testing constructors...\n";
+    mys::unrolled_list<int, 4> empty;
+    assert(empty.empty());
+    assert(empty.begin() == empty.end());
+
+    mys::unrolled_list<int, 4> l{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    assert(l.size() == 9);
+    assert(l.front() == 1);
+    assert(l.back() == 9);
+
+    mys::unrolled_list<int, 4> copy(l);
+    assert(copy == l);
+    copy.push_back(10);
+    assert(l.size() == 9);
+
+    mys::unrolled_list<int, 4> moved(std::move(copy));
+    assert(moved.size() == 10);
+    assert(copy.empty());
+
+    mys::unrolled_list<int, 4> assigned;
+    assigned = l;
+    assert(assigned == l);
+    assigned = std::move(moved);
+    assert(assigned.size() == 10);
+    std::cout << "Constructors test passed.\n";
+}
+
+// 测试两端操作
+void test_push_pop() {
+    std::cout << "Testing push/pop...\n";
+    mys::unrolled_list<int, 4> l;
+    std::list<int> ref;
+    for (int i = 0; i < 20; ++i) {
+        l.push_back(i);
+        ref.push_back(i);
+        l.push_front(-i);
+        ref.push_front(-i);
+    }
+    assert(same_as_std(l, ref));
+
+    for (int i = 0; i < 15; ++i) {
+        l.pop_back();
+        ref.pop_back();
+        l.pop_front();
+        ref.pop_front();
+    }
+    assert(same_as_std(l, ref));
+
+    l.emplace_back(100);
+    l.emplace_front(-100);
+    assert(l.front() == -100);
+    assert(l.back() == 100);
+
+    mys::unrolled_list<int, 4> e;
+    try {
+        e.front();
+        assert(false);
+    } catch (const std::out_of_range &) {
+    }
+    std::cout << "Push/pop test passed.\n";
+}
+
+// 测试中间插入（触发节点分裂）
+void test_insert() {
+    std::cout << "Testing insert...\n";
+    mys::unrolled_list<int, 4> l;
+    std::list<int> ref;
+    for (int i = 0; i < 8; ++i) {
+        l.push_back(i);
+        ref.push_back(i);
+    }
+
+    for (int k = 0; k < 30; ++k) {
+        std::size_t pos = (k * 7) % (ref.size() + 1);
+        auto it = std::next(l.begin(), pos);
+        auto rit = std::next(ref.begin(), pos);
+        auto res = l.insert(it, 1000 + k);
+        ref.insert(rit, 1000 + k);
+        assert(*res == 1000 + k);
+        assert(static_cast<std::size_t>(std::distance(l.begin(), res)) == pos);
+    }
+    assert(same_as_std(l, ref));
+
+    // 插入容器自身的元素
+    l.insert(std::next(l.begin(), 2), l.front());
+    ref.insert(std::next(ref.begin(), 2), ref.front());
+    assert(same_as_std(l, ref));
+
+    auto it = l.emplace(l.end(), 42);
+    assert(*it == 42);
+    assert(l.back() == 42);
+    std::cout << "Insert test passed.\n";
+}
+
+// 构造时对负数抛异常的类型
+struct ThrowIfNegative {
+    int value;
+    ThrowIfNegative(int v) : value(v) {
+        if (v < 0) throw std::runtime_error("negative");
+    }
+};
+
+// 在新开节点中构造失败时不留下空节点
+void test_emplace_exception_safety() {
+    std::cout << "Testing emplace exception safety...\n";
+    mys::unrolled_list<ThrowIfNegative, 2> l;
+    l.emplace_back(1);
+    l.emplace_back(2);
+
+    // 尾节点已满，end() 处插入需要新节点
+    bool thrown = false;
+    try {
+        l.emplace_back(-1);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(l.size() == 2);
+    assert(l.back().value == 2);
+
+    // 首节点已满且在其开头插入，同样需要新节点
+    thrown = false;
+    try {
+        l.emplace(l.begin(), -1);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(l.size() == 2);
+    assert(l.front().value == 1);
+    assert(std::distance(l.begin(), l.end()) == 2);
+    assert(std::distance(l.rbegin(), l.rend()) == 2);
+
+    l.emplace_back(3);
+    assert(l.back().value == 3);
+    std::cout << "Emplace exception safety test passed.\n";
+}
+
+// 测试删除（触发节点合并）
+void test_erase() {
+    std::cout << "Testing erase...\n";
+    mys::unrolled_list<int, 4> l;
+    std::list<int> ref;
+    for (int i = 0; i < 40; ++i) {
+        l.push_back(i);
+        ref.push_back(i);
+    }
+
+    // 删除所有偶数
+    for (auto it = l.begin(); it != l.end();) {
+        it = (*it % 2 == 0) ? l.erase(it) : std::next(it);
+    }
+    ref.remove_if([](int x) { return x % 2 == 0; });
+    assert(same_as_std(l, ref));
+
+    // 范围删除
+    auto first = std::next(l.begin(), 3);
+    auto last = std::next(l.begin(), 12);
+    auto res = l.erase(first, last);
+    ref.erase(std::next(ref.begin(), 3), std::next(ref.begin(), 12));
+    assert(same_as_std(l, ref));
+    assert(*res == *std::next(ref.begin(), 3));
+
+    // 删除到空
+    l.erase(l.begin(), l.end());
+    assert(l.empty());
+
+    try {
+        l.erase(l.end());
+        assert(false);
+    } catch (const std::out_of_range &) {
+    }
+    std::cout << "Erase test passed.\n";
+}
+
+// 测试比较
+void test_comparison() {
+    std::cout << "Testing comparison...\n";
+    mys::unrolled_list<int> l1{1, 2, 3};
+    mys::unrolled_list<int> l2{1, 2, 3};
+    mys::unrolled_list<int> l3{1, 2, 4};
+    mys::unrolled_list<int> l4{1, 2};
+
+    assert(l1 == l2);
+    assert(l1 != l3);
+    assert((l1 <=> l3) == std::strong_ordering::less);
+    assert((l1 <=> l4) == std::strong_ordering::greater);
+    std::cout << "Comparison test passed.\n";
+}
+
+// 测试资源管理
+void test_resource_management() {
+    std::cout << "Testing resource management...\n";
+    {
+        mys::unrolled_list<Counted, 4> l;
+        for (int i = 0; i < 50; ++i) {
+            l.emplace_back(i);
+        }
+        for (int i = 0; i < 10; ++i) {
+            l.insert(std::next(l.begin(), 5), Counted(i));
+        }
+        for (int i = 0; i < 30; ++i) {
+            l.erase(std::next(l.begin(), i % l.size()));
+        }
+        assert(Counted::alive == static_cast<int>(l.size()));
+    }
+    assert(Counted::alive == 0);
+    std::cout << "Resource management test passed.\n";
+}
+
+int main() {
+    try {
+        std::cout << "Starting tests for mys::unrolled_list...\n\n";
+
+        test_constructors();
+        test_push_pop();
+        test_insert();
+        test_emplace_exception_safety();
+        test_erase();
+        test_comparison();
+        test_resource_management();
+
+        std::cout << "\nAll tests passed successfully!\n";
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
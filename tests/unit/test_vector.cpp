@@ -0,0 +1,282 @@
+#include "vector.h"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+
+// 只持有堆指针和长度的字符串，显式声明为可平凡重定位
+class HeapString {
+    char *data_ = nullptr;
+    std::size_t size_ = 0;
+
+public:
+    HeapString() = default;
+    HeapString(const char *s) : size_(std::strlen(s)) {
+        data_ = static_cast<char *>(std::malloc(size_ + 1));
+        std::memcpy(data_, s, size_ + 1);
+    }
+    HeapString(const HeapString &other) : HeapString(other.data_ ? other.data_ : "") {}
+    HeapString(HeapString &&other) noexcept : data_(other.data_), size_(other.size_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    HeapString &operator=(HeapString other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        return *this;
+    }
+    ~HeapString() { std::free(data_); }
+
+    bool operator==(const char *s) const { return data_ && std::strcmp(data_, s) == 0; }
+};
+
+template <>
+struct mys::is_trivially_relocatable<HeapString> : std::true_type {};
+
+// 带状态、移动赋值时不传播的分配器：每个默认构造的实例有独立的 id，
+// 只能释放同一 id 分配的内存，live 记录各 id 尚未归还的块数
+template <typename T>
+struct TaggedAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    static inline int next_id = 0;
+    static inline int live[16] = {};
+    int id;
+
+    TaggedAllocator() : id(next_id++ % 16) {}
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U> &other) noexcept : id(other.id) {}
+
+    T *allocate(std::size_t n) {
+        ++live[id];
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept {
+        --live[id];
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(const TaggedAllocator &lhs, const TaggedAllocator &rhs) { return lhs.id == rhs.id; }
+};
+
+// 统计存活对象数的非平凡类型，走 move + destroy 路径
+struct Tracked {
+    static inline int alive = 0;
+    int value;
+
+    Tracked(int v = 0) : value(v) { ++alive; }
+    Tracked(const Tracked &other) : value(other.value) { ++alive; }
+    Tracked(Tracked &&other) noexcept : value(other.value) { ++alive; }
+    Tracked &operator=(const Tracked &) = default;
+    Tracked &operator=(Tracked &&) noexcept = default;
+    ~Tracked() { --alive; }
+};
+
+static_assert(mys::is_trivially_relocatable_v<int>);
+static_assert(mys::is_trivially_relocatable_v<HeapString>);
+static_assert(!mys::is_trivially_relocatable_v<Tracked>);
+static_assert(std::contiguous_iterator<mys::vector<int>::iterator>);
+
+void test_basic_operations() {
+    std::cout << "\n=== Testing basic operations ===" << std::endl;
+
+    mys::vector<int> v;
+    assert(v.empty());
+    assert(v.capacity() == 0);
+
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(i);
+    }
+    assert(v.size() == 100);
+    assert(v.capacity() >= 100);
+    assert(v.front() == 0);
+    assert(v.back() == 99);
+    assert(v[50] == 50);
+    assert(v.at(99) == 99);
+    assert(v.data()[10] == 10);
+
+    bool thrown = false;
+    try {
+        (void)v.at(100);
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    v.pop_back();
+    assert(v.back() == 98);
+    std::cout << "push_back/access/pop_back: OK" << std::endl;
+
+    int &ref = v.emplace_back(7);
+    assert(&ref == &v.back());
+    std::cout << "emplace_back returns reference: OK" << std::endl;
+
+    // emplace_back 的参数引用自身元素，扩容时也必须安全
+    mys::vector<std::string> sv;
+    sv.push_back("self");
+    sv.shrink_to_fit();
+    sv.push_back(sv[0]);
+    assert(sv.size() == 2 && sv[1] == "self");
+    std::cout << "Self-referencing push_back: OK" << std::endl;
+}
+
+void test_constructors() {
+    std::cout << "\n=== Testing constructors ===" << std::endl;
+
+    mys::vector<int> a{1, 2, 3};
+    mys::vector<int> b(a);
+    assert(a == b);
+
+    mys::vector<int> c(std::move(b));
+    assert(c.size() == 3);
+    assert(b.empty());
+
+    mys::vector<int> d(4, 9);
+    assert(d.size() == 4 && d[3] == 9);
+
+    mys::vector<int> e(a.begin(), a.end());
+    assert(e == a);
+
+    mys::vector<std::string> f(3);
+    assert(f.size() == 3 && f[0].empty());
+
+    d = a;
+    assert(d == a);
+    d = std::move(c);
+    assert(d == a);
+    std::cout << "Constructors and assignment: OK" << std::endl;
+}
+
+void test_insert_erase() {
+    std::cout << "\n=== Testing insert/erase ===" << std::endl;
+
+    mys::vector<int> v{1, 2, 4, 5};
+    auto it = v.insert(v.begin() + 2, 3);
+    assert(*it == 3);
+    assert((v == mys::vector<int>{1, 2, 3, 4, 5}));
+
+    v.insert(v.begin(), 2, 0);
+    assert((v == mys::vector<int>{0, 0, 1, 2, 3, 4, 5}));
+
+    it = v.erase(v.begin(), v.begin() + 2);
+    assert(*it == 1);
+    it = v.erase(v.end() - 1);
+    assert(it == v.end());
+    assert((v == mys::vector<int>{1, 2, 3, 4}));
+
+    mys::vector<std::string> s{"a", "c"};
+    s.reserve(10);
+    s.emplace(s.begin() + 1, "b");
+    s.insert(s.begin(), s[2]);
+    assert(s.size() == 4);
+    assert(s[0] == "c" && s[1] == "a" && s[2] == "b" && s[3] == "c");
+    s.erase(s.begin() + 1);
+    assert(s[1] == "b");
+    std::cout << "insert/emplace/erase: OK" << std::endl;
+}
+
+void test_relocation_paths() {
+    std::cout << "\n=== Testing relocation paths ===" << std::endl;
+
+    {
+        mys::vector<HeapString> v;
+        for (int i = 0; i < 100; ++i) {
+            v.emplace_back("payload");
+        }
+        v.insert(v.begin() + 10, HeapString("middle"));
+        v.erase(v.begin());
+        assert(v[9] == "middle");
+        assert(v.back() == "payload");
+        v.shrink_to_fit();
+        assert(v.capacity() == v.size());
+    }
+    std::cout << "Trivially relocatable (memcpy) path: OK" << std::endl;
+
+    {
+        mys::vector<Tracked> v;
+        for (int i = 0; i < 100; ++i) {
+            v.emplace_back(i);
+        }
+        assert(Tracked::alive == 100);
+        v.insert(v.begin() + 1, 3, Tracked(-1));
+        assert(Tracked::alive == 103);
+        assert(v[2].value == -1 && v[4].value == 1);
+        v.erase(v.begin(), v.begin() + 50);
+        assert(Tracked::alive == 53);
+        v.resize(10);
+        assert(Tracked::alive == 10);
+        v.resize(20, Tracked(5));
+        assert(Tracked::alive == 20);
+    }
+    assert(Tracked::alive == 0);
+    std::cout << "Move + destroy path: OK" << std::endl;
+}
+
+void test_iterators_and_comparison() {
+    std::cout << "\n=== Testing iterators and comparison ===" << std::endl;
+
+    mys::vector<int> v{1, 2, 3, 4};
+    int sum = 0;
+    for (const auto &x : v) {
+        sum += x;
+    }
+    assert(sum == 10);
+
+    auto rit = v.rbegin();
+    assert(*rit == 4);
+    assert(v.end() - v.begin() == 4);
+    assert(v.cbegin() < v.cend());
+
+    mys::vector<int> w{1, 2, 5};
+    assert(v < w);
+    assert(v != w);
+    mys::vector<int> x{1, 2};
+    assert(x < v);
+
+    swap(v, w);
+    assert(v.size() == 3);
+    std::cout << "Iterators and <=>: OK" << std::endl;
+}
+
+void test_move_assignment_allocators() {
+    std::cout << "\n=== Testing move assignment with unequal allocators ===" << std::endl;
+
+    // 分配器不相等且不传播：不能接管对方的缓冲区，只能逐个移动元素
+    {
+        mys::vector<Tracked, TaggedAllocator<Tracked>> a{1, 2, 3};
+        mys::vector<Tracked, TaggedAllocator<Tracked>> b;
+        const Tracked *buffer = a.data();
+        b = std::move(a);
+        assert(b.size() == 3 && b[2].value == 3);
+        assert(b.data() != buffer);
+        assert(a.empty());
+    }
+    assert(Tracked::alive == 0);
+    for (int count : TaggedAllocator<Tracked>::live) {
+        assert(count == 0);
+    }
+    std::cout << "Element-wise move: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::vector implementation..." << std::endl;
+
+    try {
+        test_basic_operations();
+        test_constructors();
+        test_insert_erase();
+        test_relocation_paths();
+        test_iterators_and_comparison();
+        test_move_assignment_allocators();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
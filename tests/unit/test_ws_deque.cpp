@@ -0,0 +1,118 @@
+#include "ws_deque.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+void test_owner() {
+    std::cout << "\n=== Testing owner push/pop ===" << std::endl;
+
+    mys::ws_deque<int> d(3);
+    assert(d.capacity() == 4);
+    assert(d.empty_approx());
+
+    int value = -1;
+    assert(!d.try_pop(value));
+    assert(!d.try_steal(value));
+    assert(value == -1);
+
+    for (int i = 0; i < 4; ++i) {
+        d.push(i);
+    }
+    assert(d.size_approx() == 4);
+    // 所有者从底部 LIFO，窃取者从顶部 FIFO
+    assert(d.try_pop(value) && value == 3);
+    assert(d.try_steal(value) && value == 0);
+    assert(d.try_pop(value) && value == 2);
+    assert(d.try_pop(value) && value == 1);
+    assert(!d.try_pop(value));
+    assert(!d.try_steal(value));
+    std::cout << "LIFO for the owner, FIFO for thieves: OK" << std::endl;
+
+    // 环绕后扩容，元素保持顺序
+    for (int i = 0; i < 3; ++i) {
+        d.push(i);
+        assert(d.try_steal(value));
+    }
+    for (int i = 0; i < 100; ++i) {
+        d.push(i);
+    }
+    assert(d.capacity() == 128);
+    assert(d.size_approx() == 100);
+    for (int i = 0; i < 50; ++i) {
+        assert(d.try_steal(value) && value == i);
+    }
+    for (int i = 99; i >= 50; --i) {
+        assert(d.try_pop(value) && value == i);
+    }
+    assert(d.empty_approx());
+    std::cout << "Growth across the wrap point: OK" << std::endl;
+}
+
+void test_concurrent() {
+    std::cout << "\n=== Testing owner against concurrent thieves ===" << std::endl;
+
+    constexpr int thieves = 3;
+    constexpr int total = 200000;
+
+    // 所有者一边压入一边弹出，窃取者不停窃取；每个值必须恰好被取走一次
+    mys::ws_deque<int> d(2);
+    std::vector<std::atomic<int>> taken(total);
+    std::atomic<int> count{0};
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; ++t) {
+        threads.emplace_back([&] {
+            int value;
+            while (!done.load() || !d.empty_approx()) {
+                if (d.try_steal(value)) {
+                    taken[value].fetch_add(1);
+                    count.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    int value;
+    for (int i = 0; i < total; ++i) {
+        d.push(i);
+        if (i % 3 == 0 && d.try_pop(value)) {
+            taken[value].fetch_add(1);
+            count.fetch_add(1);
+        }
+    }
+    while (d.try_pop(value)) {
+        taken[value].fetch_add(1);
+        count.fetch_add(1);
+    }
+    done.store(true);
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    assert(count.load() == total);
+    for (int i = 0; i < total; ++i) {
+        assert(taken[i].load() == 1);
+    }
+    std::cout << "Every value taken exactly once: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::ws_deque implementation..." << std::endl;
+
+    try {
+        test_owner();
+        test_concurrent();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,289 @@
+#include "xor_list.h"
+#include "pool_allocator.h"
+#include <algorithm>
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+static_assert(std::bidirectional_iterator<mys::xor_list<int>::iterator>);
+static_assert(std::bidirectional_iterator<mys::xor_list<int>::const_iterator>);
+// 一个链接字 + 数据：int 节点 16 字节，mys::list<int> 节点为 24 字节
+static_assert(mys::xor_list<int>::node_size() == sizeof(std::uintptr_t) + sizeof(std::uint64_t));
+
+template <typename List>
+std::vector<int> forward(const List &l) {
+    return std::vector<int>(l.begin(), l.end());
+}
+
+template <typename List>
+std::vector<int> backward(const List &l) {
+    return std::vector<int>(l.rbegin(), l.rend());
+}
+
+// 正反两个方向都与模型一致
+template <typename List>
+void check(const List &l, const std::deque<int> &model) {
+    assert(l.size() == model.size());
+    assert(forward(l) == std::vector<int>(model.begin(), model.end()));
+    assert(backward(l) == std::vector<int>(model.rbegin(), model.rend()));
+    if (!model.empty()) {
+        assert(l.front() == model.front());
+        assert(l.back() == model.back());
+    }
+}
+
+void test_basic_operations() {
+    std::cout << "\n=== Testing basic operations ===" << std::endl;
+
+    mys::xor_list<int> l;
+    assert(l.empty() && l.begin() == l.end());
+    l.push_back(2);
+    l.push_back(3);
+    l.push_front(1);
+    l.emplace_front(0);
+    l.emplace_back(4);
+    check(l, {0, 1, 2, 3, 4});
+    std::cout << "push/emplace at both ends: OK" << std::endl;
+
+    // 从 end() 后退、从 begin() 前进
+    auto it = l.end();
+    --it;
+    assert(*it == 4);
+    --it;
+    assert(*it == 3);
+    ++it;
+    ++it;
+    assert(it == l.end());
+    std::cout << "Bidirectional steps: OK" << std::endl;
+
+    // insert 返回的迭代器带着正确的前驱，可以继续向两边走
+    auto pos = std::next(l.begin(), 2);
+    auto ins = l.insert(pos, 10);
+    assert(*ins == 10);
+    assert(*std::prev(ins) == 1);
+    assert(*std::next(ins) == 2);
+    ins = l.insert(l.end(), 11);
+    assert(*ins == 11 && std::next(ins) == l.end());
+    ins = l.emplace(l.begin(), -1);
+    assert(ins == l.begin());
+    check(l, {-1, 0, 1, 10, 2, 3, 4, 11});
+    std::cout << "insert/emplace: OK" << std::endl;
+
+    auto after = l.erase(std::next(l.begin(), 3));
+    assert(*after == 2 && *std::prev(after) == 1);
+    after = l.erase(std::prev(l.end()));
+    assert(after == l.end());
+    after = l.erase(std::next(l.begin()), std::next(l.begin(), 4));
+    assert(*after == 3 && *std::prev(after) == -1);
+    check(l, {-1, 3, 4});
+    bool thrown = false;
+    try {
+        l.erase(l.end());
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "erase: OK" << std::endl;
+
+    l.pop_front();
+    l.pop_back();
+    check(l, {3});
+    l.pop_back();
+    assert(l.empty() && l.begin() == l.end());
+    l.pop_back();
+    l.pop_front();
+    assert(l.empty());
+    std::cout << "pop at both ends: OK" << std::endl;
+}
+
+void test_reverse_and_copy() {
+    std::cout << "\n=== Testing reverse, copy and move ===" << std::endl;
+
+    mys::xor_list<int> l = {1, 2, 3, 4};
+    l.reverse();
+    check(l, {4, 3, 2, 1});
+    l.push_back(0);
+    l.push_front(5);
+    check(l, {5, 4, 3, 2, 1, 0});
+
+    mys::xor_list<int> copy(l);
+    assert(copy == l);
+    copy.pop_front();
+    assert(copy < l && copy != l);
+
+    mys::xor_list<int> moved(std::move(copy));
+    assert(copy.empty() && copy.begin() == copy.end());
+    check(moved, {4, 3, 2, 1, 0});
+
+    copy = moved;
+    check(copy, {4, 3, 2, 1, 0});
+    moved = std::move(l);
+    check(moved, {5, 4, 3, 2, 1, 0});
+    swap(copy, moved);
+    check(copy, {5, 4, 3, 2, 1, 0});
+    check(moved, {4, 3, 2, 1, 0});
+
+    mys::xor_list<std::string> strings = {"a", "b"};
+    strings.emplace_back(3, 'c');
+    assert(strings.back() == "ccc");
+
+    mys::xor_list<std::unique_ptr<int>> owners;
+    owners.push_back(std::make_unique<int>(7));
+    owners.emplace_front(new int(6));
+    assert(*owners.front() == 6 && *owners.back() == 7);
+    std::cout << "Reverse, copy and move: OK" << std::endl;
+}
+
+// 带编号、移动赋值时不传播的分配器：live[id] 记录各编号尚未释放的节点数
+template <typename T>
+struct TaggedAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    static inline int next_id = 0;
+    static inline int live[16] = {};
+    int id;
+
+    TaggedAllocator() : id(next_id++ % 16) {}
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U> &other) noexcept : id(other.id) {}
+
+    T *allocate(std::size_t n) {
+        ++live[id];
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept {
+        --live[id];
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(const TaggedAllocator &lhs, const TaggedAllocator &rhs) { return lhs.id == rhs.id; }
+};
+
+void test_move_assignment_allocators() {
+    std::cout << "\n=== Testing move assignment with unequal allocators ===" << std::endl;
+
+    using List = mys::xor_list<int, TaggedAllocator<int>>;
+    {
+        List a = {1, 2, 3};
+        List b = {7};
+        const int *first = &a.front();
+        b = std::move(a);
+        check(b, {1, 2, 3});
+        assert(&b.front() != first);
+        assert(a.empty());
+
+        List c(b.get_allocator());
+        first = &b.front();
+        c = std::move(b);
+        check(c, {1, 2, 3});
+        assert(&c.front() == first);
+    }
+    for (int count : TaggedAllocator<int>::live) {
+        assert(count == 0);
+    }
+    std::cout << "Element-wise move when allocators differ: OK" << std::endl;
+}
+
+// 与 std::deque 对照的随机操作序列，覆盖两端和中间位置
+template <typename List>
+void run_random_model(unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> op(0, 7);
+    List l;
+    std::deque<int> model;
+
+    for (int step = 0; step < 4000; ++step) {
+        int value = step;
+        auto index = [&](std::size_t extra) { return std::uniform_int_distribution<std::size_t>(0, model.size() - 1 + extra)(gen); };
+        switch (op(gen)) {
+        case 0:
+            l.push_back(value);
+            model.push_back(value);
+            break;
+        case 1:
+            l.push_front(value);
+            model.push_front(value);
+            break;
+        case 2:
+            if (!model.empty()) {
+                l.pop_back();
+                model.pop_back();
+            }
+            break;
+        case 3:
+            if (!model.empty()) {
+                l.pop_front();
+                model.pop_front();
+            }
+            break;
+        case 4: {
+            std::size_t i = model.empty() ? 0 : index(1);
+            auto it = l.insert(std::next(l.begin(), static_cast<std::ptrdiff_t>(i)), value);
+            model.insert(model.begin() + static_cast<std::ptrdiff_t>(i), value);
+            assert(*it == value);
+            break;
+        }
+        case 5:
+            if (!model.empty()) {
+                std::size_t i = index(0);
+                // 从尾部倒着走到同一位置，检验反向得到的迭代器同样可以删除
+                auto it = std::prev(l.end(), static_cast<std::ptrdiff_t>(model.size() - i));
+                auto next = l.erase(it);
+                auto model_next = model.erase(model.begin() + static_cast<std::ptrdiff_t>(i));
+                assert((next == l.end()) == (model_next == model.end()));
+                if (model_next != model.end()) assert(*next == *model_next);
+            }
+            break;
+        case 6:
+            l.reverse();
+            std::reverse(model.begin(), model.end());
+            break;
+        case 7:
+            if (model.size() > 200) {
+                l.erase(std::next(l.begin(), 10), std::prev(l.end(), 10));
+                model.erase(model.begin() + 10, model.end() - 10);
+            }
+            break;
+        }
+        if (step % 97 == 0) check(l, model);
+    }
+    check(l, model);
+}
+
+void test_random_against_model() {
+    std::cout << "\n=== Testing random operations against std::deque ===" << std::endl;
+
+    for (unsigned seed = 1; seed <= 4; ++seed) {
+        run_random_model<mys::xor_list<int>>(seed);
+    }
+    run_random_model<mys::xor_list<int, mys::pool_allocator<int>>>(5);
+    std::cout << "Random operations: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing mys::xor_list..." << std::endl;
+
+    try {
+        test_basic_operations();
+        test_reverse_and_copy();
+        test_move_assignment_allocators();
+        test_random_against_model();
+
+        std::cout << "\n=== ALL TESTS PASSED ===" << std::endl;
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "concurrent_forward_list.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace mys;
+
+TEST_CASE("Concurrent forward list basic operations", "[concurrent_forward_list]") {
+    concurrent_forward_list<int> list;
+
+    SECTION("sorted set semantics") {
+        REQUIRE(list.insert(3));
+        REQUIRE(list.insert(1));
+        REQUIRE_FALSE(list.insert(3));
+        REQUIRE(list.contains(3));
+        REQUIRE(list.erase(3));
+        REQUIRE_FALSE(list.contains(3));
+        REQUIRE(list.size_approx() == 1);
+    }
+
+    SECTION("each key is inserted by exactly one of several threads") {
+        constexpr int keys = 5000;
+        std::atomic<int> wins{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 3; ++t) {
+            threads.emplace_back([&] {
+                for (int k = 0; k < keys; ++k) {
+                    if (list.insert(k)) wins.fetch_add(1);
+                }
+            });
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+        REQUIRE(wins.load() == keys);
+        REQUIRE(list.size_approx() == keys);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include "deque.h"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+using namespace mys;
+
+TEST_CASE("Deque basic operations", "[deque]") {
+    deque<int> d;
+
+    SECTION("push and pop") {
+        d.push_back(1);
+        d.push_front(0);
+        REQUIRE(d.size() == 2);
+        REQUIRE(d.front() == 0);
+        REQUIRE(d.back() == 1);
+        d.pop_front();
+        REQUIRE(d.front() == 1);
+    }
+
+    SECTION("random access") {
+        for (int i = 0; i < 3000; ++i) {
+            d.push_front(i);
+        }
+        REQUIRE(d[0] == 2999);
+        REQUIRE(d[2999] == 0);
+        REQUIRE(*(d.end() - 1) == 0);
+    }
+
+    SECTION("sliding window") {
+        for (int i = 0; i < 100000; ++i) {
+            d.push_back(i);
+            if (d.size() > 100) d.pop_front();
+        }
+        REQUIRE(d.size() == 100);
+        REQUIRE(d.front() == 99900);
+    }
+}
+
+TEST_CASE("Deque of strings", "[deque]") {
+    deque<std::string> d{"b", "c"};
+    d.emplace_front("a");
+    d.insert(d.begin() + 1, "x");
+    REQUIRE(d == deque<std::string>{"a", "x", "b", "c"});
+    d.erase(d.begin() + 1);
+    REQUIRE(d == deque<std::string>{"a", "b", "c"});
+}
\ No newline at end of file
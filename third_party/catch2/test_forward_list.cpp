@@ -351,6 +351,24 @@ TEST_CASE("Reverse operation", "[forward_list]") {
     REQUIRE_THAT(actual, Catch::Matchers::Equals(expected));
 }
 
+TEST_CASE("Sort and merge", "[forward_list]") {
+    SECTION("Sort") {
+        forward_list<int> fl{3, 1, 4, 1, 5, 9, 2, 6};
+        fl.sort();
+        std::vector<int> actual{fl.begin(), fl.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{1, 1, 2, 3, 4, 5, 6, 9}));
+    }
+
+    SECTION("Merge") {
+        forward_list<int> a{1, 3, 5};
+        forward_list<int> b{2, 4};
+        a.merge(b);
+        REQUIRE(b.empty());
+        std::vector<int> actual{a.begin(), a.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{1, 2, 3, 4, 5}));
+    }
+}
+
 TEST_CASE("Comparison operations", "[forward_list]") {
     forward_list<int> fl1{1, 2, 3};
     forward_list<int> fl2{1, 2, 3};
@@ -367,4 +385,70 @@ TEST_CASE("Comparison operations", "[forward_list]") {
         REQUIRE(fl1 < fl3);
         REQUIRE(fl4 < fl1);
     }
+}
+
+TEST_CASE("Range operations", "[forward_list]") {
+    forward_list<int> fl{1, 2};
+
+    SECTION("Append and prepend") {
+        fl.append_range(std::vector<int>{3, 4});
+        fl.prepend_range(std::vector<int>{0});
+        std::vector<int> actual{fl.begin(), fl.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{0, 1, 2, 3, 4}));
+        REQUIRE(fl.size() == 5);
+    }
+
+    SECTION("Insert after a position") {
+        auto it = fl.insert_after(fl.begin(), {7, 8});
+        REQUIRE(*it == 8);
+        std::vector<int> actual{fl.begin(), fl.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{1, 7, 8, 2}));
+    }
+}
+
+TEST_CASE("Tail-tracking forward_list", "[forward_list]") {
+    tail_forward_list<int> q{1, 2};
+
+    SECTION("push_back appends in O(1)") {
+        q.push_back(3);
+        q.emplace_back(4);
+        std::vector<int> actual{q.begin(), q.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{1, 2, 3, 4}));
+        REQUIRE(*q.before_end() == 4);
+    }
+
+    SECTION("erasing the last element moves the tail back") {
+        q.erase_after(q.begin());
+        REQUIRE(*q.before_end() == 1);
+        q.pop_front();
+        REQUIRE(q.before_end() == q.before_begin());
+    }
+
+    SECTION("unique keeps the tail") {
+        q.push_back(2);
+        q.unique();
+        REQUIRE(q.size() == 2);
+        REQUIRE(*q.before_end() == 2);
+    }
+}
+
+TEST_CASE("Compaction", "[forward_list]") {
+    forward_list<std::string, pool_allocator<std::string>> l;
+    for (int i = 0; i < 300; ++i) {
+        l.push_front(std::to_string(i));
+    }
+    // push_front 之后遍历顺序与分配顺序相反
+
+    SECTION("compact keeps the elements in order") {
+        l.compact();
+        REQUIRE(l.size() == 300);
+        REQUIRE(l.front() == "299");
+        REQUIRE(l.fragmentation() < 0.05);
+    }
+
+    SECTION("compact_if only acts above the threshold") {
+        REQUIRE_FALSE(l.compact_if(1.0));
+        REQUIRE(l.compact_if(0.5));
+        REQUIRE_FALSE(l.compact_if(0.5));
+    }
 }
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "heap.h"
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <string>
+
+using namespace mys;
+
+TEST_CASE("Heap basic operations", "[heap]") {
+    heap<int> h;
+    auto a = h.push(3);
+    auto b = h.push(8);
+    h.push(5);
+
+    SECTION("top is the largest") {
+        REQUIRE(h.top() == 8);
+        h.pop();
+        REQUIRE(h.top() == 5);
+    }
+
+    SECTION("update through handles") {
+        h.update(a, 10);
+        REQUIRE(h.top() == 10);
+        h.erase(a);
+        REQUIRE(h.top() == 8);
+        REQUIRE(h.value(b) == 8);
+    }
+}
+
+TEST_CASE("Min-heap of strings with arity 8", "[heap]") {
+    heap<std::string, std::greater<std::string>, 8> h;
+    auto z = h.push("zebra");
+    h.push("mango");
+    h.decrease_key(z, "aardvark");
+    REQUIRE(h.top() == "aardvark");
+    REQUIRE(h.size() == 2);
+}
\ No newline at end of file
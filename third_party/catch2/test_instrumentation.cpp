@@ -0,0 +1,35 @@
+#include "forward_list.h"
+#include "list.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+using namespace mys;
+
+TEST_CASE("Counting instrumentation", "[instrumentation]") {
+    forward_list<int, std::allocator<int>, counting_instrumentation> l = {3, 3, 3, 4};
+    auto &stats = l.instrumentation();
+
+    SECTION("construction allocates one node per element") {
+        REQUIRE(stats.allocations == 4);
+        REQUIRE(stats.peak_length == 4);
+    }
+
+    SECTION("unique visits each adjacent pair") {
+        stats.reset();
+        l.unique();
+        REQUIRE(stats.nodes_visited == 3);
+        REQUIRE(stats.erase_calls == 2);
+        REQUIRE(stats.deallocations == 2);
+    }
+
+    SECTION("counters stay with the container on move") {
+        auto moved = std::move(l);
+        REQUIRE(moved.instrumentation().allocations == 0);
+        REQUIRE(moved.size() == 4);
+    }
+}
+
+TEST_CASE("Default instantiation is unchanged", "[instrumentation]") {
+    STATIC_REQUIRE(std::is_same_v<list<int>, list<int, std::allocator<int>, no_instrumentation>>);
+    STATIC_REQUIRE(sizeof(forward_list<int>) == sizeof(void *) + sizeof(std::size_t));
+}
\ No newline at end of file
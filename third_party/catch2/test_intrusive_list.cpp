@@ -0,0 +1,52 @@
+#include "intrusive_list.h"
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <stdexcept>
+
+using namespace mys;
+
+struct Job {
+    int priority = 0;
+    list_hook<Job> hook;
+};
+
+TEST_CASE("Intrusive list basic operations", "[intrusive_list]") {
+    Job jobs[3] = {{1, {}}, {2, {}}, {3, {}}};
+    intrusive_list<Job, &Job::hook> l;
+    for (Job &job : jobs) {
+        l.push_back(job);
+    }
+
+    SECTION("iteration follows link order") {
+        REQUIRE(l.size() == 3);
+        REQUIRE(l.front().priority == 1);
+        REQUIRE(std::prev(l.end())->priority == 3);
+    }
+
+    SECTION("erase in O(1) from the object") {
+        l.erase(jobs[1]);
+        REQUIRE(l.size() == 2);
+        REQUIRE(std::next(l.begin())->priority == 3);
+    }
+
+    SECTION("move to front with splice") {
+        l.splice(l.begin(), l, l.iterator_to(jobs[2]));
+        REQUIRE(l.front().priority == 3);
+        REQUIRE(l.back().priority == 2);
+    }
+}
+
+TEST_CASE("Intrusive list rejects a hook that is already linked", "[intrusive_list]") {
+    Job jobs[2] = {{1, {}}, {2, {}}};
+    intrusive_list<Job, &Job::hook> a, b;
+    a.push_back(jobs[0]);
+    REQUIRE_THROWS_AS(a.push_front(jobs[0]), std::invalid_argument);
+    REQUIRE_THROWS_AS(b.push_back(jobs[0]), std::invalid_argument);
+    REQUIRE(a.size() == 1);
+    REQUIRE(b.empty());
+
+    a.pop_front();
+    REQUIRE_FALSE(jobs[0].hook.is_linked());
+    b.insert(b.end(), jobs[0]);
+    REQUIRE(b.front().priority == 1);
+}
\ No newline at end of file
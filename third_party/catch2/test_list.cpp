@@ -282,6 +282,27 @@ TEST_CASE("Reverse iterators", "[list]") {
     REQUIRE_THAT(reversed, Catch::Matchers::Equals(expected));
 }
 
+TEST_CASE("Sort and merge", "[list]") {
+    SECTION("Sort") {
+        list<int> l{3, 1, 4, 1, 5, 9, 2, 6};
+        l.sort();
+        std::vector<int> actual{l.begin(), l.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{1, 1, 2, 3, 4, 5, 6, 9}));
+        std::vector<int> reversed{l.rbegin(), l.rend()};
+        REQUIRE_THAT(reversed, Catch::Matchers::Equals(std::vector<int>{9, 6, 5, 4, 3, 2, 1, 1}));
+    }
+
+    SECTION("Merge") {
+        list<int> a{1, 3, 5};
+        list<int> b{2, 4};
+        a.merge(b);
+        REQUIRE(b.empty());
+        std::vector<int> actual{a.begin(), a.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{1, 2, 3, 4, 5}));
+        REQUIRE(a.back() == 5);
+    }
+}
+
 TEST_CASE("Comparison operations", "[list]") {
     list<int> l1{1, 2, 3};
     list<int> l2{1, 2, 3};
@@ -298,4 +319,87 @@ TEST_CASE("Comparison operations", "[list]") {
         REQUIRE(l1 < l3);
         REQUIRE(l4 < l1);
     }
+}
+
+TEST_CASE("Range operations", "[list]") {
+    list<int> l{1, 2};
+
+    SECTION("Append and prepend") {
+        l.append_range(std::vector<int>{3, 4});
+        l.prepend_range(std::vector<int>{0});
+        std::vector<int> actual{l.begin(), l.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{0, 1, 2, 3, 4}));
+        REQUIRE(l.back() == 4);
+    }
+
+    SECTION("Insert in the middle") {
+        auto it = l.insert(std::next(l.begin()), {7, 8});
+        REQUIRE(*it == 7);
+        std::vector<int> actual{l.begin(), l.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{1, 7, 8, 2}));
+    }
+
+    SECTION("Assign replaces the content") {
+        l.assign_range(std::vector<int>{5, 6, 7});
+        REQUIRE(l.size() == 3);
+        REQUIRE(l.front() == 5);
+        REQUIRE(l.back() == 7);
+    }
+}
+
+TEST_CASE("Relinking operations", "[list]") {
+    list<int> l{1, 2, 3};
+
+    SECTION("Splice whole list") {
+        list<int> other{7, 8};
+        l.splice(std::next(l.begin()), other);
+        std::vector<int> actual{l.begin(), l.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{1, 7, 8, 2, 3}));
+        REQUIRE(other.empty());
+    }
+
+    SECTION("Splice within the same list") {
+        l.splice(l.end(), l, l.begin());
+        std::vector<int> actual{l.begin(), l.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{2, 3, 1}));
+        REQUIRE(l.size() == 3);
+    }
+
+    SECTION("Remove and unique return counts") {
+        l.push_back(3);
+        REQUIRE(l.unique() == 1);
+        REQUIRE(l.remove(2) == 1);
+        REQUIRE(l.remove_if([](int v) { return v > 5; }) == 0);
+        REQUIRE(l.size() == 2);
+    }
+
+    SECTION("Reverse") {
+        l.reverse();
+        std::vector<int> actual{l.begin(), l.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{3, 2, 1}));
+        REQUIRE(l.front() == 3);
+        REQUIRE(l.back() == 1);
+    }
+}
+
+TEST_CASE("Compaction", "[list]") {
+    list<std::string, pool_allocator<std::string>> l;
+    for (int i = 0; i < 300; ++i) {
+        l.push_back(std::to_string(i));
+    }
+    l.reverse();
+
+    SECTION("compact keeps the elements in order") {
+        l.compact();
+        REQUIRE(l.size() == 300);
+        REQUIRE(l.front() == "299");
+        REQUIRE(l.back() == "0");
+        REQUIRE(l.fragmentation() < 0.05);
+    }
+
+    SECTION("compact_if only acts above the threshold") {
+        REQUIRE_FALSE(l.compact_if(1.0));
+        REQUIRE(l.compact_if(0.5));
+        REQUIRE_FALSE(l.compact_if(0.5));
+    }
 }
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "map.h"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+using namespace mys;
+
+TEST_CASE("Map basic operations", "[map]") {
+    map<std::string, int, std::less<std::string>, 4> m;
+    for (const char *word : {"pear", "apple", "fig", "kiwi", "lime", "date", "plum"}) {
+        m.emplace(word, static_cast<int>(std::string(word).size()));
+    }
+
+    SECTION("lookup") {
+        REQUIRE(m.size() == 7);
+        REQUIRE(m.at("kiwi") == 4);
+        REQUIRE(m.find("mango") == m.end());
+    }
+
+    SECTION("iteration is sorted") {
+        REQUIRE(m.begin()->first == "apple");
+        REQUIRE((*m.rbegin()).first == "plum");
+    }
+
+    SECTION("equal_range") {
+        auto [first, last] = m.equal_range("fig");
+        REQUIRE(std::distance(first, last) == 1);
+        auto [none_first, none_last] = m.equal_range("grape");
+        REQUIRE(none_first == none_last);
+        REQUIRE(none_first->first == "kiwi");
+    }
+
+    SECTION("erase rebalances") {
+        REQUIRE(m.erase("apple") == 1);
+        REQUIRE(m.erase("date") == 1);
+        REQUIRE(m.erase("fig") == 1);
+        REQUIRE(m.begin()->first == "kiwi");
+        REQUIRE(m.size() == 4);
+    }
+}
+
+TEST_CASE("Map bulk load", "[map]") {
+    std::vector<std::pair<int, int>> sorted;
+    for (int i = 0; i < 100; ++i) {
+        sorted.emplace_back(i * 2, i);
+    }
+    map<int, int, std::less<int>, 4> m(sorted_unique, sorted.begin(), sorted.end());
+    REQUIRE(m.size() == 100);
+    REQUIRE(m.lower_bound(51)->first == 52);
+    m.emplace(51, 0);
+    REQUIRE(m.lower_bound(51)->first == 51);
+}
\ No newline at end of file
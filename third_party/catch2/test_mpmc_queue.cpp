@@ -0,0 +1,60 @@
+#include "mpmc_queue.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace mys;
+
+TEST_CASE("MPMC queue basic operations", "[mpmc_queue]") {
+    mpmc_queue<int> q(3);
+    REQUIRE(q.capacity() == 4);
+
+    SECTION("single push and pop") {
+        REQUIRE(q.try_push(1));
+        REQUIRE(q.try_emplace(2));
+        int value = 0;
+        REQUIRE(q.try_pop(value));
+        REQUIRE(value == 1);
+    }
+
+    SECTION("bulk push and pop") {
+        std::vector<int> in{1, 2, 3, 4, 5};
+        REQUIRE(q.try_push_n(in.begin(), in.size()) == 4);
+        std::vector<int> out;
+        REQUIRE(q.try_pop_n(std::back_inserter(out), 10) == 4);
+        REQUIRE(out == std::vector<int>{1, 2, 3, 4});
+    }
+}
+
+TEST_CASE("MPMC queue with two producers and two consumers", "[mpmc_queue]") {
+    mpmc_queue<int> q(64);
+    constexpr int per_producer = 10000;
+    std::atomic<long long> sum{0};
+    std::atomic<int> popped{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 2; ++p) {
+        threads.emplace_back([&] {
+            for (int i = 1; i <= per_producer;) {
+                if (q.try_push(i)) ++i;
+                else std::this_thread::yield();
+            }
+        });
+        threads.emplace_back([&] {
+            int value;
+            while (popped.load() < 2 * per_producer) {
+                if (q.try_pop(value)) {
+                    sum += value;
+                    ++popped;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    REQUIRE(sum.load() == 2LL * per_producer * (per_producer + 1) / 2);
+}
\ No newline at end of file
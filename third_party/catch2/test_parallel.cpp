@@ -0,0 +1,33 @@
+#include "parallel.h"
+#include "list.h"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+using namespace mys;
+
+TEST_CASE("Parallel algorithms over a list", "[parallel]") {
+    list<int> l;
+    for (int i = 1; i <= 500; ++i) {
+        l.push_back(i);
+    }
+
+    SECTION("reduce and count_if match the sequential result") {
+        REQUIRE(parallel::reduce(l, 0, std::plus<>{}, {4, 16}) == 125250);
+        REQUIRE(parallel::count_if(l, [](int v) { return v > 250; }, {4, 16}) == 250);
+    }
+
+    SECTION("for_each visits every element once") {
+        parallel::for_each(l, [](int &v) { v += 1; }, {3, 10});
+        REQUIRE(parallel::reduce(l, 0, std::plus<>{}, {3, 10}) == 125750);
+    }
+
+    SECTION("floating point sum is the same for every thread count") {
+        list<double> d;
+        for (int i = 1; i <= 5000; ++i) {
+            d.push_back(1.0 / i);
+        }
+        double one = parallel::reduce(d, 0.0, std::plus<>{}, {1, 64});
+        REQUIRE(parallel::reduce(d, 0.0, std::plus<>{}, {4, 64}) == one);
+        REQUIRE(parallel::reduce(d, 0.0, std::plus<>{}, {7, 64}) == one);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "persistent_forward_list.h"
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+using namespace mys;
+
+TEST_CASE("Persistent forward_list versions", "[persistent_forward_list]") {
+    persistent_forward_list<int> base{3, 2, 1};
+
+    SECTION("copies share every node") {
+        persistent_forward_list<int> copy = base;
+        REQUIRE(copy.shares_with(base));
+        REQUIRE(&copy.front() == &base.front());
+    }
+
+    SECTION("changes to a copy leave the original alone") {
+        persistent_forward_list<int> copy = base;
+        copy.pop_front();
+        copy.push_front(9);
+        REQUIRE(std::vector<int>(base.begin(), base.end()) == std::vector<int>{3, 2, 1});
+        REQUIRE(std::vector<int>(copy.begin(), copy.end()) == std::vector<int>{9, 2, 1});
+    }
+
+    SECTION("move leaves the source empty") {
+        persistent_forward_list<int> moved = std::move(base);
+        REQUIRE(base.empty());
+        REQUIRE(moved.size() == 3);
+    }
+}
+
+TEST_CASE("Shared snapshots across threads", "[persistent_forward_list]") {
+    shared_persistent_forward_list<int> base;
+    for (int i = 0; i < 100; ++i) {
+        base.push_front(i);
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<std::size_t> sizes(4);
+    for (std::size_t t = 0; t < sizes.size(); ++t) {
+        threads.emplace_back([&, t] {
+            for (int round = 0; round < 1000; ++round) {
+                shared_persistent_forward_list<int> snapshot = base;
+                snapshot.pop_front();
+                sizes[t] = snapshot.size();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (std::size_t size : sizes) {
+        REQUIRE(size == 99);
+    }
+    REQUIRE(base.size() == 100);
+}
\ No newline at end of file
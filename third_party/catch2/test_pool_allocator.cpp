@@ -0,0 +1,58 @@
+#include "pool_allocator.h"
+#include "list.h"
+#include "forward_list.h"
+#include <catch2/catch_test_macros.hpp>
+#include <set>
+#include <string>
+
+using namespace mys;
+
+TEST_CASE("Slot reuse", "[pool_allocator]") {
+    pool_allocator<int> alloc;
+    int *a = alloc.allocate(1);
+    alloc.deallocate(a, 1);
+    REQUIRE(alloc.allocate(1) == a);
+    alloc.deallocate(a, 1);
+}
+
+TEST_CASE("Allocations across slabs", "[pool_allocator]") {
+    pool_allocator<int, 64> alloc;
+    std::set<int *> seen;
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(seen.insert(alloc.allocate(1)).second);
+    }
+    REQUIRE(alloc.release());
+}
+
+TEST_CASE("Shared pool", "[pool_allocator]") {
+    pool_allocator<int> a;
+    a.deallocate(a.allocate(1), 1);
+    pool_allocator<int> b(a);
+
+    REQUIRE(a == b);
+    REQUIRE_FALSE(a.release());
+}
+
+TEST_CASE("Containers with pool_allocator", "[pool_allocator]") {
+    SECTION("list clear and reuse") {
+        list<int, pool_allocator<int>> l{1, 2, 3};
+        l.clear();
+        REQUIRE(l.empty());
+        l.push_back(4);
+        REQUIRE(l.front() == 4);
+    }
+
+    SECTION("list move assignment") {
+        list<int, pool_allocator<int>> a{1, 2, 3};
+        list<int, pool_allocator<int>> b;
+        b = std::move(a);
+        REQUIRE(b.size() == 3);
+    }
+
+    SECTION("forward_list with strings") {
+        forward_list<std::string, pool_allocator<std::string>> fl{"a", "b"};
+        REQUIRE(fl.front() == "a");
+        fl.clear();
+        REQUIRE(fl.empty());
+    }
+}
\ No newline at end of file
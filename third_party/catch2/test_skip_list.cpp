@@ -0,0 +1,36 @@
+#include "skip_list.h"
+#include <catch2/catch_test_macros.hpp>
+#include <set>
+#include <vector>
+
+using namespace mys;
+
+TEST_CASE("Skip list basic operations", "[skip_list]") {
+    skip_list<int> s{3, 1, 2};
+
+    SECTION("iteration is in key order") {
+        REQUIRE(std::vector<int>(s.begin(), s.end()) == std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("insert and erase match std::set") {
+        std::set<int> ref{1, 2, 3};
+        for (int i = 0; i < 3000; ++i) {
+            int key = (i * 37) % 500;
+            if (i % 3 == 0) {
+                REQUIRE(s.erase(key) == ref.erase(key));
+            } else {
+                REQUIRE(s.insert(key).second == ref.insert(key).second);
+            }
+        }
+        REQUIRE(s.size() == ref.size());
+        REQUIRE(std::vector<int>(s.begin(), s.end()) == std::vector<int>(ref.begin(), ref.end()));
+    }
+
+    SECTION("copy is equal and independent") {
+        skip_list<int> copy = s;
+        REQUIRE(copy == s);
+        copy.insert(4);
+        REQUIRE(s.size() == 3);
+        REQUIRE(copy.size() == 4);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "small_vector.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+
+using namespace mys;
+
+// Stateful allocator that stays put on move assignment; copies share an id, fresh instances differ
+template <typename T>
+struct IdAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    static inline int next_id = 0;
+    int id = next_id++;
+
+    IdAllocator() = default;
+    template <typename U>
+    IdAllocator(const IdAllocator<U> &other) noexcept : id(other.id) {}
+
+    T *allocate(std::size_t n) { return std::allocator<T>().allocate(n); }
+    void deallocate(T *p, std::size_t n) noexcept { std::allocator<T>().deallocate(p, n); }
+
+    friend bool operator==(const IdAllocator &lhs, const IdAllocator &rhs) { return lhs.id == rhs.id; }
+};
+
+TEST_CASE("Small vector storage", "[small_vector]") {
+    small_vector<int, 4> v{1, 2, 3};
+    REQUIRE(v.is_inline());
+
+    SECTION("spill and shrink") {
+        v.push_back(4);
+        v.push_back(5);
+        REQUIRE_FALSE(v.is_inline());
+        v.resize(2);
+        v.shrink_to_fit();
+        REQUIRE(v.is_inline());
+        REQUIRE(v == small_vector<int, 4>{1, 2});
+    }
+
+    SECTION("copy") {
+        small_vector<int, 4> copy(v);
+        REQUIRE(copy == v);
+        copy.push_back(0);
+        REQUIRE(v < copy);
+    }
+}
+
+TEST_CASE("Small vector move", "[small_vector]") {
+    small_vector<std::string, 2> inline_v{"a"};
+    small_vector<std::string, 2> heap_v{"a", "b", "c"};
+
+    small_vector<std::string, 2> moved_inline(std::move(inline_v));
+    small_vector<std::string, 2> moved_heap(std::move(heap_v));
+    REQUIRE(moved_inline.front() == "a");
+    REQUIRE(moved_heap.back() == "c");
+    REQUIRE(inline_v.empty());
+    REQUIRE(heap_v.empty());
+}
+
+TEST_CASE("Small vector move assignment with unequal allocators", "[small_vector]") {
+    small_vector<std::string, 2, IdAllocator<std::string>> a{"a", "b", "c"};
+    small_vector<std::string, 2, IdAllocator<std::string>> b;
+    const std::string *data = a.data();
+    b = std::move(a);
+    REQUIRE(b.data() != data);
+    REQUIRE(b.size() == 3);
+    REQUIRE(b.back() == "c");
+    REQUIRE(a.empty());
+}
@@ -0,0 +1,67 @@
+#include "spsc_ring.h"
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+using namespace mys;
+
+TEST_CASE("SPSC ring basic operations", "[spsc_ring]") {
+    spsc_ring<int> ring(4);
+
+    SECTION("push and pop") {
+        REQUIRE(ring.try_push(1));
+        REQUIRE(ring.try_push(2));
+        int value = 0;
+        REQUIRE(ring.try_pop(value));
+        REQUIRE(value == 1);
+        REQUIRE(ring.size_approx() == 1);
+    }
+
+    SECTION("span batches") {
+        auto slots = ring.reserve(10);
+        REQUIRE(slots.size() == 4);
+        for (int i = 0; i < 4; ++i) {
+            slots[i] = i * 10;
+        }
+        ring.commit(4);
+        REQUIRE_FALSE(ring.try_push(0));
+
+        auto ready = ring.peek(10);
+        REQUIRE(ready.size() == 4);
+        REQUIRE(ready[3] == 30);
+        ring.release(4);
+        REQUIRE(ring.empty_approx());
+    }
+}
+
+TEST_CASE("SPSC ring across threads", "[spsc_ring]") {
+    constexpr int total = 50000;
+    spsc_ring<int> ring(32);
+    std::thread producer([&] {
+        for (int i = 0; i < total;) {
+            auto slots = ring.reserve(8);
+            if (slots.empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+            std::size_t n = 0;
+            for (; n < slots.size() && i < total; ++n) {
+                slots[n] = i++;
+            }
+            ring.commit(n);
+        }
+    });
+
+    long long sum = 0;
+    int received = 0;
+    while (received < total) {
+        int value;
+        if (ring.try_pop(value)) {
+            sum += value;
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    REQUIRE(sum == static_cast<long long>(total) * (total - 1) / 2);
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include "thread_pool.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <stdexcept>
+
+using namespace mys;
+
+static int count_leaves(thread_pool &pool, int depth) {
+    if (depth == 0) return 1;
+    int left = 0;
+    thread_pool::task_group group;
+    pool.spawn(group, [&] { left = count_leaves(pool, depth - 1); });
+    int right = count_leaves(pool, depth - 1);
+    pool.wait(group);
+    return left + right;
+}
+
+TEST_CASE("Thread pool fork/join", "[thread_pool]") {
+    thread_pool pool(3);
+
+    SECTION("binary recursion reaches every leaf") {
+        REQUIRE(count_leaves(pool, 12) == 4096);
+    }
+
+    SECTION("flat spawn from the calling thread") {
+        thread_pool::task_group group;
+        std::atomic<int> sum{0};
+        for (int i = 0; i < 500; ++i) {
+            pool.spawn(group, [&sum] { sum.fetch_add(2); });
+        }
+        pool.wait(group);
+        REQUIRE(sum.load() == 1000);
+    }
+
+    SECTION("exception reaches the waiter") {
+        thread_pool::task_group group;
+        pool.spawn(group, [] { throw std::runtime_error("boom"); });
+        REQUIRE_THROWS_AS(pool.wait(group), std::runtime_error);
+    }
+}
\ No newline at end of file
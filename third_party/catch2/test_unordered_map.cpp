@@ -0,0 +1,68 @@
+#include "unordered_map.h"
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <string>
+
+using namespace mys;
+
+TEST_CASE("Unordered map basic operations", "[unordered_map]") {
+    unordered_map<std::string, int> m{{"one", 1}, {"two", 2}};
+
+    SECTION("lookup") {
+        REQUIRE(m.size() == 2);
+        REQUIRE(m.at("one") == 1);
+        REQUIRE_THROWS_AS(m.at("three"), std::out_of_range);
+    }
+
+    SECTION("insert and erase") {
+        m["three"] = 3;
+        REQUIRE(m.contains("three"));
+        REQUIRE(m.erase("one") == 1);
+        REQUIRE_FALSE(m.contains("one"));
+        REQUIRE(m.size() == 2);
+    }
+
+    SECTION("clear keeps buckets") {
+        std::size_t buckets = m.bucket_count();
+        m.clear();
+        REQUIRE(m.empty());
+        REQUIRE(m.bucket_count() == buckets);
+    }
+}
+
+TEST_CASE("Unordered map rehash keeps elements", "[unordered_map]") {
+    unordered_map<int, int> m;
+    for (int i = 0; i < 300; ++i) {
+        m[i] = i * i;
+    }
+    m.rehash(4096);
+    REQUIRE(m.bucket_count() == 4096);
+    for (int i = 0; i < 300; ++i) {
+        REQUIRE(m.at(i) == i * i);
+    }
+}
+
+struct FlakyHash {
+    static inline int budget = -1;
+    size_t operator()(int key) const {
+        if (budget == 0) throw std::runtime_error("hash budget exhausted");
+        if (budget > 0) --budget;
+        return std::hash<int>{}(key);
+    }
+};
+
+TEST_CASE("Unordered map survives a throwing hash during rehash", "[unordered_map]") {
+    unordered_map<int, int, FlakyHash> m;
+    for (int i = 0; i < 100; ++i) {
+        m.emplace(i, i + 7);
+    }
+    std::size_t buckets = m.bucket_count();
+    FlakyHash::budget = 50;
+    REQUIRE_THROWS_AS(m.rehash(buckets * 4), std::runtime_error);
+    FlakyHash::budget = -1;
+    REQUIRE(m.size() == 100);
+    REQUIRE(m.bucket_count() == buckets);
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(m.at(i) == i + 7);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "unrolled_list.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_vector.hpp>
+#include <string>
+#include <vector>
+
+using namespace mys;
+
+TEST_CASE("Construction", "[unrolled_list]") {
+    unrolled_list<int, 4> l{1, 2, 3, 4, 5, 6};
+    REQUIRE(l.size() == 6);
+    REQUIRE(l.front() == 1);
+    REQUIRE(l.back() == 6);
+
+    unrolled_list<int, 4> copy(l);
+    REQUIRE(copy == l);
+}
+
+TEST_CASE("Insert and erase", "[unrolled_list]") {
+    unrolled_list<int, 4> l{0, 1, 2, 3, 4, 5, 6, 7};
+
+    SECTION("Insert into a full node") {
+        l.insert(std::next(l.begin(), 1), 100);
+        std::vector<int> actual{l.begin(), l.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{0, 100, 1, 2, 3, 4, 5, 6, 7}));
+    }
+
+    SECTION("Erase a range") {
+        auto it = l.erase(std::next(l.begin(), 2), std::next(l.begin(), 6));
+        REQUIRE(*it == 6);
+        std::vector<int> actual{l.begin(), l.end()};
+        REQUIRE_THAT(actual, Catch::Matchers::Equals(std::vector<int>{0, 1, 6, 7}));
+    }
+}
+
+TEST_CASE("Both ends", "[unrolled_list]") {
+    unrolled_list<std::string, 4> l;
+    l.push_back("b");
+    l.push_front("a");
+    l.emplace_back("c");
+    REQUIRE(l.front() == "a");
+    REQUIRE(l.back() == "c");
+
+    l.pop_front();
+    l.pop_back();
+    REQUIRE(l.size() == 1);
+    REQUIRE(l.front() == "b");
+}
+
+TEST_CASE("Reverse iterators", "[unrolled_list]") {
+    unrolled_list<int, 4> l{1, 2, 3, 4, 5, 6};
+    std::vector<int> reversed{l.rbegin(), l.rend()};
+    REQUIRE_THAT(reversed, Catch::Matchers::Equals(std::vector<int>{6, 5, 4, 3, 2, 1}));
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "vector.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+
+using namespace mys;
+
+// Stateful allocator that stays put on move assignment; copies share an id, fresh instances differ
+template <typename T>
+struct IdAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    static inline int next_id = 0;
+    int id = next_id++;
+
+    IdAllocator() = default;
+    template <typename U>
+    IdAllocator(const IdAllocator<U> &other) noexcept : id(other.id) {}
+
+    T *allocate(std::size_t n) { return std::allocator<T>().allocate(n); }
+    void deallocate(T *p, std::size_t n) noexcept { std::allocator<T>().deallocate(p, n); }
+
+    friend bool operator==(const IdAllocator &lhs, const IdAllocator &rhs) { return lhs.id == rhs.id; }
+};
+
+TEST_CASE("Vector basic operations", "[vector]") {
+    vector<int> v;
+
+    SECTION("push_back and access") {
+        for (int i = 0; i < 10; ++i) {
+            v.push_back(i);
+        }
+        REQUIRE(v.size() == 10);
+        REQUIRE(v.front() == 0);
+        REQUIRE(v.back() == 9);
+        REQUIRE(v[5] == 5);
+        REQUIRE_THROWS_AS(v.at(10), std::out_of_range);
+    }
+
+    SECTION("insert and erase") {
+        v = {1, 2, 4};
+        v.insert(v.begin() + 2, 3);
+        REQUIRE(v == vector<int>{1, 2, 3, 4});
+        v.erase(v.begin(), v.begin() + 2);
+        REQUIRE(v == vector<int>{3, 4});
+    }
+
+    SECTION("resize") {
+        v.resize(3, 7);
+        REQUIRE(v == vector<int>{7, 7, 7});
+        v.resize(1);
+        REQUIRE(v.size() == 1);
+    }
+}
+
+TEST_CASE("Vector of strings", "[vector]") {
+    vector<std::string> v{"a", "b"};
+    v.emplace(v.begin(), "z");
+    REQUIRE(v.front() == "z");
+
+    vector<std::string> copy(v);
+    REQUIRE(copy == v);
+    copy.pop_back();
+    REQUIRE(copy < v);
+}
+
+TEST_CASE("Vector move assignment with unequal allocators", "[vector]") {
+    vector<std::string, IdAllocator<std::string>> a{"a", "b", "c"};
+    vector<std::string, IdAllocator<std::string>> b;
+    const std::string *data = a.data();
+    b = std::move(a);
+    REQUIRE(b.data() != data);
+    REQUIRE(b.size() == 3);
+    REQUIRE(b.back() == "c");
+    REQUIRE(a.empty());
+}
@@ -0,0 +1,49 @@
+#include "ws_deque.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace mys;
+
+TEST_CASE("Work-stealing deque basic operations", "[ws_deque]") {
+    ws_deque<int> d(2);
+
+    SECTION("owner pops the newest, thief steals the oldest") {
+        d.push(1);
+        d.push(2);
+        d.push(3);
+        int value = 0;
+        REQUIRE(d.try_pop(value));
+        REQUIRE(value == 3);
+        REQUIRE(d.try_steal(value));
+        REQUIRE(value == 1);
+        REQUIRE(d.capacity() == 4);
+    }
+
+    SECTION("two thieves drain a full deque exactly once") {
+        constexpr int total = 20000;
+        for (int i = 0; i < total; ++i) {
+            d.push(i);
+        }
+        std::atomic<long long> sum{0};
+        std::atomic<int> count{0};
+        std::vector<std::thread> thieves;
+        for (int t = 0; t < 2; ++t) {
+            thieves.emplace_back([&] {
+                int value;
+                while (!d.empty_approx()) {
+                    if (d.try_steal(value)) {
+                        sum.fetch_add(value);
+                        count.fetch_add(1);
+                    }
+                }
+            });
+        }
+        for (auto &t : thieves) {
+            t.join();
+        }
+        REQUIRE(count.load() == total);
+        REQUIRE(sum.load() == static_cast<long long>(total) * (total - 1) / 2);
+    }
+}
\ No newline at end of file
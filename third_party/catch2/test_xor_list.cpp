@@ -0,0 +1,37 @@
+#include "xor_list.h"
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <vector>
+
+using namespace mys;
+
+TEST_CASE("XOR list basic operations", "[xor_list]") {
+    xor_list<int> l{1, 2, 3};
+
+    SECTION("iterates from both ends") {
+        REQUIRE(std::vector<int>(l.begin(), l.end()) == std::vector<int>{1, 2, 3});
+        REQUIRE(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>{3, 2, 1});
+    }
+
+    SECTION("push and pop at both ends") {
+        l.push_front(0);
+        l.push_back(4);
+        l.pop_front();
+        l.pop_back();
+        REQUIRE(l.size() == 3);
+        REQUIRE(l.front() == 1);
+        REQUIRE(l.back() == 3);
+    }
+
+    SECTION("insert keeps the neighbour pair") {
+        auto it = l.insert(std::prev(l.end()), 9);
+        REQUIRE(*std::prev(it) == 2);
+        REQUIRE(*std::next(it) == 3);
+    }
+
+    SECTION("reverse in O(1)") {
+        l.reverse();
+        REQUIRE(l.front() == 3);
+        REQUIRE(std::vector<int>(l.rbegin(), l.rend()) == std::vector<int>{1, 2, 3});
+    }
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+// bench_common.h
+// 链表类基准共享的参数矩阵：固定随机种子、三种元素类型、1e2 ~ 1e7 的规模
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <compare>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// 最大规模可在 CMake 中通过 MYS_BENCH_MAX_SIZE 调小，便于快速回归对比
+#ifndef MYS_BENCH_MAX_SIZE
+#define MYS_BENCH_MAX_SIZE 10000000
+#endif
+
+// 固定种子：每次运行生成相同的数据，结果才能和基线比较
+constexpr std::uint64_t bench_seed = 20240601;
+// 键的取值范围，数据量大时会出现重复值
+constexpr std::uint64_t bench_key_space = 1000000;
+
+// 64 字节的平凡类型，代表较大的值类型元素
+struct Pod64 {
+    std::uint64_t key;
+    std::uint64_t payload[7];
+
+    friend auto operator<=>(const Pod64 &, const Pod64 &) = default;
+    friend bool operator==(const Pod64 &, const Pod64 &) = default;
+};
+static_assert(sizeof(Pod64) == 64 && std::is_trivially_copyable_v<Pod64>);
+
+// 由整数键构造各类型的元素；字符串补齐到 20 位，超出 SSO 以包含堆分配
+template <typename T>
+T make_value(std::uint64_t key) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        std::string s = std::to_string(key);
+        return std::string(20 - s.size(), '0') + s;
+    } else if constexpr (std::is_same_v<T, Pod64>) {
+        return Pod64{key, {key, key, key, key, key, key, key}};
+    } else {
+        return static_cast<T>(key);
+    }
+}
+
+// 遍历类基准用来累加的整数，保证每个元素都被真正读取
+template <typename T>
+std::uint64_t bench_key(const T &value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return value.size() + static_cast<unsigned char>(value.back());
+    } else if constexpr (std::is_same_v<T, Pod64>) {
+        return value.key;
+    } else {
+        return static_cast<std::uint64_t>(value);
+    }
+}
+
+// n 个随机元素；salt 用来为同一基准生成另一份不同的数据
+template <typename T>
+std::vector<T> make_data(std::size_t n, std::uint64_t salt = 0) {
+    std::mt19937_64 gen(bench_seed + salt);
+    std::uniform_int_distribution<std::uint64_t> dist(0, bench_key_space - 1);
+    std::vector<T> data;
+    data.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data.push_back(make_value<T>(dist(gen)));
+    }
+    return data;
+}
+
+// 容器的元素类型（mys 的容器没有 value_type 成员）
+template <typename Container>
+using element_t = std::remove_cvref_t<decltype(*std::declval<Container &>().begin())>;
+
+// 规模参数：1e2, 1e3, ..., MYS_BENCH_MAX_SIZE
+inline void SizeRange(benchmark::internal::Benchmark *b) {
+    b->RangeMultiplier(10)->Range(100, MYS_BENCH_MAX_SIZE)->Unit(benchmark::kMicrosecond);
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+// bench_compact.cpp
+#include "list.h"
+#include "forward_list.h"
+#include "bench_common.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// 模拟长时间增删之后的链表：节点按一种顺序分配，sort 只重连指针，
+// 遍历顺序因此与内存顺序无关，每一步都可能是一次缓存/TLB 未命中。
+// 同一份链表分别在整理前后遍历，compact 本身的开销单独测量
+
+// 节点乱序的代价在链表超出缓存后才明显，下限从 1e3 开始；上限收紧到 1e6，建表要排序
+constexpr std::int64_t compact_max_size = std::min<std::int64_t>(MYS_BENCH_MAX_SIZE, 1000000);
+
+inline void CompactRange(benchmark::internal::Benchmark *b) {
+    b->RangeMultiplier(10)->Range(1000, compact_max_size)->Unit(benchmark::kMicrosecond);
+}
+
+template <typename List>
+static List make_scattered(std::size_t n) {
+    std::vector<element_t<List>> data = make_data<element_t<List>>(n);
+    List l;
+    l.assign(data.begin(), data.end());
+    l.sort();
+    return l;
+}
+
+template <typename List>
+static void iterate(benchmark::State &state, const List &l) {
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (const auto &val : l) {
+            sum += bench_key(val);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["fragmentation"] = l.fragmentation();
+}
+
+// 整理前：按打乱的分配顺序遍历
+template <typename List>
+static void BM_IterateScattered(benchmark::State &state) {
+    List l = make_scattered<List>(static_cast<std::size_t>(state.range(0)));
+    iterate(state, l);
+}
+
+// 整理后：同样的链表 compact 一次再遍历
+template <typename List>
+static void BM_IterateCompacted(benchmark::State &state) {
+    List l = make_scattered<List>(static_cast<std::size_t>(state.range(0)));
+    l.compact();
+    iterate(state, l);
+}
+
+// 一次 compact 的开销：每个元素一次分配、一次移动、一次释放。
+// 重复整理同一个链表时新节点取自上一轮释放的槽位，与第一次整理的内存布局不同，只作开销参考
+template <typename List>
+static void BM_Compact(benchmark::State &state) {
+    List l = make_scattered<List>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        l.compact();
+        benchmark::DoNotOptimize(l.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 池分配器：旧节点归还到空闲链表，新节点从 slab 顺序切出
+using pooled_list = mys::list<std::uint64_t, mys::pool_allocator<std::uint64_t>>;
+
+#define COMPACT_BENCHMARKS(List)                                        \
+    BENCHMARK_TEMPLATE(BM_IterateScattered, List)->Apply(CompactRange); \
+    BENCHMARK_TEMPLATE(BM_IterateCompacted, List)->Apply(CompactRange); \
+    BENCHMARK_TEMPLATE(BM_Compact, List)->Apply(CompactRange)
+
+COMPACT_BENCHMARKS(mys::list<std::uint64_t>);
+COMPACT_BENCHMARKS(mys::forward_list<std::uint64_t>);
+COMPACT_BENCHMARKS(mys::list<Pod64>);
+COMPACT_BENCHMARKS(mys::forward_list<Pod64>);
+COMPACT_BENCHMARKS(pooled_list);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,108 @@
+// bench_concurrent_forward_list.cpp
+#include "concurrent_forward_list.h"
+#include "forward_list.h"
+#include "bench_common.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// 对照组：一把互斥锁保护的有序 mys::forward_list，即现在共享有序集合的做法
+class locked_forward_list {
+    std::mutex mutex_;
+    mys::forward_list<int> list_;
+
+    // 第一个不小于 key 的元素的前一个位置
+    mys::forward_list<int>::iterator lower_bound_before(int key) {
+        auto prev = list_.before_begin();
+        for (auto it = list_.begin(); it != list_.end() && *it < key; ++it) {
+            prev = it;
+        }
+        return prev;
+    }
+
+public:
+    bool insert(int key) {
+        std::lock_guard lock(mutex_);
+        auto prev = lower_bound_before(key);
+        auto next = std::next(prev);
+        if (next != list_.end() && *next == key) return false;
+        list_.insert_after(prev, key);
+        return true;
+    }
+
+    bool erase(int key) {
+        std::lock_guard lock(mutex_);
+        auto prev = lower_bound_before(key);
+        auto next = std::next(prev);
+        if (next == list_.end() || *next != key) return false;
+        list_.erase_after(prev);
+        return true;
+    }
+
+    bool contains(int key) {
+        std::lock_guard lock(mutex_);
+        auto next = std::next(lower_bound_before(key));
+        return next != list_.end() && *next == key;
+    }
+};
+
+// 键的取值范围；预先插入一半，插入和删除各占写操作的一半，集合大小保持在一半左右
+constexpr int key_range = 1024;
+
+// 每个线程各自的 xorshift 状态，避免共享随机数生成器成为瓶颈
+static std::uint64_t next_random(std::uint64_t &state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+// range(0) 是查找所占的百分比；所有线程共享同一个集合，由 0 号线程在计时开始前建好、结束后销毁
+template <typename Set>
+static void BM_MixedOps(benchmark::State &state) {
+    static std::unique_ptr<Set> set;
+    const std::uint64_t read_percent = static_cast<std::uint64_t>(state.range(0));
+    if (state.thread_index() == 0) {
+        set = std::make_unique<Set>();
+        for (int key = 0; key < key_range; key += 2) {
+            set->insert(key);
+        }
+    }
+
+    std::uint64_t rng = bench_seed + static_cast<std::uint64_t>(state.thread_index()) * 0x9e3779b97f4a7c15ULL;
+    for (auto _ : state) {
+        std::uint64_t r = next_random(rng);
+        int key = static_cast<int>(r % key_range);
+        std::uint64_t op = (r >> 32) % 100;
+        if (op < read_percent) {
+            benchmark::DoNotOptimize(set->contains(key));
+        } else if ((op - read_percent) % 2 == 0) {
+            benchmark::DoNotOptimize(set->insert(key));
+        } else {
+            benchmark::DoNotOptimize(set->erase(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        set.reset();
+    }
+}
+
+// 查找占 90% / 50% / 0%，线程数 1, 2, 4, ..., 2 * hardware_concurrency()
+inline void MixRange(benchmark::internal::Benchmark *b) {
+    const int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int read_percent : {90, 50, 0}) {
+        b->Arg(read_percent);
+    }
+    b->ThreadRange(1, 2 * cores)->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(BM_MixedOps, mys::concurrent_forward_list<int>)->Apply(MixRange);
+BENCHMARK_TEMPLATE(BM_MixedOps, locked_forward_list)->Apply(MixRange);
+
+BENCHMARK_MAIN();
\ No newline at end of file
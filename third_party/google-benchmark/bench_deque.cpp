@@ -0,0 +1,83 @@
+// bench_deque.cpp
+#include "deque.h"
+#include "list.h"
+#include <benchmark/benchmark.h>
+#include <deque>
+#include <numeric>
+
+// 两端交替插入
+template <typename Deque>
+static void BM_Deque_PushBothEnds(benchmark::State &state) {
+    const int n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        Deque d;
+        for (int i = 0; i < n; ++i) {
+            d.push_back(i);
+            d.push_front(i);
+        }
+        benchmark::DoNotOptimize(d);
+    }
+    state.SetItemsProcessed(state.iterations() * n * 2);
+}
+BENCHMARK(BM_Deque_PushBothEnds<mys::deque<int>>)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_Deque_PushBothEnds<std::deque<int>>)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_Deque_PushBothEnds<mys::list<int>>)->Range(1 << 10, 1 << 18);
+
+// 滑动窗口：稳态下 push_back + pop_front，备用块让它不再触碰分配器
+template <typename Deque>
+static void BM_Deque_SlidingWindow(benchmark::State &state) {
+    const int window = static_cast<int>(state.range(0));
+    Deque d;
+    for (int i = 0; i < window; ++i) {
+        d.push_back(i);
+    }
+    int next = window;
+    for (auto _ : state) {
+        d.push_back(next++);
+        d.pop_front();
+        benchmark::DoNotOptimize(d.front());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Deque_SlidingWindow<mys::deque<int>>)->Arg(64)->Arg(4096)->Arg(1 << 16);
+BENCHMARK(BM_Deque_SlidingWindow<std::deque<int>>)->Arg(64)->Arg(4096)->Arg(1 << 16);
+BENCHMARK(BM_Deque_SlidingWindow<mys::list<int>>)->Arg(64)->Arg(4096)->Arg(1 << 16);
+
+// 顺序遍历
+template <typename Deque>
+static void BM_Deque_Iteration(benchmark::State &state) {
+    const int n = static_cast<int>(state.range(0));
+    Deque d;
+    for (int i = 0; i < n; ++i) {
+        d.push_back(i);
+    }
+    for (auto _ : state) {
+        long long sum = std::accumulate(d.begin(), d.end(), 0LL);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Deque_Iteration<mys::deque<int>>)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_Deque_Iteration<std::deque<int>>)->Range(1 << 10, 1 << 18);
+
+// 下标随机访问
+template <typename Deque>
+static void BM_Deque_RandomAccess(benchmark::State &state) {
+    const int n = static_cast<int>(state.range(0));
+    Deque d;
+    for (int i = 0; i < n; ++i) {
+        d.push_back(i);
+    }
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int i = 0, j = 0; i < n; ++i, j = (j + 7919) % n) {
+            sum += d[j];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Deque_RandomAccess<mys::deque<int>>)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_Deque_RandomAccess<std::deque<int>>)->Range(1 << 10, 1 << 18);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -1,256 +1,400 @@
+#include "forward_list.h"
+#include "bench_common.h"
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
 #include <forward_list>
+#include <iterator>
+#include <string>
 #include <vector>
-#include <random>
-#include <algorithm>
-#include "forward_list.h"
 
-// 测试数据大小
-constexpr int test_size = 1000;
+// 每个基准都是容器类型的模板，元素类型取 int / std::string / Pod64，
+// 规模由 SizeRange 从 1e2 扫到 1e7，数据由固定种子生成
 
-// 生成随机数的辅助函数
-std::vector<int> generate_random_data(int size) {
-    std::vector<int> data(size);
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(1, 10000);
-
-    for (int i = 0; i < size; ++i) {
-        data[i] = dis(gen);
+// 按 data 的顺序建表：倒序 push_front
+template <typename List>
+static List make_list(const std::vector<element_t<List>> &data) {
+    List l;
+    for (auto it = data.rbegin(); it != data.rend(); ++it) {
+        l.push_front(*it);
     }
-    return data;
+    return l;
 }
 
-// 测试 mys::forward_list 的插入性能 (头部插入)
-static void BM_MyForwardList_PushFront(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试头部插入性能
+template <typename List>
+static void BM_PushFront(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
-        mys::forward_list<int> list;
-        for (int i = 0; i < test_size; ++i) {
-            list.push_front(test_data[i]);
+        List l;
+        for (const auto &val : data) {
+            l.push_front(val);
         }
-        benchmark::DoNotOptimize(list);
+        benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_MyForwardList_PushFront);
 
-// 测试 std::forward_list 的插入性能 (头部插入)
-static void BM_StdForwardList_PushFront(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试 insert_after 连续追加 (返回的迭代器作为下一次的位置)
+template <typename List>
+static void BM_InsertAfter(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
-        std::forward_list<int> list;
-        for (int i = 0; i < test_size; ++i) {
-            list.push_front(test_data[i]);
+        List l;
+        auto it = l.before_begin();
+        for (const auto &val : data) {
+            it = l.insert_after(it, val);
         }
-        benchmark::DoNotOptimize(list);
+        benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_StdForwardList_PushFront);
-
-// 测试 mys::forward_list 的遍历性能
-static void BM_MyForwardList_Iteration(benchmark::State &state) {
-    mys::forward_list<int> list;
-    auto test_data = generate_random_data(test_size);
-    for (const auto &val : test_data) {
-        list.push_front(val);
-    }
 
+// 测试整段插入：先建好整条链再一次接入
+template <typename List>
+static void BM_InsertAfterRange(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
-        int sum = 0;
-        for (const auto &val : list) {
-            sum += val;
-        }
-        benchmark::DoNotOptimize(sum);
+        List l;
+        l.insert_after(l.before_begin(), data.begin(), data.end());
+        benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_MyForwardList_Iteration);
-
-// 测试 std::forward_list 的遍历性能
-static void BM_StdForwardList_Iteration(benchmark::State &state) {
-    std::forward_list<int> list;
-    auto test_data = generate_random_data(test_size);
-    for (const auto &val : test_data) {
-        list.push_front(val);
-    }
 
+// 测试遍历性能
+template <typename List>
+static void BM_Iteration(benchmark::State &state) {
+    List l = make_list<List>(make_data<element_t<List>>(static_cast<std::size_t>(state.range(0))));
     for (auto _ : state) {
-        int sum = 0;
-        for (const auto &val : list) {
-            sum += val;
+        std::uint64_t sum = 0;
+        for (const auto &val : l) {
+            sum += bench_key(val);
         }
         benchmark::DoNotOptimize(sum);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_StdForwardList_Iteration);
-
-// 测试 mys::forward_list 的查找性能
-static void BM_MyForwardList_Find(benchmark::State &state) {
-    mys::forward_list<int> list;
-    auto test_data = generate_random_data(test_size);
-    for (const auto &val : test_data) {
-        list.push_front(val);
-    }
 
+// 测试查找性能：查找中间位置的值
+template <typename List>
+static void BM_Find(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto data = make_data<element_t<List>>(n);
+    List l = make_list<List>(data);
     for (auto _ : state) {
-        // 查找中间值
-        auto it = std::find(list.begin(), list.end(), test_data[test_size / 2]);
+        auto it = std::find(l.begin(), l.end(), data[n / 2]);
         benchmark::DoNotOptimize(it);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
 }
-BENCHMARK(BM_MyForwardList_Find);
-
-// 测试 std::forward_list 的查找性能
-static void BM_StdForwardList_Find(benchmark::State &state) {
-    std::forward_list<int> list;
-    auto test_data = generate_random_data(test_size);
-    for (const auto &val : test_data) {
-        list.push_front(val);
-    }
 
+// 测试逐个 pop_front 清空
+template <typename List>
+static void BM_PopFront(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
-        // 查找中间值
-        auto it = std::find(list.begin(), list.end(), test_data[test_size / 2]);
-        benchmark::DoNotOptimize(it);
+        state.PauseTiming();
+        List l = make_list<List>(data);
+        state.ResumeTiming();
+
+        while (!l.empty()) {
+            l.pop_front();
+        }
+        benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_StdForwardList_Find);
 
-// 测试 mys::forward_list 的删除性能
-static void BM_MyForwardList_Remove(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试区间 erase_after：删除中间一半
+template <typename List>
+static void BM_EraseAfterRange(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto data = make_data<element_t<List>>(n);
     for (auto _ : state) {
         state.PauseTiming();
-        mys::forward_list<int> list;
-        for (const auto &val : test_data) {
-            list.push_front(val);
-        }
+        List l = make_list<List>(data);
+        auto first = std::next(l.before_begin(), static_cast<std::ptrdiff_t>(n / 4));
+        auto last = std::next(first, static_cast<std::ptrdiff_t>(n / 2 + 1));
         state.ResumeTiming();
 
-        list.remove(test_data[test_size / 2]);
-        benchmark::DoNotOptimize(list);
+        l.erase_after(first, last);
+        benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
 }
-BENCHMARK(BM_MyForwardList_Remove);
 
-// 测试 std::forward_list 的删除性能
-static void BM_StdForwardList_Remove(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试删除指定值
+template <typename List>
+static void BM_Remove(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto data = make_data<element_t<List>>(n);
     for (auto _ : state) {
         state.PauseTiming();
-        std::forward_list<int> list;
-        for (const auto &val : test_data) {
-            list.push_front(val);
-        }
+        List l = make_list<List>(data);
         state.ResumeTiming();
 
-        list.remove(test_data[test_size / 2]);
-        benchmark::DoNotOptimize(list);
+        l.remove(data[n / 2]);
+        benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_StdForwardList_Remove);
 
-// 测试 mys::forward_list 的反转性能
-static void BM_MyForwardList_Reverse(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试按谓词删除：大约删除一半元素
+template <typename List>
+static void BM_RemoveIf(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
         state.PauseTiming();
-        mys::forward_list<int> list;
-        for (const auto &val : test_data) {
-            list.push_front(val);
-        }
+        List l = make_list<List>(data);
         state.ResumeTiming();
 
-        list.reverse();
-        benchmark::DoNotOptimize(list);
+        l.remove_if([](const auto &val) { return bench_key(val) % 2 == 0; });
+        benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_MyForwardList_Reverse);
 
-// 测试 std::forward_list 的反转性能
-static void BM_StdForwardList_Reverse(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试去重性能：每个值连续出现两次
+template <typename List>
+static void BM_Unique(benchmark::State &state) {
+    using T = element_t<List>;
+    const auto n = static_cast<std::size_t>(state.range(0));
+    std::vector<T> data;
+    data.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data.push_back(make_value<T>(i / 2));
+    }
     for (auto _ : state) {
         state.PauseTiming();
-        std::forward_list<int> list;
-        for (const auto &val : test_data) {
-            list.push_front(val);
-        }
+        List l = make_list<List>(data);
         state.ResumeTiming();
 
-        list.reverse();
-        benchmark::DoNotOptimize(list);
+        l.unique();
+        benchmark::DoNotOptimize(l);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 测试反转性能
+template <typename List>
+static void BM_Reverse(benchmark::State &state) {
+    List l = make_list<List>(make_data<element_t<List>>(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        l.reverse();
+        benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_StdForwardList_Reverse);
 
-// 测试 mys::forward_list 的拼接性能
-static void BM_MyForwardList_Splice(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试拼接性能：把另一个 n/2 元素的链表整体接到开头
+template <typename List>
+static void BM_SpliceAfter(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto data = make_data<element_t<List>>(n);
+    std::vector<element_t<List>> front(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(n / 2));
+    std::vector<element_t<List>> back(data.begin() + static_cast<std::ptrdiff_t>(n / 2), data.end());
     for (auto _ : state) {
         state.PauseTiming();
-        mys::forward_list<int> list1, list2;
-        for (int i = 0; i < test_size / 2; ++i) {
-            list1.push_front(test_data[i]);
-            list2.push_front(test_data[test_size / 2 + i]);
-        }
+        List l1 = make_list<List>(front);
+        List l2 = make_list<List>(back);
         state.ResumeTiming();
 
-        list1.splice_after(list1.before_begin(), list2);
-        benchmark::DoNotOptimize(list1);
+        l1.splice_after(l1.before_begin(), l2);
+        benchmark::DoNotOptimize(l1);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
 }
-BENCHMARK(BM_MyForwardList_Splice);
 
-// 测试 std::forward_list 的拼接性能
-static void BM_StdForwardList_Splice(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试区间拼接：把另一个链表中间的一半移到开头
+template <typename List>
+static void BM_SpliceAfterRange(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto data = make_data<element_t<List>>(n);
     for (auto _ : state) {
         state.PauseTiming();
-        std::forward_list<int> list1, list2;
-        for (int i = 0; i < test_size / 2; ++i) {
-            list1.push_front(test_data[i]);
-            list2.push_front(test_data[test_size / 2 + i]);
-        }
+        List l1;
+        List l2 = make_list<List>(data);
+        auto first = std::next(l2.before_begin(), static_cast<std::ptrdiff_t>(n / 4));
+        auto last = std::next(first, static_cast<std::ptrdiff_t>(n / 2 + 1));
         state.ResumeTiming();
 
-        list1.splice_after(list1.before_begin(), list2);
-        benchmark::DoNotOptimize(list1);
+        l1.splice_after(l1.before_begin(), l2, first, last);
+        benchmark::DoNotOptimize(l1);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+}
+
+// 测试拷贝构造
+template <typename List>
+static void BM_Copy(benchmark::State &state) {
+    List l = make_list<List>(make_data<element_t<List>>(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        List copy(l);
+        benchmark::DoNotOptimize(copy);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_StdForwardList_Splice);
 
-// 测试 mys::forward_list 的去重性能
-static void BM_MyForwardList_Unique(benchmark::State &state) {
+// 测试拷贝赋值到已有同样长度内容的链表
+template <typename List>
+static void BM_Assign(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    List source = make_list<List>(make_data<element_t<List>>(n));
+    List target = make_list<List>(make_data<element_t<List>>(n, 1));
+    for (auto _ : state) {
+        target = source;
+        benchmark::DoNotOptimize(target);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 测试 <=>：两个相等的链表需要比较到末尾
+template <typename List>
+static void BM_Compare(benchmark::State &state) {
+    List a = make_list<List>(make_data<element_t<List>>(static_cast<std::size_t>(state.range(0))));
+    List b = a;
+    for (auto _ : state) {
+        auto order = a <=> b;
+        benchmark::DoNotOptimize(order);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 测试排序性能
+template <typename List>
+static void BM_Sort(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
         state.PauseTiming();
-        mys::forward_list<int> list;
-        // 创建有重复元素的列表
-        for (int i = 0; i < test_size; ++i) {
-            list.push_front(i / 2); // 每个数字出现两次
-        }
+        List l = make_list<List>(data);
         state.ResumeTiming();
 
-        list.unique();
-        benchmark::DoNotOptimize(list);
+        l.sort();
+        benchmark::DoNotOptimize(l);
     }
+    state.SetComplexityN(state.range(0));
 }
-BENCHMARK(BM_MyForwardList_Unique);
 
-// 测试 std::forward_list 的去重性能
-static void BM_StdForwardList_Unique(benchmark::State &state) {
+// 测试两个各含 n 个元素的有序链表的归并
+template <typename List>
+static void BM_Merge(benchmark::State &state) {
+    using T = element_t<List>;
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto left = make_data<T>(n);
+    auto right = make_data<T>(n, 1);
+    std::sort(left.begin(), left.end());
+    std::sort(right.begin(), right.end());
     for (auto _ : state) {
         state.PauseTiming();
-        std::forward_list<int> list;
-        // 创建有重复元素的列表
-        for (int i = 0; i < test_size; ++i) {
-            list.push_front(i / 2); // 每个数字出现两次
-        }
+        List a = make_list<List>(left);
+        List b = make_list<List>(right);
         state.ResumeTiming();
 
-        list.unique();
-        benchmark::DoNotOptimize(list);
+        a.merge(b);
+        benchmark::DoNotOptimize(a);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+// 在尾部追加：跟踪尾指针的链表直接 push_back，
+// 其余链表由调用者维护指向最后一个元素的迭代器 last
+template <typename List, typename It, typename T>
+static void append_back(List &l, It &last, const T &value) {
+    if constexpr (requires { l.push_back(value); }) {
+        l.push_back(value);
+    } else {
+        last = l.insert_after(last, value);
     }
 }
-BENCHMARK(BM_StdForwardList_Unique);
+
+// 队列负载：先入队 n 个，再交替入队/出队 n 次
+template <typename List>
+static void BM_Queue(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        List q;
+        auto last = q.before_begin();
+        for (const auto &val : data) {
+            append_back(q, last, val);
+        }
+        for (const auto &val : data) {
+            append_back(q, last, val);
+            q.pop_front();
+        }
+        benchmark::DoNotOptimize(q);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+// 拼接负载：把 n 个元素的链表整体接到另一个 n 元素链表的末尾
+// 建表和销毁都不计时，只手动计时 splice_after 本身：跟踪尾指针时应与 n 无关
+template <typename List>
+static void BM_Concat(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto data = make_data<element_t<List>>(n);
+    for (auto _ : state) {
+        List a;
+        List b;
+        auto last = a.before_begin();
+        auto b_last = b.before_begin();
+        for (const auto &val : data) {
+            append_back(a, last, val);
+            append_back(b, b_last, val);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        if constexpr (requires { a.before_end(); }) {
+            a.splice_after(a.before_end(), b);
+        } else {
+            a.splice_after(last, b);
+        }
+        auto stop = std::chrono::steady_clock::now();
+        benchmark::DoNotOptimize(a);
+        state.SetIterationTime(std::chrono::duration<double>(stop - start).count());
+    }
+}
+
+#define FORWARD_LIST_BENCHMARKS(List)                                                      \
+    BENCHMARK_TEMPLATE(BM_PushFront, List)->Apply(SizeRange);                              \
+    BENCHMARK_TEMPLATE(BM_InsertAfter, List)->Apply(SizeRange);                            \
+    BENCHMARK_TEMPLATE(BM_InsertAfterRange, List)->Apply(SizeRange);                       \
+    BENCHMARK_TEMPLATE(BM_Iteration, List)->Apply(SizeRange);                              \
+    BENCHMARK_TEMPLATE(BM_Find, List)->Apply(SizeRange);                                   \
+    BENCHMARK_TEMPLATE(BM_PopFront, List)->Apply(SizeRange);                               \
+    BENCHMARK_TEMPLATE(BM_EraseAfterRange, List)->Apply(SizeRange);                        \
+    BENCHMARK_TEMPLATE(BM_Remove, List)->Apply(SizeRange);                                 \
+    BENCHMARK_TEMPLATE(BM_RemoveIf, List)->Apply(SizeRange);                               \
+    BENCHMARK_TEMPLATE(BM_Unique, List)->Apply(SizeRange);                                 \
+    BENCHMARK_TEMPLATE(BM_Reverse, List)->Apply(SizeRange);                                \
+    BENCHMARK_TEMPLATE(BM_SpliceAfter, List)->Apply(SizeRange);                            \
+    BENCHMARK_TEMPLATE(BM_SpliceAfterRange, List)->Apply(SizeRange);                       \
+    BENCHMARK_TEMPLATE(BM_Copy, List)->Apply(SizeRange);                                   \
+    BENCHMARK_TEMPLATE(BM_Assign, List)->Apply(SizeRange);                                 \
+    BENCHMARK_TEMPLATE(BM_Compare, List)->Apply(SizeRange);                                \
+    BENCHMARK_TEMPLATE(BM_Sort, List)->Apply(SizeRange)->Complexity(benchmark::oNLogN);    \
+    BENCHMARK_TEMPLATE(BM_Merge, List)->Apply(SizeRange)
+
+#define ALL_FORWARD_LIST_BENCHMARKS(T)           \
+    FORWARD_LIST_BENCHMARKS(mys::forward_list<T>); \
+    FORWARD_LIST_BENCHMARKS(std::forward_list<T>)
+
+ALL_FORWARD_LIST_BENCHMARKS(int);
+ALL_FORWARD_LIST_BENCHMARKS(std::string);
+ALL_FORWARD_LIST_BENCHMARKS(Pod64);
+
+// 跟踪尾指针的 tail_forward_list 与当前的 forward_list / std::forward_list 对比
+#define TAIL_BENCHMARKS(List)                                   \
+    BENCHMARK_TEMPLATE(BM_Queue, List)->Apply(SizeRange);       \
+    BENCHMARK_TEMPLATE(BM_Concat, List)->Apply(SizeRange)->UseManualTime()->Iterations(16)
+
+#define ALL_TAIL_BENCHMARKS(T)                      \
+    TAIL_BENCHMARKS(mys::tail_forward_list<T>);     \
+    TAIL_BENCHMARKS(mys::forward_list<T>);          \
+    TAIL_BENCHMARKS(std::forward_list<T>)
+
+ALL_TAIL_BENCHMARKS(int);
+ALL_TAIL_BENCHMARKS(std::string);
+ALL_TAIL_BENCHMARKS(Pod64);
 
 BENCHMARK_MAIN();
\ No newline at end of file
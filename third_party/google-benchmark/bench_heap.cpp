@@ -0,0 +1,166 @@
+// bench_heap.cpp
+#include "heap.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+// 固定种子的随机有向图（邻接表），保证各实现跑的是同一张图
+struct Graph {
+    struct Edge {
+        std::uint32_t to;
+        std::uint32_t weight;
+    };
+    std::vector<std::vector<Edge>> adjacency;
+};
+
+static const Graph &make_graph(std::size_t vertices, std::size_t degree) {
+    static std::vector<std::pair<std::pair<std::size_t, std::size_t>, Graph>> cache;
+    for (auto &[key, graph] : cache) {
+        if (key == std::make_pair(vertices, degree)) return graph;
+    }
+
+    std::mt19937 gen(12345);
+    std::uniform_int_distribution<std::uint32_t> vertex(0, static_cast<std::uint32_t>(vertices - 1));
+    std::uniform_int_distribution<std::uint32_t> weight(1, 1000);
+    Graph graph;
+    graph.adjacency.resize(vertices);
+    for (std::size_t v = 0; v < vertices; ++v) {
+        // 先连一条环边保证连通
+        graph.adjacency[v].push_back({static_cast<std::uint32_t>((v + 1) % vertices), weight(gen)});
+        for (std::size_t e = 1; e < degree; ++e) {
+            graph.adjacency[v].push_back({vertex(gen), weight(gen)});
+        }
+    }
+    cache.emplace_back(std::make_pair(vertices, degree), std::move(graph));
+    return cache.back().second;
+}
+
+constexpr std::uint64_t infinity = std::numeric_limits<std::uint64_t>::max();
+
+// Dijkstra：mys::heap 通过句柄 decrease_key，堆中每个顶点至多一项
+template <std::size_t D>
+static void BM_Dijkstra_Heap(benchmark::State &state) {
+    const Graph &graph = make_graph(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+    std::size_t n = graph.adjacency.size();
+
+    using Item = std::pair<std::uint64_t, std::uint32_t>;
+    using Heap = mys::heap<Item, std::greater<Item>, D>;
+
+    for (auto _ : state) {
+        std::vector<std::uint64_t> dist(n, infinity);
+        std::vector<typename Heap::handle> handles(n);
+        Heap queue;
+        queue.reserve(n);
+
+        dist[0] = 0;
+        handles[0] = queue.push({0, 0});
+        while (!queue.empty()) {
+            auto [d, u] = queue.top();
+            queue.pop();
+            for (const auto &edge : graph.adjacency[u]) {
+                std::uint64_t candidate = d + edge.weight;
+                if (candidate >= dist[edge.to]) continue;
+                if (dist[edge.to] == infinity) {
+                    handles[edge.to] = queue.push({candidate, edge.to});
+                } else {
+                    queue.decrease_key(handles[edge.to], {candidate, edge.to});
+                }
+                dist[edge.to] = candidate;
+            }
+        }
+        benchmark::DoNotOptimize(dist.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+}
+
+// 基准：std::priority_queue 不支持 decrease_key，只能重复插入并在弹出时跳过过期项
+static void BM_Dijkstra_PriorityQueue(benchmark::State &state) {
+    const Graph &graph = make_graph(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+    std::size_t n = graph.adjacency.size();
+
+    using Item = std::pair<std::uint64_t, std::uint32_t>;
+
+    for (auto _ : state) {
+        std::vector<std::uint64_t> dist(n, infinity);
+        std::priority_queue<Item, std::vector<Item>, std::greater<Item>> queue;
+
+        dist[0] = 0;
+        queue.push({0, 0});
+        while (!queue.empty()) {
+            auto [d, u] = queue.top();
+            queue.pop();
+            if (d != dist[u]) continue;
+            for (const auto &edge : graph.adjacency[u]) {
+                std::uint64_t candidate = d + edge.weight;
+                if (candidate >= dist[edge.to]) continue;
+                dist[edge.to] = candidate;
+                queue.push({candidate, edge.to});
+            }
+        }
+        benchmark::DoNotOptimize(dist.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+}
+
+// 参数：{顶点数, 平均出度}
+static void DijkstraArgs(benchmark::internal::Benchmark *b) {
+    for (long long vertices : {1 << 12, 1 << 16, 1 << 18}) {
+        for (long long degree : {4, 16}) {
+            b->Args({vertices, degree});
+        }
+    }
+}
+
+BENCHMARK(BM_Dijkstra_Heap<2>)->Apply(DijkstraArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Dijkstra_Heap<4>)->Apply(DijkstraArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Dijkstra_Heap<8>)->Apply(DijkstraArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Dijkstra_PriorityQueue)->Apply(DijkstraArgs)->Unit(benchmark::kMillisecond);
+
+// 纯 push 后全部 pop（堆排序负载），不涉及句柄更新
+template <std::size_t D>
+static void BM_PushPop_Heap(benchmark::State &state) {
+    std::size_t n = static_cast<std::size_t>(state.range(0));
+    std::mt19937 gen(42);
+    std::vector<std::uint32_t> keys(n);
+    for (auto &k : keys) k = gen();
+
+    for (auto _ : state) {
+        mys::heap<std::uint32_t, std::less<std::uint32_t>, D> h;
+        h.reserve(n);
+        for (auto k : keys) h.push(k);
+        while (!h.empty()) {
+            benchmark::DoNotOptimize(h.top());
+            h.pop();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+}
+
+static void BM_PushPop_PriorityQueue(benchmark::State &state) {
+    std::size_t n = static_cast<std::size_t>(state.range(0));
+    std::mt19937 gen(42);
+    std::vector<std::uint32_t> keys(n);
+    for (auto &k : keys) k = gen();
+
+    for (auto _ : state) {
+        std::priority_queue<std::uint32_t> h;
+        for (auto k : keys) h.push(k);
+        while (!h.empty()) {
+            benchmark::DoNotOptimize(h.top());
+            h.pop();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+}
+
+BENCHMARK(BM_PushPop_Heap<2>)->RangeMultiplier(16)->Range(1 << 10, 1 << 18)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PushPop_Heap<4>)->RangeMultiplier(16)->Range(1 << 10, 1 << 18)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PushPop_Heap<8>)->RangeMultiplier(16)->Range(1 << 10, 1 << 18)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PushPop_PriorityQueue)->RangeMultiplier(16)->Range(1 << 10, 1 << 18)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
\ No newline at end of file
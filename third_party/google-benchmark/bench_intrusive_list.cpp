@@ -0,0 +1,130 @@
+// bench_intrusive_list.cpp
+#include "intrusive_list.h"
+#include "list.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// 模拟已经放在对象池里的对象：链表只负责串联，不负责分配
+struct Object {
+    std::uint64_t payload = 0;
+    mys::list_hook<Object> hook;
+};
+
+using IntrusiveList = mys::intrusive_list<Object, &Object::hook>;
+using PointerList = mys::list<Object *>;
+
+static std::vector<Object> make_pool(std::size_t n) {
+    std::vector<Object> pool(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        pool[i].payload = i;
+    }
+    return pool;
+}
+
+// 串联 n 个对象再清空：intrusive_list 不分配，mys::list<Object *> 每个元素一次分配
+static void BM_Intrusive_LinkAll(benchmark::State &state) {
+    auto pool = make_pool(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        IntrusiveList l;
+        for (auto &obj : pool) {
+            l.push_back(obj);
+        }
+        benchmark::DoNotOptimize(l.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PointerList_LinkAll(benchmark::State &state) {
+    auto pool = make_pool(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        PointerList l;
+        for (auto &obj : pool) {
+            l.push_back(&obj);
+        }
+        benchmark::DoNotOptimize(l.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 遍历并读取对象字段：mys::list<Object *> 多一次经由 Node::val 的间接访问
+static void BM_Intrusive_Traverse(benchmark::State &state) {
+    auto pool = make_pool(static_cast<std::size_t>(state.range(0)));
+    IntrusiveList l;
+    for (auto &obj : pool) {
+        l.push_back(obj);
+    }
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (const Object &obj : l) {
+            sum += obj.payload;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PointerList_Traverse(benchmark::State &state) {
+    auto pool = make_pool(static_cast<std::size_t>(state.range(0)));
+    PointerList l;
+    for (auto &obj : pool) {
+        l.push_back(&obj);
+    }
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (const Object *obj : l) {
+            sum += obj->payload;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 随机摘除一个对象再放回末尾（类似 LRU 的 touch）。
+// intrusive_list 直接从对象定位；mys::list 需要额外保存每个对象的迭代器
+static void BM_Intrusive_Touch(benchmark::State &state) {
+    std::size_t n = static_cast<std::size_t>(state.range(0));
+    auto pool = make_pool(n);
+    IntrusiveList l;
+    for (auto &obj : pool) {
+        l.push_back(obj);
+    }
+    std::mt19937 gen(2024);
+    for (auto _ : state) {
+        for (int i = 0; i < 1024; ++i) {
+            Object &obj = pool[gen() % n];
+            l.erase(obj);
+            l.push_back(obj);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+static void BM_PointerList_Touch(benchmark::State &state) {
+    std::size_t n = static_cast<std::size_t>(state.range(0));
+    auto pool = make_pool(n);
+    PointerList l;
+    std::vector<PointerList::iterator> where(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        where[i] = l.insert(l.end(), &pool[i]);
+    }
+    std::mt19937 gen(2024);
+    for (auto _ : state) {
+        for (int i = 0; i < 1024; ++i) {
+            std::size_t k = gen() % n;
+            l.erase(where[k]);
+            where[k] = l.insert(l.end(), &pool[k]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+BENCHMARK(BM_Intrusive_LinkAll)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_PointerList_LinkAll)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_Intrusive_Traverse)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_PointerList_Traverse)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_Intrusive_Touch)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_PointerList_Touch)->Range(1 << 8, 1 << 16);
+
+BENCHMARK_MAIN();
\ No newline at end of file
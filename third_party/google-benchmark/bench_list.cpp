@@ -1,184 +1,377 @@
 // benchmark_list.cpp
 #include "list.h"
+#include "unrolled_list.h"
+#include "bench_common.h"
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <iterator>
 #include <list>
+#include <string>
 #include <vector>
-#include <random>
 
-// 测试数据大小
-constexpr int test_size = 1000;
+// 每个基准都是容器类型的模板，元素类型取 int / std::string / Pod64，
+// 规模由 SizeRange 从 1e2 扫到 1e7，数据由固定种子生成
 
-// 生成随机数的辅助函数
-std::vector<int> generate_random_data(int size) {
-    std::vector<int> data(size);
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(1, 10000);
-
-    for (int i = 0; i < size; ++i) {
-        data[i] = dis(gen);
+template <typename List>
+static List make_list(const std::vector<element_t<List>> &data) {
+    List l;
+    for (const auto &val : data) {
+        l.push_back(val);
     }
-    return data;
+    return l;
 }
 
-// 测试 mys::list 的 push_back 性能
-static void BM_List_PushBack(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试 push_back 性能
+template <typename List>
+static void BM_PushBack(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
-        mys::list<int> l;
-        for (int i = 0; i < test_size; ++i) {
-            l.push_back(test_data[i]);
+        List l;
+        for (const auto &val : data) {
+            l.push_back(val);
         }
         benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_List_PushBack);
 
-// 测试 std::list 的 push_back 性能作为对比
-static void BM_StdList_PushBack(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试 push_front 性能
+template <typename List>
+static void BM_PushFront(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
-        std::list<int> l;
-        for (int i = 0; i < test_size; ++i) {
-            l.push_back(test_data[i]);
+        List l;
+        for (const auto &val : data) {
+            l.push_front(val);
         }
         benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_StdList_PushBack);
 
-// 测试 mys::list 的 push_front 性能
-static void BM_List_PushFront(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试 pop_front / pop_back 交替清空
+template <typename List>
+static void BM_PopBothEnds(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
-        mys::list<int> l;
-        for (int i = 0; i < test_size; ++i) {
-            l.push_front(test_data[i]);
+        state.PauseTiming();
+        List l = make_list<List>(data);
+        state.ResumeTiming();
+
+        while (!l.empty()) {
+            l.pop_front();
+            if (!l.empty()) l.pop_back();
         }
         benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_List_PushFront);
 
-// 测试 std::list 的 push_front 性能作为对比
-static void BM_StdList_PushFront(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试反向遍历：每一步都走 prev，包括从 end() 退到最后一个元素
+template <typename List>
+static void BM_ReverseIteration(benchmark::State &state) {
+    List l = make_list<List>(make_data<element_t<List>>(static_cast<std::size_t>(state.range(0))));
     for (auto _ : state) {
-        std::list<int> l;
-        for (int i = 0; i < test_size; ++i) {
-            l.push_front(test_data[i]);
+        std::uint64_t sum = 0;
+        for (auto it = l.rbegin(); it != l.rend(); ++it) {
+            sum += bench_key(*it);
         }
-        benchmark::DoNotOptimize(l);
+        benchmark::DoNotOptimize(sum);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_StdList_PushFront);
-
-// 测试 mys::list 的遍历性能
-static void BM_List_Iteration(benchmark::State &state) {
-    mys::list<int> l;
-    auto test_data = generate_random_data(test_size);
-    for (const auto &val : test_data) {
-        l.push_back(val);
-    }
 
+// 测试遍历性能
+template <typename List>
+static void BM_Iteration(benchmark::State &state) {
+    List l = make_list<List>(make_data<element_t<List>>(static_cast<std::size_t>(state.range(0))));
     for (auto _ : state) {
-        int sum = 0;
+        std::uint64_t sum = 0;
         for (const auto &val : l) {
-            sum += val;
+            sum += bench_key(val);
         }
         benchmark::DoNotOptimize(sum);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_List_Iteration);
 
-// 测试 std::list 的遍历性能作为对比
-static void BM_StdList_Iteration(benchmark::State &state) {
-    std::list<int> l;
-    auto test_data = generate_random_data(test_size);
-    for (const auto &val : test_data) {
-        l.push_back(val);
+// 测试整段插入：先建好整条链再一次接入
+template <typename List>
+static void BM_InsertRange(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        List l;
+        l.insert(l.end(), data.begin(), data.end());
+        benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
 
+// 测试在开始位置连续插入 (insert 返回的迭代器作为下一次的位置)
+template <typename List>
+static void BM_InsertFront(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
-        int sum = 0;
-        for (const auto &val : l) {
-            sum += val;
+        List l;
+        auto it = l.begin();
+        for (const auto &val : data) {
+            it = l.insert(it, val);
         }
-        benchmark::DoNotOptimize(sum);
+        benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_StdList_Iteration);
 
-// 测试 mys::list 的插入性能 (在开始位置插入)
-static void BM_List_Insert(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试中间位置的插入 (已知位置，迭代器在计时外定位)
+template <typename List>
+static void BM_InsertMiddle(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto data = make_data<element_t<List>>(n);
     for (auto _ : state) {
         state.PauseTiming();
-        mys::list<int> l;
+        List l = make_list<List>(data);
+        auto it = l.begin();
+        std::advance(it, n / 2);
         state.ResumeTiming();
 
-        auto it = l.begin();
-        for (int i = 0; i < test_size; ++i) {
-            it = l.insert(it, test_data[i]);
+        for (const auto &val : data) {
+            it = l.insert(it, val);
         }
         benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_List_Insert);
 
-// 测试 std::list 的插入性能 (在开始位置插入)作为对比
-static void BM_StdList_Insert(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试逐个 erase(begin()) 清空
+template <typename List>
+static void BM_EraseFront(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
         state.PauseTiming();
-        std::list<int> l;
+        List l = make_list<List>(data);
         state.ResumeTiming();
 
-        auto it = l.begin();
-        for (int i = 0; i < test_size; ++i) {
-            it = l.insert(it, test_data[i]);
+        while (!l.empty()) {
+            l.erase(l.begin());
         }
         benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-BENCHMARK(BM_StdList_Insert);
 
-// 测试 mys::list 的 erase 性能
-static void BM_List_Erase(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试区间 erase：删除中间一半
+template <typename List>
+static void BM_EraseRange(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto data = make_data<element_t<List>>(n);
     for (auto _ : state) {
         state.PauseTiming();
-        mys::list<int> l;
-        for (const auto &val : test_data) {
-            l.push_back(val);
-        }
+        List l = make_list<List>(data);
+        auto first = std::next(l.begin(), static_cast<std::ptrdiff_t>(n / 4));
+        auto last = std::next(first, static_cast<std::ptrdiff_t>(n / 2));
         state.ResumeTiming();
 
-        while (!l.empty()) {
-            l.erase(l.begin());
-        }
+        l.erase(first, last);
         benchmark::DoNotOptimize(l);
     }
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
 }
-BENCHMARK(BM_List_Erase);
 
-// 测试 std::list 的 erase 性能作为对比
-static void BM_StdList_Erase(benchmark::State &state) {
-    auto test_data = generate_random_data(test_size);
+// 测试拷贝构造
+template <typename List>
+static void BM_Copy(benchmark::State &state) {
+    List l = make_list<List>(make_data<element_t<List>>(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        List copy(l);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 测试拷贝赋值到已有同样长度内容的链表
+template <typename List>
+static void BM_Assign(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    List source = make_list<List>(make_data<element_t<List>>(n));
+    List target = make_list<List>(make_data<element_t<List>>(n, 1));
+    for (auto _ : state) {
+        target = source;
+        benchmark::DoNotOptimize(target);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 测试 <=>：两个相等的链表需要比较到末尾
+template <typename List>
+static void BM_Compare(benchmark::State &state) {
+    List a = make_list<List>(make_data<element_t<List>>(static_cast<std::size_t>(state.range(0))));
+    List b = a;
+    for (auto _ : state) {
+        auto order = a <=> b;
+        benchmark::DoNotOptimize(order);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 测试排序性能
+template <typename List>
+static void BM_Sort(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
     for (auto _ : state) {
         state.PauseTiming();
-        std::list<int> l;
-        for (const auto &val : test_data) {
-            l.push_back(val);
-        }
+        List l = make_list<List>(data);
         state.ResumeTiming();
 
-        while (!l.empty()) {
-            l.erase(l.begin());
-        }
+        l.sort();
         benchmark::DoNotOptimize(l);
     }
+    state.SetComplexityN(state.range(0));
 }
-BENCHMARK(BM_StdList_Erase);
+
+// 旧做法：拷贝到 std::vector 排序后重建链表 (2N 次分配)
+template <typename List>
+static void BM_SortViaVector(benchmark::State &state) {
+    using T = element_t<List>;
+    auto data = make_data<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        List l = make_list<List>(data);
+        state.ResumeTiming();
+
+        std::vector<T> buffer(l.begin(), l.end());
+        std::stable_sort(buffer.begin(), buffer.end());
+        List rebuilt = make_list<List>(buffer);
+        l.swap(rebuilt);
+        benchmark::DoNotOptimize(l);
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+// 测试两个各含 n 个元素的有序链表的归并
+template <typename List>
+static void BM_Merge(benchmark::State &state) {
+    using T = element_t<List>;
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto left = make_data<T>(n);
+    auto right = make_data<T>(n, 1);
+    std::sort(left.begin(), left.end());
+    std::sort(right.begin(), right.end());
+    for (auto _ : state) {
+        state.PauseTiming();
+        List a = make_list<List>(left);
+        List b = make_list<List>(right);
+        state.ResumeTiming();
+
+        a.merge(b);
+        benchmark::DoNotOptimize(a);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+// 整表 splice 来回搬运 n 个元素：只重连两端，耗时与 n 无关
+template <typename List>
+static void BM_SpliceWhole(benchmark::State &state) {
+    List a = make_list<List>(make_data<element_t<List>>(static_cast<std::size_t>(state.range(0))));
+    List b;
+    for (auto _ : state) {
+        b.splice(b.end(), a);
+        a.splice(a.end(), b);
+        benchmark::DoNotOptimize(a);
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+// 单元素 splice：把首元素移到末尾，同样与 n 无关
+template <typename List>
+static void BM_SpliceElement(benchmark::State &state) {
+    List l = make_list<List>(make_data<element_t<List>>(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        l.splice(l.end(), l, l.begin());
+        benchmark::DoNotOptimize(l);
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+// 测试 remove_if：删除约一半元素
+template <typename List>
+static void BM_RemoveIf(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        List l = make_list<List>(data);
+        state.ResumeTiming();
+
+        auto removed = l.remove_if([](const auto &v) { return bench_key(v) % 2 == 0; });
+        benchmark::DoNotOptimize(removed);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 测试 unique：有序数据中含有重复键
+template <typename List>
+static void BM_Unique(benchmark::State &state) {
+    auto data = make_data<element_t<List>>(static_cast<std::size_t>(state.range(0)));
+    std::sort(data.begin(), data.end());
+    for (auto _ : state) {
+        state.PauseTiming();
+        List l = make_list<List>(data);
+        state.ResumeTiming();
+
+        auto removed = l.unique();
+        benchmark::DoNotOptimize(removed);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 测试原地反转
+template <typename List>
+static void BM_Reverse(benchmark::State &state) {
+    List l = make_list<List>(make_data<element_t<List>>(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        l.reverse();
+        benchmark::DoNotOptimize(l);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// mys::list 与 std::list 共有的操作
+#define LIST_BENCHMARKS(List)                                                                \
+    BENCHMARK_TEMPLATE(BM_PushBack, List)->Apply(SizeRange);                                 \
+    BENCHMARK_TEMPLATE(BM_PushFront, List)->Apply(SizeRange);                                \
+    BENCHMARK_TEMPLATE(BM_PopBothEnds, List)->Apply(SizeRange);                              \
+    BENCHMARK_TEMPLATE(BM_Iteration, List)->Apply(SizeRange);                                \
+    BENCHMARK_TEMPLATE(BM_ReverseIteration, List)->Apply(SizeRange);                         \
+    BENCHMARK_TEMPLATE(BM_InsertRange, List)->Apply(SizeRange);                              \
+    BENCHMARK_TEMPLATE(BM_InsertFront, List)->Apply(SizeRange);                              \
+    BENCHMARK_TEMPLATE(BM_InsertMiddle, List)->Apply(SizeRange);                             \
+    BENCHMARK_TEMPLATE(BM_EraseFront, List)->Apply(SizeRange);                               \
+    BENCHMARK_TEMPLATE(BM_EraseRange, List)->Apply(SizeRange);                               \
+    BENCHMARK_TEMPLATE(BM_Copy, List)->Apply(SizeRange);                                     \
+    BENCHMARK_TEMPLATE(BM_Assign, List)->Apply(SizeRange);                                   \
+    BENCHMARK_TEMPLATE(BM_Compare, List)->Apply(SizeRange);                                  \
+    BENCHMARK_TEMPLATE(BM_Sort, List)->Apply(SizeRange)->Complexity(benchmark::oNLogN);      \
+    BENCHMARK_TEMPLATE(BM_Merge, List)->Apply(SizeRange);                                    \
+    BENCHMARK_TEMPLATE(BM_SpliceWhole, List)->Apply(SizeRange)->Complexity(benchmark::o1);   \
+    BENCHMARK_TEMPLATE(BM_SpliceElement, List)->Apply(SizeRange)->Complexity(benchmark::o1); \
+    BENCHMARK_TEMPLATE(BM_RemoveIf, List)->Apply(SizeRange);                                 \
+    BENCHMARK_TEMPLATE(BM_Unique, List)->Apply(SizeRange);                                   \
+    BENCHMARK_TEMPLATE(BM_Reverse, List)->Apply(SizeRange)
+
+// mys::unrolled_list 只比较它提供的操作
+#define UNROLLED_LIST_BENCHMARKS(List)                     \
+    BENCHMARK_TEMPLATE(BM_PushBack, List)->Apply(SizeRange);    \
+    BENCHMARK_TEMPLATE(BM_Iteration, List)->Apply(SizeRange);   \
+    BENCHMARK_TEMPLATE(BM_InsertMiddle, List)->Apply(SizeRange); \
+    BENCHMARK_TEMPLATE(BM_EraseFront, List)->Apply(SizeRange)
+
+#define ALL_LIST_BENCHMARKS(T)                                                                           \
+    LIST_BENCHMARKS(mys::list<T>);                                                                       \
+    LIST_BENCHMARKS(std::list<T>);                                                                       \
+    UNROLLED_LIST_BENCHMARKS(mys::unrolled_list<T>);                                                     \
+    BENCHMARK_TEMPLATE(BM_SortViaVector, mys::list<T>)->Apply(SizeRange)->Complexity(benchmark::oNLogN)
+
+ALL_LIST_BENCHMARKS(int);
+ALL_LIST_BENCHMARKS(std::string);
+ALL_LIST_BENCHMARKS(Pod64);
 
 BENCHMARK_MAIN();
\ No newline at end of file
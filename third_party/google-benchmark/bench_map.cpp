@@ -0,0 +1,124 @@
+// bench_map.cpp
+#include "map.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+// 固定种子的不重复随机键
+static std::vector<std::uint64_t> make_keys(std::size_t n) {
+    std::mt19937_64 gen(2024);
+    std::vector<std::uint64_t> keys(n);
+    for (auto &k : keys) k = gen() >> 1;
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(7));
+    return keys;
+}
+
+template <typename Map>
+static Map make_map(const std::vector<std::uint64_t> &keys) {
+    Map map;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        map.emplace(keys[i], i);
+    }
+    return map;
+}
+
+// 点查询：按随机顺序查找已存在的键
+template <typename Map>
+static void BM_PointLookup(benchmark::State &state) {
+    auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+    Map map = make_map<Map>(keys);
+    std::vector<std::uint64_t> queries = keys;
+    std::shuffle(queries.begin(), queries.end(), std::mt19937_64(11));
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (auto k : queries) {
+            sum += map.find(k)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+}
+
+// 区间扫描：从随机起点 lower_bound 后顺序读取 100 个元素
+template <typename Map>
+static void BM_RangeScan(benchmark::State &state) {
+    auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+    Map map = make_map<Map>(keys);
+    constexpr std::size_t scan_length = 100;
+    constexpr std::size_t scans = 1000;
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < scans; ++i) {
+            auto it = map.lower_bound(keys[i]);
+            for (std::size_t j = 0; j < scan_length && it != map.end(); ++j, ++it) {
+                sum += it->second;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(scans * scan_length));
+}
+
+// 随机顺序逐个插入
+template <typename Map>
+static void BM_RandomInsert(benchmark::State &state) {
+    auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        Map map = make_map<Map>(keys);
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+}
+
+// 已排序输入的批量构建：mys::map 使用 O(n) 的 sorted_unique 构造，
+// std::map 使用最优的 end() 提示插入
+template <typename Map>
+static void BM_BulkLoad(benchmark::State &state) {
+    auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::pair<std::uint64_t, std::size_t>> sorted;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        sorted.emplace_back(keys[i], i);
+    }
+    std::sort(sorted.begin(), sorted.end());
+
+    for (auto _ : state) {
+        if constexpr (requires { Map(mys::sorted_unique, sorted.begin(), sorted.end()); }) {
+            Map map(mys::sorted_unique, sorted.begin(), sorted.end());
+            benchmark::DoNotOptimize(map.size());
+        } else {
+            Map map;
+            for (const auto &item : sorted) {
+                map.emplace_hint(map.end(), item);
+            }
+            benchmark::DoNotOptimize(map.size());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sorted.size()));
+}
+
+using MysMap16 = mys::map<std::uint64_t, std::size_t, std::less<std::uint64_t>, 16>;
+using MysMap32 = mys::map<std::uint64_t, std::size_t, std::less<std::uint64_t>, 32>;
+using MysMap64 = mys::map<std::uint64_t, std::size_t, std::less<std::uint64_t>, 64>;
+using StdMap = std::map<std::uint64_t, std::size_t>;
+
+#define MAP_BENCHMARKS(Map)                                                                \
+    BENCHMARK(BM_PointLookup<Map>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK(BM_RangeScan<Map>)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);            \
+    BENCHMARK(BM_RandomInsert<Map>)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond); \
+    BENCHMARK(BM_BulkLoad<Map>)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond)
+
+MAP_BENCHMARKS(MysMap16);
+MAP_BENCHMARKS(MysMap32);
+MAP_BENCHMARKS(MysMap64);
+MAP_BENCHMARKS(StdMap);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,163 @@
+// bench_mpmc_queue.cpp
+#include "mpmc_queue.h"
+#include "list.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+// 对照组：互斥锁保护的 mys::list，与现有 worker pool 的做法一致
+template <typename T>
+class LockedListQueue {
+    std::mutex mutex_;
+    mys::list<T> list_;
+
+public:
+    explicit LockedListQueue(std::size_t) {}
+
+    bool try_push(const T &value) {
+        std::lock_guard lock(mutex_);
+        list_.push_back(value);
+        return true;
+    }
+
+    bool try_pop(T &out) {
+        std::lock_guard lock(mutex_);
+        if (list_.empty()) return false;
+        out = std::move(list_.front());
+        list_.pop_front();
+        return true;
+    }
+
+    template <typename InputIt>
+    std::size_t try_push_n(InputIt first, std::size_t count) {
+        std::lock_guard lock(mutex_);
+        for (std::size_t i = 0; i < count; ++i, ++first) {
+            list_.push_back(*first);
+        }
+        return count;
+    }
+
+    template <typename OutputIt>
+    std::size_t try_pop_n(OutputIt out, std::size_t max_count) {
+        std::lock_guard lock(mutex_);
+        std::size_t n = 0;
+        for (; n < max_count && !list_.empty(); ++n) {
+            *out++ = std::move(list_.front());
+            list_.pop_front();
+        }
+        return n;
+    }
+};
+
+// 每轮迭代传递的消息总数
+constexpr int total_items = 1 << 18;
+constexpr std::size_t queue_capacity = 4096;
+
+// P 个生产者、C 个消费者，batch 为 1 时走单个接口，否则走批量接口
+template <typename Queue>
+static void BM_Queue_Throughput(benchmark::State &state) {
+    const int producers = static_cast<int>(state.range(0));
+    const int consumers = static_cast<int>(state.range(1));
+    const std::size_t batch = static_cast<std::size_t>(state.range(2));
+
+    for (auto _ : state) {
+        Queue q(queue_capacity);
+        std::atomic<int> consumed{0};
+        std::vector<std::thread> threads;
+
+        for (int p = 0; p < producers; ++p) {
+            int begin = total_items / producers * p;
+            int end = p == producers - 1 ? total_items : begin + total_items / producers;
+            threads.emplace_back([&q, begin, end, batch] {
+                std::vector<int> items(batch);
+                for (int i = begin; i < end;) {
+                    std::size_t pushed;
+                    if (batch == 1) {
+                        pushed = q.try_push(i) ? 1 : 0;
+                    } else {
+                        std::size_t n = std::min<std::size_t>(batch, static_cast<std::size_t>(end - i));
+                        for (std::size_t k = 0; k < n; ++k) {
+                            items[k] = i + static_cast<int>(k);
+                        }
+                        pushed = q.try_push_n(items.begin(), n);
+                    }
+                    // 队列满时让出 CPU，避免线程数超过核数时空转
+                    if (pushed == 0) std::this_thread::yield();
+                    i += static_cast<int>(pushed);
+                }
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&q, &consumed, batch] {
+                std::vector<int> items(batch);
+                long long sum = 0;
+                while (consumed.load(std::memory_order_relaxed) < total_items) {
+                    std::size_t n = 0;
+                    if (batch == 1) {
+                        int value;
+                        if (q.try_pop(value)) {
+                            sum += value;
+                            n = 1;
+                        }
+                    } else {
+                        n = q.try_pop_n(items.begin(), batch);
+                        for (std::size_t k = 0; k < n; ++k) {
+                            sum += items[k];
+                        }
+                    }
+                    if (n) {
+                        consumed.fetch_add(static_cast<int>(n), std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                benchmark::DoNotOptimize(sum);
+            });
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * total_items);
+}
+
+// 生产者和消费者数量从 1 扩展到硬件线程数
+static void ScalingArgs(benchmark::internal::Benchmark *b) {
+    int max_threads = std::max(2, static_cast<int>(std::thread::hardware_concurrency()));
+    std::set<std::pair<int, int>> shapes;
+    for (int n = 1; 2 * n <= max_threads; n *= 2) {
+        shapes.insert({n, n});
+    }
+    shapes.insert({1, max_threads - 1});
+    shapes.insert({max_threads - 1, 1});
+    for (long long batch : {1, 32}) {
+        for (auto [producers, consumers] : shapes) {
+            b->Args({producers, consumers, batch});
+        }
+    }
+    b->ArgNames({"producers", "consumers", "batch"});
+}
+
+BENCHMARK(BM_Queue_Throughput<mys::mpmc_queue<int>>)->Apply(ScalingArgs)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Queue_Throughput<LockedListQueue<int>>)->Apply(ScalingArgs)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// 无竞争时单线程 push + pop 的固定开销
+template <typename Queue>
+static void BM_Queue_Uncontended(benchmark::State &state) {
+    Queue q(queue_capacity);
+    int value = 0;
+    for (auto _ : state) {
+        q.try_push(value);
+        q.try_pop(value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Queue_Uncontended<mys::mpmc_queue<int>>);
+BENCHMARK(BM_Queue_Uncontended<LockedListQueue<int>>);
+
+BENCHMARK_MAIN();
\ No newline at end of file
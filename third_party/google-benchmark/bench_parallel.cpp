@@ -0,0 +1,103 @@
+// bench_parallel.cpp
+#include "parallel.h"
+#include "forward_list.h"
+#include "list.h"
+#include "bench_common.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+
+// 大链表上的折叠：线程数从 1 到全部核心，规模固定为 MYS_BENCH_MAX_SIZE
+// 三种形态：每次调用都先走一遍链接找块边界、复用事先建好的 chunk_index、以及顺序 std::accumulate 基线
+// 多线程下以墙钟时间计时
+
+constexpr std::size_t parallel_size = MYS_BENCH_MAX_SIZE;
+
+template <typename List>
+const List &shared_list() {
+    // 各基准共用同一条链表，避免每个参数组合都重新分配千万个节点
+    static const List l = [] {
+        List built;
+        for (std::uint64_t key : make_data<std::uint64_t>(parallel_size)) {
+            built.push_front(key);
+        }
+        return built;
+    }();
+    return l;
+}
+
+// 线程数 1, 2, 4, ..., 以及 hardware_concurrency()
+inline void ThreadRange(benchmark::internal::Benchmark *b) {
+    const int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int t = 1; t < cores; t *= 2) {
+        b->Arg(t);
+    }
+    b->Arg(cores)->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+template <typename List>
+static void BM_Sequential_Reduce(benchmark::State &state) {
+    const List &l = shared_list<List>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(l.begin(), l.end(), std::uint64_t{0}));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(parallel_size));
+}
+
+template <typename List>
+static void BM_Parallel_Reduce(benchmark::State &state) {
+    const List &l = shared_list<List>();
+    mys::parallel::options opts{static_cast<std::size_t>(state.range(0))};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mys::parallel::reduce(l, std::uint64_t{0}, std::plus<>{}, opts));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(parallel_size));
+}
+
+template <typename List>
+static void BM_Parallel_Reduce_Index(benchmark::State &state) {
+    const List &l = shared_list<List>();
+    mys::parallel::options opts{static_cast<std::size_t>(state.range(0))};
+    mys::parallel::chunk_index index(l);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mys::parallel::reduce(index, std::uint64_t{0}, std::plus<>{}, opts));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(parallel_size));
+}
+
+// 每个元素有一定计算量时，找块边界的那一遍所占比例更小
+template <typename List>
+static void BM_Parallel_TransformReduce(benchmark::State &state) {
+    const List &l = shared_list<List>();
+    mys::parallel::options opts{static_cast<std::size_t>(state.range(0))};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mys::parallel::transform_reduce(
+            l, 0.0, std::plus<>{}, [](std::uint64_t v) { return std::sqrt(static_cast<double>(v)); }, opts));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(parallel_size));
+}
+
+template <typename List>
+static void BM_Parallel_CountIf(benchmark::State &state) {
+    const List &l = shared_list<List>();
+    mys::parallel::options opts{static_cast<std::size_t>(state.range(0))};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mys::parallel::count_if(l, [](std::uint64_t v) { return v % 3 == 0; }, opts));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(parallel_size));
+}
+
+#define PARALLEL_BENCHMARKS(List)                                                                    \
+    BENCHMARK_TEMPLATE(BM_Sequential_Reduce, List)->Unit(benchmark::kMillisecond);                   \
+    BENCHMARK_TEMPLATE(BM_Parallel_Reduce, List)->Apply(ThreadRange);                                \
+    BENCHMARK_TEMPLATE(BM_Parallel_Reduce_Index, List)->Apply(ThreadRange);                          \
+    BENCHMARK_TEMPLATE(BM_Parallel_TransformReduce, List)->Apply(ThreadRange);                       \
+    BENCHMARK_TEMPLATE(BM_Parallel_CountIf, List)->Apply(ThreadRange)
+
+PARALLEL_BENCHMARKS(mys::list<std::uint64_t>);
+PARALLEL_BENCHMARKS(mys::forward_list<std::uint64_t>);
+
+BENCHMARK_MAIN();
\ No newline at end of file
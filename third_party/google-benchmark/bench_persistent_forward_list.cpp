@@ -0,0 +1,89 @@
+// bench_persistent_forward_list.cpp
+#include "persistent_forward_list.h"
+#include "forward_list.h"
+#include "bench_common.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 快照密集的负载：一份配置链表，每个请求取一份快照（拷贝），读完丢弃。
+// mys::forward_list 的拷贝逐个复制节点，persistent_forward_list 的拷贝只增加一个计数；
+// shared_ 版本的计数是原子的，单线程下对比的是原子操作本身的开销
+
+constexpr std::int64_t snapshot_max_size = std::min<std::int64_t>(MYS_BENCH_MAX_SIZE, 100000);
+
+inline void SnapshotRange(benchmark::internal::Benchmark *b) {
+    b->RangeMultiplier(10)->Range(10, snapshot_max_size)->Unit(benchmark::kNanosecond);
+}
+
+template <typename List>
+static List make_config(std::size_t n) {
+    std::vector<element_t<List>> data = make_data<element_t<List>>(n);
+    List config;
+    for (auto it = data.rbegin(); it != data.rend(); ++it) {
+        config.push_front(*it);
+    }
+    return config;
+}
+
+// 只取快照并读首元素
+template <typename List>
+static void BM_Snapshot(benchmark::State &state) {
+    const List config = make_config<List>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        List snapshot = config;
+        benchmark::DoNotOptimize(&snapshot.front());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 取快照后完整读一遍：读的开销两者相同，差别只在拷贝
+template <typename List>
+static void BM_SnapshotScan(benchmark::State &state) {
+    const List config = make_config<List>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        List snapshot = config;
+        std::uint64_t sum = 0;
+        for (const auto &val : snapshot) {
+            sum += bench_key(val);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 64 个请求同时在处理，各持有一份快照；每 16 个请求更新一次配置的首项。
+// 持久化版本中各快照共享除首部外的全部节点，更新只分配一个节点
+template <typename List>
+static void BM_SnapshotWithUpdates(benchmark::State &state) {
+    List config = make_config<List>(static_cast<std::size_t>(state.range(0)));
+    const std::vector<element_t<List>> updates = make_data<element_t<List>>(64, 1);
+    std::array<List, 64> in_flight;
+    std::size_t request = 0;
+    for (auto _ : state) {
+        if (request % 16 == 0) {
+            config.pop_front();
+            config.push_front(updates[(request / 16) & 63]);
+        }
+        in_flight[request & 63] = config;
+        benchmark::DoNotOptimize(&in_flight[request & 63].front());
+        ++request;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+#define SNAPSHOT_BENCHMARKS(List)                                          \
+    BENCHMARK_TEMPLATE(BM_Snapshot, List)->Apply(SnapshotRange);           \
+    BENCHMARK_TEMPLATE(BM_SnapshotScan, List)->Apply(SnapshotRange);       \
+    BENCHMARK_TEMPLATE(BM_SnapshotWithUpdates, List)->Apply(SnapshotRange)
+
+SNAPSHOT_BENCHMARKS(mys::forward_list<std::uint64_t>);
+SNAPSHOT_BENCHMARKS(mys::persistent_forward_list<std::uint64_t>);
+SNAPSHOT_BENCHMARKS(mys::shared_persistent_forward_list<std::uint64_t>);
+SNAPSHOT_BENCHMARKS(mys::forward_list<std::string>);
+SNAPSHOT_BENCHMARKS(mys::persistent_forward_list<std::string>);
+
+BENCHMARK_MAIN();
\ No newline at end of file
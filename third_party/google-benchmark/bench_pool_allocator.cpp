@@ -0,0 +1,92 @@
+// bench_pool_allocator.cpp
+#include "list.h"
+#include "forward_list.h"
+#include "pool_allocator.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <random>
+
+// 测试数据大小
+constexpr int test_size = 1000;
+
+// 生成随机数的辅助函数
+std::vector<int> generate_random_data(int size) {
+    std::vector<int> data(size);
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> dis(1, 10000);
+
+    for (int i = 0; i < size; ++i) {
+        data[i] = dis(gen);
+    }
+    return data;
+}
+
+// 构建 + 析构：逐节点 malloc/free 与 slab 池 + 整体释放的对比
+template <typename List>
+static void BM_List_BuildAndDestroy(benchmark::State &state) {
+    auto test_data = generate_random_data(test_size);
+    for (auto _ : state) {
+        List l;
+        for (int i = 0; i < test_size; ++i) {
+            l.push_back(test_data[i]);
+        }
+        benchmark::DoNotOptimize(l);
+    }
+}
+BENCHMARK(BM_List_BuildAndDestroy<mys::list<int>>);
+BENCHMARK(BM_List_BuildAndDestroy<mys::list<int, mys::pool_allocator<int>>>);
+
+// 高频插入删除：释放的槽位通过空闲链表复用
+template <typename List>
+static void BM_List_Churn(benchmark::State &state) {
+    auto test_data = generate_random_data(test_size);
+    List l;
+    for (int i = 0; i < test_size; ++i) {
+        l.push_back(test_data[i]);
+    }
+    for (auto _ : state) {
+        for (int i = 0; i < test_size; ++i) {
+            l.pop_front();
+            l.push_back(test_data[i]);
+        }
+        benchmark::DoNotOptimize(l);
+    }
+}
+BENCHMARK(BM_List_Churn<mys::list<int>>);
+BENCHMARK(BM_List_Churn<mys::list<int, mys::pool_allocator<int>>>);
+
+// clear 的代价：平凡析构时池分配器一次性归还 slab
+template <typename List>
+static void BM_List_Clear(benchmark::State &state) {
+    auto test_data = generate_random_data(test_size);
+    for (auto _ : state) {
+        state.PauseTiming();
+        List l;
+        for (int i = 0; i < test_size; ++i) {
+            l.push_back(test_data[i]);
+        }
+        state.ResumeTiming();
+
+        l.clear();
+        benchmark::DoNotOptimize(l);
+    }
+}
+BENCHMARK(BM_List_Clear<mys::list<int>>);
+BENCHMARK(BM_List_Clear<mys::list<int, mys::pool_allocator<int>>>);
+
+template <typename ForwardList>
+static void BM_ForwardList_BuildAndDestroy(benchmark::State &state) {
+    auto test_data = generate_random_data(test_size);
+    for (auto _ : state) {
+        ForwardList l;
+        for (int i = 0; i < test_size; ++i) {
+            l.push_front(test_data[i]);
+        }
+        benchmark::DoNotOptimize(l);
+    }
+}
+BENCHMARK(BM_ForwardList_BuildAndDestroy<mys::forward_list<int>>);
+BENCHMARK(BM_ForwardList_BuildAndDestroy<mys::forward_list<int, mys::pool_allocator<int>>>);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,114 @@
+// bench_skip_list.cpp
+#include "skip_list.h"
+#include "forward_list.h"
+#include "bench_common.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+// 三种有序查找方式：跳表、红黑树、以及在有序 forward_list 上线性查找（现在的做法）
+// 跳表固定使用默认种子，塔高每次运行都相同
+
+// 线性查找只适合小规模，规模上限单独收紧
+constexpr std::int64_t linear_max_size = std::min<std::int64_t>(MYS_BENCH_MAX_SIZE, 100000);
+constexpr std::int64_t tree_max_size = std::min<std::int64_t>(MYS_BENCH_MAX_SIZE, 1000000);
+
+template <typename Set>
+Set build_set(const std::vector<std::uint64_t> &keys) {
+    Set set;
+    for (std::uint64_t key : keys) {
+        set.insert(key);
+    }
+    return set;
+}
+
+// 有序 forward_list：先排序去重，再按序建表
+template <>
+mys::forward_list<std::uint64_t> build_set(const std::vector<std::uint64_t> &keys) {
+    std::vector<std::uint64_t> sorted = keys;
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    mys::forward_list<std::uint64_t> list;
+    list.assign(sorted.begin(), sorted.end());
+    return list;
+}
+
+template <typename Set>
+bool lookup(const Set &set, std::uint64_t key) {
+    return set.find(key) != set.end();
+}
+
+// 有序表上的线性查找：遇到不小于 key 的元素即可停止
+template <>
+bool lookup(const mys::forward_list<std::uint64_t> &list, std::uint64_t key) {
+    for (std::uint64_t value : list) {
+        if (value >= key) return value == key;
+    }
+    return false;
+}
+
+template <typename Set>
+static void BM_Find(benchmark::State &state) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    Set set = build_set<Set>(make_data<std::uint64_t>(n));
+    // 另取一组随机键查找；键取自 bench_key_space，规模越大命中越多
+    std::vector<std::uint64_t> probes = make_data<std::uint64_t>(1024, 1);
+    std::size_t hits = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        hits += lookup(set, probes[i++ & 1023]);
+    }
+    benchmark::DoNotOptimize(hits);
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Set>
+static void BM_Insert(benchmark::State &state) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    std::vector<std::uint64_t> keys = make_data<std::uint64_t>(n);
+    for (auto _ : state) {
+        Set set = build_set<Set>(keys);
+        benchmark::DoNotOptimize(set.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+}
+
+// 三者都按键的顺序建立，节点在内存中的先后一致，比较的只是每个节点的遍历开销
+template <typename Set>
+static void BM_Iterate(benchmark::State &state) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    std::vector<std::uint64_t> keys = make_data<std::uint64_t>(n);
+    std::sort(keys.begin(), keys.end());
+    Set set = build_set<Set>(keys);
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (std::uint64_t value : set) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+}
+
+inline void TreeRange(benchmark::internal::Benchmark *b) {
+    b->RangeMultiplier(10)->Range(100, tree_max_size)->Unit(benchmark::kMicrosecond);
+}
+
+inline void LinearRange(benchmark::internal::Benchmark *b) {
+    b->RangeMultiplier(10)->Range(100, linear_max_size)->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK_TEMPLATE(BM_Find, mys::skip_list<std::uint64_t>)->Apply(TreeRange);
+BENCHMARK_TEMPLATE(BM_Find, std::set<std::uint64_t>)->Apply(TreeRange);
+BENCHMARK_TEMPLATE(BM_Find, mys::forward_list<std::uint64_t>)->Apply(LinearRange);
+
+BENCHMARK_TEMPLATE(BM_Insert, mys::skip_list<std::uint64_t>)->Apply(TreeRange);
+BENCHMARK_TEMPLATE(BM_Insert, std::set<std::uint64_t>)->Apply(TreeRange);
+
+BENCHMARK_TEMPLATE(BM_Iterate, mys::skip_list<std::uint64_t>)->Apply(TreeRange);
+BENCHMARK_TEMPLATE(BM_Iterate, std::set<std::uint64_t>)->Apply(TreeRange);
+BENCHMARK_TEMPLATE(BM_Iterate, mys::forward_list<std::uint64_t>)->Apply(TreeRange);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,66 @@
+// bench_small_vector.cpp
+#include "small_vector.h"
+#include "vector.h"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <vector>
+
+// 固定大小的负载，用于观察元素大小对内联存储的影响
+template <std::size_t Bytes>
+struct Blob {
+    std::array<char, Bytes> data{};
+
+    Blob() = default;
+    explicit Blob(int i) { data[0] = static_cast<char>(i); }
+};
+
+// 模拟每个请求里的小集合：构建 k 个元素、遍历、析构
+template <typename Vector>
+static void BM_SmallCollection(benchmark::State &state) {
+    using T = typename Vector::value_type;
+    const int k = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        Vector v;
+        for (int i = 0; i < k; ++i) {
+            v.push_back(T(i));
+        }
+        for (auto &x : v) {
+            benchmark::DoNotOptimize(x);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * k);
+}
+
+// 移动构造的代价：内联状态逐个重定位，堆状态直接接管指针
+template <typename Vector>
+static void BM_Move(benchmark::State &state) {
+    using T = typename Vector::value_type;
+    const int k = static_cast<int>(state.range(0));
+    Vector source;
+    for (int i = 0; i < k; ++i) {
+        source.push_back(T(i));
+    }
+    for (auto _ : state) {
+        Vector moved(std::move(source));
+        benchmark::DoNotOptimize(moved.data());
+        source = std::move(moved);
+    }
+}
+
+#define SMALL_COLLECTION_BENCHMARKS(T)                                        \
+    BENCHMARK(BM_SmallCollection<std::vector<T>>)->DenseRange(2, 16, 2);      \
+    BENCHMARK(BM_SmallCollection<mys::vector<T>>)->DenseRange(2, 16, 2);      \
+    BENCHMARK(BM_SmallCollection<mys::small_vector<T, 4>>)->DenseRange(2, 16, 2); \
+    BENCHMARK(BM_SmallCollection<mys::small_vector<T, 8>>)->DenseRange(2, 16, 2); \
+    BENCHMARK(BM_SmallCollection<mys::small_vector<T, 16>>)->DenseRange(2, 16, 2)
+
+SMALL_COLLECTION_BENCHMARKS(int);
+SMALL_COLLECTION_BENCHMARKS(Blob<64>);
+SMALL_COLLECTION_BENCHMARKS(Blob<256>);
+
+BENCHMARK(BM_Move<mys::vector<int>>)->Arg(4)->Arg(32);
+BENCHMARK(BM_Move<mys::small_vector<int, 8>>)->Arg(4)->Arg(32);
+BENCHMARK(BM_Move<mys::vector<Blob<256>>>)->Arg(4)->Arg(32);
+BENCHMARK(BM_Move<mys::small_vector<Blob<256>, 8>>)->Arg(4)->Arg(32);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,134 @@
+// bench_spsc_ring.cpp
+#include "spsc_ring.h"
+#include "mpmc_queue.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// 把当前线程绑定到指定 CPU（核数不足时取模），减少调度带来的抖动
+static void pin_current_thread(int cpu) {
+#ifdef __linux__
+    int count = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % count, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+// 每轮迭代传递的消息数
+constexpr int messages = 1 << 20;
+constexpr std::size_t ring_capacity = 1024;
+
+// 吞吐：一个线程写入、一个线程读出，逐条 try_push/try_pop
+template <typename Queue>
+static void BM_Throughput_Single(benchmark::State &state) {
+    for (auto _ : state) {
+        Queue q(ring_capacity);
+        std::thread consumer([&q] {
+            pin_current_thread(1);
+            int value;
+            long long sum = 0;
+            for (int received = 0; received < messages;) {
+                if (q.try_pop(value)) {
+                    sum += value;
+                    ++received;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        });
+        pin_current_thread(0);
+        for (int i = 0; i < messages;) {
+            if (q.try_push(i)) ++i;
+            else std::this_thread::yield();
+        }
+        consumer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+BENCHMARK(BM_Throughput_Single<mys::spsc_ring<int>>)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Throughput_Single<mys::mpmc_queue<int>>)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// 吞吐：reserve/commit 与 peek/release 原地批量读写
+static void BM_Throughput_Span(benchmark::State &state) {
+    const std::size_t batch = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        mys::spsc_ring<int> ring(ring_capacity);
+        std::thread consumer([&ring, batch] {
+            pin_current_thread(1);
+            long long sum = 0;
+            for (int received = 0; received < messages;) {
+                auto ready = ring.peek(batch);
+                if (ready.empty()) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (int v : ready) {
+                    sum += v;
+                }
+                ring.release(ready.size());
+                received += static_cast<int>(ready.size());
+            }
+            benchmark::DoNotOptimize(sum);
+        });
+        pin_current_thread(0);
+        for (int i = 0; i < messages;) {
+            auto slots = ring.reserve(std::min<std::size_t>(batch, static_cast<std::size_t>(messages - i)));
+            if (slots.empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (auto &slot : slots) {
+                slot = i++;
+            }
+            ring.commit(slots.size());
+        }
+        consumer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+BENCHMARK(BM_Throughput_Span)->Arg(8)->Arg(64)->Arg(256)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// 往返延迟：两个环组成 ping-pong，对端线程原样回传；每次迭代的耗时即一次往返
+template <typename Queue>
+static void BM_RoundTrip(benchmark::State &state) {
+    Queue ping(ring_capacity);
+    Queue pong(ring_capacity);
+    std::atomic<bool> stop{false};
+
+    std::thread echo([&] {
+        pin_current_thread(1);
+        int value;
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (ping.try_pop(value)) {
+                while (!pong.try_push(value)) {
+                }
+            }
+        }
+    });
+    pin_current_thread(0);
+
+    int value = 0;
+    for (auto _ : state) {
+        while (!ping.try_push(value)) {
+        }
+        while (!pong.try_pop(value)) {
+        }
+        ++value;
+    }
+    stop.store(true);
+    echo.join();
+}
+BENCHMARK(BM_RoundTrip<mys::spsc_ring<int>>)->UseRealTime();
+BENCHMARK(BM_RoundTrip<mys::mpmc_queue<int>>)->UseRealTime();
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,180 @@
+// bench_thread_pool.cpp
+#include "thread_pool.h"
+#include "vector.h"
+#include "bench_common.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// 对照组：所有线程共用一个互斥锁保护的队列，接口与 mys::thread_pool 相同
+// 取任务的策略与工作窃取一致，差别只在于一把锁还是每个线程一个无锁 deque：
+// 空闲线程从头部取最老的任务；wait() 在等待期间从尾部取最新的任务执行，
+// 既避免递归 fork/join 因工作线程全部阻塞而死锁，也保持深度优先，栈不会随任务数增长
+class shared_queue_pool {
+public:
+    struct task_group {
+        std::atomic<std::size_t> pending{0};
+    };
+
+private:
+    struct Item {
+        task_group *group;
+        std::function<void()> fn;
+    };
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Item> queue_;
+    bool stop_ = false;
+    std::vector<std::jthread> threads_;
+
+    bool try_run() {
+        Item item;
+        {
+            std::lock_guard lock(mutex_);
+            if (queue_.empty()) return false;
+            item = std::move(queue_.back());
+            queue_.pop_back();
+        }
+        item.fn();
+        item.group->pending.fetch_sub(1);
+        return true;
+    }
+
+public:
+    explicit shared_queue_pool(std::size_t threads) {
+        for (std::size_t i = 0; i < threads; ++i) {
+            threads_.emplace_back([this] {
+                while (true) {
+                    Item item;
+                    {
+                        std::unique_lock lock(mutex_);
+                        cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+                        if (queue_.empty()) return;
+                        item = std::move(queue_.front());
+                        queue_.pop_front();
+                    }
+                    item.fn();
+                    item.group->pending.fetch_sub(1);
+                }
+            });
+        }
+    }
+
+    ~shared_queue_pool() {
+        {
+            std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+    }
+
+    template <typename F>
+    void spawn(task_group &group, F &&f) {
+        group.pending.fetch_add(1);
+        {
+            std::lock_guard lock(mutex_);
+            queue_.push_back({&group, std::forward<F>(f)});
+        }
+        cv_.notify_one();
+    }
+
+    void wait(task_group &group) {
+        while (group.pending.load() != 0) {
+            if (!try_run()) std::this_thread::yield();
+        }
+    }
+};
+
+constexpr std::size_t sort_size = std::min<std::size_t>(MYS_BENCH_MAX_SIZE, 1 << 22);
+constexpr std::size_t sort_cutoff = 2048;
+
+// 递归归并排序：左半交给线程池，右半自己做，等左半完成后归并
+template <typename Pool>
+void merge_sort(Pool &pool, int *data, int *buffer, std::size_t n) {
+    if (n <= sort_cutoff) {
+        std::sort(data, data + n);
+        return;
+    }
+    std::size_t half = n / 2;
+    typename Pool::task_group group;
+    pool.spawn(group, [&pool, data, buffer, half] { merge_sort(pool, data, buffer, half); });
+    merge_sort(pool, data + half, buffer + half, n - half);
+    pool.wait(group);
+    std::merge(data, data + half, data + half, data + n, buffer);
+    std::copy(buffer, buffer + n, data);
+}
+
+// 每轮都把同一份随机数据拷回再排序，拷贝不计时
+template <typename Pool>
+static void BM_MergeSort(benchmark::State &state) {
+    Pool pool(static_cast<std::size_t>(state.range(0)));
+    auto data = make_data<int>(sort_size);
+    mys::vector<int> v(sort_size);
+    mys::vector<int> buffer(sort_size);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(data.begin(), data.end(), &v[0]);
+        state.ResumeTiming();
+        merge_sort(pool, &v[0], &buffer[0], sort_size);
+        benchmark::DoNotOptimize(&v[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sort_size));
+}
+
+static void BM_MergeSort_Sequential(benchmark::State &state) {
+    auto data = make_data<int>(sort_size);
+    mys::vector<int> v(sort_size);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(data.begin(), data.end(), &v[0]);
+        state.ResumeTiming();
+        std::sort(&v[0], &v[0] + sort_size);
+        benchmark::DoNotOptimize(&v[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sort_size));
+}
+
+// 几乎不做事的二叉递归：衡量每次 spawn/wait 本身的开销和调度器的扩展性
+template <typename Pool>
+int spawn_tree(Pool &pool, int depth) {
+    if (depth == 0) return 1;
+    int left = 0;
+    typename Pool::task_group group;
+    pool.spawn(group, [&pool, &left, depth] { left = spawn_tree(pool, depth - 1); });
+    int right = spawn_tree(pool, depth - 1);
+    pool.wait(group);
+    return left + right;
+}
+
+template <typename Pool>
+static void BM_SpawnTree(benchmark::State &state) {
+    Pool pool(static_cast<std::size_t>(state.range(0)));
+    constexpr int depth = 16;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(spawn_tree(pool, depth));
+    }
+    state.SetItemsProcessed(state.iterations() * ((1 << depth) - 1));
+}
+
+// 工作线程数 1, 2, 4, ..., 以及 hardware_concurrency()；等待的调用线程也会执行任务
+inline void WorkerRange(benchmark::internal::Benchmark *b) {
+    const int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int t = 1; t < cores; t *= 2) {
+        b->Arg(t);
+    }
+    b->Arg(cores)->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK(BM_MergeSort_Sequential)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MergeSort, mys::thread_pool)->Apply(WorkerRange);
+BENCHMARK_TEMPLATE(BM_MergeSort, shared_queue_pool)->Apply(WorkerRange);
+BENCHMARK_TEMPLATE(BM_SpawnTree, mys::thread_pool)->Apply(WorkerRange);
+BENCHMARK_TEMPLATE(BM_SpawnTree, shared_queue_pool)->Apply(WorkerRange);
+
+BENCHMARK_MAIN();
\ No newline at end of file
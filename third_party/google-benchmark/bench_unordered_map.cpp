@@ -0,0 +1,139 @@
+// bench_unordered_map.cpp
+#include "unordered_map.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// mys::unordered_map 的槽数固定为 2^16，按装载因子决定元素个数，
+// 这样每组参数都在同一张表上比较不同的装载程度
+constexpr std::size_t slot_count = std::size_t{1} << 16;
+
+static std::size_t element_count(const benchmark::State &state) {
+    return static_cast<std::size_t>(static_cast<double>(slot_count) * static_cast<double>(state.range(0)) / 1000.0);
+}
+
+// 固定种子的随机键：前 n 个插入表中，后 n 个用于未命中查找
+static std::vector<std::uint64_t> make_keys(std::size_t n) {
+    std::mt19937_64 gen(2024);
+    std::vector<std::uint64_t> keys(2 * n);
+    for (auto &k : keys) k = gen();
+    return keys;
+}
+
+template <typename Map>
+static Map make_map(const std::vector<std::uint64_t> &keys, std::size_t n) {
+    Map map;
+    map.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        map.emplace(keys[i], i);
+    }
+    return map;
+}
+
+template <typename Map>
+static void report_load(benchmark::State &state, const Map &map) {
+    state.counters["load_factor"] = static_cast<double>(map.size()) / static_cast<double>(slot_count);
+}
+
+// 命中查找：按打乱后的顺序查询已存在的键
+template <typename Map>
+static void BM_Lookup_Hit(benchmark::State &state) {
+    std::size_t n = element_count(state);
+    auto keys = make_keys(n);
+    Map map = make_map<Map>(keys, n);
+    std::vector<std::uint64_t> queries(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(n));
+    std::shuffle(queries.begin(), queries.end(), std::mt19937_64(7));
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (auto k : queries) {
+            sum += map.find(k)->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    report_load(state, map);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+}
+
+// 未命中查找：探测链越长越慢，最能体现装载因子的影响
+template <typename Map>
+static void BM_Lookup_Miss(benchmark::State &state) {
+    std::size_t n = element_count(state);
+    auto keys = make_keys(n);
+    Map map = make_map<Map>(keys, n);
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::size_t i = n; i < 2 * n; ++i) {
+            found += map.count(keys[i]);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    report_load(state, map);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+}
+
+// 插入：预留空间后从空表填充到目标装载因子
+template <typename Map>
+static void BM_Insert(benchmark::State &state) {
+    std::size_t n = element_count(state);
+    auto keys = make_keys(n);
+
+    for (auto _ : state) {
+        Map map;
+        map.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            map.emplace(keys[i], i);
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.counters["load_factor"] = static_cast<double>(n) / static_cast<double>(slot_count);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+}
+
+// 删除后立即插入新键，装载因子保持不变（开放寻址会留下墓碑）
+template <typename Map>
+static void BM_EraseInsert(benchmark::State &state) {
+    std::size_t n = element_count(state);
+    auto keys = make_keys(n);
+    Map map = make_map<Map>(keys, n);
+
+    // keys 当作环形队列：删除最旧的键，插入下一个新键
+    std::mt19937_64 gen(99);
+    std::vector<std::uint64_t> window(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(n));
+    std::size_t oldest = 0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < 1024; ++i) {
+            map.erase(window[oldest]);
+            window[oldest] = gen();
+            map.emplace(window[oldest], i);
+            oldest = oldest + 1 == n ? 0 : oldest + 1;
+        }
+    }
+    report_load(state, map);
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+// 参数为装载因子 × 1000
+static void LoadFactors(benchmark::internal::Benchmark *b) {
+    for (long long load : {500, 625, 750, 875}) {
+        b->Arg(load);
+    }
+}
+
+using MysMap = mys::unordered_map<std::uint64_t, std::size_t>;
+using StdMap = std::unordered_map<std::uint64_t, std::size_t>;
+
+BENCHMARK(BM_Lookup_Hit<MysMap>)->Apply(LoadFactors)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Lookup_Hit<StdMap>)->Apply(LoadFactors)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Lookup_Miss<MysMap>)->Apply(LoadFactors)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Lookup_Miss<StdMap>)->Apply(LoadFactors)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Insert<MysMap>)->Apply(LoadFactors)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Insert<StdMap>)->Apply(LoadFactors)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EraseInsert<MysMap>)->Apply(LoadFactors)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EraseInsert<StdMap>)->Apply(LoadFactors)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
\ No newline at end of file
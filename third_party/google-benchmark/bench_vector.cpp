@@ -0,0 +1,111 @@
+// bench_vector.cpp
+#include "vector.h"
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// 只持有堆指针和长度的字符串：可平凡重定位，扩容时 mys::vector 直接 memcpy
+class HeapString {
+    char *data_ = nullptr;
+    std::size_t size_ = 0;
+
+public:
+    HeapString() = default;
+    explicit HeapString(const char *s) : size_(std::strlen(s)) {
+        data_ = static_cast<char *>(std::malloc(size_ + 1));
+        std::memcpy(data_, s, size_ + 1);
+    }
+    HeapString(const HeapString &other) : HeapString(other.data_ ? other.data_ : "") {}
+    HeapString(HeapString &&other) noexcept : data_(other.data_), size_(other.size_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    HeapString &operator=(HeapString other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        return *this;
+    }
+    ~HeapString() { std::free(data_); }
+};
+
+template <>
+struct mys::is_trivially_relocatable<HeapString> : std::true_type {};
+
+// 测试负载：足够长以避开 std::string 的 SSO
+constexpr const char *payload = "a payload string long enough to live on the heap";
+
+template <typename T>
+T make_value(int i) {
+    if constexpr (std::is_same_v<T, int>) {
+        return i;
+    } else {
+        return T(payload);
+    }
+}
+
+// 已 reserve 的 push_back：只衡量元素构造本身
+template <typename Vector>
+static void BM_Vector_PushBack(benchmark::State &state) {
+    using T = typename Vector::value_type;
+    const int n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        Vector v;
+        v.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            v.push_back(make_value<T>(i));
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+// 不 reserve 的增长：扩容时的重定位成本
+template <typename Vector>
+static void BM_Vector_Growth(benchmark::State &state) {
+    using T = typename Vector::value_type;
+    const int n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        Vector v;
+        for (int i = 0; i < n; ++i) {
+            v.push_back(make_value<T>(i));
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+// 中间插入：尾部元素整体后移
+template <typename Vector>
+static void BM_Vector_InsertMiddle(benchmark::State &state) {
+    using T = typename Vector::value_type;
+    const int n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        Vector v;
+        for (int i = 0; i < n; ++i) {
+            v.insert(v.begin() + v.size() / 2, make_value<T>(i));
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(BM_Vector_PushBack<mys::vector<int>>)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Vector_PushBack<std::vector<int>>)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Vector_PushBack<mys::vector<std::string>>)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Vector_PushBack<std::vector<std::string>>)->Range(1 << 10, 1 << 16);
+
+BENCHMARK(BM_Vector_Growth<mys::vector<int>>)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Vector_Growth<std::vector<int>>)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Vector_Growth<mys::vector<std::string>>)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Vector_Growth<std::vector<std::string>>)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Vector_Growth<mys::vector<HeapString>>)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_Vector_Growth<std::vector<HeapString>>)->Range(1 << 10, 1 << 16);
+
+BENCHMARK(BM_Vector_InsertMiddle<mys::vector<int>>)->Range(1 << 8, 1 << 12);
+BENCHMARK(BM_Vector_InsertMiddle<std::vector<int>>)->Range(1 << 8, 1 << 12);
+BENCHMARK(BM_Vector_InsertMiddle<mys::vector<HeapString>>)->Range(1 << 8, 1 << 12);
+BENCHMARK(BM_Vector_InsertMiddle<std::vector<HeapString>>)->Range(1 << 8, 1 << 12);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,142 @@
+// bench_xor_list.cpp
+#include "xor_list.h"
+#include "list.h"
+#include "pool_allocator.h"
+#include "bench_common.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <list>
+#include <memory>
+
+// 小元素常驻场景：比较每个元素占用的字节数，以及两端操作和双向遍历的速度
+// 节点在 malloc 下会被向上取整到同一个 32 字节块，所以同时给出 pool_allocator 的版本，
+// 它的槽位恰好是 sizeof(Node)
+
+// 统计通过分配器申请的字节数（不含 malloc 自身的取整和头部）
+inline std::size_t requested_bytes = 0;
+
+template <typename T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    template <typename U>
+    counting_allocator(const counting_allocator<U> &) noexcept {}
+
+    T *allocate(std::size_t n) {
+        requested_bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *ptr, std::size_t n) noexcept {
+        requested_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    friend bool operator==(const counting_allocator &, const counting_allocator &) noexcept { return true; }
+};
+
+// 每个元素占用的节点字节数
+template <typename List>
+static void BM_BytesPerElement(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    double per_element = 0;
+    for (auto _ : state) {
+        std::size_t before = requested_bytes;
+        List l;
+        for (std::size_t i = 0; i < n; ++i) {
+            l.push_back(static_cast<int>(i));
+        }
+        per_element = static_cast<double>(requested_bytes - before) / static_cast<double>(n);
+        benchmark::DoNotOptimize(l);
+    }
+    state.counters["bytes_per_element"] = per_element;
+}
+
+template <typename List>
+static void BM_PushBack(benchmark::State &state) {
+    auto data = make_data<int>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        List l;
+        for (int val : data) {
+            l.push_back(val);
+        }
+        benchmark::DoNotOptimize(l);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 双端队列式的使用：尾部进、头部出，再头部进、尾部出
+template <typename List>
+static void BM_PushPopBothEnds(benchmark::State &state) {
+    auto data = make_data<int>(static_cast<std::size_t>(state.range(0)));
+    List l;
+    for (int val : data) {
+        l.push_back(val);
+    }
+    for (auto _ : state) {
+        for (int val : data) {
+            l.push_back(val);
+            l.pop_front();
+            l.push_front(val);
+            l.pop_back();
+        }
+        benchmark::DoNotOptimize(l);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 4);
+}
+
+template <typename List>
+static void BM_Iteration(benchmark::State &state) {
+    auto data = make_data<int>(static_cast<std::size_t>(state.range(0)));
+    List l;
+    for (int val : data) {
+        l.push_back(val);
+    }
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (int val : l) {
+            sum += static_cast<std::uint64_t>(val);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+static void BM_ReverseIteration(benchmark::State &state) {
+    auto data = make_data<int>(static_cast<std::size_t>(state.range(0)));
+    List l;
+    for (int val : data) {
+        l.push_back(val);
+    }
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (auto it = l.rbegin(); it != l.rend(); ++it) {
+            sum += static_cast<std::uint64_t>(*it);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using PooledXorList = mys::xor_list<int, mys::pool_allocator<int>>;
+using PooledList = mys::list<int, mys::pool_allocator<int>>;
+
+#define XOR_LIST_BENCHMARKS(List)                                    \
+    BENCHMARK_TEMPLATE(BM_PushBack, List)->Apply(SizeRange);         \
+    BENCHMARK_TEMPLATE(BM_PushPopBothEnds, List)->Apply(SizeRange);  \
+    BENCHMARK_TEMPLATE(BM_Iteration, List)->Apply(SizeRange);        \
+    BENCHMARK_TEMPLATE(BM_ReverseIteration, List)->Apply(SizeRange)
+
+BENCHMARK_TEMPLATE(BM_BytesPerElement, mys::xor_list<int, counting_allocator<int>>)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_BytesPerElement, mys::list<int, counting_allocator<int>>)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_BytesPerElement, std::list<int, counting_allocator<int>>)->Arg(1000);
+
+XOR_LIST_BENCHMARKS(mys::xor_list<int>);
+XOR_LIST_BENCHMARKS(mys::list<int>);
+XOR_LIST_BENCHMARKS(std::list<int>);
+XOR_LIST_BENCHMARKS(PooledXorList);
+XOR_LIST_BENCHMARKS(PooledList);
+
+BENCHMARK_MAIN();
\ No newline at end of file
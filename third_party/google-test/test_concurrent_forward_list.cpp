@@ -0,0 +1,72 @@
+// test_concurrent_forward_list.cpp
+#include "concurrent_forward_list.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mys;
+
+// Test insert/erase/contains behave like a sorted set
+TEST(ConcurrentForwardListTest, SetSemantics) {
+    concurrent_forward_list<int> list;
+    EXPECT_TRUE(list.empty_approx());
+    EXPECT_TRUE(list.insert(2));
+    EXPECT_TRUE(list.insert(1));
+    EXPECT_FALSE(list.insert(2));
+    EXPECT_TRUE(list.contains(1));
+    EXPECT_FALSE(list.contains(3));
+    EXPECT_EQ(list.size_approx(), 2u);
+    EXPECT_TRUE(list.erase(1));
+    EXPECT_FALSE(list.erase(1));
+    EXPECT_FALSE(list.contains(1));
+    EXPECT_EQ(list.size_approx(), 1u);
+}
+
+// Test values with heap storage survive repeated erase and reinsert
+TEST(ConcurrentForwardListTest, StringValues) {
+    concurrent_forward_list<std::string> list;
+    for (int round = 0; round < 50; ++round) {
+        for (int i = 0; i < 20; ++i) {
+            ASSERT_TRUE(list.insert("value-" + std::to_string(i)));
+        }
+        for (int i = 0; i < 20; ++i) {
+            ASSERT_TRUE(list.erase("value-" + std::to_string(i)));
+        }
+    }
+    EXPECT_TRUE(list.empty_approx());
+}
+
+// Test readers running alongside writers never see a value outside the writers' key range
+TEST(ConcurrentForwardListTest, ReadersDuringWrites) {
+    concurrent_forward_list<int> list;
+    for (int i = 0; i < 100; i += 2) {
+        list.insert(i);
+    }
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 2; ++t) {
+        threads.emplace_back([&list, t] {
+            for (int i = 0; i < 20000; ++i) {
+                int key = (i * 13 + t) % 100;
+                if (i % 2 == 0) {
+                    list.insert(key);
+                } else {
+                    list.erase(key);
+                }
+            }
+        });
+    }
+    threads.emplace_back([&list, &stop] {
+        while (!stop.load()) {
+            EXPECT_FALSE(list.contains(-1));
+            EXPECT_FALSE(list.contains(100));
+            EXPECT_LE(list.size_approx(), 100u);
+        }
+    });
+    threads[0].join();
+    threads[1].join();
+    stop.store(true);
+    threads[2].join();
+}
\ No newline at end of file
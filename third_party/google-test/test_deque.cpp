@@ -0,0 +1,82 @@
+// test_deque.cpp
+#include "deque.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+
+using namespace mys;
+
+// Test fixture for deque tests
+class DequeTest : public ::testing::Test {
+protected:
+    deque<int> d;
+
+    void SetUp() override {
+        for (int i = 0; i < 5; ++i) {
+            d.push_back(i);
+        }
+    }
+};
+
+// Test push and pop at both ends
+TEST_F(DequeTest, PushPopBothEnds) {
+    d.push_front(-1);
+    EXPECT_EQ(d.front(), -1);
+    EXPECT_EQ(d.back(), 4);
+    d.pop_front();
+    d.pop_back();
+    EXPECT_EQ(d.size(), 4u);
+    EXPECT_EQ(d.back(), 3);
+}
+
+// Test random access across block boundaries
+TEST_F(DequeTest, RandomAccessAcrossBlocks) {
+    for (int i = 5; i < 5000; ++i) {
+        d.push_back(i);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        EXPECT_EQ(d[i], i);
+    }
+    EXPECT_EQ(*(d.begin() + 4321), 4321);
+    EXPECT_EQ(d.end() - d.begin(), 5000);
+    EXPECT_THROW((void)d.at(5000), std::out_of_range);
+}
+
+// Test references stay valid when the block map grows
+TEST_F(DequeTest, ReferencesSurviveGrowth) {
+    int &ref = d[2];
+    for (int i = 0; i < 10000; ++i) {
+        d.push_front(i);
+        d.push_back(i);
+    }
+    EXPECT_EQ(&ref, &d[10002]);
+}
+
+// Test insert and erase in the middle
+TEST_F(DequeTest, InsertErase) {
+    d.insert(d.begin() + 1, 10);
+    d.insert(d.begin() + 5, 20);
+    EXPECT_EQ(d, (deque<int>{0, 10, 1, 2, 3, 20, 4}));
+    d.erase(d.begin() + 1);
+    d.erase(d.begin() + 4, d.end());
+    EXPECT_EQ(d, (deque<int>{0, 1, 2, 3}));
+}
+
+// Test standard algorithms on deque iterators
+TEST_F(DequeTest, StdAlgorithms) {
+    std::reverse(d.begin(), d.end());
+    EXPECT_EQ(d.front(), 4);
+    std::sort(d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+    EXPECT_EQ(std::lower_bound(d.begin(), d.end(), 3) - d.begin(), 3);
+}
+
+// Test deque of strings with copy and move
+TEST(DequeStringTest, CopyMove) {
+    deque<std::string> a{"x", "y"};
+    deque<std::string> b(a);
+    EXPECT_EQ(a, b);
+    deque<std::string> c(std::move(a));
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(c.back(), "y");
+}
\ No newline at end of file
@@ -387,6 +387,32 @@ TEST_F(ForwardListTest, ComparisonOperators) {
     EXPECT_TRUE(fl1 >= fl4);
 }
 
+// Test sort and merge operations
+TEST_F(ForwardListTest, SortAndMerge) {
+    forward_list<int> fl{5, 3, 9, 1, 7, 2, 8, 6, 4, 0};
+    fl.sort();
+    std::vector<int> sorted(fl.begin(), fl.end());
+    EXPECT_EQ(sorted, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    fl.sort(std::greater<int>());
+    EXPECT_EQ(fl.front(), 9);
+
+    // Stability
+    forward_list<std::pair<int, char>> pairs{{1, 'a'}, {0, 'b'}, {1, 'c'}, {0, 'd'}};
+    pairs.sort([](const auto &a, const auto &b) { return a.first < b.first; });
+    std::vector<char> order;
+    for (const auto &p : pairs) order.push_back(p.second);
+    EXPECT_EQ(order, (std::vector<char>{'b', 'd', 'a', 'c'}));
+
+    forward_list<int> a{1, 4, 6};
+    forward_list<int> b{2, 3, 5, 7};
+    a.merge(b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a.size(), 7);
+    std::vector<int> merged(a.begin(), a.end());
+    EXPECT_EQ(merged, (std::vector<int>{1, 2, 3, 4, 5, 6, 7}));
+}
+
 // Test with different types
 TEST_F(ForwardListTest, DifferentTypes) {
     // String list
@@ -417,6 +443,87 @@ TEST_F(ForwardListTest, MoveOnlyTypes) {
     EXPECT_EQ(fl.front(), nullptr);
 }
 
+// Test range insertion keeps order and returns the last inserted element
+TEST_F(ForwardListTest, RangeInsertion) {
+    fl.append_range(std::vector<int>{3, 4});
+    fl.prepend_range(std::vector<int>{1, 2});
+    auto it = fl.insert_range_after(std::next(fl.begin(), 3), std::vector<int>{5, 6});
+    EXPECT_EQ(*it, 6);
+    EXPECT_EQ(std::vector<int>(fl.begin(), fl.end()), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(fl.size(), 6);
+
+    fl.assign({9, 8});
+    EXPECT_EQ(std::vector<int>(fl.begin(), fl.end()), (std::vector<int>{9, 8}));
+}
+
+// Test range erase_after removes the open interval in one step
+TEST_F(ForwardListTest, RangeEraseAfter) {
+    fl.assign_range(std::vector<int>{0, 1, 2, 3, 4});
+    auto it = fl.erase_after(fl.begin(), std::next(fl.begin(), 3));
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(std::vector<int>(fl.begin(), fl.end()), (std::vector<int>{0, 3, 4}));
+    EXPECT_EQ(fl.size(), 3);
+}
+
+// Test the tail-tracking variant used as a FIFO queue
+TEST(TailForwardListTest, QueueOperations) {
+    tail_forward_list<int> q;
+    EXPECT_EQ(q.before_end(), q.before_begin());
+    for (int i = 0; i < 4; ++i) {
+        q.push_back(i);
+    }
+    q.emplace_back(4);
+    EXPECT_EQ(*q.before_end(), 4);
+    q.pop_front();
+    q.pop_front();
+    EXPECT_EQ(std::vector<int>(q.begin(), q.end()), (std::vector<int>{2, 3, 4}));
+
+    while (!q.empty()) {
+        q.pop_front();
+    }
+    EXPECT_EQ(q.before_end(), q.before_begin());
+    q.push_back(9);
+    EXPECT_EQ(q.front(), 9);
+    EXPECT_EQ(*q.before_end(), 9);
+}
+
+// Test whole-list splice and structural operations keep the tail pointer valid
+TEST(TailForwardListTest, TailSurvivesRelinking) {
+    tail_forward_list<int> a = {3, 1, 2};
+    tail_forward_list<int> b = {6, 5};
+    a.splice_after(a.before_end(), b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(b.before_end(), b.before_begin());
+    EXPECT_EQ(*a.before_end(), 5);
+
+    a.reverse();
+    EXPECT_EQ(*a.before_end(), 3);
+    a.sort();
+    EXPECT_EQ(*a.before_end(), 6);
+    a.remove_if([](int v) { return v > 4; });
+    EXPECT_EQ(*a.before_end(), 3);
+    a.push_back(10);
+    EXPECT_EQ(std::vector<int>(a.begin(), a.end()), (std::vector<int>{1, 2, 3, 10}));
+}
+
+// Test compact keeps the elements and moves the tail pointer to the new last node
+TEST(TailForwardListTest, CompactRestoresOrder) {
+    tail_forward_list<int, pool_allocator<int>> pooled;
+    for (int i = 0; i < 500; ++i) {
+        pooled.push_back(i);
+    }
+    pooled.reverse();
+    EXPECT_GT(pooled.fragmentation(), 0.9);
+    EXPECT_TRUE(pooled.compact_if(0.5));
+    EXPECT_LT(pooled.fragmentation(), 0.05);
+    EXPECT_FALSE(pooled.compact_if(0.5));
+    EXPECT_EQ(pooled.size(), 500u);
+    EXPECT_EQ(pooled.front(), 499);
+    EXPECT_EQ(*pooled.before_end(), 0);
+    pooled.push_back(-1);
+    EXPECT_EQ(*pooled.before_end(), -1);
+}
+
 // Main function
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
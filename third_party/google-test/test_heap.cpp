@@ -0,0 +1,56 @@
+// test_heap.cpp
+#include "heap.h"
+#include <gtest/gtest.h>
+#include <functional>
+#include <vector>
+
+using namespace mys;
+
+// Typed tests over the supported arities
+template <typename Heap>
+class HeapTest : public ::testing::Test {};
+
+using HeapTypes = ::testing::Types<heap<int, std::greater<int>, 2>, heap<int, std::greater<int>, 4>, heap<int, std::greater<int>, 8>>;
+TYPED_TEST_SUITE(HeapTest, HeapTypes);
+
+// Test pops come out in priority order
+TYPED_TEST(HeapTest, PopsInOrder) {
+    TypeParam h;
+    for (int i = 99; i >= 0; --i) {
+        h.push((i * 37) % 100);
+    }
+    for (int expected = 0; expected < 100; ++expected) {
+        ASSERT_EQ(h.top(), expected);
+        h.pop();
+    }
+    EXPECT_TRUE(h.empty());
+}
+
+// Test decrease_key moves an element to the top
+TYPED_TEST(HeapTest, DecreaseKey) {
+    TypeParam h;
+    std::vector<typename TypeParam::handle> handles;
+    for (int i = 0; i < 50; ++i) {
+        handles.push_back(h.push(10 + i));
+    }
+    h.decrease_key(handles[40], 0);
+    EXPECT_EQ(h.top(), 0);
+    h.pop();
+    EXPECT_FALSE(h.contains(handles[40]));
+    EXPECT_EQ(h.top(), 10);
+}
+
+// Test update in both directions and erase by handle
+TYPED_TEST(HeapTest, UpdateAndErase) {
+    TypeParam h;
+    auto a = h.push(1);
+    auto b = h.push(2);
+    auto c = h.push(3);
+    h.update(a, 10);
+    EXPECT_EQ(h.top(), 2);
+    h.erase(b);
+    EXPECT_EQ(h.top(), 3);
+    EXPECT_EQ(h.value(c), 3);
+    EXPECT_EQ(h.value(a), 10);
+    EXPECT_THROW(h.erase(b), std::out_of_range);
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+// test_instrumentation.cpp
+#include "forward_list.h"
+#include "list.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace mys;
+
+using CountedList = list<int, std::allocator<int>, counting_instrumentation>;
+using CountedForwardList = forward_list<int, std::allocator<int>, counting_instrumentation>;
+
+// Test the default policy adds no state to the containers
+TEST(InstrumentationTest, DefaultPolicyIsFree) {
+    EXPECT_TRUE(std::is_empty_v<no_instrumentation>);
+    EXPECT_EQ(sizeof(list<int>), 2 * sizeof(void *) + sizeof(std::size_t));
+    EXPECT_EQ(sizeof(forward_list<int>), sizeof(void *) + sizeof(std::size_t));
+}
+
+// Test allocation, deallocation and peak length counters of list
+TEST(InstrumentationTest, ListCounters) {
+    CountedList l;
+    for (int i = 0; i < 8; ++i) {
+        l.push_front(i);
+    }
+    l.erase(l.begin(), std::next(l.begin(), 5));
+    l.push_back(42);
+
+    const auto &stats = l.instrumentation();
+    EXPECT_EQ(stats.allocations, 9u);
+    EXPECT_EQ(stats.deallocations, 5u);
+    EXPECT_EQ(stats.erase_calls, 5u);
+    EXPECT_EQ(stats.peak_length, 8u);
+
+    l.clear();
+    EXPECT_EQ(stats.deallocations, stats.allocations);
+}
+
+// Test nodes visited by remove_if, unique and splice_after
+TEST(InstrumentationTest, ForwardListVisits) {
+    CountedForwardList l = {5, 5, 1, 2, 2};
+    auto &stats = l.instrumentation();
+
+    stats.reset();
+    l.unique();
+    EXPECT_EQ(stats.nodes_visited, 4u);
+    EXPECT_EQ(stats.erase_calls, 2u);
+
+    stats.reset();
+    l.remove_if([](int v) { return v == 1; });
+    EXPECT_EQ(stats.nodes_visited, 3u);
+    EXPECT_EQ(stats.erase_calls, 1u);
+
+    CountedForwardList other = {7, 8, 9, 10};
+    stats.reset();
+    l.splice_after(l.before_begin(), other);
+    EXPECT_EQ(stats.nodes_visited, 4u);
+    EXPECT_EQ(stats.peak_length, 6u);
+}
+
+// Test the tracer receives every event with its value
+TEST(InstrumentationTest, Tracer) {
+    std::vector<std::pair<list_event, std::size_t>> events;
+    CountedList l;
+    l.instrumentation().set_tracer(
+        [](void *ctx, list_event event, std::size_t value) noexcept {
+            static_cast<std::vector<std::pair<list_event, std::size_t>> *>(ctx)->emplace_back(event, value);
+        },
+        &events);
+
+    l.push_back(1);
+    l.pop_back();
+
+    std::vector<std::pair<list_event, std::size_t>> expected = {
+        {list_event::allocate, 1}, {list_event::length, 1}, {list_event::deallocate, 1}};
+    EXPECT_EQ(events, expected);
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+// test_intrusive_list.cpp
+#include "intrusive_list.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using namespace mys;
+
+struct Item {
+    int value = 0;
+    list_hook<Item> hook;
+};
+
+using ItemList = intrusive_list<Item, &Item::hook>;
+
+// Test the list links the caller's objects in place
+TEST(IntrusiveListTest, LinksObjectsInPlace) {
+    std::vector<Item> items(3);
+    ItemList l;
+    for (int i = 0; i < 3; ++i) {
+        items[i].value = i * 10;
+        l.push_back(items[i]);
+    }
+    EXPECT_EQ(&l.front(), &items[0]);
+    EXPECT_EQ(&*std::next(l.begin()), &items[1]);
+    EXPECT_EQ(l.back().value, 20);
+}
+
+// Test erase by reference and by iterator
+TEST(IntrusiveListTest, Erase) {
+    std::vector<Item> items(4);
+    ItemList l;
+    for (auto &item : items) {
+        l.push_back(item);
+    }
+    l.erase(items[0]);
+    l.erase(items[3]);
+    EXPECT_EQ(l.size(), 2);
+    EXPECT_EQ(&l.front(), &items[1]);
+    EXPECT_EQ(&l.back(), &items[2]);
+    EXPECT_EQ(l.erase(l.begin(), l.end()), l.end());
+    EXPECT_TRUE(l.empty());
+}
+
+// Test splicing a whole list
+TEST(IntrusiveListTest, SpliceAll) {
+    std::vector<Item> items(4);
+    ItemList a, b;
+    a.push_back(items[0]);
+    a.push_back(items[1]);
+    b.push_back(items[2]);
+    b.push_back(items[3]);
+    a.splice(std::next(a.begin()), b);
+    EXPECT_EQ(a.size(), 4);
+    EXPECT_TRUE(b.empty());
+    std::vector<Item *> order;
+    for (auto &item : a) {
+        order.push_back(&item);
+    }
+    EXPECT_EQ(order, (std::vector<Item *>{&items[0], &items[2], &items[3], &items[1]}));
+}
+
+// Test that a hook already in a list cannot be linked again
+TEST(IntrusiveListTest, RejectsLinkedHook) {
+    std::vector<Item> items(2);
+    ItemList a, b;
+    a.push_back(items[0]);
+    EXPECT_THROW(a.push_back(items[0]), std::invalid_argument);
+    EXPECT_THROW(b.push_front(items[0]), std::invalid_argument);
+    EXPECT_THROW(b.insert(b.end(), items[0]), std::invalid_argument);
+    EXPECT_EQ(a.size(), 1);
+    EXPECT_TRUE(b.empty());
+    a.erase(items[0]);
+    EXPECT_FALSE(items[0].hook.is_linked());
+    b.push_back(items[0]);
+    EXPECT_EQ(&b.front(), &items[0]);
+}
+
+// Test the iterator is a single pointer and end() can be decremented
+TEST(IntrusiveListTest, SinglePointerIterator) {
+    EXPECT_EQ(sizeof(ItemList::iterator), sizeof(void *));
+    std::vector<Item> items(2);
+    ItemList l;
+    l.push_back(items[0]);
+    l.push_back(items[1]);
+    EXPECT_EQ(&*std::prev(l.end()), &items[1]);
+}
\ No newline at end of file
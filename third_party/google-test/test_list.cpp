@@ -352,6 +352,36 @@ TEST_F(ListTest, ComparisonOperators) {
     EXPECT_TRUE(l1 >= l4);
 }
 
+// Test sort and merge operations
+TEST_F(ListTest, SortAndMerge) {
+    list<int> l{5, 3, 9, 1, 7, 2, 8, 6, 4, 0};
+    l.sort();
+    std::vector<int> sorted(l.begin(), l.end());
+    EXPECT_EQ(sorted, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    std::vector<int> backwards(l.rbegin(), l.rend());
+    EXPECT_EQ(backwards, (std::vector<int>{9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+
+    l.sort(std::greater<int>());
+    EXPECT_EQ(l.front(), 9);
+    EXPECT_EQ(l.back(), 0);
+
+    // Stability
+    list<std::pair<int, char>> pairs{{1, 'a'}, {0, 'b'}, {1, 'c'}, {0, 'd'}};
+    pairs.sort([](const auto &a, const auto &b) { return a.first < b.first; });
+    std::vector<char> order;
+    for (const auto &p : pairs) order.push_back(p.second);
+    EXPECT_EQ(order, (std::vector<char>{'b', 'd', 'a', 'c'}));
+
+    list<int> a{1, 4, 6};
+    list<int> b{2, 3, 5, 7};
+    a.merge(b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a.size(), 7);
+    std::vector<int> merged(a.begin(), a.end());
+    EXPECT_EQ(merged, (std::vector<int>{1, 2, 3, 4, 5, 6, 7}));
+    EXPECT_EQ(a.back(), 7);
+}
+
 // Test with different types
 TEST_F(ListTest, DifferentTypes) {
     // String list
@@ -383,6 +413,105 @@ TEST_F(ListTest, MoveOnlyTypes) {
     EXPECT_EQ(l.front(), nullptr);
 }
 
+// Test range insertion links the whole chain in order
+TEST_F(ListTest, RangeInsertion) {
+    std::vector<int> src{3, 4, 5};
+    l.append_range(src);
+    l.prepend_range(std::vector<int>{1, 2});
+    auto it = l.insert_range(std::next(l.begin(), 2), std::vector<int>{10, 11});
+    EXPECT_EQ(*it, 10);
+    EXPECT_EQ(std::vector<int>(l.begin(), l.end()), (std::vector<int>{1, 2, 10, 11, 3, 4, 5}));
+    EXPECT_EQ(std::vector<int>(l.rbegin(), l.rend()), (std::vector<int>{5, 4, 3, 11, 10, 2, 1}));
+
+    l.assign(src.begin(), src.end());
+    EXPECT_EQ(l.size(), 3);
+    EXPECT_EQ(l.front(), 3);
+    EXPECT_EQ(l.back(), 5);
+}
+
+// Test range erase unlinks the segment and keeps both ends consistent
+TEST_F(ListTest, RangeErase) {
+    l.append_range(std::vector<int>{0, 1, 2, 3, 4, 5});
+    auto it = l.erase(std::next(l.begin()), std::next(l.begin(), 4));
+    EXPECT_EQ(*it, 4);
+    EXPECT_EQ(l.size(), 3);
+    EXPECT_EQ(std::vector<int>(l.rbegin(), l.rend()), (std::vector<int>{5, 4, 0}));
+
+    l.erase(l.begin(), l.end());
+    EXPECT_TRUE(l.empty());
+    EXPECT_EQ(l.begin(), l.end());
+}
+
+// Test splice moves nodes between lists without touching the elements
+TEST_F(ListTest, Splice) {
+    list<int> other{10, 20, 30};
+    l.push_back(1);
+    l.push_back(2);
+    const int *node = &other.front();
+
+    l.splice(std::next(l.begin()), other, other.begin());
+    EXPECT_EQ(std::vector<int>(l.begin(), l.end()), (std::vector<int>{1, 10, 2}));
+    EXPECT_EQ(&*std::next(l.begin()), node);
+    EXPECT_EQ(other.size(), 2);
+
+    l.splice(l.begin(), other);
+    EXPECT_EQ(std::vector<int>(l.begin(), l.end()), (std::vector<int>{20, 30, 1, 10, 2}));
+    EXPECT_TRUE(other.empty());
+
+    other.splice(other.end(), l, std::next(l.begin()), std::prev(l.end()));
+    EXPECT_EQ(std::vector<int>(l.rbegin(), l.rend()), (std::vector<int>{2, 20}));
+    EXPECT_EQ(std::vector<int>(other.begin(), other.end()), (std::vector<int>{30, 1, 10}));
+    EXPECT_EQ(l.size(), 2);
+    EXPECT_EQ(other.size(), 3);
+}
+
+// Test remove, unique and reverse report and relink correctly
+TEST_F(ListTest, RemoveUniqueReverse) {
+    l.append_range(std::vector<int>{5, 5, 1, 2, 2, 5, 3});
+    EXPECT_EQ(l.unique(), 2);
+    EXPECT_EQ(l.remove(5), 2);
+    EXPECT_EQ(l.remove_if([](int v) { return v > 2; }), 1);
+    EXPECT_EQ(std::vector<int>(l.begin(), l.end()), (std::vector<int>{1, 2}));
+
+    l.reverse();
+    EXPECT_EQ(std::vector<int>(l.begin(), l.end()), (std::vector<int>{2, 1}));
+    EXPECT_EQ(std::vector<int>(l.rbegin(), l.rend()), (std::vector<int>{1, 2}));
+    EXPECT_EQ(l.front(), 2);
+    EXPECT_EQ(l.back(), 1);
+}
+
+// Test the sentinel follows the list through move and swap
+TEST_F(ListTest, SentinelAfterMoveAndSwap) {
+    l.append_range(std::vector<int>{1, 2, 3});
+    EXPECT_EQ(*std::prev(l.end()), 3);
+
+    list<int> moved(std::move(l));
+    EXPECT_EQ(std::vector<int>(moved.rbegin(), moved.rend()), (std::vector<int>{3, 2, 1}));
+    EXPECT_EQ(l.begin(), l.end());
+
+    list<int> other{7};
+    moved.swap(other);
+    EXPECT_EQ(std::vector<int>(moved.rbegin(), moved.rend()), (std::vector<int>{7}));
+    EXPECT_EQ(std::vector<int>(other.rbegin(), other.rend()), (std::vector<int>{3, 2, 1}));
+    EXPECT_EQ(sizeof(list<int>::iterator), sizeof(void *));
+}
+
+// Test compact keeps the elements and lays the nodes out in traversal order
+TEST(ListCompactTest, CompactRestoresOrder) {
+    list<int, pool_allocator<int>> pooled;
+    for (int i = 0; i < 500; ++i) {
+        pooled.push_back(i);
+    }
+    pooled.reverse();
+    EXPECT_GT(pooled.fragmentation(), 0.9);
+    EXPECT_TRUE(pooled.compact_if(0.5));
+    EXPECT_LT(pooled.fragmentation(), 0.05);
+    EXPECT_FALSE(pooled.compact_if(0.5));
+    EXPECT_EQ(pooled.size(), 500u);
+    EXPECT_EQ(pooled.front(), 499);
+    EXPECT_EQ(*std::prev(pooled.end()), 0);
+}
+
 // Main function
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
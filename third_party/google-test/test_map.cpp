@@ -0,0 +1,59 @@
+// test_map.cpp
+#include "map.h"
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace mys;
+
+// Test ordered iteration after unordered inserts
+TEST(MapTest, IteratesInKeyOrder) {
+    map<int, int, std::less<int>, 8> m;
+    for (int i = 0; i < 1000; ++i) {
+        m.emplace((i * 7919) % 1000, i);
+    }
+    EXPECT_EQ(m.size(), 1000);
+    int expected = 0;
+    for (const auto &[key, value] : m) {
+        EXPECT_EQ(key, expected++);
+    }
+}
+
+// Test lower_bound and upper_bound on missing and present keys
+TEST(MapTest, Bounds) {
+    map<int, std::string> m{{10, "a"}, {20, "b"}, {30, "c"}};
+    EXPECT_EQ(m.lower_bound(20)->first, 20);
+    EXPECT_EQ(m.upper_bound(20)->first, 30);
+    EXPECT_EQ(m.lower_bound(15)->first, 20);
+    EXPECT_EQ(m.lower_bound(31), m.end());
+    EXPECT_EQ(m.upper_bound(30), m.end());
+}
+
+// Test bulk load matches element-wise insertion
+TEST(MapTest, BulkLoadMatchesInsert) {
+    std::vector<std::pair<int, int>> sorted;
+    for (int i = 0; i < 5000; ++i) {
+        sorted.emplace_back(i, i * i);
+    }
+    map<int, int, std::less<int>, 16> loaded(sorted_unique, sorted.begin(), sorted.end());
+    map<int, int, std::less<int>, 16> inserted(sorted.begin(), sorted.end());
+    EXPECT_TRUE(loaded == inserted);
+}
+
+// Test reverse iteration and erase shrink the tree back to empty
+TEST(MapTest, ReverseEraseToEmpty) {
+    map<int, int, std::less<int>, 4> m;
+    for (int i = 0; i < 300; ++i) {
+        m[i] = i;
+    }
+    int expected = 299;
+    for (auto it = m.rbegin(); it != m.rend(); ++it) {
+        EXPECT_EQ((*it).first, expected--);
+    }
+    for (int i = 299; i >= 0; --i) {
+        EXPECT_EQ(m.erase(i), 1);
+    }
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.begin(), m.end());
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+// test_mpmc_queue.cpp
+#include "mpmc_queue.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mys;
+
+// Test push/pop order and the full/empty boundaries
+TEST(MpmcQueueTest, FullAndEmpty) {
+    mpmc_queue<int> q(4);
+    EXPECT_EQ(q.capacity(), 4u);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(q.try_push(i));
+    }
+    EXPECT_FALSE(q.try_push(4));
+
+    int value;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(q.try_pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(q.try_pop(value));
+}
+
+// Test bulk operations stop at the ring boundary
+TEST(MpmcQueueTest, BulkPartial) {
+    mpmc_queue<std::string> q(8);
+    std::vector<std::string> in{"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"};
+    EXPECT_EQ(q.try_push_n(std::make_move_iterator(in.begin()), in.size()), 8u);
+
+    std::vector<std::string> out(8);
+    EXPECT_EQ(q.try_pop_n(out.begin(), 3), 3u);
+    EXPECT_EQ(out[0], "a");
+    EXPECT_EQ(out[2], "c");
+    EXPECT_EQ(q.size_approx(), 5u);
+}
+
+// Test values are delivered exactly once under contention
+TEST(MpmcQueueTest, ConcurrentExactlyOnce) {
+    constexpr int threads_per_side = 3;
+    constexpr int per_producer = 20000;
+    mpmc_queue<int> q(256);
+    std::vector<std::atomic<int>> seen(threads_per_side * per_producer);
+    std::atomic<int> remaining{threads_per_side * per_producer};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < threads_per_side; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < per_producer;) {
+                if (q.try_push(p * per_producer + i)) ++i;
+                else std::this_thread::yield();
+            }
+        });
+        threads.emplace_back([&] {
+            int value;
+            while (remaining.load() > 0) {
+                if (q.try_pop(value)) {
+                    seen[value]++;
+                    remaining--;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    for (auto &count : seen) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+// test_parallel.cpp
+#include "parallel.h"
+#include "forward_list.h"
+#include "list.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+using namespace mys;
+
+// Test every algorithm against the sequential result over a list
+TEST(ParallelTest, ListAlgorithms) {
+    list<int> l;
+    for (int i = 1; i <= 1000; ++i) {
+        l.push_back(i);
+    }
+    parallel::options opts{4, 32};
+    EXPECT_EQ(parallel::reduce(l, 0LL, std::plus<>{}, opts), 500500);
+    EXPECT_EQ(parallel::transform_reduce(l, 0LL, std::plus<>{}, [](int v) { return 1LL * v * v; }, opts), 333833500);
+    EXPECT_EQ(parallel::count_if(l, [](int v) { return v % 3 == 0; }, opts), 333u);
+
+    parallel::for_each(l, [](int &v) { v = -v; }, opts);
+    EXPECT_EQ(l.front(), -1);
+    EXPECT_EQ(l.back(), -1000);
+}
+
+// Test the forward_list walk and a grain larger than the list
+TEST(ParallelTest, ForwardList) {
+    forward_list<int> l;
+    for (int i = 0; i < 100; ++i) {
+        l.push_front(i);
+    }
+    EXPECT_EQ(parallel::reduce(l, 0, std::plus<>{}, {8, 16}), 4950);
+    EXPECT_EQ(parallel::reduce(l, 0, std::plus<>{}, {8, 1000}), 4950);
+    EXPECT_EQ(parallel::count_if(forward_list<int>{}, [](int) { return true; }), 0u);
+}
+
+// Test a non-commutative operation keeps element order for any thread count
+TEST(ParallelTest, DeterministicOrder) {
+    list<std::string> l;
+    std::string expected;
+    for (int i = 0; i < 300; ++i) {
+        l.push_back(std::to_string(i % 10));
+        expected += std::to_string(i % 10);
+    }
+    for (std::size_t threads = 1; threads <= 6; ++threads) {
+        EXPECT_EQ(parallel::reduce(l, std::string(), std::plus<>{}, {threads, 7}), expected);
+    }
+}
+
+// Test a kept index picks up pushes at both ends and can be rebuilt
+TEST(ParallelTest, ChunkIndex) {
+    list<int> l;
+    for (int i = 0; i < 40; ++i) {
+        l.push_back(1);
+    }
+    parallel::chunk_index index(l, 8);
+    EXPECT_EQ(index.chunks(), 5u);
+    l.push_front(1);
+    l.push_back(1);
+    EXPECT_EQ(parallel::reduce(index, 0), 42);
+    index.rebuild();
+    EXPECT_EQ(index.chunks(), 6u);
+}
+
+// Test an exception thrown by the callable reaches the caller
+TEST(ParallelTest, Exception) {
+    list<int> l = {1, 2, 3, 4, 5, 6, 7, 8};
+    EXPECT_THROW(parallel::for_each(l, [](int v) {
+        if (v == 6) throw std::logic_error("bad");
+    }, {3, 2}), std::logic_error);
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+// test_persistent_forward_list.cpp
+#include "persistent_forward_list.h"
+#include <gtest/gtest.h>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace mys;
+
+// Test push_front and pop_front on a single version
+TEST(PersistentForwardListTest, PushPop) {
+    persistent_forward_list<std::string> l{"b", "c"};
+    l.push_front("a");
+    EXPECT_EQ(l.size(), 3u);
+    EXPECT_EQ(std::vector<std::string>(l.begin(), l.end()), (std::vector<std::string>{"a", "b", "c"}));
+    l.pop_front();
+    l.pop_front();
+    EXPECT_EQ(l.front(), "c");
+    l.pop_front();
+    EXPECT_TRUE(l.empty());
+    l.pop_front();
+    EXPECT_TRUE(l.empty());
+    EXPECT_THROW((void)l.front(), std::out_of_range);
+}
+
+// Test a copy is a snapshot that shares nodes and ignores later changes
+TEST(PersistentForwardListTest, SnapshotIsIndependent) {
+    persistent_forward_list<int> l{2, 1};
+    persistent_forward_list<int> snapshot = l;
+    EXPECT_TRUE(snapshot.shares_with(l));
+    EXPECT_EQ(&snapshot.front(), &l.front());
+
+    l.push_front(3);
+    l.push_front(4);
+    EXPECT_EQ(std::vector<int>(snapshot.begin(), snapshot.end()), (std::vector<int>{2, 1}));
+    EXPECT_EQ(&*std::next(l.begin(), 2), &snapshot.front());
+
+    l.clear();
+    EXPECT_EQ(snapshot.size(), 2u);
+    EXPECT_EQ(snapshot.front(), 2);
+}
+
+// Test comparison across versions that share a tail
+TEST(PersistentForwardListTest, Comparison) {
+    persistent_forward_list<int> a{1, 2, 3};
+    persistent_forward_list<int> b = a;
+    b.pop_front();
+    b.push_front(1);
+    EXPECT_FALSE(b.shares_with(a));
+    EXPECT_EQ(a, b);
+    b.push_front(0);
+    EXPECT_LT(b, a);
+}
+
+// Main function
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
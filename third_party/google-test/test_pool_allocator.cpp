@@ -0,0 +1,89 @@
+// test_pool_allocator.cpp
+#include "pool_allocator.h"
+#include "list.h"
+#include "forward_list.h"
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+
+using namespace mys;
+
+// Test that freed slots are reused before carving new ones
+TEST(PoolAllocatorTest, ReusesFreedSlot) {
+    pool_allocator<int> alloc;
+    int *a = alloc.allocate(1);
+    int *b = alloc.allocate(1);
+    EXPECT_NE(a, b);
+
+    alloc.deallocate(a, 1);
+    EXPECT_EQ(alloc.allocate(1), a);
+    alloc.deallocate(a, 1);
+    alloc.deallocate(b, 1);
+}
+
+// Test allocations spanning several slabs never overlap
+TEST(PoolAllocatorTest, MultipleSlabs) {
+    pool_allocator<long, 64> alloc;
+    std::set<long *> seen;
+    for (int i = 0; i < 200; ++i) {
+        long *p = alloc.allocate(1);
+        *p = i;
+        EXPECT_TRUE(seen.insert(p).second);
+    }
+    EXPECT_TRUE(alloc.release());
+}
+
+// Test release is refused while the pool is shared
+TEST(PoolAllocatorTest, SharedPoolRelease) {
+    pool_allocator<int> a;
+    a.deallocate(a.allocate(1), 1);
+    pool_allocator<int> b(a);
+    EXPECT_TRUE(a == b);
+    EXPECT_FALSE(a.release());
+
+    pool_allocator<int> c;
+    EXPECT_FALSE(a == c);
+}
+
+// Test list with pool allocator (trivially destructible, bulk release)
+TEST(PoolAllocatorTest, ListBulkClear) {
+    list<int, pool_allocator<int>> l;
+    for (int i = 0; i < 1000; ++i) {
+        l.push_back(i);
+    }
+    EXPECT_EQ(l.size(), 1000);
+    l.clear();
+    EXPECT_TRUE(l.empty());
+
+    l.push_back(7);
+    EXPECT_EQ(l.front(), 7);
+}
+
+// Test list move assignment carries the pool with the nodes
+TEST(PoolAllocatorTest, ListMoveAssignment) {
+    list<int, pool_allocator<int>> a{1, 2, 3};
+    list<int, pool_allocator<int>> b{4, 5};
+    b = std::move(a);
+    EXPECT_EQ(b.size(), 3);
+    EXPECT_EQ(b.back(), 3);
+}
+
+// Test forward_list with non-trivial payload
+TEST(PoolAllocatorTest, ForwardListStrings) {
+    forward_list<std::string, pool_allocator<std::string>> fl;
+    for (int i = 0; i < 100; ++i) {
+        fl.push_front(std::to_string(i));
+    }
+    EXPECT_EQ(fl.front(), "99");
+
+    forward_list<std::string, pool_allocator<std::string>> moved(std::move(fl));
+    EXPECT_EQ(moved.size(), 100);
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+}
+
+// Main function
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+// test_skip_list.cpp
+#include "skip_list.h"
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace mys;
+
+// Test keys come out sorted and duplicates are rejected
+TEST(SkipListTest, SortedUnique) {
+    skip_list<int> s{4, 2, 8, 2, 6};
+    EXPECT_EQ(s.size(), 4u);
+    EXPECT_EQ(std::vector<int>(s.begin(), s.end()), (std::vector<int>{2, 4, 6, 8}));
+    EXPECT_FALSE(s.insert(4).second);
+    EXPECT_TRUE(s.insert(5).second);
+    EXPECT_EQ(s.front(), 2);
+}
+
+// Test lower_bound and upper_bound at, between and past the keys
+TEST(SkipListTest, Bounds) {
+    skip_list<int> s;
+    for (int i = 0; i < 1000; i += 10) {
+        s.insert(i);
+    }
+    EXPECT_EQ(*s.lower_bound(0), 0);
+    EXPECT_EQ(*s.lower_bound(15), 20);
+    EXPECT_EQ(*s.upper_bound(20), 30);
+    EXPECT_EQ(s.lower_bound(991), s.end());
+    EXPECT_EQ(s.find(15), s.end());
+    EXPECT_NE(s.find(990), s.end());
+}
+
+// Test erasing every other key keeps the rest reachable on all levels
+TEST(SkipListTest, EraseHalf) {
+    skip_list<std::string> s;
+    for (int i = 0; i < 500; ++i) {
+        s.insert(std::to_string(i));
+    }
+    for (int i = 0; i < 500; i += 2) {
+        EXPECT_EQ(s.erase(std::to_string(i)), 1u);
+    }
+    EXPECT_EQ(s.size(), 250u);
+    for (int i = 0; i < 500; ++i) {
+        EXPECT_EQ(s.contains(std::to_string(i)), i % 2 == 1);
+    }
+}
+
+// Test the same seed gives the same tower heights
+TEST(SkipListTest, Seed) {
+    skip_list<int> a;
+    skip_list<int> b;
+    a.seed(7);
+    b.seed(7);
+    for (int i = 0; i < 5000; ++i) {
+        a.insert(i);
+        b.insert(i);
+    }
+    EXPECT_EQ(a.levels(), b.levels());
+    EXPECT_EQ(a, b);
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+// test_small_vector.cpp
+#include "small_vector.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace mys;
+
+// Stateful allocator that stays put on move assignment; copies share an id, fresh instances differ
+template <typename T>
+struct IdAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    static inline int next_id = 0;
+    int id = next_id++;
+
+    IdAllocator() = default;
+    template <typename U>
+    IdAllocator(const IdAllocator<U> &other) noexcept : id(other.id) {}
+
+    T *allocate(std::size_t n) { return std::allocator<T>().allocate(n); }
+    void deallocate(T *p, std::size_t n) noexcept { std::allocator<T>().deallocate(p, n); }
+
+    friend bool operator==(const IdAllocator &lhs, const IdAllocator &rhs) { return lhs.id == rhs.id; }
+};
+
+// Test elements stay inline up to N and spill to the heap after
+TEST(SmallVectorTest, InlineThenHeap) {
+    small_vector<int, 4> v;
+    for (int i = 0; i < 4; ++i) {
+        v.push_back(i);
+        EXPECT_TRUE(v.is_inline());
+    }
+    v.push_back(4);
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_GE(v.capacity(), 5u);
+    EXPECT_EQ(v.back(), 4);
+}
+
+// Test moving an inline vector relocates its elements
+TEST(SmallVectorTest, MoveInline) {
+    small_vector<std::string, 4> a{"a", "b"};
+    small_vector<std::string, 4> b(std::move(a));
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(b, (small_vector<std::string, 4>{"a", "b"}));
+}
+
+// Test moving a heap vector steals its buffer
+TEST(SmallVectorTest, MoveHeap) {
+    small_vector<int, 2> a{1, 2, 3, 4};
+    const int *data = a.data();
+    small_vector<int, 2> b;
+    b = std::move(a);
+    EXPECT_EQ(b.data(), data);
+    EXPECT_TRUE(a.empty());
+    EXPECT_TRUE(a.is_inline());
+}
+
+// Test swapping inline and heap vectors
+TEST(SmallVectorTest, SwapMixed) {
+    small_vector<int, 2> a{1};
+    small_vector<int, 2> b{1, 2, 3};
+    a.swap(b);
+    EXPECT_EQ(a.size(), 3u);
+    EXPECT_EQ(b.size(), 1u);
+    EXPECT_TRUE(b.is_inline());
+}
+
+// Test insert and erase across the inline boundary
+TEST(SmallVectorTest, InsertErase) {
+    small_vector<int, 4> v{1, 2, 3, 4};
+    v.insert(v.begin(), 0);
+    EXPECT_EQ(v, (small_vector<int, 4>{0, 1, 2, 3, 4}));
+    v.erase(v.begin(), v.begin() + 3);
+    EXPECT_EQ(v, (small_vector<int, 4>{3, 4}));
+    v.shrink_to_fit();
+    EXPECT_TRUE(v.is_inline());
+}
+
+// Test move assignment between unequal, non-propagating allocators moves elements instead of the buffer
+TEST(SmallVectorTest, MoveAssignUnequalAllocators) {
+    small_vector<std::string, 2, IdAllocator<std::string>> a{"a", "b", "c"};
+    small_vector<std::string, 2, IdAllocator<std::string>> b;
+    const std::string *data = a.data();
+    b = std::move(a);
+    EXPECT_NE(b.data(), data);
+    EXPECT_EQ(b.size(), 3u);
+    EXPECT_EQ(b.back(), "c");
+    EXPECT_TRUE(a.empty());
+}
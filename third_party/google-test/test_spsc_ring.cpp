@@ -0,0 +1,74 @@
+// test_spsc_ring.cpp
+#include "spsc_ring.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+using namespace mys;
+
+// Test capacity rounding and full/empty detection
+TEST(SpscRingTest, FullAndEmpty) {
+    spsc_ring<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8u);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(ring.try_push(i));
+    }
+    EXPECT_FALSE(ring.try_push(8));
+
+    int value;
+    EXPECT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(ring.try_push(8));
+}
+
+// Test reserved slots stay invisible until committed
+TEST(SpscRingTest, ReserveCommit) {
+    spsc_ring<std::string> ring(4);
+    auto slots = ring.reserve(2);
+    ASSERT_EQ(slots.size(), 2u);
+    slots[0] = "a";
+    slots[1] = "b";
+    EXPECT_TRUE(ring.peek(4).empty());
+
+    ring.commit(2);
+    auto ready = ring.peek(4);
+    ASSERT_EQ(ready.size(), 2u);
+    EXPECT_EQ(ready[0], "a");
+    EXPECT_EQ(ready[1], "b");
+    ring.release(2);
+    EXPECT_TRUE(ring.empty_approx());
+}
+
+// Test a partial release keeps the rest readable
+TEST(SpscRingTest, PartialRelease) {
+    spsc_ring<int> ring(8);
+    for (int i = 0; i < 6; ++i) {
+        ring.try_push(i);
+    }
+    ring.release(ring.peek(2).size());
+    auto ready = ring.peek(8);
+    ASSERT_EQ(ready.size(), 4u);
+    EXPECT_EQ(ready.front(), 2);
+}
+
+// Test ordered delivery between two threads
+TEST(SpscRingTest, TwoThreads) {
+    constexpr int total = 100000;
+    spsc_ring<int> ring(64);
+    std::thread producer([&] {
+        for (int i = 0; i < total;) {
+            if (ring.try_push(i)) ++i;
+            else std::this_thread::yield();
+        }
+    });
+    int value;
+    for (int expected = 0; expected < total;) {
+        if (ring.try_pop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+// test_thread_pool.cpp
+#include "thread_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace mys;
+
+// 递归求和：拆成两半，一半交给线程池，一半自己做
+static long long range_sum(thread_pool &pool, const std::vector<int> &v, std::size_t lo, std::size_t hi) {
+    if (hi - lo <= 256) {
+        return std::accumulate(v.begin() + static_cast<std::ptrdiff_t>(lo), v.begin() + static_cast<std::ptrdiff_t>(hi), 0LL);
+    }
+    std::size_t mid = lo + (hi - lo) / 2;
+    long long left = 0;
+    thread_pool::task_group group;
+    pool.spawn(group, [&] { left = range_sum(pool, v, lo, mid); });
+    long long right = range_sum(pool, v, mid, hi);
+    pool.wait(group);
+    return left + right;
+}
+
+// Test recursive fork/join gives the sequential result
+TEST(ThreadPoolTest, RecursiveSum) {
+    thread_pool pool(4);
+    std::vector<int> v(100000);
+    std::iota(v.begin(), v.end(), 1);
+    EXPECT_EQ(range_sum(pool, v, 0, v.size()), 5000050000LL);
+}
+
+// Test wait rethrows a task's exception and leaves the group reusable
+TEST(ThreadPoolTest, Exception) {
+    thread_pool pool(2);
+    thread_pool::task_group group;
+    pool.spawn(group, [] { throw std::invalid_argument("bad"); });
+    EXPECT_THROW(pool.wait(group), std::invalid_argument);
+    EXPECT_TRUE(group.done());
+
+    std::atomic<int> ran{0};
+    pool.spawn(group, [&] { ran.fetch_add(1); });
+    pool.wait(group);
+    EXPECT_EQ(ran.load(), 1);
+}
+
+// Test waiting on an empty group returns at once
+TEST(ThreadPoolTest, EmptyGroup) {
+    thread_pool pool(1);
+    thread_pool::task_group group;
+    pool.wait(group);
+    EXPECT_TRUE(group.done());
+    EXPECT_EQ(pool.size(), 1u);
+}
\ No newline at end of file
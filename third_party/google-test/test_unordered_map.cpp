@@ -0,0 +1,100 @@
+// test_unordered_map.cpp
+// Exercise the portable control-group code path; the unit test covers SSE2
+#define MYS_HASH_NO_SSE2
+#include "unordered_map.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace mys;
+
+static_assert(!MYS_HASH_USE_SSE2);
+
+// Test basic insert and lookup
+TEST(UnorderedMapTest, InsertAndFind) {
+    unordered_map<int, int> m;
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(m.emplace(i, -i).second);
+    }
+    EXPECT_EQ(m.size(), 1000);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_NE(m.find(i), m.end());
+        EXPECT_EQ(m.find(i)->second, -i);
+    }
+    EXPECT_EQ(m.find(1000), m.end());
+}
+
+// Test erase leaves other keys reachable
+TEST(UnorderedMapTest, EraseKeepsProbeChains) {
+    unordered_map<int, int> m;
+    for (int i = 0; i < 2000; ++i) {
+        m[i] = i;
+    }
+    for (int i = 0; i < 2000; i += 3) {
+        EXPECT_EQ(m.erase(i), 1);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        EXPECT_EQ(m.contains(i), i % 3 != 0);
+    }
+}
+
+// Test erase through iterators visits every remaining element once
+TEST(UnorderedMapTest, IteratorErase) {
+    unordered_map<int, int> m;
+    for (int i = 0; i < 100; ++i) {
+        m[i] = i;
+    }
+    for (auto it = m.begin(); it != m.end();) {
+        if (it->first % 2 == 0) it = m.erase(it);
+        else ++it;
+    }
+    EXPECT_EQ(m.size(), 50);
+    for (const auto &[key, value] : m) {
+        EXPECT_EQ(key % 2, 1);
+    }
+}
+
+struct StringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+};
+
+// Test heterogeneous lookup with string_view
+TEST(UnorderedMapTest, HeterogeneousLookup) {
+    unordered_map<std::string, int, StringHash, std::equal_to<>> m{{"alpha", 1}, {"beta", 2}};
+    EXPECT_EQ(m.find(std::string_view("beta"))->second, 2);
+    EXPECT_TRUE(m.contains("alpha"));
+    EXPECT_EQ(m.erase(std::string_view("alpha")), 1);
+    EXPECT_FALSE(m.contains("alpha"));
+}
+
+// Hash that throws once its call budget runs out; a negative budget never throws
+struct FlakyHash {
+    static inline int budget = -1;
+    size_t operator()(int key) const {
+        if (budget == 0) throw std::runtime_error("hash budget exhausted");
+        if (budget > 0) --budget;
+        return std::hash<int>{}(key);
+    }
+};
+
+// Test that a hash throwing mid-rehash leaves the old table intact
+TEST(UnorderedMapTest, RehashSurvivesThrowingHash) {
+    unordered_map<int, int, FlakyHash> m;
+    for (int i = 0; i < 100; ++i) {
+        m.emplace(i, -i);
+    }
+    std::size_t buckets = m.bucket_count();
+    FlakyHash::budget = 50;
+    EXPECT_THROW(m.rehash(buckets * 4), std::runtime_error);
+    FlakyHash::budget = -1;
+    EXPECT_EQ(m.size(), 100);
+    EXPECT_EQ(m.bucket_count(), buckets);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(m.at(i), -i);
+    }
+    m.rehash(buckets * 4);
+    EXPECT_EQ(m.bucket_count(), buckets * 4);
+    EXPECT_EQ(m.at(99), -99);
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+// test_unrolled_list.cpp
+#include "unrolled_list.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace mys;
+
+// Test fixture with a small node capacity so splits and merges happen early
+class UnrolledListTest : public ::testing::Test {
+protected:
+    unrolled_list<int, 4> l;
+};
+
+// Test default constructor
+TEST_F(UnrolledListTest, DefaultConstructor) {
+    EXPECT_TRUE(l.empty());
+    EXPECT_EQ(l.size(), 0);
+    EXPECT_EQ(l.begin(), l.end());
+}
+
+// Test initializer list constructor spanning several nodes
+TEST_F(UnrolledListTest, InitializerListConstructor) {
+    unrolled_list<int, 4> ul{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(ul.size(), 9);
+    EXPECT_EQ(ul.front(), 1);
+    EXPECT_EQ(ul.back(), 9);
+}
+
+// Test copy and move
+TEST_F(UnrolledListTest, CopyAndMove) {
+    unrolled_list<std::string, 4> original{"a", "b", "c", "d", "e"};
+    unrolled_list<std::string, 4> copy(original);
+    EXPECT_EQ(copy, original);
+
+    unrolled_list<std::string, 4> moved(std::move(copy));
+    EXPECT_EQ(moved, original);
+    EXPECT_TRUE(copy.empty());
+}
+
+// Test push/pop at both ends
+TEST_F(UnrolledListTest, PushPop) {
+    for (int i = 0; i < 10; ++i) {
+        l.push_back(i);
+        l.push_front(-i);
+    }
+    EXPECT_EQ(l.size(), 20);
+    EXPECT_EQ(l.front(), -9);
+    EXPECT_EQ(l.back(), 9);
+
+    l.pop_front();
+    l.pop_back();
+    EXPECT_EQ(l.front(), -8);
+    EXPECT_EQ(l.back(), 8);
+}
+
+// Test insertion in the middle of full nodes
+TEST_F(UnrolledListTest, InsertMiddle) {
+    for (int i = 0; i < 8; ++i) {
+        l.push_back(i * 10);
+    }
+    auto it = l.insert(std::next(l.begin(), 2), 15);
+    EXPECT_EQ(*it, 15);
+    it = l.emplace(std::next(l.begin(), 6), 45);
+    EXPECT_EQ(*it, 45);
+
+    std::vector<int> actual(l.begin(), l.end());
+    EXPECT_EQ(actual, (std::vector<int>{0, 10, 15, 20, 30, 40, 45, 50, 60, 70}));
+}
+
+// Test erase with node merging
+TEST_F(UnrolledListTest, EraseMerges) {
+    for (int i = 0; i < 12; ++i) {
+        l.push_back(i);
+    }
+    auto it = l.erase(std::next(l.begin(), 1));
+    EXPECT_EQ(*it, 2);
+    it = l.erase(std::next(l.begin(), 4), std::next(l.begin(), 8));
+    EXPECT_EQ(*it, 9);
+
+    std::vector<int> actual(l.begin(), l.end());
+    EXPECT_EQ(actual, (std::vector<int>{0, 2, 3, 4, 9, 10, 11}));
+    std::vector<int> reversed(l.rbegin(), l.rend());
+    EXPECT_EQ(reversed, (std::vector<int>{11, 10, 9, 4, 3, 2, 0}));
+}
+
+// Test comparison operators
+TEST_F(UnrolledListTest, ComparisonOperators) {
+    unrolled_list<int> l1{1, 2, 3};
+    unrolled_list<int> l2{1, 2, 3};
+    unrolled_list<int> l3{1, 2, 4};
+
+    EXPECT_TRUE(l1 == l2);
+    EXPECT_TRUE(l1 < l3);
+    EXPECT_TRUE(l3 > l2);
+}
+
+// Test move-only types
+TEST_F(UnrolledListTest, MoveOnlyTypes) {
+    unrolled_list<std::unique_ptr<int>, 4> ul;
+    for (int i = 0; i < 6; ++i) {
+        ul.push_back(std::make_unique<int>(i));
+    }
+    ul.insert(std::next(ul.begin(), 3), std::make_unique<int>(100));
+    EXPECT_EQ(*ul.front(), 0);
+    EXPECT_EQ(**std::next(ul.begin(), 3), 100);
+}
+
+// Main function
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+// test_vector.cpp
+#include "vector.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace mys;
+
+// Stateful allocator that stays put on move assignment; copies share an id, fresh instances differ
+template <typename T>
+struct IdAllocator {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    static inline int next_id = 0;
+    int id = next_id++;
+
+    IdAllocator() = default;
+    template <typename U>
+    IdAllocator(const IdAllocator<U> &other) noexcept : id(other.id) {}
+
+    T *allocate(std::size_t n) { return std::allocator<T>().allocate(n); }
+    void deallocate(T *p, std::size_t n) noexcept { std::allocator<T>().deallocate(p, n); }
+
+    friend bool operator==(const IdAllocator &lhs, const IdAllocator &rhs) { return lhs.id == rhs.id; }
+};
+
+// Test fixture for vector tests
+class VectorTest : public ::testing::Test {
+protected:
+    vector<int> v;
+
+    void SetUp() override {
+        for (int i = 0; i < 5; ++i) {
+            v.push_back(i);
+        }
+    }
+};
+
+// Test push_back grows capacity geometrically and keeps values
+TEST_F(VectorTest, PushBackAndAccess) {
+    EXPECT_EQ(v.size(), 5u);
+    EXPECT_GE(v.capacity(), 5u);
+    EXPECT_EQ(v.front(), 0);
+    EXPECT_EQ(v.back(), 4);
+    EXPECT_EQ(v[2], 2);
+    EXPECT_THROW((void)v.at(5), std::out_of_range);
+}
+
+// Test emplace_back returns a reference to the new element
+TEST_F(VectorTest, EmplaceBackReturnsReference) {
+    int &ref = v.emplace_back(42);
+    EXPECT_EQ(&ref, &v.back());
+    EXPECT_EQ(ref, 42);
+}
+
+// Test insert and erase in the middle
+TEST_F(VectorTest, InsertEraseMiddle) {
+    auto it = v.insert(v.begin() + 2, 100);
+    EXPECT_EQ(*it, 100);
+    EXPECT_EQ(v, (vector<int>{0, 1, 100, 2, 3, 4}));
+
+    it = v.erase(v.begin() + 2);
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(v, (vector<int>{0, 1, 2, 3, 4}));
+
+    v.insert(v.end(), 3, 7);
+    EXPECT_EQ(v.size(), 8u);
+    EXPECT_EQ(v.back(), 7);
+}
+
+// Test reserve and shrink_to_fit
+TEST_F(VectorTest, ReserveAndShrink) {
+    v.reserve(100);
+    EXPECT_GE(v.capacity(), 100u);
+    EXPECT_EQ(v.size(), 5u);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 5u);
+}
+
+// Test copy, move and comparison
+TEST_F(VectorTest, CopyMoveCompare) {
+    vector<int> copy(v);
+    EXPECT_EQ(copy, v);
+
+    vector<int> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved, v);
+
+    moved.back() = 10;
+    EXPECT_LT(v, moved);
+}
+
+// Test non-trivially relocatable elements survive reallocation
+TEST(VectorNonTrivialTest, StringGrowth) {
+    vector<std::string> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(std::to_string(i));
+    }
+    v.insert(v.begin(), "front");
+    EXPECT_EQ(v.front(), "front");
+    EXPECT_EQ(v[1], "0");
+    EXPECT_EQ(v.back(), "999");
+}
+
+// Test move-only elements
+TEST(VectorNonTrivialTest, MoveOnly) {
+    vector<std::unique_ptr<int>> v;
+    for (int i = 0; i < 10; ++i) {
+        v.push_back(std::make_unique<int>(i));
+    }
+    v.erase(v.begin());
+    EXPECT_EQ(*v.front(), 1);
+    EXPECT_EQ(v.size(), 9u);
+}
+
+// Test move assignment between unequal, non-propagating allocators moves elements instead of the buffer
+TEST(VectorNonTrivialTest, MoveAssignUnequalAllocators) {
+    vector<std::string, IdAllocator<std::string>> a{"a", "b", "c"};
+    vector<std::string, IdAllocator<std::string>> b;
+    const std::string *data = a.data();
+    b = std::move(a);
+    EXPECT_NE(b.data(), data);
+    EXPECT_EQ(b.size(), 3u);
+    EXPECT_EQ(b.back(), "c");
+    EXPECT_TRUE(a.empty());
+}
@@ -0,0 +1,58 @@
+// test_ws_deque.cpp
+#include "ws_deque.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace mys;
+
+// Test the owner end is LIFO and the thief end FIFO
+TEST(WsDequeTest, OwnerAndThiefEnds) {
+    ws_deque<int> d(4);
+    for (int i = 0; i < 3; ++i) {
+        d.push(i);
+    }
+    int value;
+    ASSERT_TRUE(d.try_pop(value));
+    EXPECT_EQ(value, 2);
+    ASSERT_TRUE(d.try_steal(value));
+    EXPECT_EQ(value, 0);
+    ASSERT_TRUE(d.try_pop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_FALSE(d.try_pop(value));
+    EXPECT_FALSE(d.try_steal(value));
+}
+
+// Test pushing past the capacity grows the ring and keeps the order
+TEST(WsDequeTest, Grow) {
+    ws_deque<int> d(2);
+    EXPECT_EQ(d.capacity(), 2u);
+    for (int i = 0; i < 37; ++i) {
+        d.push(i);
+    }
+    EXPECT_EQ(d.capacity(), 64u);
+    EXPECT_EQ(d.size_approx(), 37u);
+    int value;
+    for (int i = 0; i < 37; ++i) {
+        ASSERT_TRUE(d.try_steal(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+// Test the last element goes to exactly one of the owner and a thief
+TEST(WsDequeTest, RaceForLastElement) {
+    for (int round = 0; round < 2000; ++round) {
+        ws_deque<int> d(2);
+        d.push(round);
+        std::atomic<int> winners{0};
+        std::thread thief([&] {
+            int value;
+            if (d.try_steal(value)) winners.fetch_add(1);
+        });
+        int value;
+        if (d.try_pop(value)) winners.fetch_add(1);
+        thief.join();
+        EXPECT_EQ(winners.load(), 1);
+    }
+}
\ No newline at end of file
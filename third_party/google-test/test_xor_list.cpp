@@ -0,0 +1,57 @@
+// test_xor_list.cpp
+#include "xor_list.h"
+#include <gtest/gtest.h>
+#include <iterator>
+#include <vector>
+
+using namespace mys;
+
+// Test traversal from both ends
+TEST(XorListTest, BidirectionalTraversal) {
+    xor_list<int> l = {1, 2, 3, 4};
+    EXPECT_EQ(std::vector<int>(l.begin(), l.end()), (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(std::vector<int>(l.rbegin(), l.rend()), (std::vector<int>{4, 3, 2, 1}));
+    EXPECT_EQ(*std::prev(l.end()), 4);
+    EXPECT_EQ(l.front(), 1);
+    EXPECT_EQ(l.back(), 4);
+}
+
+// Test push and pop at both ends
+TEST(XorListTest, PushPopBothEnds) {
+    xor_list<int> l;
+    l.push_back(2);
+    l.push_front(1);
+    l.push_back(3);
+    l.pop_front();
+    EXPECT_EQ(l.front(), 2);
+    l.pop_back();
+    EXPECT_EQ(l.back(), 2);
+    l.pop_back();
+    EXPECT_TRUE(l.empty());
+    EXPECT_THROW(l.front(), std::out_of_range);
+}
+
+// Test insert and erase through iterators keep both directions consistent
+TEST(XorListTest, InsertErase) {
+    xor_list<int> l = {1, 3, 5};
+    auto it = l.insert(std::next(l.begin()), 2);
+    EXPECT_EQ(*std::prev(it), 1);
+    it = l.erase(std::next(it));
+    EXPECT_EQ(*it, 5);
+    EXPECT_EQ(*std::prev(it), 2);
+    EXPECT_EQ(std::vector<int>(l.rbegin(), l.rend()), (std::vector<int>{5, 2, 1}));
+}
+
+// Test reverse is a swap of the ends
+TEST(XorListTest, Reverse) {
+    xor_list<int> l = {1, 2, 3};
+    l.reverse();
+    EXPECT_EQ(std::vector<int>(l.begin(), l.end()), (std::vector<int>{3, 2, 1}));
+    l.push_back(0);
+    EXPECT_EQ(std::vector<int>(l.rbegin(), l.rend()), (std::vector<int>{0, 1, 2, 3}));
+}
+
+// Test the node carries one link word
+TEST(XorListTest, NodeSize) {
+    EXPECT_EQ(xor_list<int>::node_size(), 2 * sizeof(void *));
+}
\ No newline at end of file